@@ -7,10 +7,44 @@ in vec2 texCoord;
 uniform vec2 quadSize;
 uniform float distance;
 uniform sampler2D heightTexture;
+uniform vec4 heightTextureRegion = vec4(0.0, 0.0, 1.0, 1.0);
+
+// reconstructed height computed once per node frame (not for tiled domains).
+uniform bool derivedHeights = false;
+uniform sampler2D derivedTexture;
+// comparison mode: left of this domain x coordinate the result is sampled bilinearly (negative: no comparison).
+uniform float comparisonSplit = -1.0;
 
 layout(location = 0) out vec4 color;
 
+// tiled virtual domain: heightTexture is the result atlas, tiles are found through the indirection table.
+uniform bool tiledDomain = false;
+uniform isampler2D tileIndirection;
+uniform int tileSize = 128;
+uniform ivec2 tiledDomainSize;
+
+float fetchTiledHeight(ivec2 cell) {
+    cell = clamp(cell, ivec2(0), tiledDomainSize - 1);
+    const ivec2 tile = cell / tileSize;
+    const int slot = texelFetch(tileIndirection, tile, 0).r;
+    if (slot < 0) return 0.0; // non resident tiles are at rest
+    const int slotsX = textureSize(heightTexture, 0).x / tileSize;
+    return texelFetch(heightTexture, ivec2(slot % slotsX, slot / slotsX) * tileSize + cell - tile * tileSize, 0).r;
+}
+
+float sampleHeight(vec2 domainCoords) {
+    if (derivedHeights && domainCoords.x >= comparisonSplit) return textureLod(derivedTexture, (domainCoords - heightTextureRegion.xy) / heightTextureRegion.zw, 0.0).r;
+    if (!tiledDomain) return texture(heightTexture, (domainCoords - heightTextureRegion.xy) / heightTextureRegion.zw).r;
+
+    const vec2 p = domainCoords * vec2(tiledDomainSize) - 0.5;
+    const ivec2 c = ivec2(floor(p));
+    const vec2 f = p - vec2(c);
+    return mix(mix(fetchTiledHeight(c), fetchTiledHeight(c + ivec2(1, 0)), f.x),
+        mix(fetchTiledHeight(c + ivec2(0, 1)), fetchTiledHeight(c + ivec2(1, 1)), f.x), f.y);
+}
+
 void main()
 {
-    color = vec4(texture(heightTexture, texCoord).rrr, 1.0);
+    color = vec4(vec3(sampleHeight(texCoord)), 1.0);
+    if (comparisonSplit >= 0.0 && abs(texCoord.x - comparisonSplit) < fwidth(texCoord.x)) color = vec4(1.0, 0.0, 0.0, 1.0);
 }
@@ -13,10 +13,45 @@ uniform vec3 sigma_a;
 uniform sampler2D environment;
 uniform sampler2D backgroundTexture;
 uniform sampler2D heightTexture;
+// region of the domain covered by the height texture (xy: offset, zw: size)
+uniform vec4 heightTextureRegion = vec4(0.0, 0.0, 1.0, 1.0);
 layout(rg32f) uniform image2D backPositionTexture;
+// reconstructed height and gradient computed once per node frame (not for tiled domains).
+uniform bool derivedNormals = false;
+uniform bool derivedHeights = false;
+uniform sampler2D derivedTexture;
+// comparison mode: left of this domain x coordinate the result is sampled bilinearly (negative: no comparison).
+uniform float comparisonSplit = -1.0;
+bool useReconstruction = true;
 
 layout(location = 0) out vec4 color;
 
+// tiled virtual domain: heightTexture is the result atlas, tiles are found through the indirection table.
+uniform bool tiledDomain = false;
+uniform isampler2D tileIndirection;
+uniform int tileSize = 128;
+uniform ivec2 tiledDomainSize;
+
+float fetchTiledHeight(ivec2 cell) {
+    cell = clamp(cell, ivec2(0), tiledDomainSize - 1);
+    const ivec2 tile = cell / tileSize;
+    const int slot = texelFetch(tileIndirection, tile, 0).r;
+    if (slot < 0) return 0.0; // non resident tiles are at rest
+    const int slotsX = textureSize(heightTexture, 0).x / tileSize;
+    return texelFetch(heightTexture, ivec2(slot % slotsX, slot / slotsX) * tileSize + cell - tile * tileSize, 0).r;
+}
+
+float sampleHeight(vec2 domainCoords) {
+    if (derivedHeights && useReconstruction) return textureLod(derivedTexture, (domainCoords - heightTextureRegion.xy) / heightTextureRegion.zw, 0.0).r;
+    if (!tiledDomain) return texture(heightTexture, (domainCoords - heightTextureRegion.xy) / heightTextureRegion.zw).r;
+
+    const vec2 p = domainCoords * vec2(tiledDomainSize) - 0.5;
+    const ivec2 c = ivec2(floor(p));
+    const vec2 f = p - vec2(c);
+    return mix(mix(fetchTiledHeight(c), fetchTiledHeight(c + ivec2(1, 0)), f.x),
+        mix(fetchTiledHeight(c + ivec2(0, 1)), fetchTiledHeight(c + ivec2(1, 1)), f.x), f.y);
+}
+
 vec3 worldToTex(vec3 x) {
     vec3 offset = vec3(quadSize, distance + 1.0f);
     vec3 scale = 1.0 / vec3(2.0 * quadSize, 1.0f);
@@ -37,7 +72,7 @@ float heightFieldSphere(vec2 texCoords, vec2 c, float r) {
 }
 
 float heightField(vec2 texCoords) {
-    return simulationHeight * texture(heightTexture, texCoords).r;
+    return simulationHeight * sampleHeight(texCoords);
     //return (4.0 * heightFieldSphere(texCoords, vec2(0.5), 0.25))
     //    + (5.0 * heightFieldSphere(texCoords, vec2(0.12, 0.12), 0.09))
     //    + (5.0 * heightFieldSphere(texCoords, vec2(0.12, 0.88), 0.09))
@@ -45,8 +80,13 @@ float heightField(vec2 texCoords) {
     //    + (5.0 * heightFieldSphere(texCoords, vec2(0.88, 0.88), 0.09));
 }
 
-vec3 heightfieldNormal(vec3 p) {
-    const vec2 delta = 1.0f / vec2(textureSize(heightTexture, 0));
+vec3 heightfieldNormal(vec3 p, float lod) {
+    if (derivedNormals && useReconstruction) {
+        const vec2 gradient = textureLod(derivedTexture, (p.xy - heightTextureRegion.xy) / heightTextureRegion.zw, lod).gb / heightTextureRegion.zw;
+        return normalize(vec3(-simulationHeight * gradient, 1.0));
+    }
+
+    const vec2 delta = tiledDomain ? 1.0 / vec2(tiledDomainSize) : heightTextureRegion.zw / vec2(textureSize(heightTexture, 0));
     const vec2 deltaX = vec2(delta.x, 0.0);
     const vec2 deltaY = vec2(0.0, delta.y);
 
@@ -76,6 +116,11 @@ void main()
     // vec3 lightPos = worldToTex(vec3(5, 2, -3));
     vec3 lightPos = worldToTex(vec3(0.0, 0.0, -10.0));
     vec3 camPos = worldToTex(cameraPosition);
+    // level of the derived texture matching the pixel footprint (derivatives are only defined before the discard).
+    const vec2 footprint = max(abs(dFdx(texCoord)), abs(dFdy(texCoord))) * vec2(textureSize(derivedTexture, 0)) / heightTextureRegion.zw;
+    const float lod = max(log2(max(max(footprint.x, footprint.y), 1e-6)), 0.0);
+    const float splitWidth = fwidth(texCoord.x);
+    useReconstruction = texCoord.x >= comparisonSplit;
 
     vec3 t1 = vec3(texCoord, 1.0f);
     vec3 t0  = vec3(imageLoad(backPositionTexture, ivec2(gl_FragCoord.xy)).xy, 0.0f);
@@ -88,7 +133,7 @@ void main()
         t = t0 + (h * t1m0);
     }
 
-    vec3 normal = heightfieldNormal(t);
+    vec3 normal = heightfieldNormal(t, lod);
 
     vec3 v = normalize(t - camPos);
     vec3 rr = normalize(reflect(v, normal));
@@ -105,6 +150,7 @@ void main()
     vec3 T = (1.0 - R) * exp(-sigma_a * bgHitLen);
 
     color = vec4(sqrt(R * cReflection + T * cRefraction), 1.0);
+    if (comparisonSplit >= 0.0 && abs(texCoord.x - comparisonSplit) < splitWidth) color = vec4(1.0);
     
     // color = vec4(t0.xy, 0.0, 1.0);
     // vec3 l = lightPos;// vec3(0.5, 0.5, 5.0);
@@ -12,17 +12,24 @@ uniform sampler2D texture_0;
 
 //uniform vec2 inv_tex_dim;
 
-uniform float diffusion_rate_A = 1.0;
-uniform float diffusion_rate_B = 0.5;
-uniform float feed_rate = 0.055;
-uniform float kill_rate = 0.062;
-uniform float dt = 1.0;
+// constant within a frame, uploaded once for all iterations (SimulationUniforms in ApplicationNodeImplementation.cpp).
+layout(std140, binding = 0) uniform SimulationParameters
+{
+    float diffusion_rate_A;
+    float diffusion_rate_B;
+    float feed_rate;
+    float kill_rate;
+    float dt;
+    float seed_point_radius;
+    bool use_manhattan_distance;
+    // placement of this texture in the global domain (distributed mode), seed points are global.
+    vec2 domain_offset;
+    vec2 domain_scale;
+};
 
-uniform float seed_point_radius = 0.001;
 uniform uint num_seed_points = 0;
 const uint max_seed_points = 10;
 uniform vec2 seed_points[max_seed_points];
-uniform bool use_manhattan_distance = false;
 
 vec2 laplaceAB() // vec2 laplaceAB(vec2 inv_tex_dim)
 {
@@ -59,14 +66,15 @@ vec2 laplaceAB() // vec2 laplaceAB(vec2 inv_tex_dim)
 
 void main()
 {
-    const vec2 tex_dim = textureSize(texture_0, 0).xy;
+    const vec2 tex_dim = textureSize(texture_0, 0).xy / domain_scale;
+    const vec2 global_tex_coord = domain_offset + texCoord * domain_scale;
     //const vec2 inv_tex_dim = 1.0 / tex_dim;
     const vec2 AB = texture(texture_0, texCoord).rg;
     const float A = AB.r;
     float B = AB.g; // TODO: add const here when brush shader is available
 
     for (int i = 0; i < num_seed_points; ++i) {
-        vec2 seed_point = abs(texCoord - seed_points[i]);
+        vec2 seed_point = abs(global_tex_coord - seed_points[i]);
         seed_point.x *= tex_dim.x / tex_dim.y; // fix aspect ratio
         if (use_manhattan_distance) {
             const float d = seed_point.x + seed_point.y;
@@ -0,0 +1,117 @@
+#version 430 core
+
+// output attributes
+layout(location = 0) out vec4 AB_next;
+layout(location = 1) out vec4 result;
+
+// uniforms
+uniform sampler2D texture_0; // A/B atlas
+uniform isampler2D tile_indirection; // tile -> slot (-1 = not resident)
+uniform isampler2D slot_tiles; // slot -> tile (-1 = free)
+uniform int tile_size = 128;
+uniform ivec2 tiles;
+uniform ivec2 domain_size;
+
+uniform float diffusion_rate_A = 1.0;
+uniform float diffusion_rate_B = 0.5;
+uniform float feed_rate = 0.055;
+uniform float kill_rate = 0.062;
+uniform float dt = 1.0;
+
+uniform float seed_point_radius = 0.001;
+uniform uint num_seed_points = 0;
+const uint max_seed_points = 10;
+uniform vec2 seed_points[max_seed_points];
+uniform bool use_manhattan_distance = false;
+
+int slots_x;
+
+// fetches A/B of a global cell, non resident tiles are at rest (A = 1, B = 0).
+vec2 fetchAB(ivec2 cell)
+{
+    cell = clamp(cell, ivec2(0), domain_size - 1);
+    const ivec2 tile = cell / tile_size;
+    const int slot = texelFetch(tile_indirection, tile, 0).r;
+    if (slot < 0) return vec2(1.0, 0.0);
+    const ivec2 slot_origin = ivec2(slot % slots_x, slot / slots_x) * tile_size;
+    return texelFetch(texture_0, slot_origin + cell - tile * tile_size, 0).rg;
+}
+
+vec2 laplaceAB(ivec2 atlas_texel, ivec2 local, ivec2 cell)
+{
+    // 0.0500    0.2000    0.0500
+    // 0.2000   -1.0000    0.2000
+    // 0.0500    0.2000    0.0500
+
+    // fast path: the whole stencil is inside this slot and the domain.
+    if (all(greaterThan(local, ivec2(0))) && all(lessThan(local, ivec2(tile_size - 1))) && all(lessThan(cell, domain_size - 1))) {
+        return 0.05 * texelFetchOffset(texture_0, atlas_texel, 0, ivec2(-1,  1)).rg // upper line
+             + 0.20 * texelFetchOffset(texture_0, atlas_texel, 0, ivec2( 0,  1)).rg
+             + 0.05 * texelFetchOffset(texture_0, atlas_texel, 0, ivec2( 1,  1)).rg
+             + 0.20 * texelFetchOffset(texture_0, atlas_texel, 0, ivec2(-1,  0)).rg // middle line
+             -        texelFetch(texture_0, atlas_texel, 0).rg
+             + 0.20 * texelFetchOffset(texture_0, atlas_texel, 0, ivec2( 1,  0)).rg
+             + 0.05 * texelFetchOffset(texture_0, atlas_texel, 0, ivec2(-1, -1)).rg // lower line
+             + 0.20 * texelFetchOffset(texture_0, atlas_texel, 0, ivec2( 0, -1)).rg
+             + 0.05 * texelFetchOffset(texture_0, atlas_texel, 0, ivec2( 1, -1)).rg;
+    }
+
+    return 0.05 * fetchAB(cell + ivec2(-1,  1)) // upper line
+         + 0.20 * fetchAB(cell + ivec2( 0,  1))
+         + 0.05 * fetchAB(cell + ivec2( 1,  1))
+         + 0.20 * fetchAB(cell + ivec2(-1,  0)) // middle line
+         -        fetchAB(cell)
+         + 0.20 * fetchAB(cell + ivec2( 1,  0))
+         + 0.05 * fetchAB(cell + ivec2(-1, -1)) // lower line
+         + 0.20 * fetchAB(cell + ivec2( 0, -1))
+         + 0.05 * fetchAB(cell + ivec2( 1, -1));
+}
+
+void main()
+{
+    slots_x = textureSize(slot_tiles, 0).x;
+    const ivec2 atlas_texel = ivec2(gl_FragCoord.xy);
+    const ivec2 slot = atlas_texel / tile_size;
+    const int tile_index = texelFetch(slot_tiles, slot, 0).r;
+    if (tile_index < 0) discard;
+
+    const ivec2 tile = ivec2(tile_index % tiles.x, tile_index / tiles.x);
+    const ivec2 local = atlas_texel - slot * tile_size;
+    const ivec2 cell = tile * tile_size + local;
+    if (any(greaterThanEqual(cell, domain_size))) discard;
+
+    const vec2 tex_dim = vec2(domain_size);
+    const vec2 global_tex_coord = (vec2(cell) + 0.5) / tex_dim;
+    const vec2 AB = texelFetch(texture_0, atlas_texel, 0).rg;
+    const float A = AB.r;
+    float B = AB.g;
+
+    for (int i = 0; i < num_seed_points; ++i) {
+        vec2 seed_point = abs(global_tex_coord - seed_points[i]);
+        seed_point.x *= tex_dim.x / tex_dim.y; // fix aspect ratio
+        if (use_manhattan_distance) {
+            const float d = seed_point.x + seed_point.y;
+            if (d < seed_point_radius) {
+                B = 1.0;
+            }
+        } else {
+            const float d = dot(seed_point, seed_point);
+            const float r = seed_point_radius * seed_point_radius;
+            if (d < r) {
+                B = 1.0;
+            }
+        }
+    }
+
+    const vec2 laplace_AB = laplaceAB(atlas_texel, local, cell);
+    const float laplace_A = laplace_AB.r;
+    const float laplace_B = laplace_AB.g;
+
+    const float ABB = A * B * B;
+    const float A_next = A + (diffusion_rate_A * laplace_A - ABB + feed_rate * (1 - A)) * dt;
+    const float B_next = B + (diffusion_rate_B * laplace_B + ABB - (kill_rate + feed_rate) * B) * dt;
+
+    const float result_value = 1.0 - clamp(A_next - B_next, 0.0, 1.0);
+    result = vec4(result_value, result_value, result_value, 1.0);
+    AB_next = vec4(clamp(A_next, 0.0, 1.0), clamp(B_next, 0.0, 1.0), 1.0, 1.0);
+}
@@ -0,0 +1,84 @@
+/**
+ * @file   AppSettings.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the per node application settings.
+ */
+
+#include "AppSettings.h"
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace viscom {
+
+    void AppSettings::Load(const std::string& settingsFile)
+    {
+        std::ifstream ifs(settingsFile);
+        std::string str;
+
+        while (ifs >> str && ifs.good()) {
+            if (str == "simulationBackend=") ifs >> simulationBackend_;
+            else if (str == "cpuSimulationPipelined=") ifs >> cpuSimulationPipelined_;
+            else if (str == "batchedSimulationSubmission=") ifs >> batchedSimulationSubmission_;
+            else if (str == "fixedPointSimulation=") ifs >> fixedPointSimulation_;
+            else if (str == "inPlaceSimulation=") ifs >> inPlaceSimulation_;
+            else if (str == "simulationRate=") ifs >> simulationRate_;
+            else if (str == "simulationBudget=") ifs >> simulationBudget_;
+            else if (str == "divergenceCheckInterval=") ifs >> divergenceCheckInterval_;
+            else if (str == "divergenceMasterAddress=") ifs >> divergenceMasterAddress_;
+            else if (str == "divergenceReportPort=") ifs >> divergenceReportPort_;
+            else if (str == "divergenceAutoResync=") ifs >> divergenceAutoResync_;
+            else if (str == "idleWhenConverged=") ifs >> idleWhenConverged_;
+            else if (str == "idleChangeThreshold=") ifs >> idleChangeThreshold_;
+            else if (str == "idleSteadyChecks=") ifs >> idleSteadyChecks_;
+            else if (str == "allocationCheck=") ifs >> allocationCheck_;
+            else if (str == "gpuTimingReport=") ifs >> gpuTimingReport_;
+            else if (str == "gpuMemoryBudget=") ifs >> gpuMemoryBudget_;
+            else if (str == "hostMemoryBudget=") ifs >> hostMemoryBudget_;
+            else if (str == "traceFile=") ifs >> traceFile_;
+            else if (str == "traceZonesPerThread=") ifs >> traceZonesPerThread_;
+            else if (str == "cpuRaycasterThreads=") ifs >> cpuRaycasterThreads_;
+            else if (str == "autotune=") ifs >> autotune_;
+            else if (str == "autotuneSeconds=") ifs >> autotuneSeconds_;
+            else if (str == "tuningProfileDirectory=") ifs >> tuningProfileDirectory_;
+            else if (str == "textureLoaderThreads=") ifs >> textureLoaderThreads_;
+            else if (str == "textureCacheDirectory=") ifs >> textureCacheDirectory_;
+            else if (str == "sessionRecordFile=") ifs >> sessionRecordFile_;
+            else if (str == "sessionReplayFile=") ifs >> sessionReplayFile_;
+            else if (str == "sessionReplayRealTime=") ifs >> sessionReplayRealTime_;
+            else if (str == "exportSharedMemory=") ifs >> exportSharedMemory_;
+            else if (str == "exportSharedMemoryName=") ifs >> exportSharedMemoryName_;
+            else if (str == "exportFrameInterval=") ifs >> exportFrameInterval_;
+            else if (str == "exportRingSlots=") ifs >> exportRingSlots_;
+            else if (str == "monitorStreamPort=") ifs >> monitorStreamPort_;
+            else if (str == "monitorStreamRate=") ifs >> monitorStreamRate_;
+            else if (str == "metricsPort=") ifs >> metricsPort_;
+            else if (str == "metricsAddress=") ifs >> metricsAddress_;
+            else if (str == "metricsAggregateSlaves=") ifs >> metricsAggregateSlaves_;
+            else if (str == "distributedMode=") ifs >> distributedMode_;
+            else if (str == "distributedTilesX=") ifs >> distributedTilesX_;
+            else if (str == "distributedTilesY=") ifs >> distributedTilesY_;
+            else if (str == "distributedNodeIndex=") ifs >> distributedNodeIndex_;
+            else if (str == "distributedExchangeInterval=") ifs >> distributedExchangeInterval_;
+            else if (str == "distributedBasePort=") ifs >> distributedBasePort_;
+            else if (str == "tiledMode=") ifs >> tiledMode_;
+            else if (str == "tiledDomainWidth=") ifs >> tiledDomainWidth_;
+            else if (str == "tiledDomainHeight=") ifs >> tiledDomainHeight_;
+            else if (str == "tiledTileSize=") ifs >> tiledTileSize_;
+            else if (str == "tiledResidentTiles=") ifs >> tiledResidentTiles_;
+            else if (str == "tiledPageDirectory=") ifs >> tiledPageDirectory_;
+            else if (str == "distributedNodeAddresses=") {
+                std::string addresses;
+                ifs >> addresses;
+                std::istringstream addressStream(addresses);
+                distributedNodeAddresses_.clear();
+                for (std::string address; std::getline(addressStream, address, ',');) distributedNodeAddresses_.push_back(address);
+            }
+        }
+
+        auto overrideFile = std::getenv("VISCOM_RD_SETTINGS");
+        if (overrideFile != nullptr && settingsFile != overrideFile) Load(overrideFile);
+    }
+}
@@ -0,0 +1,141 @@
+/**
+ * @file   AppSettings.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the per node application settings.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace viscom {
+
+    /**
+     *  Node local settings that are not synchronized by the master.
+     *  They are read from "appSettings.txt" in the resource directory, the format is the same as for presets.
+     *  If the environment variable VISCOM_RD_SETTINGS names another file, its values override the defaults (e.g. the
+     *  node index when several nodes share one installation).
+     */
+    struct AppSettings {
+        /** Simulation backend, "gpu" (fragment shader) or "cpu". */
+        std::string simulationBackend_ = "gpu";
+        /** Run the CPU backend on a worker thread one frame ahead of rendering. */
+        bool cpuSimulationPipelined_ = true;
+        /** Submit the GPU iterations of a frame with prebuilt frame buffers and one parameter upload (0 sets up every iteration, for comparison). */
+        bool batchedSimulationSubmission_ = true;
+        /** Simulate in fixed point (both backends), the state is bit identical on all nodes whatever GPU or driver they use. */
+        bool fixedPointSimulation_ = false;
+        /** Update a single A/B state in four colour order instead of ping-ponging (both backends, halves the state memory, changes the result slightly). */
+        bool inPlaceSimulation_ = false;
+
+        /** Global simulation rate in iterations per second (master), 0 advances a fixed number of iterations per frame. */
+        float simulationRate_ = 0.0f;
+        /** Fraction of the GPU (or CPU) time the simulation may use, the nodes report the rate this sustains. */
+        float simulationBudget_ = 0.5f;
+
+        /** Iterations between two state hashes compared across nodes (0 disables the check). */
+        unsigned int divergenceCheckInterval_ = 0;
+        /** Host name of the master node the slaves report divergence to. */
+        std::string divergenceMasterAddress_ = "localhost";
+        /** UDP port the master receives divergence reports on. */
+        unsigned short divergenceReportPort_ = 27400;
+        /** Send the master state to all nodes when a node diverged. */
+        bool divergenceAutoResync_ = true;
+
+        /** Suspend simulation and rendering while the pattern does not change (decided by the master). */
+        bool idleWhenConverged_ = false;
+        /** Maximum change of A and B per iteration that counts as converged. */
+        float idleChangeThreshold_ = 1e-5f;
+        /** Number of consecutive converged checks (one per frame) before idling. */
+        unsigned int idleSteadyChecks_ = 60;
+
+        /** Heap allocations of the frame loop: 0 off, 1 report, 2 also assert zero in steady state (needs VISCOM_RD_COUNT_ALLOCATIONS). */
+        unsigned int allocationCheck_ = 0;
+        /** Frames between reports of the GPU time per window and eye (0 disables them). */
+        unsigned int gpuTimingReport_ = 0;
+        /** Textures, renderbuffers and buffers of this node in MB above which a warning is logged (0 disables the budget). */
+        unsigned int gpuMemoryBudget_ = 0;
+        /** Tracked host allocations of this node in MB above which a warning is logged (0 disables the budget). */
+        unsigned int hostMemoryBudget_ = 0;
+        /** Prefix of the CPU trace each node writes at exit as <prefix>_<role>_<pid>.json ("none" disables tracing, see RDTraceMerge). */
+        std::string traceFile_ = "none";
+        /** Number of trace zones kept per thread (the oldest are overwritten). */
+        unsigned int traceZonesPerThread_ = 65536;
+
+        /** Number of threads of the CPU raycaster renderer (0 takes the tuned number). */
+        unsigned int cpuRaycasterThreads_ = 0;
+
+        /** Benchmark this machine at start up, "auto" if no profile exists, "force" on every start or "off" for the defaults. */
+        std::string autotune_ = "off";
+        /** Wall clock time the benchmarks may take in seconds. */
+        float autotuneSeconds_ = 3.0f;
+        /** Directory of the tuning profiles, one file per GPU, driver and CPU. */
+        std::string tuningProfileDirectory_ = "tuning";
+
+        /** Number of threads decoding textures in the background. */
+        unsigned int textureLoaderThreads_ = 2;
+        /** Directory of the baked textures (see RDTextureBaker), "none" bakes them on every start. */
+        std::string textureCacheDirectory_ = "none";
+
+        /** Records input, seed points and parameter changes of the master to this file ("none" disables recording). */
+        std::string sessionRecordFile_ = "none";
+        /** Replays a recorded session on the master instead of live input ("none" disables replay). */
+        std::string sessionReplayFile_ = "none";
+        /** Replay with the recorded timing instead of as fast as possible. */
+        bool sessionReplayRealTime_ = false;
+
+        /** Export the simulation field to a shared memory ring buffer. */
+        bool exportSharedMemory_ = false;
+        /** The name of the shared memory object. */
+        std::string exportSharedMemoryName_ = "/viscom_rd_field";
+        /** Export every n-th simulation frame. */
+        unsigned int exportFrameInterval_ = 1;
+        /** Number of frames kept in the ring buffer. */
+        unsigned int exportRingSlots_ = 4;
+
+        /** Port the master streams the 8 bit simulation result to monitoring clients on (0 disables the stream, see RDMonitorViewer). */
+        unsigned int monitorStreamPort_ = 0;
+        /** Frames per second of the monitoring stream. */
+        float monitorStreamRate_ = 5.0f;
+
+        /** Port of the HTTP endpoint serving the metrics of this node in the Prometheus text format (0 disables it). */
+        unsigned int metricsPort_ = 0;
+        /** IPv4 address of the interface the metrics endpoint is bound to (0.0.0.0 for all interfaces). */
+        std::string metricsAddress_ = "127.0.0.1";
+        /** Slaves report their metrics to the master, which serves them labelled by node (over the divergence report channel). */
+        bool metricsAggregateSlaves_ = false;
+
+        /** Simulate only a sub-rectangle of the domain on each node and exchange halos with the neighbours. */
+        bool distributedMode_ = false;
+        /** Number of nodes in x direction, the global domain grows with the number of nodes. */
+        unsigned int distributedTilesX_ = 1;
+        /** Number of nodes in y direction. */
+        unsigned int distributedTilesY_ = 1;
+        /** Index of this node in the decomposition (row major, starting bottom left). */
+        unsigned int distributedNodeIndex_ = 0;
+        /** Iterations between two halo exchanges (also the halo width). */
+        unsigned int distributedExchangeInterval_ = 5;
+        /** Port of node 0, node i listens on distributedBasePort + i. */
+        unsigned short distributedBasePort_ = 27300;
+        /** Host names of all nodes in the decomposition. */
+        std::vector<std::string> distributedNodeAddresses_;
+
+        /** Simulate a virtual domain larger than a texture with only the active tiles resident on the GPU. */
+        bool tiledMode_ = false;
+        /** Width of the virtual domain in cells. */
+        unsigned int tiledDomainWidth_ = 16384;
+        /** Height of the virtual domain in cells. */
+        unsigned int tiledDomainHeight_ = 8192;
+        /** Edge length of a tile in cells. */
+        unsigned int tiledTileSize_ = 128;
+        /** Number of tiles resident on the GPU. */
+        unsigned int tiledResidentTiles_ = 256;
+        /** Directory for paged out tiles, "none" keeps them in host memory. */
+        std::string tiledPageDirectory_ = "none";
+
+        void Load(const std::string& settingsFile);
+    };
+}
@@ -18,98 +18,190 @@
 #include <glm/gtc/quaternion.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include "app/renderers/HeightfieldRaycaster.h"
+#include "app/renderers/HeightfieldRaycasterCPU.h"
 #include "app/renderers/SimpleGreyScaleRenderer.h"
+#include "app/rendergraph/RenderGraph.h"
+#include "app/export/FieldExporter.h"
+#include "app/metrics/NodeMetrics.h"
+#include "app/distributed/DomainDecomposition.h"
+#include "app/distributed/HaloExchange.h"
+#include "app/distributed/TextureHaloField.h"
+#include "app/distributed/HaloTransport.h"
+#include "app/simulation/TiledSimulation.h"
+#include "app/simulation/CPUSimulation.h"
+#include "app/simulation/ComparisonSimulation.h"
+#include "app/simulation/FixedPointSimulation.h"
+#include "app/simulation/InPlaceSimulation.h"
+#include "app/simulation/PingPongSimulation.h"
+#include "app/simulation/WarmStart.h"
+#include "app/tuning/Autotuner.h"
+#include "app/util/InputLatencyTracker.h"
+#include "app/sync/DivergenceCheck.h"
+#include "app/sync/SustainableRate.h"
+#include "app/idle/FrameCache.h"
+#include "app/idle/IdleStatistics.h"
+#include "app/util/GPUTiming.h"
+#include "app/util/AllocationCheck.h"
+#include "app/util/MemoryMonitor.h"
+#include "app/util/TraceClock.h"
+#include "app/util/TextureLoader.h"
+#include "app/util/FrameTrace.h"
+#include <cassert>
 #include "core/open_gl.h"
 
 #include <iostream>
 
 namespace viscom {
 
+    namespace {
+        /** The parameters on a grid whose resolution is divided by the scale (the rates are given for the full grid). */
+        simulation::GrayScottParameters GetSimulationParameters(const SimulationData& simData, int simulationScale)
+        {
+            // the cells of the coarser grid are that much larger, diffusion between them is slower by its square.
+            const auto cellArea = static_cast<float>(simulationScale * simulationScale);
+            simulation::GrayScottParameters params;
+            params.diffusionRateA_ = simData.diffusion_rate_a_ / cellArea;
+            params.diffusionRateB_ = simData.diffusion_rate_b_ / cellArea;
+            params.feedRate_ = simData.feed_rate_;
+            params.killRate_ = simData.kill_rate_;
+            params.dt_ = simData.dt_;
+            params.seedPointRadius_ = simData.seed_point_radius_;
+            params.useManhattanDistance_ = simData.use_manhattan_distance_;
+            return params;
+        }
+
+        template<typename Renderer> std::unique_ptr<renderers::RDRenderer> CreateRenderer(ApplicationNodeImplementation* appNode)
+        {
+            return std::make_unique<Renderer>(appNode);
+        }
+
+        struct RendererType {
+            const char* name_;
+            std::unique_ptr<renderers::RDRenderer>(*create_)(ApplicationNodeImplementation*);
+        };
+
+        /** All renderers in the order they are selected by SimulationData::currentRenderer_. */
+        const RendererType RENDERER_TYPES[] = {
+            { renderers::HeightfieldRaycaster::NAME, &CreateRenderer<renderers::HeightfieldRaycaster> },
+            { renderers::SimpleGreyScaleRenderer::NAME, &CreateRenderer<renderers::SimpleGreyScaleRenderer> },
+            { renderers::HeightfieldRaycasterCPU::NAME, &CreateRenderer<renderers::HeightfieldRaycasterCPU> }
+        };
+    }
+
     ApplicationNodeImplementation::ApplicationNodeImplementation(ApplicationNodeInternal* appNode) :
         ApplicationNodeBase{ appNode }
     {
+        allocationCheck_ = AddComponent<util::AllocationCheck>();
+        memoryMonitor_ = AddComponent<util::MemoryMonitor>();
+        nodeMetrics_ = AddComponent<metrics::NodeMetrics>();
+        warmStart_ = AddComponent<simulation::WarmStart>();
+        divergenceCheck_ = AddComponent<sync::DivergenceCheck>();
+        traceClock_ = AddComponent<util::TraceClock>();
+        idleStatistics_ = AddComponent<idle::IdleStatistics>();
+        sustainableRate_ = AddComponent<sync::SustainableRate>();
+        gpuTiming_ = AddComponent<util::GPUTiming>();
     }
 
     ApplicationNodeImplementation::~ApplicationNodeImplementation() = default;
 
+    template<typename Component> Component* ApplicationNodeImplementation::AddComponent()
+    {
+        components_.emplace_back(std::make_unique<Component>(this));
+        return static_cast<Component*>(components_.back().get());
+    }
+
     void ApplicationNodeImplementation::InitOpenGL()
     {
-        FrameBufferDescriptor reactDiffuseFBDesc;
-        reactDiffuseFBDesc.texDesc_.emplace_back(GL_RG32F, GL_TEXTURE_2D);
-        reactDiffuseFBDesc.texDesc_.emplace_back(GL_RG32F, GL_TEXTURE_2D);
-        reactDiffuseFBDesc.texDesc_.emplace_back(GL_R32F, GL_TEXTURE_2D);
-        reactDiffuseFBO_ = std::make_unique<FrameBuffer>(SIMULATION_SIZE_X, SIMULATION_SIZE_Y, reactDiffuseFBDesc);
-
-        renderers_.push_back(std::make_unique<renderers::HeightfieldRaycaster>(this));
-        renderers_.push_back(std::make_unique<renderers::SimpleGreyScaleRenderer>(this));
-
-        reactionDiffusionFullScreenQuad_ = CreateFullscreenQuad("reactionDiffusionSimulation.frag");
-        const auto rdGpuProgram = reactionDiffusionFullScreenQuad_->GetGPUProgram();
-        rdPrevIterationTextureLoc_ = rdGpuProgram->getUniformLocation("texture_0");
-        rdDiffusionRateALoc_ = rdGpuProgram->getUniformLocation("diffusion_rate_A");
-        rdDiffusionRateBLoc_ = rdGpuProgram->getUniformLocation("diffusion_rate_B");
-        rdFeedRateLoc_ = rdGpuProgram->getUniformLocation("feed_rate");
-        rdKillRateLoc_ = rdGpuProgram->getUniformLocation("kill_rate");
-        rdDtLoc_ = rdGpuProgram->getUniformLocation("dt");
-        rdSeedPointRadiusLoc_ = rdGpuProgram->getUniformLocation("seed_point_radius");
-        rdNumSeedPointsLoc_ = rdGpuProgram->getUniformLocation("num_seed_points");
-        rdSeedPointsLoc_ = rdGpuProgram->getUniformLocation("seed_points");
-        rdUseManhattanDistanceLoc_ = rdGpuProgram->getUniformLocation("use_manhattan_distance");
+        const auto initStart = std::chrono::steady_clock::now();
+        settings_.Load(GetConfig().resourceSearchPaths_.back() + "/appSettings.txt");
+        if (settings_.traceFile_ != "none") {
+            util::EnableTracing(settings_.traceZonesPerThread_);
+            util::SetTraceThreadName("main");
+        }
+        presets_ = LoadPresetList(GetConfig().resourceSearchPaths_.back() + "/presetList.txt");
+        if (settings_.tiledMode_ && settings_.distributedMode_) {
+            LOG(WARNING) << "Tiled mode cannot be combined with distributed mode, disabling distributed mode.";
+            settings_.distributedMode_ = false;
+        }
+        if (settings_.distributedMode_) InitDistributedSimulation();
+        if (settings_.inPlaceSimulation_ && (settings_.tiledMode_ || haloExchange_ || settings_.fixedPointSimulation_)) {
+            LOG(WARNING) << "The in-place simulation does not support the tiled, distributed or fixed point mode, using two A/B textures.";
+            settings_.inPlaceSimulation_ = false;
+        }
+
+        CreateSimulationTextures();
+
+        // renderers are created on first selection, a renderer that is never shown does not load its resources.
+        textureLoader_ = std::make_unique<util::TextureLoader>(GetConfig().resourceSearchPaths_, settings_.textureCacheDirectory_, settings_.textureLoaderThreads_);
+        for (const auto& rendererType : RENDERER_TYPES) rendererNames_.emplace_back(rendererType.name_);
+        renderers_.resize(rendererNames_.size());
+        renderGraph_ = std::make_unique<rendergraph::RenderGraph>();
+
+        if (settings_.tiledMode_) InitTiledSimulation();
+        if (settings_.fixedPointSimulation_ && (tiledSimulation_ || haloExchange_)) {
+            LOG(WARNING) << "The fixed point simulation does not support the tiled or distributed mode, simulating in floating point.";
+            settings_.fixedPointSimulation_ = false;
+        }
+        if (settings_.simulationBackend_ == "cpu") {
+            if (tiledSimulation_ || haloExchange_) LOG(WARNING) << "The CPU backend does not support the tiled or distributed mode, simulating on the GPU.";
+            else cpuSimulation_ = std::make_unique<simulation::CPUSimulation>(simulationSize_.x, simulationSize_.y, settings_.cpuSimulationPipelined_,
+                settings_.fixedPointSimulation_, settings_.inPlaceSimulation_);
+        }
+        if (!cpuSimulation_ && !tiledSimulation_) gpuSimulation_ = CreateGPUSimulation();
+        InitTuning();
+
+        frameCache_ = std::make_unique<idle::FrameCache>();
+
+        std::string latencyMode = tiledSimulation_ ? "tiled GPU" : "GPU";
+        if (cpuSimulation_) latencyMode = cpuSimulation_->IsPipelined() ? "pipelined CPU" : "synchronous CPU";
+        latencyTracker_ = std::make_unique<util::InputLatencyTracker>(latencyMode);
 
         seed_points_.clear();
         ResetSimulation();
+
+        if (settings_.exportSharedMemory_ && tiledSimulation_) {
+            LOG(WARNING) << "The shared memory export does not support the tiled mode.";
+        } else if (settings_.exportSharedMemory_) {
+            fieldExporter_ = std::make_unique<exporter::FieldExporter>(simulationSize_.x, simulationSize_.y, settings_.exportFrameInterval_);
+            if (!fieldExporter_->Initialize(settings_.exportSharedMemoryName_, settings_.exportRingSlots_)) fieldExporter_ = nullptr;
+        }
+        for (const auto& component : components_) component->Init();
+        initTime_ = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - initStart).count();
+    }
+
+    void ApplicationNodeImplementation::PreSync()
+    {
+        simData_.traceSyncTime_ = traceClock_->PreSync();
     }
 
     void ApplicationNodeImplementation::UpdateFrame(double currentTime, double elapsedTime)
     {
-        static const std::vector<std::size_t> drawBuffers0{{0, 2}};
-        static const std::vector<std::size_t> drawBuffers1{{1, 2}};
-
-        if (currentLocalIterationCount_ < simData_.currentGlobalIterationCount_) {
-            const auto iterations = glm::min(simData_.currentGlobalIterationCount_ - currentLocalIterationCount_, MAX_FRAME_ITERATIONS);
-
-            for (std::uint64_t i = 0; i < iterations; ++i) {
-                if (currentLocalIterationCount_ + i == simData_.resetFrameIdx_) {
-                    ResetSimulation();
-                }
-
-                const std::vector<std::size_t>* currentDrawBuffers{nullptr};
-                glActiveTexture(GL_TEXTURE0);
-                if (iterationToggle_) {
-                    currentDrawBuffers = &drawBuffers0;
-                    glBindTexture(GL_TEXTURE_2D, reactDiffuseFBO_->GetTextures()[1]);
-                } else {
-                    currentDrawBuffers = &drawBuffers1;
-                    glBindTexture(GL_TEXTURE_2D, reactDiffuseFBO_->GetTextures()[0]);
-                }
-                iterationToggle_ = !iterationToggle_;
-
-                std::vector<glm::vec2> actual_seed_points;
-                for (const auto& seed_point : seed_points_) {
-                    if (currentLocalIterationCount_ + i == seed_point.first) actual_seed_points.push_back(seed_point.second);
-                }
-
-                const auto rdGpuProgram = reactionDiffusionFullScreenQuad_->GetGPUProgram();
-                glUseProgram(rdGpuProgram->getProgramId());
-                glUniform1i(rdPrevIterationTextureLoc_, 0);
-                glUniform1f(rdDiffusionRateALoc_, simData_.diffusion_rate_a_);
-                glUniform1f(rdDiffusionRateBLoc_, simData_.diffusion_rate_b_);
-                glUniform1f(rdFeedRateLoc_, simData_.feed_rate_);
-                glUniform1f(rdKillRateLoc_, simData_.kill_rate_);
-                glUniform1f(rdDtLoc_, simData_.dt_);
-                glUniform1f(rdSeedPointRadiusLoc_, simData_.seed_point_radius_);
-                glUniform1ui(rdNumSeedPointsLoc_, static_cast<GLuint>(actual_seed_points.size()));
-                glUniform2fv(rdSeedPointsLoc_, static_cast<GLsizei>(actual_seed_points.size()), reinterpret_cast<const GLfloat*>(actual_seed_points.data()));
-                glUniform1i(rdUseManhattanDistanceLoc_, simData_.use_manhattan_distance_);
-
-                // simulate
-                reactDiffuseFBO_->DrawToFBO(*currentDrawBuffers, [this]() {
-                    reactionDiffusionFullScreenQuad_->Draw();
-                });
-            }
-            currentLocalIterationCount_ += iterations;
+        VISCOM_TRACE_ZONE("UpdateFrame");
+
+        frameArena_.Reset();
+        for (const auto& component : components_) component->UpdateFrame();
+
+        // the input time is on the master clock, the offset moves it onto the clock of this node.
+        if (simData_.inputTraceTime_ != 0) latencyTracker_->InputReceived(simData_.inputFrameIdx_, traceClock_->ToLocalTime(simData_.inputTraceTime_));
+        CollectCPUTiming();
+        ApplySimulationScale();
+
+        activeRenderer_ = SelectRenderer(simData_.currentRenderer_);
+        if (activeRenderer_ != renderGraphRenderer_) BuildRenderGraph();
+        rendergraph::PassContext passContext;
+        passContext.simData_ = &simData_;
+        renderGraph_->Execute(rendergraph::PassPhase::Simulation, passContext);
+
+        const auto texturesChanged = textureLoader_->Upload() > 0;
+        if (texturesChanged) {
+            allocationCheck_->AllowFrameAllocations();
+            if (textureLoader_->GetNumPending() == 0) memoryMonitor_->Report();
         }
 
+        const auto renderStateChanged = RenderStateChanged();
+        reuseFrames_ = settings_.idleWhenConverged_ && simData_.simulationIdle_ && !renderStateChanged && !texturesChanged;
+        if (!reuseFrames_) frameCache_->Invalidate();
+
         float userDistance = (GetCamera()->GetPosition() + GetCamera()->GetUserPosition()).z;
         // TODO: maybe calculate the correct center? (ray through userPosition, (0,0,0) -> hits z=simulationDrawDistance_) [5/27/2017 Sebastian Maisch]
         simulationOutputSize_ = GetConfig().nearPlaneSize_ * (userDistance + simData_.simulationDrawDistance_) / userDistance;
@@ -118,37 +210,601 @@ namespace viscom {
         simPlane_.right_ = glm::vec3(simulationOutputSize_.x, 0.0f, -simData_.simulationDrawDistance_);
         simPlane_.up_ = glm::vec3(0.0f, simulationOutputSize_.y, -simData_.simulationDrawDistance_);
 
-        renderers_[simData_.currentRenderer_]->UpdateFrame(currentTime, elapsedTime, simData_, GetConfig().nearPlaneSize_);
+        {
+            VISCOM_TRACE_ZONE("RDRenderer::UpdateFrame");
+            activeRenderer_->UpdateFrame(currentTime, elapsedTime, simData_, GetConfig().nearPlaneSize_);
+        }
+        UpdateSharedPasses();
+    }
+
+    void ApplicationNodeImplementation::SimulateFrame()
+    {
+        const auto frameIterations = warmStart_->HoldIterations(currentLocalIterationCount_, currentLocalIterationCount_ < simData_.currentGlobalIterationCount_
+            ? glm::min(simData_.currentGlobalIterationCount_ - currentLocalIterationCount_, maxFrameIterations_) : std::uint64_t{ 0 });
+        gpuTiming_->BeginSimulation(!cpuSimulation_, frameIterations);
+        const auto firstFrameIteration = currentLocalIterationCount_;
+        const auto frameSeedPoints = CountSeedPoints(firstFrameIteration, frameIterations);
+
+        if (cpuSimulation_ && frameIterations > 0) UpdateCPUSimulation(frameIterations);
+        else if (tiledSimulation_ && frameIterations > 0) UpdateTiledSimulation(frameIterations);
+        else if (frameIterations > 0) UpdateGPUSimulation(frameIterations);
+
+        if (cpuSimulation_) {
+            // in pipelined mode this is the result of an earlier frame, the current one is still simulated.
+            if (cpuSimulation_->Upload(GetCurrentABTexture(), reactDiffuseFBO_->GetTextures().back(), displayedIterationCount_) && fieldExporter_) {
+                fieldExporter_->ExportFrame(GetCurrentABTexture(), displayedIterationCount_);
+            }
+        } else displayedIterationCount_ = currentLocalIterationCount_;
+        // frames that did not advance the simulation start no read back, but finish the ones in flight.
+        if (fieldExporter_) fieldExporter_->PublishFinishedReadbacks();
+        latencyTracker_->Update();
+        gpuTiming_->EndSimulation();
+        // after the simulation timer, the comparison grid is measured on its own.
+        UpdateComparisonSimulation(firstFrameIteration);
+
+        nodeMetrics_->CountSimulation(currentLocalIterationCount_ - firstFrameIteration, frameSeedPoints);
+    }
+
+    void ApplicationNodeImplementation::BuildRenderGraph()
+    {
+        allocationCheck_->AllowFrameAllocations();
+        if (renderGraph_->GetNumPasses() > 0) ReportRenderGraphMemory();
+        renderGraph_->Reset();
+
+        using namespace rendergraph;
+        const auto state = renderGraph_->Import("simulation.state");
+        const auto result = renderGraph_->Import("simulation.result");
+        renderGraph_->AddPass("Simulation", PassPhase::Simulation, {}, { state, result }, [this](const RenderGraph&, const PassContext&) { SimulateFrame(); });
+        renderGraph_->MarkOutput(state);
+
+        for (auto& renderer : renderers_) {
+            if (!renderer) continue;
+            const auto output = renderGraph_->Import(renderer->GetName() + ".output");
+            renderer->AddPasses(*renderGraph_, result, output);
+            if (renderer.get() == activeRenderer_) renderGraph_->MarkOutput(output);
+        }
+        renderGraph_->Compile();
+        renderGraphRenderer_ = activeRenderer_;
+    }
+
+    void ApplicationNodeImplementation::ReportRenderGraphMemory() const
+    {
+        const auto transientBytes = renderGraph_->GetTransientBytes();
+        const auto allocatedBytes = renderGraph_->GetAllocatedBytes();
+        LOG(INFO) << "Render graph: " << renderGraph_->GetNumPasses() - renderGraph_->GetNumCulledPasses() << " passes (" << renderGraph_->GetNumCulledPasses()
+            << " culled), transient textures " << static_cast<double>(transientBytes) / (1024.0 * 1024.0) << "MB in "
+            << static_cast<double>(allocatedBytes) / (1024.0 * 1024.0) << "MB of VRAM ("
+            << static_cast<double>(transientBytes - glm::min(transientBytes, allocatedBytes)) / (1024.0 * 1024.0) << "MB saved by pooling).";
+    }
+
+    void ApplicationNodeImplementation::UpdateSharedPasses()
+    {
+        // once per node frame for all windows and eyes, and only if the displayed result or its reconstruction changed.
+        if (activeRenderer_ == sharedPassRenderer_ && displayedIterationCount_ == sharedPassIteration_
+            && simData_.reconstructionFilter_ == sharedPassReconstructionFilter_ && simData_.reconstructionScale_ == sharedPassReconstructionScale_
+            && simData_.reconstructionComparison_ == sharedPassReconstructionComparison_) return;
+        sharedPassRenderer_ = activeRenderer_;
+        sharedPassIteration_ = displayedIterationCount_;
+        sharedPassReconstructionFilter_ = simData_.reconstructionFilter_;
+        sharedPassReconstructionScale_ = simData_.reconstructionScale_;
+        sharedPassReconstructionComparison_ = simData_.reconstructionComparison_;
+
+        VISCOM_TRACE_ZONE("RDRenderer::UpdateSharedPasses");
+        gpuTiming_->BeginSharedPasses();
+        rendergraph::PassContext passContext;
+        passContext.simData_ = &simData_;
+        passContext.resultTexture_ = GetResultTexture();
+        renderGraph_->Execute(rendergraph::PassPhase::Shared, passContext);
+        gpuTiming_->EndSharedPasses();
+    }
+
+    renderers::RDRenderer* ApplicationNodeImplementation::GetRenderer(int index) const
+    {
+        if (index < 0 || static_cast<std::size_t>(index) >= renderers_.size()) return nullptr;
+        return renderers_[index].get();
+    }
+
+    GLuint ApplicationNodeImplementation::GetResultTexture() const
+    {
+        return tiledSimulation_ ? tiledSimulation_->GetResultAtlas() : reactDiffuseFBO_->GetTextures().back();
+    }
+
+    GLuint ApplicationNodeImplementation::GetCurrentABTexture() const
+    {
+        // the CPU backend uploads to the first A/B texture, the tiled mode has its own textures.
+        return gpuSimulation_ ? gpuSimulation_->GetCurrentABTexture() : reactDiffuseFBO_->GetTextures().front();
+    }
+
+    GLuint ApplicationNodeImplementation::GetPreviousABTexture() const
+    {
+        return gpuSimulation_ ? gpuSimulation_->GetPreviousABTexture() : reactDiffuseFBO_->GetTextures().front();
+    }
+
+    renderers::RDRenderer* ApplicationNodeImplementation::SelectRenderer(int index)
+    {
+        const auto rendererIndex = static_cast<std::size_t>(glm::clamp(index, 0, static_cast<int>(renderers_.size()) - 1));
+        if (!renderers_[rendererIndex]) {
+            const auto createStart = std::chrono::steady_clock::now();
+            renderers_[rendererIndex] = RENDERER_TYPES[rendererIndex].create_(this);
+            allocationCheck_->AllowFrameAllocations();
+            LOG(INFO) << "Created renderer " << rendererNames_[rendererIndex] << " in "
+                << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - createStart).count() << "ms.";
+        }
+        return renderers_[rendererIndex].get();
     }
 
     void ApplicationNodeImplementation::ResetSimulation() const
     {
-        // clear A and B, {0, 1}
-        reactDiffuseFBO_->DrawToFBO(std::vector<std::size_t>{0, 1}, []() {
-            glClearColor(1.0f, 0.0f, 1.0f, 1.0f);
-            glClear(GL_COLOR_BUFFER_BIT);
-        });
+        if (tiledSimulation_) tiledSimulation_->Reset();
+
+        // A = 1 and B = 0 in all A/B textures, the result is the last texture.
+        static const GLfloat restingState[2] = { 1.0f, 0.0f };
+        static const GLfloat restingResult = 1.0f;
+        const auto& textures = reactDiffuseFBO_->GetTextures();
+        for (std::size_t i = 0; i + 1 < textures.size(); ++i) glClearTexImage(textures[i], 0, GL_RG, GL_FLOAT, restingState);
+        glClearTexImage(textures.back(), 0, GL_RED, GL_FLOAT, &restingResult);
+        if (gpuSimulation_) gpuSimulation_->Reset();
+    }
+
+    void ApplicationNodeImplementation::ApplyWarmStart()
+    {
+        simulation::StateSnapshot snapshot;
+        // in distributed mode only the local part of the snapshot is uploaded.
+        if (warmStart_->TakeSnapshot(snapshot)) UploadState(snapshot.field_, snapshot.width_, simulationOffset_);
+    }
+
+    void ApplicationNodeImplementation::UploadState(const std::vector<float>& field, unsigned int rowLength, const glm::uvec2& offset)
+    {
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, rowLength);
+        glPixelStorei(GL_UNPACK_SKIP_PIXELS, offset.x);
+        glPixelStorei(GL_UNPACK_SKIP_ROWS, offset.y);
+        for (std::size_t i = 0; i + 1 < reactDiffuseFBO_->GetTextures().size(); ++i) {
+            glBindTexture(GL_TEXTURE_2D, reactDiffuseFBO_->GetTextures()[i]);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, simulationSize_.x, simulationSize_.y, GL_RG, GL_FLOAT, field.data());
+        }
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+        glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+        // only the fixed point simulation keeps its own state, it has no distributed mode and the field is the whole domain.
+        if (gpuSimulation_) gpuSimulation_->SetState(field.data());
+    }
+
+    bool ApplicationNodeImplementation::EncodeCurrentState(std::vector<std::uint8_t>& data)
+    {
+        allocationCheck_->AllowFrameAllocations();
+        simulation::StateSnapshot snapshot;
+        snapshot.width_ = simulationSize_.x;
+        snapshot.height_ = simulationSize_.y;
+        snapshot.iteration_ = currentLocalIterationCount_;
+        snapshot.field_.resize(2 * static_cast<std::size_t>(simulationSize_.x) * simulationSize_.y);
+
+        glBindTexture(GL_TEXTURE_2D, GetCurrentABTexture());
+        glGetTexImage(GL_TEXTURE_2D, 0, GL_RG, GL_FLOAT, snapshot.field_.data());
+        glBindTexture(GL_TEXTURE_2D, 0);
+        return simulation::EncodeStateSnapshot(snapshot, data);
+    }
+
+    void ApplicationNodeImplementation::ApplyResync()
+    {
+        simulation::StateSnapshot state;
+        if (!divergenceCheck_->TakeResyncState(state)) return;
+        UploadState(state.field_, simulationSize_.x, glm::uvec2(0));
+        LOG(INFO) << "Resynchronized the simulation state to the master in iteration " << state.iteration_ << ".";
+    }
+
+    void ApplicationNodeImplementation::InitDistributedSimulation()
+    {
+        const auto numNodes = settings_.distributedTilesX_ * settings_.distributedTilesY_;
+        if (settings_.distributedNodeIndex_ >= numNodes || settings_.distributedNodeAddresses_.size() < numNodes) {
+            LOG(WARNING) << "Distributed mode needs a node index below " << numNodes << " and " << numNodes << " node addresses, simulating the whole domain.";
+            return;
+        }
+
+        // the global domain grows with the number of nodes, so each node simulates the default size plus halo.
+        simulationGlobalSize_ = glm::uvec2(SIMULATION_SIZE_X * settings_.distributedTilesX_, SIMULATION_SIZE_Y * settings_.distributedTilesY_);
+        settings_.distributedExchangeInterval_ = glm::max(settings_.distributedExchangeInterval_, 1U);
+        decomposition_ = std::make_unique<distributed::DomainDecomposition>(simulationGlobalSize_.x, simulationGlobalSize_.y,
+            settings_.distributedTilesX_, settings_.distributedTilesY_, settings_.distributedNodeIndex_, settings_.distributedExchangeInterval_);
+
+        haloTransport_ = std::make_unique<distributed::HaloTransport>(settings_.distributedNodeIndex_, settings_.distributedNodeAddresses_, settings_.distributedBasePort_);
+        if (!haloTransport_->Connect(*decomposition_, 30000)) {
+            LOG(WARNING) << "Could not connect to the neighbour nodes, simulating the whole domain.";
+            simulationGlobalSize_ = glm::uvec2(SIMULATION_SIZE_X, SIMULATION_SIZE_Y);
+            haloTransport_ = nullptr;
+            decomposition_ = nullptr;
+            return;
+        }
+        haloExchange_ = std::make_unique<distributed::HaloExchange>(*decomposition_, *haloTransport_);
+
+        const auto& extended = decomposition_->GetExtended();
+        simulationSize_ = glm::uvec2(extended.width_, extended.height_);
+        simulationOffset_ = glm::uvec2(extended.x_, extended.y_);
+        simulationTextureRegion_ = glm::vec4(glm::vec2(simulationOffset_) / glm::vec2(simulationGlobalSize_), glm::vec2(simulationSize_) / glm::vec2(simulationGlobalSize_));
+        haloField_ = std::make_unique<distributed::TextureHaloField>(haloExchange_->GetMaxStripSize());
+
+        LOG(INFO) << "Distributed simulation: node " << settings_.distributedNodeIndex_ << " of " << numNodes << " simulates " << simulationSize_.x << "x" << simulationSize_.y
+            << " cells at (" << simulationOffset_.x << ", " << simulationOffset_.y << ") of " << simulationGlobalSize_.x << "x" << simulationGlobalSize_.y << ".";
+    }
+
+    void ApplicationNodeImplementation::ExchangeHalos(std::uint64_t iteration)
+    {
+        // only the send strips are read back and the received strips uploaded, the field stays on the GPU.
+        haloField_->SetTexture(GetCurrentABTexture());
+        if (!haloExchange_->Exchange(iteration, *haloField_, 10000)) {
+            LOG(WARNING) << "Halo exchange failed in iteration " << iteration << ", continuing without exchange.";
+            haloExchange_ = nullptr;
+        }
+    }
+
+    void ApplicationNodeImplementation::InitTiledSimulation()
+    {
+        if (settings_.tiledDomainWidth_ == 0 || settings_.tiledDomainHeight_ == 0 || settings_.tiledTileSize_ == 0 || settings_.tiledResidentTiles_ == 0) {
+            LOG(WARNING) << "Tiled mode needs a non empty domain, tile size and slot count, using the regular simulation.";
+            return;
+        }
 
-        // clear mixed result, {2}
-        reactDiffuseFBO_->DrawToFBO(std::vector<std::size_t>{2}, []() {
-            glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
-            glClear(GL_COLOR_BUFFER_BIT);
-        });
+        const auto pageDirectory = settings_.tiledPageDirectory_ == "none" ? std::string() : settings_.tiledPageDirectory_;
+        tiledSimulation_ = std::make_unique<simulation::TiledSimulation>(this, settings_.tiledDomainWidth_, settings_.tiledDomainHeight_,
+            settings_.tiledTileSize_, settings_.tiledResidentTiles_, pageDirectory);
+        simulationGlobalSize_ = glm::uvec2(settings_.tiledDomainWidth_, settings_.tiledDomainHeight_);
+    }
+
+    void ApplicationNodeImplementation::InitTuning()
+    {
+        const auto glString = [](GLenum name) {
+            const auto str = glGetString(name);
+            return str != nullptr ? std::string(reinterpret_cast<const char*>(str)) : std::string("unknown");
+        };
+        const auto machineKey = tuning::MakeMachineKey(glString(GL_VENDOR), glString(GL_RENDERER), glString(GL_VERSION));
+        const auto profileFile = tuning::GetTuningProfileFilename(settings_.tuningProfileDirectory_, machineKey);
+        tuningProfile_.machineKey_ = machineKey;
+        if (settings_.autotune_ == "off") {
+            LOG(INFO) << "Autotuning is off, using the default configuration.";
+            return;
+        }
+
+        const auto loaded = settings_.autotune_ != "force" && tuning::LoadTuningProfile(profileFile, machineKey, tuningProfile_);
+        // the frame iterations are measured with the full domain GPU simulation only, a profile tuned with another mode lacks them.
+        const auto tuneFrameIterations = IsFullDomainGPUSimulation() && (!loaded || tuningProfile_.simulationIterationTime_ <= 0.0);
+        if (loaded && !tuneFrameIterations) {
+            LOG(INFO) << "Loaded tuning profile '" << profileFile << "'.";
+        } else {
+            VISCOM_TRACE_ZONE("Autotune");
+            tuning::Autotuner tuner{ settings_.autotuneSeconds_ };
+            if (!loaded) tuning::TuneCPURaycaster(tuner, tuneFrameIterations ? 0.5 : 1.0, 2 * SIMULATION_SIZE_X, 2 * SIMULATION_SIZE_Y, tuningProfile_);
+            if (tuneFrameIterations) TuneFrameIterations(tuner, loaded ? 1.0 : 0.5);
+            if (tuning::SaveTuningProfile(profileFile, tuningProfile_)) LOG(INFO) << "Tuned this machine in " << tuner.GetElapsedSeconds() << "s, saved to '" << profileFile << "'.";
+            else LOG(WARNING) << "Could not save the tuning profile to '" << profileFile << "'.";
+        }
+
+        if (IsFullDomainGPUSimulation()) maxFrameIterations_ = glm::max(MAX_FRAME_ITERATIONS, static_cast<std::uint64_t>(tuningProfile_.maxFrameIterations_));
+        LOG(INFO) << "Tuning profile of '" << machineKey << "': CPU raycaster with " << tuningProfile_.cpuRaycasterThreads_ << " threads and "
+            << tuningProfile_.cpuRaycasterTileSize_ << "px tiles (" << tuningProfile_.cpuRaycastTime_ << "ms per frame), up to " << maxFrameIterations_
+            << " iterations per frame (" << tuningProfile_.simulationIterationTime_ << "us per iteration).";
+    }
+
+    void ApplicationNodeImplementation::TuneFrameIterations(const tuning::Autotuner& tuner, double budgetFraction)
+    {
+        // slaves have to keep up with the clock of the master, so a node never simulates fewer than MAX_FRAME_ITERATIONS.
+        static constexpr std::array<std::uint64_t, 4> FRAME_ITERATION_CANDIDATES = { { MAX_FRAME_ITERATIONS, 2 * MAX_FRAME_ITERATIONS, 3 * MAX_FRAME_ITERATIONS, 4 * MAX_FRAME_ITERATIONS } };
+        std::vector<double> times;
+        tuner.Measure(FRAME_ITERATION_CANDIDATES.size(), budgetFraction, [this](std::size_t candidate) {
+            glFinish();
+            const auto start = std::chrono::steady_clock::now();
+            UpdateGPUSimulation(FRAME_ITERATION_CANDIDATES[candidate]);
+            glFinish();
+            frameArena_.Reset();
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }, times);
+
+        // the deepest batch that fits into the simulation budget of a 60Hz frame.
+        const auto frameBudget = 1000.0 / 60.0 * settings_.simulationBudget_;
+        tuningProfile_.maxFrameIterations_ = static_cast<unsigned int>(MAX_FRAME_ITERATIONS);
+        for (std::size_t i = 0; i < times.size() && times[i] <= frameBudget; ++i) tuningProfile_.maxFrameIterations_ = static_cast<unsigned int>(FRAME_ITERATION_CANDIDATES[i]);
+        tuningProfile_.simulationIterationTime_ = 1000.0 * times.back() / static_cast<double>(FRAME_ITERATION_CANDIDATES.back());
+
+        // the benchmark iterations are not part of the simulation (the state is reset at the end of InitOpenGL).
+        currentLocalIterationCount_ = 0;
+        gpuTiming_->ResetSubmissionTime();
+    }
+
+    void ApplicationNodeImplementation::UpdateTiledSimulation(std::uint64_t iterations)
+    {
+        VISCOM_TRACE_ZONE("SimulateTiled");
+        // residency changes only at seed point and activity report iterations, so all nodes page at the same iterations.
+        const auto frameSeedPoints = GatherSeedPoints(currentLocalIterationCount_, iterations);
+        auto actual_seed_points = frameArena_.Allocate<glm::vec2>(frameSeedPoints.size());
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            const auto iteration = currentLocalIterationCount_ + i;
+            if (iteration == simData_.resetFrameIdx_) ResetSimulation();
+            tiledSimulation_->ApplyActivity(iteration);
+
+            std::size_t numSeedPoints = 0;
+            for (const auto& seed_point : frameSeedPoints) {
+                if (iteration == seed_point.first) actual_seed_points[numSeedPoints++] = seed_point.second;
+            }
+            if (numSeedPoints > 0) tiledSimulation_->UpdateResidency(actual_seed_points, numSeedPoints, simData_, iteration);
+            tiledSimulation_->Step(simData_, actual_seed_points, numSeedPoints);
+        }
+        currentLocalIterationCount_ += iterations;
+
+        tiledSimulation_->EndFrame();
+    }
+
+    bool ApplicationNodeImplementation::PollTileActivity(std::vector<std::int32_t>& activity)
+    {
+        tiledSimulation_->MeasureActivity(tiledSimulationFrame_++);
+        if (!tiledSimulation_->PollActivity(activity)) return false;
+
+        // no node has simulated beyond the global iteration count yet, so every node can still apply the report there.
+        simData_.tileActivityFrameIdx_ = simData_.currentGlobalIterationCount_;
+        QueueTileActivity(activity.data(), activity.size());
+        return true;
+    }
+
+    void ApplicationNodeImplementation::QueueTileActivity(const std::int32_t* activity, std::size_t count)
+    {
+        tiledSimulation_->QueueActivity(simData_.tileActivityFrameIdx_, activity, count);
+        allocationCheck_->AllowFrameAllocations();
+    }
+
+    void ApplicationNodeImplementation::CreateSimulationTextures()
+    {
+        // the in-place simulation reads and writes a single A/B texture, the result is the last texture in both cases.
+        FrameBufferDescriptor reactDiffuseFBDesc;
+        reactDiffuseFBDesc.texDesc_.emplace_back(GL_RG32F, GL_TEXTURE_2D);
+        if (!settings_.inPlaceSimulation_) reactDiffuseFBDesc.texDesc_.emplace_back(GL_RG32F, GL_TEXTURE_2D);
+        reactDiffuseFBDesc.texDesc_.emplace_back(GL_R32F, GL_TEXTURE_2D);
+        reactDiffuseFBO_ = std::make_unique<FrameBuffer>(simulationSize_.x, simulationSize_.y, reactDiffuseFBDesc);
+
+        trackedResources_.clear();
+        const auto& simulationTextures = reactDiffuseFBO_->GetTextures();
+        for (std::size_t i = 0; i < simulationTextures.size(); ++i) {
+            const auto name = i + 1 == simulationTextures.size() ? std::string("result") : "A/B " + std::to_string(i);
+            trackedResources_.emplace_back(util::ResourceType::Texture, "Simulation", name, util::QueryTextureSize(simulationTextures[i]));
+        }
+    }
+
+    void ApplicationNodeImplementation::ApplySimulationScale()
+    {
+        const auto scale = CanScaleSimulation() ? glm::clamp(simData_.simulationScale_, 1, MAX_SIMULATION_SCALE) : 1;
+        if (scale == simulationScale_) return;
+        allocationCheck_->AllowFrameAllocations();
+        simulationScale_ = scale;
+        simulationSize_ = glm::uvec2(SIMULATION_SIZE_X, SIMULATION_SIZE_Y) / static_cast<unsigned int>(scale);
+        simulationGlobalSize_ = simulationSize_;
+
+        // the backends, the comparison and the export hold the textures or copies of the old grid.
+        gpuSimulation_ = nullptr;
+        comparisonSimulation_ = nullptr;
+        CreateSimulationTextures();
+        if (cpuSimulation_) {
+            cpuSimulation_ = std::make_unique<simulation::CPUSimulation>(simulationSize_.x, simulationSize_.y, settings_.cpuSimulationPipelined_,
+                settings_.fixedPointSimulation_, settings_.inPlaceSimulation_);
+        } else gpuSimulation_ = CreateGPUSimulation();
+        if (fieldExporter_) {
+            fieldExporter_ = std::make_unique<exporter::FieldExporter>(simulationSize_.x, simulationSize_.y, settings_.exportFrameInterval_);
+            if (!fieldExporter_->Initialize(settings_.exportSharedMemoryName_, settings_.exportRingSlots_)) fieldExporter_ = nullptr;
+        }
+        // the master resets all nodes with the change, this node starts over until that iteration.
+        ResetSimulation();
+        sharedPassRenderer_ = nullptr;
+        LOG(INFO) << "Simulating " << simulationSize_.x << "x" << simulationSize_.y << " cells (1/" << scale << " of the full grid resolution).";
+    }
+
+    std::unique_ptr<simulation::GPUSimulation> ApplicationNodeImplementation::CreateGPUSimulation()
+    {
+        const auto& textures = reactDiffuseFBO_->GetTextures();
+        if (settings_.fixedPointSimulation_) return std::make_unique<simulation::FixedPointSimulation>(this, simulationSize_.x, simulationSize_.y, textures);
+        if (settings_.inPlaceSimulation_) return std::make_unique<simulation::InPlaceSimulation>(this, simulationSize_.x, simulationSize_.y, textures);
+        return std::make_unique<simulation::PingPongSimulation>(this, *reactDiffuseFBO_, simulationSize_.x, simulationSize_.y, settings_.batchedSimulationSubmission_);
+    }
+
+    void ApplicationNodeImplementation::UpdateGPUSimulation(std::uint64_t iterations)
+    {
+        VISCOM_TRACE_ZONE("SimulateGPU");
+        const auto frameSeedPoints = GatherSeedPoints(currentLocalIterationCount_, iterations);
+        auto actual_seed_points = frameArena_.Allocate<glm::vec2>(frameSeedPoints.size());
+
+        // the parameters are constant within the frame, one upload serves all iterations.
+        gpuSimulation_->BeginFrame(GetSimulationParameters(simData_, simulationScale_), simulationTextureRegion_);
+        std::chrono::steady_clock::duration submissionTime{ 0 };
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            // resets, halo exchanges and state hashes change the GL state between iterations, it is set up again after them.
+            if (currentLocalIterationCount_ + i == simData_.resetFrameIdx_) {
+                ResetSimulation();
+                gpuSimulation_->InvalidateState();
+            }
+            if (currentLocalIterationCount_ + i == simData_.warmStartFrameIdx_) {
+                ApplyWarmStart();
+                gpuSimulation_->InvalidateState();
+            }
+            if (currentLocalIterationCount_ + i == simData_.resyncFrameIdx_) {
+                ApplyResync();
+                gpuSimulation_->InvalidateState();
+            }
+
+            const auto submissionStart = std::chrono::steady_clock::now();
+            std::size_t numSeedPoints = 0;
+            for (const auto& seed_point : frameSeedPoints) {
+                if (currentLocalIterationCount_ + i == seed_point.first) actual_seed_points[numSeedPoints++] = seed_point.second;
+            }
+            gpuSimulation_->Step(actual_seed_points, numSeedPoints);
+            submissionTime += std::chrono::steady_clock::now() - submissionStart;
+
+            if (haloExchange_ && (currentLocalIterationCount_ + i + 1) % settings_.distributedExchangeInterval_ == 0) {
+                ExchangeHalos(currentLocalIterationCount_ + i);
+                gpuSimulation_->InvalidateState();
+            }
+            if (divergenceCheck_->HashState(GetCurrentABTexture(), currentLocalIterationCount_ + i + 1)) gpuSimulation_->InvalidateState();
+        }
+        gpuSimulation_->EndFrame();
+        gpuTiming_->AddSubmissionTime(iterations, std::chrono::duration<double, std::micro>(submissionTime).count());
+        currentLocalIterationCount_ += iterations;
+
+        if (fieldExporter_) fieldExporter_->ExportFrame(GetCurrentABTexture(), currentLocalIterationCount_);
+    }
+
+    void ApplicationNodeImplementation::UpdateComparisonSimulation(std::uint64_t firstIteration)
+    {
+        if (!simData_.reconstructionComparison_ || !gpuSimulation_ || simulationScale_ != 1) {
+            comparisonSimulation_ = nullptr;
+            return;
+        }
+
+        // resets, warm starts and resyncs of this frame are taken over from the full grid after it.
+        const auto iterations = currentLocalIterationCount_ - firstIteration;
+        const auto changedInFrame = [firstIteration, iterations](std::uint64_t iteration) { return iteration >= firstIteration && iteration < firstIteration + iterations; };
+        auto restart = changedInFrame(simData_.resetFrameIdx_) || changedInFrame(simData_.warmStartFrameIdx_) || changedInFrame(simData_.resyncFrameIdx_);
+        if (!comparisonSimulation_) {
+            allocationCheck_->AllowFrameAllocations();
+            comparisonSimulation_ = std::make_unique<simulation::ComparisonSimulation>(this, simulationSize_.x / MAX_SIMULATION_SCALE, simulationSize_.y / MAX_SIMULATION_SCALE);
+            restart = true;
+        }
+        if (restart) {
+            VISCOM_TRACE_ZONE("RestartComparison");
+            allocationCheck_->AllowFrameAllocations();
+            comparisonSimulation_->Restart(GetCurrentABTexture());
+            return;
+        }
+        if (iterations == 0) return;
+
+        VISCOM_TRACE_ZONE("SimulateComparison");
+        const auto frameSeedPoints = GatherSeedPoints(firstIteration, iterations);
+        auto actual_seed_points = frameArena_.Allocate<glm::vec2>(frameSeedPoints.size());
+        comparisonSimulation_->BeginFrame(GetSimulationParameters(simData_, MAX_SIMULATION_SCALE));
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            std::size_t numSeedPoints = 0;
+            for (const auto& seed_point : frameSeedPoints) {
+                if (firstIteration + i == seed_point.first) actual_seed_points[numSeedPoints++] = seed_point.second;
+            }
+            comparisonSimulation_->Step(actual_seed_points, numSeedPoints);
+        }
+        comparisonSimulation_->EndFrame();
+    }
+
+    void ApplicationNodeImplementation::UpdateCPUSimulation(std::uint64_t iterations)
+    {
+        VISCOM_TRACE_ZONE("SubmitCPUSimulation");
+        auto work = cpuSimulation_->AcquireWork();
+        work.firstIteration_ = currentLocalIterationCount_;
+        work.iterations_ = iterations;
+        work.params_ = GetSimulationParameters(simData_, simulationScale_);
+        work.resetIteration_ = simData_.resetFrameIdx_;
+        for (const auto& seed_point : GatherSeedPoints(currentLocalIterationCount_, iterations)) work.seedPoints_.emplace_back(seed_point.first, seed_point.second);
+
+        simulation::StateSnapshot snapshot;
+        if (simData_.warmStartFrameIdx_ >= currentLocalIterationCount_ && simData_.warmStartFrameIdx_ < currentLocalIterationCount_ + iterations && warmStart_->TakeSnapshot(snapshot)) {
+            // the CPU backend simulates the whole domain, the snapshot matches it.
+            work.warmStartIteration_ = simData_.warmStartFrameIdx_;
+            work.warmStartField_ = std::move(snapshot.field_);
+        }
+
+        cpuSimulation_->Submit(std::move(work));
+        currentLocalIterationCount_ += iterations;
+    }
+
+    bool ApplicationNodeImplementation::RenderStateChanged()
+    {
+        const auto changed = displayedIterationCount_ != cachedFrameIterationCount_
+            || simData_.currentRenderer_ != cachedFrameData_.currentRenderer_
+            || simData_.simulationDrawDistance_ != cachedFrameData_.simulationDrawDistance_
+            || simData_.simulationHeight_ != cachedFrameData_.simulationHeight_
+            || simData_.eta_ != cachedFrameData_.eta_
+            || simData_.sigma_a_ != cachedFrameData_.sigma_a_
+            || simData_.reconstructionFilter_ != cachedFrameData_.reconstructionFilter_
+            || simData_.reconstructionScale_ != cachedFrameData_.reconstructionScale_
+            || simData_.reconstructionComparison_ != cachedFrameData_.reconstructionComparison_
+            || simData_.simulationScale_ != cachedFrameData_.simulationScale_;
+        cachedFrameIterationCount_ = displayedIterationCount_;
+        cachedFrameData_ = simData_;
+        return changed;
+    }
+
+    void ApplicationNodeImplementation::CollectCPUTiming()
+    {
+        if (!cpuSimulation_) return;
+
+        std::uint64_t iterations = 0;
+        double seconds = 0.0;
+        cpuSimulation_->CollectTiming(iterations, seconds);
+        sustainableRate_->AddSimulationTime(iterations, seconds * 1000.0);
+        gpuTiming_->AddCPUSimulationTime(iterations, seconds * 1000.0);
+    }
+
+    std::size_t ApplicationNodeImplementation::CountSeedPoints(std::uint64_t firstIteration, std::uint64_t iterations) const
+    {
+        std::size_t count = 0;
+        for (const auto& seed_point : seed_points_) {
+            if (seed_point.first >= firstIteration && seed_point.first < firstIteration + iterations) ++count;
+        }
+        return count;
+    }
+
+    util::FrameSpan<ApplicationNodeImplementation::SeedPoint> ApplicationNodeImplementation::GatherSeedPoints(std::uint64_t firstIteration, std::uint64_t iterations)
+    {
+        util::FrameSpan<SeedPoint> result{ frameArena_.Allocate<SeedPoint>(CountSeedPoints(firstIteration, iterations)), 0 };
+        for (const auto& seed_point : seed_points_) {
+            if (seed_point.first >= firstIteration && seed_point.first < firstIteration + iterations) result.data_[result.size_++] = seed_point;
+        }
+        return result;
     }
 
     void ApplicationNodeImplementation::ClearBuffer(FrameBuffer& fbo)
     {
-        renderers_[simData_.currentRenderer_]->ClearBuffers(fbo);
+        // a reused frame overwrites the whole frame buffer.
+        if (reuseFrames_ && frameCache_->IsValid(fbo, GetCamera()->GetViewPerspectiveMatrix())) return;
+        VISCOM_TRACE_ZONE("RDRenderer::ClearBuffers");
+        activeRenderer_->ClearBuffers(fbo);
     }
 
     void ApplicationNodeImplementation::DrawFrame(FrameBuffer& fbo)
     {
+        VISCOM_TRACE_ZONE("DrawFrame");
         auto perspectiveMatrix = GetCamera()->GetViewPerspectiveMatrix();
-        renderers_[simData_.currentRenderer_]->RenderRDResults(fbo, simData_, perspectiveMatrix, reactDiffuseFBO_->GetTextures()[2]);
+        // only the view dependent passes run per window and eye, simulation and shared passes ran in UpdateFrame.
+        gpuTiming_->BeginView(fbo);
+        if (!reuseFrames_ || !frameCache_->Restore(fbo, perspectiveMatrix)) {
+            VISCOM_TRACE_ZONE("RDRenderer::RenderRDResults");
+            rendergraph::PassContext passContext;
+            passContext.target_ = &fbo;
+            passContext.simData_ = &simData_;
+            passContext.viewProjection_ = perspectiveMatrix;
+            passContext.resultTexture_ = GetResultTexture();
+            fbo.DrawToFBO([&passContext]() { glGetIntegerv(GL_VIEWPORT, glm::value_ptr(passContext.viewport_)); });
+            renderGraph_->Execute(rendergraph::PassPhase::View, passContext);
+            if (reuseFrames_) frameCache_->Store(fbo, perspectiveMatrix);
+        }
+        gpuTiming_->EndView();
+        latencyTracker_->FrameDrawn(displayedIterationCount_);
+
+        if (!firstFrameDrawn_) {
+            firstFrameDrawn_ = true;
+            LOG(INFO) << "Time to first frame: " << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime_).count()
+                << "ms (InitOpenGL " << initTime_ << "ms, " << textureLoader_->GetNumPending() << " textures still loading).";
+        }
     }
 
     void ApplicationNodeImplementation::CleanUp()
     {
+        for (auto component = components_.rbegin(); component != components_.rend(); ++component) (*component)->CleanUp();
+        fieldExporter_ = nullptr;
+        haloField_ = nullptr;
+        tiledSimulation_ = nullptr;
+        cpuSimulation_ = nullptr;
+        gpuSimulation_ = nullptr;
+        comparisonSimulation_ = nullptr;
+        latencyTracker_ = nullptr;
+        frameCache_ = nullptr;
+        sharedPassRenderer_ = nullptr;
+        // the passes reference the renderers.
+        if (renderGraph_ && renderGraph_->GetNumPasses() > 0) ReportRenderGraphMemory();
+        renderGraph_ = nullptr;
+        renderGraphRenderer_ = nullptr;
+        activeRenderer_ = nullptr;
         renderers_.clear();
+        textureLoader_ = nullptr;
+        trackedResources_.clear();
     }
 }
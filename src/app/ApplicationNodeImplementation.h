@@ -10,11 +10,71 @@
 
 #include "core/ApplicationNodeInternal.h"
 #include "core/ApplicationNodeBase.h"
+#include "app/AppSettings.h"
+#include "app/NodeComponent.h"
+#include "app/Presets.h"
+#include "app/simulation/StateSnapshot.h"
+#include "app/tuning/TuningProfile.h"
+#include "app/util/FrameArena.h"
+#include "app/util/ResourceRegistry.h"
+#include "app/util/RingBuffer.h"
+#include <array>
+#include <chrono>
 
 namespace viscom::renderers {
     class RDRenderer;
 }
 
+namespace viscom::rendergraph {
+    class RenderGraph;
+}
+
+namespace viscom::exporter {
+    class FieldExporter;
+}
+
+namespace viscom::metrics {
+    class NodeMetrics;
+}
+
+namespace viscom::simulation {
+    class TiledSimulation;
+    class WarmStart;
+    class CPUSimulation;
+    class GPUSimulation;
+    class ComparisonSimulation;
+}
+
+namespace viscom::util {
+    class AllocationCheck;
+    class MemoryMonitor;
+    class InputLatencyTracker;
+    class TraceClock;
+    class GPUTiming;
+    class TextureLoader;
+}
+
+namespace viscom::sync {
+    class DivergenceCheck;
+    class SustainableRate;
+}
+
+namespace viscom::idle {
+    class FrameCache;
+    class IdleStatistics;
+}
+
+namespace viscom::tuning {
+    class Autotuner;
+}
+
+namespace viscom::distributed {
+    class DomainDecomposition;
+    class HaloTransport;
+    class HaloExchange;
+    class TextureHaloField;
+}
+
 namespace viscom {
 
     class MeshRenderable;
@@ -29,10 +89,36 @@ namespace viscom {
         float eta_ = 1.5f;
         /** The absorption coefficient. */
         glm::vec3 sigma_a_ = glm::vec3(2.0f);
+        /** The filter reconstructing the display field (see renderers::ReconstructionFilter, Catmull-Rom). */
+        int reconstructionFilter_ = 2;
+        /** Resolution of the reconstructed field as a multiple of the simulation resolution. */
+        int reconstructionScale_ = 2;
+        /** Shows the left half of the domain with bilinear filtering and the right half reconstructed from a coarser grid. */
+        bool reconstructionComparison_ = false;
+        /** Divides the resolution of the simulation grid (1 or 2, no tiled or distributed mode), the diffusion rates are scaled to it. */
+        int simulationScale_ = 1;
         /** The current global iteration count. */
         std::uint64_t currentGlobalIterationCount_ = 0;
         /** frame at which the simulation should be reset */
         size_t resetFrameIdx_ = 0;
+        /** preset whose state snapshot is used for a warm start */
+        int warmStartPreset_ = 0;
+        /** frame at which the warm start snapshot should be applied */
+        std::uint64_t warmStartFrameIdx_ = 0;
+        /** newest state hash of the master and its iteration (divergence check) */
+        std::uint64_t referenceHashIteration_ = 0;
+        std::uint64_t referenceHash_ = 0;
+        /** frame at which the slaves replace their state with the one sent by the master */
+        std::uint64_t resyncFrameIdx_ = 0;
+        /** iteration at which the tile activity report sent with this frame is applied (tiled mode) */
+        std::uint64_t tileActivityFrameIdx_ = 0;
+        /** iteration of the newest seed point and the time of its input on the trace clock of the master (input latency) */
+        std::uint64_t inputFrameIdx_ = 0;
+        std::int64_t inputTraceTime_ = 0;
+        /** the simulation converged and is suspended (decided by the master) */
+        bool simulationIdle_ = false;
+        /** trace clock of the master in PreSync, aligns the trace clocks of the slaves */
+        std::int64_t traceSyncTime_ = 0;
 
         /** reaction diffusion parameters */
         float diffusion_rate_a_ = 1.0f;
@@ -63,6 +149,7 @@ namespace viscom {
         virtual ~ApplicationNodeImplementation() override;
 
         virtual void InitOpenGL() override;
+        virtual void PreSync() override;
         virtual void UpdateFrame(double currentTime, double elapsedTime) override;
         virtual void ClearBuffer(FrameBuffer& fbo) override;
         virtual void DrawFrame(FrameBuffer& fbo) override;
@@ -72,54 +159,256 @@ namespace viscom {
 
         std::uint64_t& GetCurrentLocalIterationCount() { return currentLocalIterationCount_; }
         SimulationData& GetSimulationData() { return simData_; }
-        std::vector<SeedPoint>& GetSeedPoints() { return seed_points_; }
-        const std::vector<std::unique_ptr<renderers::RDRenderer>>& GetRenderers() const { return renderers_; }
+        const SimulationData& GetSimulationData() const { return simData_; }
+        util::RingBuffer<SeedPoint>& GetSeedPoints() { return seed_points_; }
+        /** The names of all renderers (indexed like SimulationData::currentRenderer_). */
+        const std::vector<std::string>& GetRendererNames() const { return rendererNames_; }
+        /** Returns a renderer, nullptr until it is selected the first time (created in UpdateFrame). */
+        renderers::RDRenderer* GetRenderer(int index) const;
+        /** The node local settings. */
+        const AppSettings& GetAppSettings() const { return settings_; }
+        /** Loads textures in the background (GL thread only). */
+        util::TextureLoader& GetTextureLoader() { return *textureLoader_; }
         void ResetSimulation() const;
 
         const glm::vec2& GetSimulationOutputSize() const { return simulationOutputSize_; }
+        /** The region of the global domain covered by the simulation textures (xy: offset, zw: size in texture coordinates). */
+        const glm::vec4& GetSimulationTextureRegion() const { return simulationTextureRegion_; }
+        /** Size of the global simulation domain. */
+        const glm::uvec2& GetSimulationGlobalSize() const { return simulationGlobalSize_; }
+        /** Size of the simulation textures of this node. */
+        const glm::uvec2& GetSimulationSize() const { return simulationSize_; }
+        /** The whole domain is simulated on the GPU of this node (no tiled, distributed or CPU mode). */
+        bool IsFullDomainGPUSimulation() const { return !tiledSimulation_ && !haloExchange_ && !cpuSimulation_; }
+        /** The simulation grid can be coarsened at run time (no tiled or distributed mode). */
+        bool CanScaleSimulation() const { return !tiledSimulation_ && !haloExchange_; }
+        /** Divisor of the resolution of the simulated grid (SimulationData::simulationScale_ once it is applied). */
+        int GetSimulationScale() const { return simulationScale_; }
+        /** The coarse grid simulated for the reconstruction comparison (nullptr while the comparison is off). */
+        const simulation::ComparisonSimulation* GetComparisonSimulation() const { return comparisonSimulation_.get(); }
+        /** Holds the preset list (same on all nodes). */
+        std::vector<PresetEntry>& GetPresets() { return presets_; }
+        /** The tiled simulation (tiled mode only, nullptr otherwise). */
+        const simulation::TiledSimulation* GetTiledSimulation() const { return tiledSimulation_.get(); }
+        /** The configuration tuned for this machine (see AppSettings::autotune_). */
+        const tuning::TuningProfile& GetTuningProfile() const { return tuningProfile_; }
+        /** Holds data that is only needed during one frame. */
+        const util::FrameArena& GetFrameArena() const { return frameArena_; }
+        /** Checks that the frame loop is allocation free. */
+        util::AllocationCheck& GetAllocationCheck() { return *allocationCheck_; }
+        /** Watches the GPU and host memory of this node. */
+        util::MemoryMonitor& GetMemoryMonitor() { return *memoryMonitor_; }
+        /** Hashes the state of this node for the divergence check. */
+        sync::DivergenceCheck& GetDivergenceCheck() { return *divergenceCheck_; }
+        const sync::DivergenceCheck& GetDivergenceCheck() const { return *divergenceCheck_; }
+        /** The performance metrics of this node. */
+        metrics::NodeMetrics& GetNodeMetrics() { return *nodeMetrics_; }
+        const metrics::NodeMetrics& GetNodeMetrics() const { return *nodeMetrics_; }
+        /** Aligns the trace clock of this node to the master and writes its trace. */
+        util::TraceClock& GetTraceClock() { return *traceClock_; }
+        /** Measures the iterations per second this node can simulate within its budget. */
+        sync::SustainableRate& GetSustainableRate() { return *sustainableRate_; }
+        const sync::SustainableRate& GetSustainableRate() const { return *sustainableRate_; }
+        /** Follows the idle periods of the simulation. */
+        idle::IdleStatistics& GetIdleStatistics() { return *idleStatistics_; }
+        /** Logs the passes of the render graph and the memory of its transient textures. */
+        void ReportRenderGraphMemory() const;
+        /** Iteration of the result currently displayed (behind the simulation in pipelined CPU mode). */
+        std::uint64_t GetDisplayedIterationCount() const { return displayedIterationCount_; }
 
-        /** The maximum iteration count per frame. */
+        /** The maximum iteration count per frame (a node may catch up faster, see TuningProfile::maxFrameIterations_). */
         static constexpr std::uint64_t MAX_FRAME_ITERATIONS = 15;
         /** The increase in iteration count per frame. */
         static constexpr std::uint64_t FRAME_ITERATIONS_INC = 5;
+        /** The iterations between selecting a warm start and applying it (gives all nodes time to decompress). */
+        static constexpr std::uint64_t WARM_START_DELAY = 6 * FRAME_ITERATIONS_INC;
 
-        /** The simulation frame buffer size (x). */
+        /** The simulation frame buffer size (x) of the full grid. */
         static constexpr unsigned int SIMULATION_SIZE_X = 1920 / 4;
-        /** The simulation frame buffer size (y). */
+        /** The simulation frame buffer size (y) of the full grid. */
         static constexpr unsigned int SIMULATION_SIZE_Y = 1080 / 4;
+        /** The largest divisor of the simulation grid resolution (see SimulationData::simulationScale_). */
+        static constexpr int MAX_SIMULATION_SCALE = 2;
 
     protected:
         const SimulationPlane& GetSimPlane() const { return simPlane_; }
 
+        /** Reads the current state back and encodes it as a snapshot. */
+        bool EncodeCurrentState(std::vector<std::uint8_t>& data);
+
+        /**
+         *  Measures the tile activity every few frames and returns a finished report (master, tiled mode only). The
+         *  report is queued locally for SimulationData::tileActivityFrameIdx_ and has to be shared with the slaves.
+         */
+        bool PollTileActivity(std::vector<std::int32_t>& activity);
+        /** Queues the tile activity report received from the master for SimulationData::tileActivityFrameIdx_. */
+        void QueueTileActivity(const std::int32_t* activity, std::size_t count);
+
+        /** Returns the texture the renderers display (result atlas of a tiled domain). */
+        GLuint GetResultTexture() const;
+        /** Returns the A/B texture written by the last iteration. */
+        GLuint GetCurrentABTexture() const;
+        /** Returns the A/B texture written by the iteration before the last one (the current one in the in-place mode). */
+        GLuint GetPreviousABTexture() const;
+
     private:
+        /** Creates a component, it is owned by the node and initialized, updated and cleaned up with it. */
+        template<typename Component> Component* AddComponent();
+        void ApplyWarmStart();
+        /** Uploads a state to the A/B textures, the row length and offset select the part of a larger field (warm start in distributed mode). */
+        void UploadState(const std::vector<float>& field, unsigned int rowLength, const glm::uvec2& offset);
+        void InitDistributedSimulation();
+        void ExchangeHalos(std::uint64_t iteration);
+        void InitTiledSimulation();
+        /** Loads the tuning profile of this machine or benchmarks it (before the first frame only). */
+        void InitTuning();
+        /** Measures how many GPU iterations fit into the simulation budget of a frame. */
+        void TuneFrameIterations(const tuning::Autotuner& tuner, double budgetFraction);
+        void UpdateTiledSimulation(std::uint64_t iterations);
+        /** Creates the A/B and result textures of the simulation grid. */
+        void CreateSimulationTextures();
+        /** Rebuilds the simulation on the grid of a changed SimulationData::simulationScale_ and resets it. */
+        void ApplySimulationScale();
+        /** Selects the full domain GPU simulation of the configured mode. */
+        std::unique_ptr<simulation::GPUSimulation> CreateGPUSimulation();
+        /** Simulates the coarse grid of the reconstruction comparison alongside the iterations of this frame. */
+        void UpdateComparisonSimulation(std::uint64_t firstIteration);
+        void UpdateGPUSimulation(std::uint64_t iterations);
+        void UpdateCPUSimulation(std::uint64_t iterations);
+        void ApplyResync();
+        /** Runs the simulation iterations of this frame (the simulation pass of the render graph). */
+        void SimulateFrame();
+        /** Declares the simulation and the passes of all created renderers, the ones of the renderers not selected are culled. */
+        void BuildRenderGraph();
+        bool RenderStateChanged();
+        /** Collects the simulation time of the CPU backend. */
+        void CollectCPUTiming();
+        void UpdateSharedPasses();
+        renderers::RDRenderer* SelectRenderer(int index);
+        /** Returns the number of seed points placed in the iterations [firstIteration, firstIteration + iterations). */
+        std::size_t CountSeedPoints(std::uint64_t firstIteration, std::uint64_t iterations) const;
+        util::FrameSpan<SeedPoint> GatherSeedPoints(std::uint64_t firstIteration, std::uint64_t iterations);
+
+        /** Holds the components of this node in the order they are initialized and updated. */
+        std::vector<std::unique_ptr<NodeComponent>> components_;
+        /** Checks that the frame loop is allocation free (owned by components_). */
+        util::AllocationCheck* allocationCheck_ = nullptr;
+        /** Watches the GPU and host memory (owned by components_). */
+        util::MemoryMonitor* memoryMonitor_ = nullptr;
+        /** Holds the performance metrics (owned by components_). */
+        metrics::NodeMetrics* nodeMetrics_ = nullptr;
+        /** Loads the snapshots of warm starts (owned by components_). */
+        simulation::WarmStart* warmStart_ = nullptr;
+        /** Hashes the state and holds resync states (owned by components_). */
+        sync::DivergenceCheck* divergenceCheck_ = nullptr;
+        /** Aligns the trace clock to the master (owned by components_). */
+        util::TraceClock* traceClock_ = nullptr;
+        /** Follows the idle periods of the simulation (owned by components_). */
+        idle::IdleStatistics* idleStatistics_ = nullptr;
+        /** Measures the simulation rate this node can sustain (owned by components_). */
+        sync::SustainableRate* sustainableRate_ = nullptr;
+        /** Measures the GPU time of the simulation, the shared passes and the views (owned by components_). */
+        util::GPUTiming* gpuTiming_ = nullptr;
+
         /** The current local iteration count. */
         std::uint64_t currentLocalIterationCount_ = 0;
+        /** Iterations this node simulates per frame at most (tuned, at least MAX_FRAME_ITERATIONS). */
+        std::uint64_t maxFrameIterations_ = MAX_FRAME_ITERATIONS;
+        /** The configuration tuned for this machine. */
+        tuning::TuningProfile tuningProfile_;
         /** Holds the simulation data. */
         SimulationData simData_;
 
-        /** Toggle switch for iteration step */
-        bool iterationToggle_ = true;
-        /** stores seed points */
-        std::vector<SeedPoint> seed_points_;
-
-        /** Uniform Location for texture sampler of previous iteration step */
-        GLint rdPrevIterationTextureLoc_ = -1;
-        GLint rdDiffusionRateALoc_ = -1;
-        GLint rdDiffusionRateBLoc_ = -1;
-        GLint rdFeedRateLoc_ = -1;
-        GLint rdKillRateLoc_ = -1;
-        GLint rdDtLoc_ = -1;
-        GLint rdSeedPointRadiusLoc_ = -1;
-        GLint rdNumSeedPointsLoc_ = -1;
-        GLint rdSeedPointsLoc_ = -1;
-        GLint rdUseManhattanDistanceLoc_ = -1;
-
-        /** Program to compute reaction diffusion step */
-        std::unique_ptr<FullscreenQuad> reactionDiffusionFullScreenQuad_;
-        /** The frame buffer object for the simulation. */
+        /** stores seed points (ordered by iteration) */
+        util::RingBuffer<SeedPoint> seed_points_;
+        /** Holds data that is only needed during one frame (reset in UpdateFrame). */
+        util::FrameArena frameArena_{ FRAME_ARENA_SIZE };
+        /** Size of the frame arena in bytes at start up. */
+        static constexpr std::size_t FRAME_ARENA_SIZE = 64 * 1024;
+
+        /** The frame buffer object for the simulation (A/B textures followed by the result, one A/B texture in the in-place mode). */
         std::unique_ptr<FrameBuffer> reactDiffuseFBO_;
 
+        /** Holds the renderers, nullptr until a renderer is selected the first time. */
         std::vector<std::unique_ptr<renderers::RDRenderer>> renderers_;
+        /** The renderer selected in UpdateFrame, used for drawing all windows of the frame. */
+        renderers::RDRenderer* activeRenderer_ = nullptr;
+        /** Holds the names of all renderers. */
+        std::vector<std::string> rendererNames_;
+        /** Orders simulation, shared and view passes and pools their transient textures. */
+        std::unique_ptr<rendergraph::RenderGraph> renderGraph_;
+        /** The renderer the render graph was built for. */
+        renderers::RDRenderer* renderGraphRenderer_ = nullptr;
+        /** Decodes textures on worker threads and uploads them on the GL thread. */
+        std::unique_ptr<util::TextureLoader> textureLoader_;
+        /** Construction of the node (start of the time to first frame). */
+        std::chrono::steady_clock::time_point startTime_ = std::chrono::steady_clock::now();
+        /** Time InitOpenGL took in milliseconds. */
+        double initTime_ = 0.0;
+        /** The first frame was drawn. */
+        bool firstFrameDrawn_ = false;
+
+        /** Holds the node local settings. */
+        AppSettings settings_;
+        /** Exports the simulation field to shared memory (optional). */
+        std::unique_ptr<exporter::FieldExporter> fieldExporter_;
+
+        /** Size of the simulation textures (the sub-domain plus halo in distributed mode). */
+        glm::uvec2 simulationSize_ = glm::uvec2(SIMULATION_SIZE_X, SIMULATION_SIZE_Y);
+        /** Offset of the simulation textures in the global domain. */
+        glm::uvec2 simulationOffset_ = glm::uvec2(0);
+        /** Size of the global simulation domain. */
+        glm::uvec2 simulationGlobalSize_ = glm::uvec2(SIMULATION_SIZE_X, SIMULATION_SIZE_Y);
+        /** The region of the global domain covered by the simulation textures. */
+        glm::vec4 simulationTextureRegion_ = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
+        /** Holds the domain decomposition (distributed mode only). */
+        std::unique_ptr<distributed::DomainDecomposition> decomposition_;
+        /** Holds the connections to the neighbour nodes (distributed mode only). */
+        std::unique_ptr<distributed::HaloTransport> haloTransport_;
+        /** Exchanges the halos with the neighbour nodes (distributed mode only). */
+        std::unique_ptr<distributed::HaloExchange> haloExchange_;
+        /** Reads and writes the halo strips of the simulation texture (distributed mode only). */
+        std::unique_ptr<distributed::TextureHaloField> haloField_;
+
+        /** Holds the tiled virtual domain simulation (tiled mode only). */
+        std::unique_ptr<simulation::TiledSimulation> tiledSimulation_;
+        /** Number of frames the master polled the tile activity. */
+        std::uint64_t tiledSimulationFrame_ = 0;
+
+        /** Holds the full domain GPU simulation (nullptr in the tiled mode and when simulating on the CPU). */
+        std::unique_ptr<simulation::GPUSimulation> gpuSimulation_;
+        /** Holds the CPU simulation backend (nullptr when simulating on the GPU). */
+        std::unique_ptr<simulation::CPUSimulation> cpuSimulation_;
+        /** Divisor of the resolution of the simulated grid. */
+        int simulationScale_ = 1;
+        /** Holds the coarse grid of the reconstruction comparison (full grid GPU simulation only). */
+        std::unique_ptr<simulation::ComparisonSimulation> comparisonSimulation_;
+        /** Number of iterations contained in the currently displayed field. */
+        std::uint64_t displayedIterationCount_ = 0;
+        /** Measures the input to photon latency. */
+        std::unique_ptr<util::InputLatencyTracker> latencyTracker_;
+
+        /** The renderer and result iteration the shared passes were last run for. */
+        renderers::RDRenderer* sharedPassRenderer_ = nullptr;
+        std::uint64_t sharedPassIteration_ = 0;
+        /** The reconstruction filter, scale and comparison the shared passes were last run with. */
+        int sharedPassReconstructionFilter_ = -1;
+        int sharedPassReconstructionScale_ = -1;
+        bool sharedPassReconstructionComparison_ = false;
+
+        /** Holds the frames rendered while the simulation is idle. */
+        std::unique_ptr<idle::FrameCache> frameCache_;
+        /** Cached frames are reused this frame. */
+        bool reuseFrames_ = false;
+        /** Holds the simulation data the cached frames were rendered with. */
+        SimulationData cachedFrameData_;
+        /** Iteration count of the cached frames. */
+        std::uint64_t cachedFrameIterationCount_ = 0;
+        /** Registers the simulation textures and buffers and the host copies owned by the node. */
+        std::vector<util::TrackedResource> trackedResources_;
+
+        /** Holds the preset list (same on all nodes). */
+        std::vector<PresetEntry> presets_;
 
         /** Holds the simulation plane. */
         SimulationPlane simPlane_;
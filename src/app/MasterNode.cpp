@@ -10,11 +10,67 @@
 #include <imgui.h>
 #include "core/imgui/imgui_impl_glfw_gl3.h"
 #include "renderers/RDRenderer.h"
+#include "app/util/FrameTrace.h"
+#include "app/util/TraceClock.h"
+#include "app/metrics/NodeMetrics.h"
+#include "app/sync/DivergenceCheck.h"
+#include "app/sync/SustainableRate.h"
+#include "app/util/AllocationCheck.h"
+#include "app/util/MemoryMonitor.h"
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include "core/open_gl.h"
 
 namespace viscom {
 
+    namespace {
+        /** Names of the simulation grids (indexed by SimulationData::simulationScale_ - 1). */
+        const char* SIMULATION_GRID_NAMES[] = { "Full", "Half resolution" };
+
+        recording::SessionParameters GetSessionParameters(const SimulationData& simData)
+        {
+            recording::SessionParameters parameters;
+            parameters.drawDistance_ = simData.simulationDrawDistance_;
+            parameters.height_ = simData.simulationHeight_;
+            parameters.eta_ = simData.eta_;
+            for (int i = 0; i < 3; ++i) parameters.sigmaA_[i] = simData.sigma_a_[i];
+            parameters.resetIteration_ = simData.resetFrameIdx_;
+            parameters.warmStartPreset_ = simData.warmStartPreset_;
+            parameters.warmStartIteration_ = simData.warmStartFrameIdx_;
+            parameters.diffusionRateA_ = simData.diffusion_rate_a_;
+            parameters.diffusionRateB_ = simData.diffusion_rate_b_;
+            parameters.feedRate_ = simData.feed_rate_;
+            parameters.killRate_ = simData.kill_rate_;
+            parameters.dt_ = simData.dt_;
+            parameters.seedPointRadius_ = simData.seed_point_radius_;
+            parameters.useManhattanDistance_ = simData.use_manhattan_distance_;
+            parameters.simulationScale_ = simData.simulationScale_;
+            parameters.renderer_ = simData.currentRenderer_;
+            return parameters;
+        }
+
+        void SetSessionParameters(const recording::SessionParameters& parameters, SimulationData& simData)
+        {
+            simData.simulationDrawDistance_ = parameters.drawDistance_;
+            simData.simulationHeight_ = parameters.height_;
+            simData.eta_ = parameters.eta_;
+            simData.sigma_a_ = glm::vec3(parameters.sigmaA_[0], parameters.sigmaA_[1], parameters.sigmaA_[2]);
+            simData.resetFrameIdx_ = static_cast<size_t>(parameters.resetIteration_);
+            simData.warmStartPreset_ = parameters.warmStartPreset_;
+            simData.warmStartFrameIdx_ = parameters.warmStartIteration_;
+            simData.diffusion_rate_a_ = parameters.diffusionRateA_;
+            simData.diffusion_rate_b_ = parameters.diffusionRateB_;
+            simData.feed_rate_ = parameters.feedRate_;
+            simData.kill_rate_ = parameters.killRate_;
+            simData.dt_ = parameters.dt_;
+            simData.seed_point_radius_ = parameters.seedPointRadius_;
+            simData.use_manhattan_distance_ = parameters.useManhattanDistance_;
+            simData.simulationScale_ = parameters.simulationScale_;
+            simData.currentRenderer_ = parameters.renderer_;
+        }
+    }
+
     MasterNode::MasterNode(ApplicationNodeInternal* appNode) :
         ApplicationNodeImplementation{ appNode }
     {
@@ -26,59 +82,405 @@ namespace viscom {
     {
         ApplicationNodeImplementation::InitOpenGL();
 
-        LoadPresetList();
+        UpdatePresetNames();
+        InitSession();
+
+        if (GetAppSettings().idleWhenConverged_) {
+            // the change is measured between the two A/B textures, the in-place mode keeps only one.
+            if (IsFullDomainGPUSimulation() && !GetAppSettings().inPlaceSimulation_) convergenceMonitor_ = std::make_unique<idle::ConvergenceMonitor>(this);
+            else LOG(INFO) << "Idling a converged simulation needs the regular ping-pong GPU simulation, it stays active.";
+        }
+
+        if (GetAppSettings().monitorStreamPort_ != 0) {
+            if (GetTiledSimulation() != nullptr) LOG(WARNING) << "The monitoring stream needs a simulation texture of the whole domain, it is disabled in tiled mode.";
+            else StartMonitorStream();
+        }
+
+        if (GetAppSettings().simulationRate_ > 0.0f) {
+            simulationClock_ = std::make_unique<sync::SimulationClock>(GetAppSettings().simulationRate_, ApplicationNodeImplementation::MAX_FRAME_ITERATIONS,
+                2 * ApplicationNodeImplementation::MAX_FRAME_ITERATIONS);
+        }
 
-        for (const auto& renderer : GetRenderers()) {
-            rendererNames_.push_back(renderer->GetName());
+        // the slaves report divergence, their capacity for the simulation clock and their metrics on the same channel.
+        if (GetDivergenceCheck().IsEnabled() || simulationClock_ || GetAppSettings().metricsAggregateSlaves_) {
+            divergenceReporter_ = std::make_unique<sync::DivergenceReporter>();
+            if (!divergenceReporter_->Listen(GetAppSettings().divergenceReportPort_)) {
+                LOG(WARNING) << "Could not receive node reports on port " << GetAppSettings().divergenceReportPort_ << ".";
+                divergenceReporter_ = nullptr;
+            }
         }
 
-        for (const auto& rName : rendererNames_) {
+        for (const auto& rName : GetRendererNames()) {
             rendererNamesCStr_.push_back(rName.c_str());
         }
     }
 
     void MasterNode::PreSync()
     {
+        VISCOM_TRACE_ZONE("MasterNode::PreSync");
         ApplicationNodeImplementation::PreSync();
 #ifdef VISCOM_USE_SGCT
         sharedData_.setVal(GetSimulationData());
-        sharedSeedPoints_.setVal(GetSeedPoints());
+        syncedSeedPoints_.assign(GetSeedPoints().begin(), GetSeedPoints().end());
+        sharedSeedPoints_.setVal(syncedSeedPoints_);
+        sharedResyncState_.setVal(resyncState_);
+        sharedTileActivity_.setVal(tileActivity_);
+        GetNodeMetrics().CountSyncBytes(sizeof(SimulationData) + syncedSeedPoints_.size() * sizeof(SeedPoint) + resyncState_.size()
+            + tileActivity_.size() * sizeof(std::int32_t) + sizeof(std::uint64_t));
+        resyncState_.clear();
+        tileActivity_.clear();
 
         auto syncPoint = syncedTimestamp_.getVal();
 #else
         auto syncPoint = GetCurrentLocalIterationCount();
 #endif
-        // iterate GetSeedPoints, delete all seed points before syncPoint
-        auto lastDel = GetSeedPoints().begin();
-        for (; lastDel != GetSeedPoints().end() && lastDel->first < syncPoint; ++lastDel);
-        if (lastDel != GetSeedPoints().begin()) {
-            GetSeedPoints().erase(GetSeedPoints().begin(), lastDel);
-        }
+        // delete all seed points before syncPoint (they are ordered by iteration)
+        auto& seedPoints = GetSeedPoints();
+        while (!seedPoints.empty() && seedPoints.front().first < syncPoint) seedPoints.pop_front();
     }
 
     void MasterNode::UpdateFrame(double currentTime, double elapsedTime)
     {
-        auto seedIterationCount = GetSimulationData().currentGlobalIterationCount_ + 1;
-        GetSimulationData().currentGlobalIterationCount_ += ApplicationNodeImplementation::FRAME_ITERATIONS_INC;
-
+        VISCOM_TRACE_ZONE("MasterNode::UpdateFrame");
+        auto& simData = GetSimulationData();
         auto& seed_points = GetSeedPoints();
-        if (currentMouseButton_ == GLFW_MOUSE_BUTTON_1 && currentMouseAction_ == GLFW_PRESS) {
-            //seed_points.emplace_back(seedIterationCount, FindIntersectionWithPlane(GetCamera()->GetPickRay(currentMouseCursorPosition_)));
-            seed_points.emplace_back(seedIterationCount, FindIntersectionWithPlane(currentMouseCursorPosition_));
-        } else if (currentMouseButton_ == GLFW_MOUSE_BUTTON_2 && currentMouseAction_ == GLFW_PRESS) {
-            SimulationData& sim_data = GetSimulationData();
-            sim_data.resetFrameIdx_ = seedIterationCount;
+        const auto frameIteration = simData.currentGlobalIterationCount_;
+        const auto firstNewSeed = seed_points.size();
+
+        divergenceReports_.clear();
+        capacityReports_.clear();
+        metricsReports_.clear();
+        if (divergenceReporter_) divergenceReporter_->Receive(divergenceReports_, capacityReports_, metricsReports_);
+        if (simulationClock_) UpdateSimulationRate();
+        if (!metricsReports_.empty()) UpdateNodeMetrics();
+
+        auto input = false;
+        auto advance = true;
+        if (sessionPlayer_) advance = ReplayFrame(input);
+        else input = (currentMouseAction_ == GLFW_PRESS && (currentMouseButton_ == GLFW_MOUSE_BUTTON_1 || currentMouseButton_ == GLFW_MOUSE_BUTTON_2))
+            || !tuioCursorPositions_.empty();
+        if (simData.simulationIdle_ && (input || SimulationParametersChanged())) {
+            simData.simulationIdle_ = false;
+            steadyChecks_ = 0;
+            LOG(INFO) << "Waking the simulation in iteration " << simData.currentGlobalIterationCount_ << ".";
         }
 
-        for (const auto& tpos : tuioCursorPositions_) {
-            seed_points.emplace_back(seedIterationCount, FindIntersectionWithPlane(GetCamera()->GetPickRay(tpos.second)));
+        // while idle the global iteration count stands still, so all nodes stop and resume at the same iteration.
+        auto frameIterations = ApplicationNodeImplementation::FRAME_ITERATIONS_INC;
+        const auto useClock = simulationClock_ && (!sessionPlayer_ || GetAppSettings().sessionReplayRealTime_);
+        if (useClock && advance && !simData.simulationIdle_) frameIterations = simulationClock_->Advance(std::chrono::steady_clock::now(), frameIteration);
+        else if (useClock) simulationClock_->Pause();
+        if (sessionPlayer_) {
+            // frames end exactly at the recorded iterations, so parameters change at the same iterations as recorded.
+            auto next = sessionPlayer_->Peek();
+            if (next != nullptr && next->iteration_ > frameIteration) frameIterations = std::min(frameIterations, next->iteration_ - frameIteration);
         }
+        if (advance && !simData.simulationIdle_) simData.currentGlobalIterationCount_ += frameIterations;
+
+        // seeds are placed at the iteration of the newest input event (the first of the frame while a button is held).
+        auto seedIterationCount = frameIteration + 1;
+        if (useClock) seedIterationCount = std::max(seedIterationCount, simulationClock_->GetIterationAt(lastInputTime_));
+
+        if (!sessionPlayer_) {
+            if (currentMouseButton_ == GLFW_MOUSE_BUTTON_1 && currentMouseAction_ == GLFW_PRESS) {
+                //seed_points.emplace_back(seedIterationCount, FindIntersectionWithPlane(GetCamera()->GetPickRay(currentMouseCursorPosition_)));
+                seed_points.emplace_back(seedIterationCount, FindIntersectionWithPlane(currentMouseCursorPosition_));
+            } else if (currentMouseButton_ == GLFW_MOUSE_BUTTON_2 && currentMouseAction_ == GLFW_PRESS) {
+                simData.resetFrameIdx_ = seedIterationCount;
+            }
+
+            for (const auto& tpos : tuioCursorPositions_) {
+                seed_points.emplace_back(seedIterationCount, FindIntersectionWithPlane(GetCamera()->GetPickRay(tpos.second)));
+            }
+            // the input time travels with the seed, every node measures its latency from the input on the master.
+            if (seed_points.size() > firstNewSeed) {
+                simData.inputFrameIdx_ = seedIterationCount;
+                simData.inputTraceTime_ = std::chrono::duration_cast<std::chrono::nanoseconds>(lastInputTime_.time_since_epoch()).count();
+            }
+        }
+        if (sessionRecorder_) RecordFrame(frameIteration, firstNewSeed);
 
         ApplicationNodeImplementation::UpdateFrame(currentTime, elapsedTime);
+        // the master alone decides which tiles are active, the slaves apply its report at the same iteration.
+        if (GetTiledSimulation()) PollTileActivity(tileActivity_);
+        if (replayEndIteration_ != 0 && !replayFinished_ && GetCurrentLocalIterationCount() >= replayEndIteration_) FinishReplay();
+        if (GetDivergenceCheck().IsEnabled()) CheckDivergence();
+        if (convergenceMonitor_) UpdateConvergence(input);
+        if (monitorStreamer_ && monitorStreamer_->GetSize() != GetSimulationSize()) StartMonitorStream();
+        if (monitorStreamer_) monitorStreamer_->Update(GetResultTexture(), GetDisplayedIterationCount());
+    }
+
+    void MasterNode::StartMonitorStream()
+    {
+        // the frames have the size of the simulation, clients have to connect again. The old server releases the port first.
+        GetAllocationCheck().AllowFrameAllocations();
+        monitorStreamer_ = nullptr;
+        monitorStreamer_ = std::make_unique<exporter::MonitorStreamer>(GetSimulationSize().x, GetSimulationSize().y, GetAppSettings().monitorStreamRate_);
+        if (!monitorStreamer_->Initialize(static_cast<unsigned short>(GetAppSettings().monitorStreamPort_))) monitorStreamer_ = nullptr;
+    }
+
+    void MasterNode::InitSession()
+    {
+        const auto& settings = GetAppSettings();
+        if (settings.sessionReplayFile_ != "none") {
+            sessionPlayer_ = std::make_unique<recording::SessionPlayer>();
+            if (!sessionPlayer_->Open(settings.sessionReplayFile_)) {
+                LOG(WARNING) << "Could not open session log '" << settings.sessionReplayFile_ << "' for replay.";
+                sessionPlayer_ = nullptr;
+            } else {
+                SetSessionParameters(sessionPlayer_->GetInitialParameters(), GetSimulationData());
+                replayStartTime_ = std::chrono::steady_clock::now();
+                LOG(INFO) << "Replaying session '" << settings.sessionReplayFile_ << "' " << (settings.sessionReplayRealTime_ ? "in real time." : "as fast as possible.");
+            }
+            if (settings.sessionRecordFile_ != "none") LOG(WARNING) << "Sessions are not recorded during a replay.";
+            return;
+        }
+
+        if (settings.sessionRecordFile_ != "none") {
+            recordedParameters_ = GetSessionParameters(GetSimulationData());
+            sessionRecorder_ = std::make_unique<recording::SessionRecorder>();
+            if (!sessionRecorder_->Open(settings.sessionRecordFile_, recordedParameters_)) {
+                LOG(WARNING) << "Could not open session log '" << settings.sessionRecordFile_ << "' for recording.";
+                sessionRecorder_ = nullptr;
+            }
+        }
+    }
+
+    bool MasterNode::ReplayFrame(bool& input)
+    {
+        if (replayFinished_) return false;
+
+        const auto frameIteration = GetSimulationData().currentGlobalIterationCount_;
+        const auto replayTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - replayStartTime_).count();
+        recording::SessionRecord record;
+        for (auto next = sessionPlayer_->Peek(); next != nullptr && next->iteration_ <= frameIteration; next = sessionPlayer_->Peek()) {
+            // the simulation waits at the iteration of a record until its recorded time is reached.
+            if (GetAppSettings().sessionReplayRealTime_ && next->time_ > replayTime) return false;
+            // the end record is not consumed, the replay stops advancing until the final state is compared.
+            if (next->type_ == recording::RecordType::END) {
+                replayEndIteration_ = std::max<std::uint64_t>(next->iteration_, 1);
+                return false;
+            }
+
+            sessionPlayer_->Next(record);
+            switch (record.type_) {
+            case recording::RecordType::SEED:
+                GetSeedPoints().emplace_back(static_cast<size_t>(record.seedIteration_), glm::vec2(record.x_, record.y_));
+                input = true;
+                ++replayedSeeds_;
+                break;
+            case recording::RecordType::PARAMETERS:
+                SetSessionParameters(record.parameters_, GetSimulationData());
+                break;
+            default:
+                // the seed points and parameter records already contain the effect of all input events.
+                ++replayedEvents_;
+                break;
+            }
+        }
+
+        if (sessionPlayer_->Peek() == nullptr && replayEndIteration_ == 0) {
+            LOG(WARNING) << "Session log ended without end record in iteration " << frameIteration << ".";
+            replayEndIteration_ = std::max<std::uint64_t>(frameIteration, 1);
+            return false;
+        }
+        return true;
+    }
+
+    void MasterNode::RecordFrame(std::uint64_t frameIteration, std::size_t firstNewSeed)
+    {
+        // parameters changed in the GUI during the last frame are applied from this frame on.
+        const auto parameters = GetSessionParameters(GetSimulationData());
+        if (parameters != recordedParameters_) {
+            sessionRecorder_->RecordParameters(frameIteration, parameters);
+            recordedParameters_ = parameters;
+        }
+
+        const auto& seedPoints = GetSeedPoints();
+        for (auto i = firstNewSeed; i < seedPoints.size(); ++i) {
+            sessionRecorder_->RecordSeed(frameIteration, seedPoints[i].first, seedPoints[i].second.x, seedPoints[i].second.y);
+        }
+    }
+
+    void MasterNode::FinishReplay()
+    {
+        replayFinished_ = true;
+        const auto replaySeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - replayStartTime_).count();
+        LOG(INFO) << "Replay finished in iteration " << GetCurrentLocalIterationCount() << " after " << replaySeconds << "s ("
+            << static_cast<double>(GetCurrentLocalIterationCount()) / std::max(replaySeconds, 1e-6) << " iterations/s, " << replayedSeeds_
+            << " seed points, " << replayedEvents_ << " input events).";
+        if (GetTiledSimulation()) return;
+
+        std::vector<std::uint8_t> state;
+        simulation::StateSnapshot replayState, recordedState;
+        const auto& replayFile = GetAppSettings().sessionReplayFile_;
+        if (!EncodeCurrentState(state) || !simulation::DecodeStateSnapshot(state.data(), state.size(), replayState)
+            || !simulation::SaveStateSnapshot(replayFile + ".replay.rdss", replayState)) {
+            LOG(WARNING) << "Could not store the final state of the replay.";
+            return;
+        }
+        if (!simulation::LoadStateSnapshot(replayFile + ".final.rdss", recordedState)) {
+            LOG(INFO) << "No recorded final state to compare the replay with.";
+            return;
+        }
+
+        simulation::StateDifference difference;
+        if (recordedState.iteration_ != replayState.iteration_) {
+            LOG(WARNING) << "Recorded final state is from iteration " << recordedState.iteration_ << ", the replay ended in iteration " << replayState.iteration_ << ".";
+        }
+        if (!simulation::CompareStateSnapshots(recordedState, replayState, difference)) {
+            LOG(WARNING) << "Recorded final state (" << recordedState.width_ << "x" << recordedState.height_ << ") does not match the simulation size.";
+        } else if (difference.differingCells_ == 0) {
+            LOG(INFO) << "Final state of the replay matches the recording.";
+        } else {
+            LOG(WARNING) << "Final state of the replay differs from the recording in " << difference.differingCells_ << " cells (max difference "
+                << difference.maxDifference_ << ").";
+        }
+    }
+
+    bool MasterNode::SimulationParametersChanged() const
+    {
+        const auto& simData = GetSimulationData();
+        return simData.diffusion_rate_a_ != idleSimulationData_.diffusion_rate_a_ || simData.diffusion_rate_b_ != idleSimulationData_.diffusion_rate_b_
+            || simData.feed_rate_ != idleSimulationData_.feed_rate_ || simData.kill_rate_ != idleSimulationData_.kill_rate_
+            || simData.dt_ != idleSimulationData_.dt_ || simData.resetFrameIdx_ != idleSimulationData_.resetFrameIdx_
+            || simData.warmStartFrameIdx_ != idleSimulationData_.warmStartFrameIdx_ || simData.resyncFrameIdx_ != idleSimulationData_.resyncFrameIdx_
+            || simData.simulationScale_ != idleSimulationData_.simulationScale_;
+    }
+
+    void MasterNode::UpdateNodeMetrics()
+    {
+        struct NodeMetricField {
+            const char* name_;
+            const char* help_;
+            double metrics::NodeMetricsSnapshot::* value_;
+        };
+        static const NodeMetricField NODE_METRIC_FIELDS[NodeMetrics::NUM_FIELDS] = {
+            { "rd_node_iterations_per_second", "Simulation iterations computed per second by a slave.", &metrics::NodeMetricsSnapshot::iterationsPerSecond_ },
+            { "rd_node_iteration_lag", "Global iteration count minus the iteration displayed by a slave.", &metrics::NodeMetricsSnapshot::iterationLag_ },
+            { "rd_node_simulation_gpu_milliseconds", "GPU time of the simulation per frame of a slave.", &metrics::NodeMetricsSnapshot::simulationGPUTime_ },
+            { "rd_node_shared_pass_gpu_milliseconds", "GPU time of the shared passes per frame of a slave.", &metrics::NodeMetricsSnapshot::sharedPassGPUTime_ },
+            { "rd_node_view_gpu_milliseconds", "GPU time of all windows and eyes per frame of a slave.", &metrics::NodeMetricsSnapshot::viewGPUTime_ },
+            { "rd_node_seed_points_per_frame", "Seed points applied per frame by a slave.", &metrics::NodeMetricsSnapshot::seedPointsPerFrame_ },
+            { "rd_node_sync_bytes_per_second", "Bytes received by the synchronization per second of a slave.", &metrics::NodeMetricsSnapshot::syncBytesPerSecond_ },
+            { "rd_node_frame_time_p50_milliseconds", "Median frame time of a slave.", &metrics::NodeMetricsSnapshot::frameTimeP50_ },
+            { "rd_node_frame_time_p95_milliseconds", "95th percentile of the frame time of a slave.", &metrics::NodeMetricsSnapshot::frameTimeP95_ },
+            { "rd_node_frame_time_p99_milliseconds", "99th percentile of the frame time of a slave.", &metrics::NodeMetricsSnapshot::frameTimeP99_ },
+            { "rd_node_gpu_memory_bytes", "Tracked textures, renderbuffers and buffers of a slave.", &metrics::NodeMetricsSnapshot::gpuMemoryBytes_ },
+            { "rd_node_host_memory_bytes", "Tracked host allocations of a slave.", &metrics::NodeMetricsSnapshot::hostMemoryBytes_ }
+        };
+        static_assert(sizeof(metrics::NodeMetricsSnapshot) == NodeMetrics::NUM_FIELDS * sizeof(double), "Every field of the snapshot needs a gauge.");
+
+        for (const auto& report : metricsReports_) {
+            auto node = std::find_if(nodeMetrics_.begin(), nodeMetrics_.end(), [&report](const NodeMetrics& n) { return n.node_ == report.node_; });
+            if (node == nodeMetrics_.end()) {
+                // the gauges of a slave are added when it reports for the first time.
+                node = nodeMetrics_.insert(nodeMetrics_.end(), NodeMetrics{ report.node_, {} });
+                for (std::size_t i = 0; i < NodeMetrics::NUM_FIELDS; ++i) {
+                    node->gauges_[i] = &GetNodeMetrics().GetRegistry().AddGauge(NODE_METRIC_FIELDS[i].name_, NODE_METRIC_FIELDS[i].help_, metrics::MetricLabel("node", report.node_));
+                }
+                LOG(INFO) << "Aggregating the metrics of node '" << report.node_ << "'.";
+            }
+            for (std::size_t i = 0; i < NodeMetrics::NUM_FIELDS; ++i) node->gauges_[i]->Set(report.metrics_.*NODE_METRIC_FIELDS[i].value_);
+        }
+    }
+
+    void MasterNode::UpdateConvergence(bool input)
+    {
+        auto& simData = GetSimulationData();
+        const auto iteration = GetCurrentLocalIterationCount();
+        if (iteration != lastMonitoredIteration_ && convergenceMonitor_->Compute(GetCurrentABTexture(), GetPreviousABTexture(), iteration)) {
+            lastMonitoredIteration_ = iteration;
+        }
+
+        idle::ChangeStatistics statistics;
+        while (convergenceMonitor_->Poll(statistics)) {
+            const auto threshold = GetAppSettings().idleChangeThreshold_;
+            const auto steady = statistics.maxDeltaA_ < threshold && statistics.maxDeltaB_ < threshold && statistics.coverage_ == lastStatistics_.coverage_;
+            steadyChecks_ = steady ? steadyChecks_ + 1 : 0;
+            lastStatistics_ = statistics;
+        }
+
+        const auto viewProjection = GetCamera()->GetViewPerspectiveMatrix();
+        const auto cameraStatic = viewProjection == lastViewProjection_;
+        lastViewProjection_ = viewProjection;
+        if (simData.simulationIdle_ || steadyChecks_ < GetAppSettings().idleSteadyChecks_ || input || !cameraStatic) return;
+
+        // everything scheduled has to be simulated before idling.
+        if (iteration != simData.currentGlobalIterationCount_ || simData.resetFrameIdx_ >= iteration || simData.warmStartFrameIdx_ >= iteration
+            || simData.resyncFrameIdx_ >= iteration) return;
+        for (const auto& seedPoint : GetSeedPoints()) {
+            if (seedPoint.first >= iteration) return;
+        }
+
+        simData.simulationIdle_ = true;
+        idleSimulationData_ = simData;
+        LOG(INFO) << "Simulation converged in iteration " << iteration << " (max |dA| " << lastStatistics_.maxDeltaA_ << ", max |dB| "
+            << lastStatistics_.maxDeltaB_ << ", B coverage " << lastStatistics_.coverage_ << " cells), idling.";
+    }
+
+    void MasterNode::CheckDivergence()
+    {
+        auto& simData = GetSimulationData();
+        if (!GetDivergenceCheck().GetStateHashes().empty()) {
+            simData.referenceHashIteration_ = GetDivergenceCheck().GetStateHashes().back().first;
+            simData.referenceHash_ = GetDivergenceCheck().GetStateHashes().back().second;
+        }
+
+        auto resyncNeeded = false;
+        for (const auto& report : divergenceReports_) {
+            // reports of states before the last resync are outdated.
+            if (report.iteration_ <= lastResyncIteration_) continue;
+            LOG(WARNING) << "Simulation state of node '" << report.node_ << "' diverged in iteration " << report.iteration_ << " (hash " << std::hex
+                << report.hash_ << ", master " << report.referenceHash_ << std::dec << ").";
+            resyncNeeded = true;
+        }
+        if (resyncNeeded && GetAppSettings().fixedPointSimulation_) {
+            LOG(WARNING) << "Fixed point states cannot drift apart, a diverged node missed input or runs with other settings (e.g. floating point).";
+        }
+
+        if (resyncNeeded && GetAppSettings().divergenceAutoResync_ && EncodeCurrentState(resyncState_)) {
+            lastResyncIteration_ = GetCurrentLocalIterationCount();
+            simData.resyncFrameIdx_ = lastResyncIteration_;
+            LOG(INFO) << "Resynchronizing all nodes to the master state of iteration " << lastResyncIteration_ << " (" << resyncState_.size() << " bytes).";
+        }
+    }
+
+    void MasterNode::UpdateSimulationRate()
+    {
+        const auto now = std::chrono::steady_clock::now();
+        for (const auto& report : capacityReports_) {
+            auto capacity = std::find_if(nodeCapacities_.begin(), nodeCapacities_.end(), [&report](const NodeCapacity& c) { return c.node_ == report.node_; });
+            if (capacity == nodeCapacities_.end()) capacity = nodeCapacities_.insert(nodeCapacities_.end(), NodeCapacity{ report.node_, 0.0, now });
+            capacity->iterationsPerSecond_ = report.iterationsPerSecond_;
+            capacity->time_ = now;
+        }
+
+        // nodes that stopped reporting no longer limit the rate.
+        auto rate = static_cast<double>(GetAppSettings().simulationRate_);
+        std::string limitingNode;
+        const auto sustainableRate = GetSustainableRate().GetRate();
+        if (sustainableRate > 0.0 && sustainableRate < rate) {
+            rate = sustainableRate;
+            limitingNode = "master";
+        }
+        for (const auto& capacity : nodeCapacities_) {
+            if (now - capacity.time_ > CAPACITY_TIMEOUT || capacity.iterationsPerSecond_ <= 0.0 || capacity.iterationsPerSecond_ >= rate) continue;
+            rate = capacity.iterationsPerSecond_;
+            limitingNode = capacity.node_;
+        }
+
+        if (std::abs(rate - reportedRate_) > 0.1 * reportedRate_) {
+            if (limitingNode.empty()) LOG(INFO) << "Simulating at the target rate of " << rate << " iterations/s.";
+            else LOG(INFO) << "Simulation rate limited to " << rate << " iterations/s by node '" << limitingNode << "' (target " << GetAppSettings().simulationRate_ << ").";
+            reportedRate_ = rate;
+        }
+        simulationClock_->SetRate(rate);
     }
 
     void MasterNode::Draw2D(FrameBuffer& fbo)
     {
+        VISCOM_TRACE_ZONE("MasterNode::Draw2D");
         fbo.DrawToFBO([this]() {
             ImGui::SetNextWindowSize(ImVec2(480.0f, 200.0f), ImGuiSetCond_FirstUseEver);
             ImGui::SetNextWindowPos(ImVec2(1920.0f - 480.0f - 10.0f, 1080.0f - 200.0f - 10.0f), ImGuiSetCond_FirstUseEver);
@@ -86,7 +488,7 @@ namespace viscom {
             {
                 SimulationData& simData = GetSimulationData();
 
-                if (presetNames_.size() > 1) {
+                if (GetPresets().size() > 1) {
                     int selectedPreset = 0;
                     if (ImGui::Combo("Select Preset", &selectedPreset, presetNamesCStr_.data(), static_cast<int>(presetNamesCStr_.size()))) LoadPreset(selectedPreset);
                 }
@@ -95,6 +497,8 @@ namespace viscom {
                 ImGui::InputText("Preset Name", presetName.data(), static_cast<int>(presetName.size()));
                 if (ImGui::Button("Save Preset")) SavePreset(presetName.c_str());
 
+                if (simulationClock_) ImGui::Text("Simulation rate: %.0f iterations/s (target %.0f)", simulationClock_->GetRate(), GetAppSettings().simulationRate_);
+
                 ImGui::Combo("Select Renderer", &simData.currentRenderer_, rendererNamesCStr_.data(), static_cast<int>(rendererNamesCStr_.size()));
 
                 if (ImGui::TreeNode("Plane Parameters")) {
@@ -103,7 +507,8 @@ namespace viscom {
                 }
 
                 if (ImGui::TreeNode("Rendering Parameters")) {
-                    GetRenderers()[simData.currentRenderer_]->DrawOptionsGUI(simData);
+                    // a newly selected renderer is created in the next UpdateFrame.
+                    if (auto renderer = GetRenderer(simData.currentRenderer_)) renderer->DrawOptionsGUI(simData);
                     ImGui::TreePop();
                 }
 
@@ -115,6 +520,24 @@ namespace viscom {
                     ImGui::SliderFloat("Dt", &simData.dt_, 0.0f, 5.0f);
                     ImGui::SliderFloat("Seed Point Radius", &simData.seed_point_radius_, 0.01f, 1.0f);
                     ImGui::Checkbox("Use Manhattan Distance", &simData.use_manhattan_distance_);
+                    if (CanScaleSimulation()) {
+                        // the state changes its size, all nodes start over in the same iteration.
+                        auto grid = simData.simulationScale_ - 1;
+                        if (ImGui::Combo("Simulation Grid", &grid, SIMULATION_GRID_NAMES, MAX_SIMULATION_SCALE)) {
+                            simData.simulationScale_ = grid + 1;
+                            simData.resetFrameIdx_ = static_cast<size_t>(simData.currentGlobalIterationCount_);
+                        }
+                    }
+                    ImGui::TreePop();
+                }
+
+                if (ImGui::TreeNode("Memory")) {
+                    GetMemoryMonitor().DrawGUI();
+                    // slaves report their totals with the metrics (metricsAggregateSlaves).
+                    for (const auto& node : nodeMetrics_) {
+                        ImGui::Text("%s: GPU %.1f MB, host %.1f MB", node.node_.c_str(), node.gauges_[NodeMetrics::GPU_MEMORY_FIELD]->GetValue() / (1024.0 * 1024.0),
+                            node.gauges_[NodeMetrics::HOST_MEMORY_FIELD]->GetValue() / (1024.0 * 1024.0));
+                    }
                     ImGui::TreePop();
                 }
             }
@@ -129,6 +552,8 @@ namespace viscom {
         if (!ApplicationNodeImplementation::MouseButtonCallback(button, action)) {
             currentMouseAction_ = action;
             currentMouseButton_ = button;
+            lastInputTime_ = std::chrono::steady_clock::now();
+            if (sessionRecorder_) sessionRecorder_->RecordMouseButton(GetSimulationData().currentGlobalIterationCount_, button, action);
         }
         return true;
     }
@@ -137,6 +562,11 @@ namespace viscom {
     {
         if (!ApplicationNodeImplementation::MousePosCallback(x, y)) {
             currentMouseCursorPosition_ = glm::vec2{x, y};
+            lastInputTime_ = std::chrono::steady_clock::now();
+            // only positions while a button is pressed create seed points.
+            if (sessionRecorder_ && currentMouseAction_ == GLFW_PRESS) {
+                sessionRecorder_->RecordMousePosition(GetSimulationData().currentGlobalIterationCount_, currentMouseCursorPosition_.x, currentMouseCursorPosition_.y);
+            }
         }
         return true;
     }
@@ -144,6 +574,8 @@ namespace viscom {
 #ifdef WITH_TUIO
     bool MasterNode::AddTuioCursor(TUIO::TuioCursor* tcur)
     {
+        lastInputTime_ = std::chrono::steady_clock::now();
+        if (sessionRecorder_) sessionRecorder_->RecordTuio(recording::RecordType::TUIO_ADD, GetSimulationData().currentGlobalIterationCount_, tcur->getCursorID(), tcur->getX(), tcur->getY());
         for (auto& tuioCursorPosition : tuioCursorPositions_) {
             if (tuioCursorPosition.first == tcur->getCursorID()) {
                 LOG(WARNING) << "TUIO cursor (" << tcur->getCursorID() << ") added while already present.";
@@ -158,6 +590,8 @@ namespace viscom {
 
     bool MasterNode::UpdateTuioCursor(TUIO::TuioCursor* tcur)
     {
+        lastInputTime_ = std::chrono::steady_clock::now();
+        if (sessionRecorder_) sessionRecorder_->RecordTuio(recording::RecordType::TUIO_UPDATE, GetSimulationData().currentGlobalIterationCount_, tcur->getCursorID(), tcur->getX(), tcur->getY());
         for (auto& tuioCursorPosition : tuioCursorPositions_) {
             if (tuioCursorPosition.first == tcur->getCursorID()) {
                 tuioCursorPosition.second = glm::vec2(tcur->getX(), tcur->getY());
@@ -171,6 +605,8 @@ namespace viscom {
 
     bool MasterNode::RemoveTuioCursor(TUIO::TuioCursor* tcur)
     {
+        lastInputTime_ = std::chrono::steady_clock::now();
+        if (sessionRecorder_) sessionRecorder_->RecordTuio(recording::RecordType::TUIO_REMOVE, GetSimulationData().currentGlobalIterationCount_, tcur->getCursorID(), tcur->getX(), tcur->getY());
         int localId = -1;
         for (int i = 0; i < tuioCursorPositions_.size(); ++i) {
             if (tuioCursorPositions_[i].first == tcur->getCursorID()) {
@@ -193,44 +629,31 @@ namespace viscom {
 #ifdef VISCOM_USE_SGCT
     void MasterNode::EncodeData()
     {
+        VISCOM_TRACE_ZONE("MasterNode::EncodeData");
         ApplicationNodeImplementation::EncodeData();
         sgct::SharedData::instance()->writeObj(&sharedData_);
         sgct::SharedData::instance()->writeVector(&sharedSeedPoints_);
+        sgct::SharedData::instance()->writeVector(&sharedResyncState_);
+        sgct::SharedData::instance()->writeVector(&sharedTileActivity_);
         syncedTimestamp_.setVal(sharedData_.getVal().currentGlobalIterationCount_);
     }
 
     void MasterNode::DecodeData()
     {
+        VISCOM_TRACE_ZONE("MasterNode::DecodeData");
         ApplicationNodeImplementation::DecodeData();
         sgct::SharedData::instance()->readObj(&sharedData_);
         sgct::SharedData::instance()->readVector(&sharedSeedPoints_);
+        sgct::SharedData::instance()->readVector(&sharedResyncState_);
+        sgct::SharedData::instance()->readVector(&sharedTileActivity_);
     }
 #endif
 
-    void MasterNode::LoadPresetList()
-    {
-        presetNames_.emplace_back("None", "");
-
-        std::string presetListFile = GetConfig().resourceSearchPaths_.back() + "/presetList.txt";
-        if (!utils::file_exists(presetListFile)) return;
-
-        std::ifstream ifs(presetListFile);
-        std::string str;
-        while (ifs >> str && ifs.good()) {
-            std::string presetName = str;
-            std::string presetFile;
-            ifs >> presetFile;
-            presetNames_.emplace_back(presetName, presetFile);
-        }
-
-        UpdatePresetNames();
-    }
-
     void MasterNode::UpdatePresetNames()
     {
         presetNamesCStr_.clear();
-        for (const auto& pName : presetNames_) {
-            presetNamesCStr_.push_back(pName.first.c_str());
+        for (const auto& preset : GetPresets()) {
+            presetNamesCStr_.push_back(preset.name_.c_str());
         }
     }
 
@@ -238,7 +661,7 @@ namespace viscom {
     {
         if (preset == 0) return;
 
-        std::string presetFile = GetConfig().resourceSearchPaths_.back() + "/" + presetNames_[preset].second;
+        std::string presetFile = GetConfig().resourceSearchPaths_.back() + "/" + GetPresets()[preset].file_;
         if (!utils::file_exists(presetFile)) return;
 
         std::ifstream ifs(presetFile);
@@ -260,6 +683,11 @@ namespace viscom {
             else if (str == "use_manhattan_distance=") ifs >> GetSimulationData().use_manhattan_distance_;
             else if (str == "currentRenderer=") ifs >> GetSimulationData().currentRenderer_;
         }
+
+        if (!GetPresets()[preset].snapshotFile_.empty()) {
+            GetSimulationData().warmStartPreset_ = preset;
+            GetSimulationData().warmStartFrameIdx_ = GetSimulationData().currentGlobalIterationCount_ + ApplicationNodeImplementation::WARM_START_DELAY;
+        }
     }
 
     void MasterNode::SavePreset(const std::string& presetName)
@@ -282,7 +710,7 @@ namespace viscom {
         ofs << "use_manhattan_distance= " << GetSimulationData().use_manhattan_distance_ << std::endl;
         ofs << "currentRenderer= " << GetSimulationData().currentRenderer_ << std::endl;
 
-        presetNames_.emplace_back(presetName, presetName + ".pst");
+        GetPresets().emplace_back(presetName, presetName + ".txt");
         UpdatePresetNames();
 
         std::string presetListFile = GetConfig().resourceSearchPaths_.back() + "/presetList.txt";
@@ -309,6 +737,33 @@ namespace viscom {
         return glm::vec2(0.5f) + glm::vec2(intersection.y, intersection.z) / 2.0f;
     }
 
+    void MasterNode::CleanUp()
+    {
+        if (monitorStreamer_) {
+            LOG(INFO) << "Sent " << monitorStreamer_->GetServer().GetFramesSent() << " monitoring frames (" << monitorStreamer_->GetServer().GetBytesSent() / 1024
+                << "KB).";
+            monitorStreamer_ = nullptr;
+        }
+        if (sessionRecorder_) {
+            // the final state next to the log is what a replay of this session is compared with.
+            const auto finalIteration = GetCurrentLocalIterationCount();
+            std::vector<std::uint8_t> state;
+            if (!GetTiledSimulation() && EncodeCurrentState(state)) {
+                std::ofstream ofs(GetAppSettings().sessionRecordFile_ + ".final.rdss", std::ofstream::binary | std::ofstream::trunc);
+                ofs.write(reinterpret_cast<const char*>(state.data()), static_cast<std::streamsize>(state.size()));
+                if (!ofs.good()) LOG(WARNING) << "Could not store the final state of the session.";
+            }
+            sessionRecorder_->Close(finalIteration);
+            LOG(INFO) << "Recorded " << sessionRecorder_->GetNumRecords() << " records up to iteration " << finalIteration << " to '"
+                << GetAppSettings().sessionRecordFile_ << "'.";
+            sessionRecorder_ = nullptr;
+        }
+        sessionPlayer_ = nullptr;
+        GetTraceClock().WriteTrace("master");
+
+        ApplicationNodeImplementation::CleanUp();
+    }
+
     void MasterNode::DrawFrame(FrameBuffer& fbo)
     {
         ApplicationNodeImplementation::DrawFrame(fbo);
@@ -9,6 +9,12 @@
 #pragma once
 
 #include "../app/ApplicationNodeImplementation.h"
+#include "app/sync/DivergenceReporter.h"
+#include "app/sync/SimulationClock.h"
+#include "app/export/MonitorStreamer.h"
+#include "app/idle/ConvergenceMonitor.h"
+#include "app/recording/SessionLog.h"
+#include <chrono>
 #ifdef WITH_TUIO
 #include "core/TuioInputWrapper.h"
 #endif
@@ -31,6 +37,7 @@ namespace viscom {
         virtual bool MousePosCallback(double x, double y) override;
 
         virtual void DrawFrame(FrameBuffer& fbo) override;
+        virtual void CleanUp() override;
 
 
 #ifdef WITH_TUIO
@@ -53,8 +60,101 @@ namespace viscom {
         sgct::SharedObject<SimulationData> sharedData_;
         sgct::SharedVector<SeedPoint> sharedSeedPoints_;
         sgct::SharedUInt64 syncedTimestamp_;
+        /** Holds the seed points copied for synchronization (kept to reuse its memory). */
+        std::vector<SeedPoint> syncedSeedPoints_;
+        /** Holds the encoded state sent to the slaves for a resync (only in the frame it is needed). */
+        sgct::SharedVector<std::uint8_t> sharedResyncState_;
+        /** Holds the tile activity report sent to the slaves (only in the frame after it finished). */
+        sgct::SharedVector<std::int32_t> sharedTileActivity_;
 #endif
 
+        void InitSession();
+        bool ReplayFrame(bool& input);
+        void RecordFrame(std::uint64_t frameIteration, std::size_t firstNewSeed);
+        void FinishReplay();
+
+        /** Records the input of this session (nullptr if not recording). */
+        std::unique_ptr<recording::SessionRecorder> sessionRecorder_;
+        /** The parameters written to the session log last. */
+        recording::SessionParameters recordedParameters_;
+        /** Replays a recorded session instead of live input (nullptr if not replaying). */
+        std::unique_ptr<recording::SessionPlayer> sessionPlayer_;
+        /** Start of the replay. */
+        std::chrono::steady_clock::time_point replayStartTime_;
+        /** Iteration the replayed session ended with (0 until the end record is reached). */
+        std::uint64_t replayEndIteration_ = 0;
+        /** The final state of the replay was compared. */
+        bool replayFinished_ = false;
+        /** Number of replayed input events and seed points. */
+        std::uint64_t replayedEvents_ = 0;
+        std::uint64_t replayedSeeds_ = 0;
+
+        void CheckDivergence();
+        void UpdateSimulationRate();
+        bool SimulationParametersChanged() const;
+        void UpdateConvergence(bool input);
+        /** Sets the gauges of the slaves that reported metrics this frame. */
+        void UpdateNodeMetrics();
+
+        /** Starts (or restarts for another simulation size) the stream of the result to remote monitoring clients. */
+        void StartMonitorStream();
+        /** Streams the result to remote monitoring clients (optional). */
+        std::unique_ptr<exporter::MonitorStreamer> monitorStreamer_;
+        /** Computes the change statistics for the idle detection. */
+        std::unique_ptr<idle::ConvergenceMonitor> convergenceMonitor_;
+        /** Number of consecutive converged statistics. */
+        unsigned int steadyChecks_ = 0;
+        /** Holds the last change statistics. */
+        idle::ChangeStatistics lastStatistics_;
+        /** Iteration the last statistics were requested for. */
+        std::uint64_t lastMonitoredIteration_ = 0;
+        /** View projection of the master in the last frame. */
+        glm::mat4 lastViewProjection_;
+        /** Simulation data when the simulation went idle. */
+        SimulationData idleSimulationData_;
+
+        /** Receives the divergence, capacity and metrics reports of the slaves. */
+        std::unique_ptr<sync::DivergenceReporter> divergenceReporter_;
+        /** Holds the reports received this frame. */
+        std::vector<sync::DivergenceReport> divergenceReports_;
+        std::vector<sync::CapacityReport> capacityReports_;
+        std::vector<sync::MetricsReport> metricsReports_;
+        /** Holds the encoded state for the next resync. */
+        std::vector<std::uint8_t> resyncState_;
+        /** Holds the newest tile activity report (tiled mode only). */
+        std::vector<std::int32_t> tileActivity_;
+        /** Iteration of the last resync. */
+        std::uint64_t lastResyncIteration_ = 0;
+
+        struct NodeCapacity {
+            std::string node_;
+            double iterationsPerSecond_;
+            std::chrono::steady_clock::time_point time_;
+        };
+
+        /** Advances the global iteration count with the wall clock (nullptr for a fixed increment per frame). */
+        std::unique_ptr<sync::SimulationClock> simulationClock_;
+        /** Holds the newest capacity reported by each slave. */
+        std::vector<NodeCapacity> nodeCapacities_;
+        /** The simulation rate logged last. */
+        double reportedRate_ = 0.0;
+        /** Capacity reports older than this are ignored. */
+        static constexpr std::chrono::seconds CAPACITY_TIMEOUT{ 5 };
+        struct NodeMetrics {
+            static constexpr std::size_t NUM_FIELDS = 12;
+            /** Fields of the memory gauges (shown in the GUI). */
+            static constexpr std::size_t GPU_MEMORY_FIELD = 10;
+            static constexpr std::size_t HOST_MEMORY_FIELD = 11;
+            std::string node_;
+            /** The gauges of the fields of NodeMetricsSnapshot (owned by the registry). */
+            std::array<metrics::Gauge*, NUM_FIELDS> gauges_;
+        };
+
+        /** Holds the gauges of each slave that reported metrics. */
+        std::vector<NodeMetrics> nodeMetrics_;
+        /** Time of the newest mouse or TUIO event. */
+        std::chrono::steady_clock::time_point lastInputTime_;
+
         /** store mouse button state */
         int currentMouseAction_ = -1;
         int currentMouseButton_ = -1;
@@ -63,17 +163,12 @@ namespace viscom {
         /** Store tuio cursor positions. */
         std::vector<std::pair<int, glm::vec2>> tuioCursorPositions_;
 
-        void LoadPresetList();
         void UpdatePresetNames();
         void LoadPreset(int preset);
         void SavePreset(const std::string& presetName);
 
-        /** The list of preset names. */
-        std::vector<std::pair<std::string, std::string>> presetNames_;
         /** The list of preset names (as c strings for imgui). */
         std::vector<const char*> presetNamesCStr_;
-        /** The list of renderer names. */
-        std::vector<std::string> rendererNames_;
         /** The list of renderer names (as c strings for imgui). */
         std::vector<const char*> rendererNamesCStr_;
     };
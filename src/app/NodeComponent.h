@@ -0,0 +1,42 @@
+/**
+ * @file   NodeComponent.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the interface of the features owned by the application node.
+ */
+
+#pragma once
+
+namespace viscom {
+
+    class ApplicationNodeImplementation;
+
+    /**
+     *  A feature of the application node that keeps its own state (allocation check, metrics, ...). The node creates
+     *  its components in its constructor, initializes them in order at the end of InitOpenGL, updates them in order at
+     *  the start of UpdateFrame and cleans them up in reverse order in CleanUp.
+     */
+    class NodeComponent
+    {
+    public:
+        explicit NodeComponent(ApplicationNodeImplementation* appNode) : appNode_{ appNode } {}
+        NodeComponent(const NodeComponent&) = delete;
+        NodeComponent& operator=(const NodeComponent&) = delete;
+        virtual ~NodeComponent() = default;
+
+        /** Called once the node is set up (settings loaded, simulation created, GL context current). */
+        virtual void Init() {}
+        /** Called once per frame before the simulation and the renderer are updated. */
+        virtual void UpdateFrame() {}
+        /** Called before the node releases its resources (GL context current). */
+        virtual void CleanUp() {}
+
+    protected:
+        ApplicationNodeImplementation* GetAppNode() const { return appNode_; }
+
+    private:
+        /** The node owning this component. */
+        ApplicationNodeImplementation* appNode_;
+    };
+}
@@ -0,0 +1,32 @@
+/**
+ * @file   Presets.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the preset list.
+ */
+
+#include "Presets.h"
+#include <fstream>
+#include <sstream>
+
+namespace viscom {
+
+    std::vector<PresetEntry> LoadPresetList(const std::string& presetListFile)
+    {
+        std::vector<PresetEntry> presets;
+        presets.emplace_back("None", "");
+
+        std::ifstream ifs(presetListFile);
+        std::string line;
+        while (std::getline(ifs, line)) {
+            std::istringstream lineStream(line);
+            std::string presetName, presetFile, snapshotFile;
+            if (!(lineStream >> presetName >> presetFile)) continue;
+            lineStream >> snapshotFile;
+            presets.emplace_back(presetName, presetFile, snapshotFile);
+        }
+
+        return presets;
+    }
+}
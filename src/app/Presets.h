@@ -0,0 +1,33 @@
+/**
+ * @file   Presets.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the preset list.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace viscom {
+
+    struct PresetEntry {
+        PresetEntry(const std::string& name, const std::string& file, const std::string& snapshotFile = "") :
+            name_{ name }, file_{ file }, snapshotFile_{ snapshotFile } {}
+
+        /** The name of the preset. */
+        std::string name_;
+        /** The file holding the preset parameters. */
+        std::string file_;
+        /** The (optional) state snapshot file used to warm start the simulation. */
+        std::string snapshotFile_;
+    };
+
+    /**
+     *  Loads the preset list, each line holds "name file [snapshotFile]".
+     *  The first entry of the returned list is always the "None" preset.
+     */
+    std::vector<PresetEntry> LoadPresetList(const std::string& presetListFile);
+}
@@ -8,6 +8,11 @@
 
 #include "SlaveNode.h"
 #include <imgui.h>
+#include "app/metrics/NodeMetrics.h"
+#include "app/sync/DivergenceCheck.h"
+#include "app/sync/SustainableRate.h"
+#include "app/util/FrameTrace.h"
+#include "app/util/TraceClock.h"
 #include "core/open_gl.h"
 
 namespace viscom {
@@ -19,6 +24,20 @@ namespace viscom {
 
     SlaveNode::~SlaveNode() = default;
 
+    void SlaveNode::InitOpenGL()
+    {
+        SlaveNodeInternal::InitOpenGL();
+
+        // the master also limits its simulation clock by the capacity reported on this channel and aggregates the metrics.
+        if (GetDivergenceCheck().IsEnabled() || GetAppSettings().simulationRate_ > 0.0f || GetAppSettings().metricsAggregateSlaves_) {
+            divergenceReporter_ = std::make_unique<sync::DivergenceReporter>();
+            if (!divergenceReporter_->Connect(GetAppSettings().divergenceMasterAddress_, GetAppSettings().divergenceReportPort_)) {
+                LOG(WARNING) << "Could not open the report channel to '" << GetAppSettings().divergenceMasterAddress_ << "'.";
+                divergenceReporter_ = nullptr;
+            }
+        }
+    }
+
     void SlaveNode::Draw2D(FrameBuffer& fbo)
     {
         // always do this call last!
@@ -27,34 +46,88 @@ namespace viscom {
 
     void SlaveNode::UpdateSyncedInfo()
     {
+        VISCOM_TRACE_ZONE("SlaveNode::UpdateSyncedInfo");
         SlaveNodeInternal::UpdateSyncedInfo();
 #ifdef VISCOM_USE_SGCT
         GetSimulationData() = sharedData_.getVal();
-        auto tmpSeedPoints = sharedSeedPoints_.getVal();
-        for (const auto& tsp : tmpSeedPoints) GetSeedPoints().push_back(tsp);
+        // element wise access avoids copying the shared vectors every frame.
+        for (std::size_t i = 0; i < sharedSeedPoints_.getSize(); ++i) GetSeedPoints().push_back(sharedSeedPoints_.getValAt(i));
+        if (sharedResyncState_.getSize() > 0) GetDivergenceCheck().SetResyncState(sharedResyncState_.getVal());
+        if (sharedTileActivity_.getSize() > 0 && GetTiledSimulation()) {
+            const auto tileActivity = sharedTileActivity_.getVal();
+            QueueTileActivity(tileActivity.data(), tileActivity.size());
+        }
+        GetNodeMetrics().CountSyncBytes(sizeof(SimulationData) + sharedSeedPoints_.getSize() * sizeof(SeedPoint) + sharedResyncState_.getSize()
+            + sharedTileActivity_.getSize() * sizeof(std::int32_t));
 #endif
+        if (GetDivergenceCheck().IsEnabled()) CheckDivergence();
+        if (divergenceReporter_ && GetAppSettings().simulationRate_ > 0.0f) SendCapacity();
+        if (divergenceReporter_ && GetAppSettings().metricsAggregateSlaves_) SendMetrics();
+
+        // delete all seed points before current time (they are ordered by iteration)
+        auto& seedPoints = GetSeedPoints();
+        while (!seedPoints.empty() && seedPoints.front().first < GetCurrentLocalIterationCount()) seedPoints.pop_front();
+    }
 
-        // iterate GetSeedPoints, delete all seed points before current time
-        auto lastDel = GetSeedPoints().begin();
-        for (; lastDel != GetSeedPoints().end() && lastDel->first < GetCurrentLocalIterationCount(); ++lastDel);
-        if (lastDel != GetSeedPoints().begin()) {
-            GetSeedPoints().erase(GetSeedPoints().begin(), lastDel);
+    void SlaveNode::CleanUp()
+    {
+        GetTraceClock().WriteTrace("slave");
+        SlaveNodeInternal::CleanUp();
+    }
+
+    void SlaveNode::CheckDivergence()
+    {
+        const auto& simData = GetSimulationData();
+        if (simData.referenceHashIteration_ <= lastComparedHashIteration_) return;
+
+        // the own hash of the iteration may not be finished yet, then it is compared in a later frame.
+        for (const auto& hash : GetDivergenceCheck().GetStateHashes()) {
+            if (hash.first != simData.referenceHashIteration_) continue;
+            lastComparedHashIteration_ = hash.first;
+            if (hash.second != simData.referenceHash_) {
+                LOG(WARNING) << "Simulation state diverged from the master in iteration " << hash.first << " (hash " << std::hex << hash.second
+                    << ", master " << simData.referenceHash_ << std::dec << ").";
+                if (divergenceReporter_) divergenceReporter_->Send(hash.first, hash.second, simData.referenceHash_);
+            }
+            break;
         }
     }
 
+    void SlaveNode::SendCapacity()
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (GetSustainableRate().GetRate() <= 0.0 || now - lastCapacitySent_ < CAPACITY_INTERVAL) return;
+        divergenceReporter_->SendCapacity(GetSustainableRate().GetRate());
+        lastCapacitySent_ = now;
+    }
+
+    void SlaveNode::SendMetrics()
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (now - lastMetricsSent_ < METRICS_INTERVAL) return;
+        divergenceReporter_->SendMetrics(GetNodeMetrics().GetSnapshot());
+        lastMetricsSent_ = now;
+    }
+
 #ifdef VISCOM_USE_SGCT
     void SlaveNode::EncodeData()
     {
+        VISCOM_TRACE_ZONE("SlaveNode::EncodeData");
         SlaveNodeInternal::EncodeData();
         sgct::SharedData::instance()->writeObj(&sharedData_);
         sgct::SharedData::instance()->writeVector(&sharedSeedPoints_);
+        sgct::SharedData::instance()->writeVector(&sharedResyncState_);
+        sgct::SharedData::instance()->writeVector(&sharedTileActivity_);
     }
 
     void SlaveNode::DecodeData()
     {
+        VISCOM_TRACE_ZONE("SlaveNode::DecodeData");
         SlaveNodeInternal::DecodeData();
         sgct::SharedData::instance()->readObj(&sharedData_);
         sgct::SharedData::instance()->readVector(&sharedSeedPoints_);
+        sgct::SharedData::instance()->readVector(&sharedResyncState_);
+        sgct::SharedData::instance()->readVector(&sharedTileActivity_);
     }
 #endif
 }
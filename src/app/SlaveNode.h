@@ -9,6 +9,8 @@
 #pragma once
 
 #include "core/SlaveNodeHelper.h"
+#include "app/sync/DivergenceReporter.h"
+#include <chrono>
 
 namespace viscom {
 
@@ -18,8 +20,10 @@ namespace viscom {
         explicit SlaveNode(ApplicationNodeInternal* appNode);
         virtual ~SlaveNode() override;
 
+        virtual void InitOpenGL() override;
         void Draw2D(FrameBuffer& fbo) override;
         virtual void UpdateSyncedInfo() override;
+        virtual void CleanUp() override;
 
 #ifdef VISCOM_USE_SGCT
         virtual void EncodeData() override;
@@ -29,6 +33,28 @@ namespace viscom {
         /** Holds the data shared by the master. */
         sgct::SharedObject<SimulationData> sharedData_;
         sgct::SharedVector<SeedPoint> sharedSeedPoints_;
+        /** Holds the state sent by the master for a resync. */
+        sgct::SharedVector<std::uint8_t> sharedResyncState_;
+        /** Holds the tile activity report of the master. */
+        sgct::SharedVector<std::int32_t> sharedTileActivity_;
 #endif
+
+    private:
+        void CheckDivergence();
+        void SendCapacity();
+        void SendMetrics();
+
+        /** Reports divergence, capacity and metrics to the master. */
+        std::unique_ptr<sync::DivergenceReporter> divergenceReporter_;
+        /** Iteration of the newest reference hash compared. */
+        std::uint64_t lastComparedHashIteration_ = 0;
+        /** Time the capacity was last sent to the master. */
+        std::chrono::steady_clock::time_point lastCapacitySent_;
+        /** The interval between capacity reports. */
+        static constexpr std::chrono::seconds CAPACITY_INTERVAL{ 1 };
+        /** Time the metrics were last sent to the master. */
+        std::chrono::steady_clock::time_point lastMetricsSent_;
+        /** The interval between metrics reports. */
+        static constexpr std::chrono::seconds METRICS_INTERVAL{ 1 };
     };
 }
@@ -0,0 +1,82 @@
+/**
+ * @file   DomainDecomposition.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the decomposition of the simulation domain into per node sub-rectangles.
+ */
+
+#include "DomainDecomposition.h"
+#include <algorithm>
+
+namespace viscom::distributed {
+
+    DomainDecomposition::DomainDecomposition(unsigned int globalWidth, unsigned int globalHeight, unsigned int tilesX, unsigned int tilesY, unsigned int nodeIndex, unsigned int haloWidth) :
+        globalWidth_{ globalWidth },
+        globalHeight_{ globalHeight },
+        tilesX_{ std::max(tilesX, 1U) },
+        tilesY_{ std::max(tilesY, 1U) },
+        nodeIndex_{ nodeIndex },
+        haloWidth_{ haloWidth }
+    {
+        interior_ = ComputeInterior(globalWidth_, globalHeight_, tilesX_, tilesY_, nodeIndex_);
+
+        const auto tileX = nodeIndex_ % tilesX_;
+        const auto tileY = nodeIndex_ / tilesX_;
+        neighbours_[static_cast<std::size_t>(Neighbour::LEFT)] = tileX > 0 ? static_cast<int>(nodeIndex_ - 1) : -1;
+        neighbours_[static_cast<std::size_t>(Neighbour::RIGHT)] = tileX + 1 < tilesX_ ? static_cast<int>(nodeIndex_ + 1) : -1;
+        neighbours_[static_cast<std::size_t>(Neighbour::DOWN)] = tileY > 0 ? static_cast<int>(nodeIndex_ - tilesX_) : -1;
+        neighbours_[static_cast<std::size_t>(Neighbour::UP)] = tileY + 1 < tilesY_ ? static_cast<int>(nodeIndex_ + tilesX_) : -1;
+
+        const auto left = GetNeighbourIndex(Neighbour::LEFT) != -1 ? haloWidth_ : 0;
+        const auto right = GetNeighbourIndex(Neighbour::RIGHT) != -1 ? haloWidth_ : 0;
+        const auto down = GetNeighbourIndex(Neighbour::DOWN) != -1 ? haloWidth_ : 0;
+        const auto up = GetNeighbourIndex(Neighbour::UP) != -1 ? haloWidth_ : 0;
+        extended_.x_ = interior_.x_ - left;
+        extended_.y_ = interior_.y_ - down;
+        extended_.width_ = interior_.width_ + left + right;
+        extended_.height_ = interior_.height_ + down + up;
+    }
+
+    DomainRect DomainDecomposition::ComputeInterior(unsigned int globalWidth, unsigned int globalHeight, unsigned int tilesX, unsigned int tilesY, unsigned int nodeIndex)
+    {
+        const auto tileX = nodeIndex % tilesX;
+        const auto tileY = nodeIndex / tilesX;
+        DomainRect interior;
+        interior.x_ = tileX * globalWidth / tilesX;
+        interior.y_ = tileY * globalHeight / tilesY;
+        interior.width_ = (tileX + 1) * globalWidth / tilesX - interior.x_;
+        interior.height_ = (tileY + 1) * globalHeight / tilesY - interior.y_;
+        return interior;
+    }
+
+    DomainRect DomainDecomposition::GetLocalInterior() const
+    {
+        return DomainRect{ interior_.x_ - extended_.x_, interior_.y_ - extended_.y_, interior_.width_, interior_.height_ };
+    }
+
+    DomainRect DomainDecomposition::GetSendRect(Neighbour neighbour) const
+    {
+        const auto local = GetLocalInterior();
+        switch (neighbour) {
+        case Neighbour::LEFT: return DomainRect{ local.x_, local.y_, haloWidth_, local.height_ };
+        case Neighbour::RIGHT: return DomainRect{ local.x_ + local.width_ - haloWidth_, local.y_, haloWidth_, local.height_ };
+        // the second phase sends whole rows, including the halo columns received in the first phase.
+        case Neighbour::DOWN: return DomainRect{ 0, local.y_, extended_.width_, haloWidth_ };
+        case Neighbour::UP: return DomainRect{ 0, local.y_ + local.height_ - haloWidth_, extended_.width_, haloWidth_ };
+        }
+        return DomainRect{};
+    }
+
+    DomainRect DomainDecomposition::GetReceiveRect(Neighbour neighbour) const
+    {
+        const auto local = GetLocalInterior();
+        switch (neighbour) {
+        case Neighbour::LEFT: return DomainRect{ 0, local.y_, haloWidth_, local.height_ };
+        case Neighbour::RIGHT: return DomainRect{ local.x_ + local.width_, local.y_, haloWidth_, local.height_ };
+        case Neighbour::DOWN: return DomainRect{ 0, 0, extended_.width_, haloWidth_ };
+        case Neighbour::UP: return DomainRect{ 0, local.y_ + local.height_, extended_.width_, haloWidth_ };
+        }
+        return DomainRect{};
+    }
+}
@@ -0,0 +1,79 @@
+/**
+ * @file   DomainDecomposition.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the decomposition of the simulation domain into per node sub-rectangles.
+ */
+
+#pragma once
+
+#include <array>
+
+namespace viscom::distributed {
+
+    /** A rectangle of simulation cells. */
+    struct DomainRect {
+        unsigned int x_ = 0;
+        unsigned int y_ = 0;
+        unsigned int width_ = 0;
+        unsigned int height_ = 0;
+    };
+
+    /** The neighbours of a node, exchanged in two phases (left/right, then down/up including the corners). */
+    enum class Neighbour { LEFT = 0, RIGHT = 1, DOWN = 2, UP = 3 };
+
+    /**
+     *  Splits the global domain into tilesX * tilesY sub-rectangles, one per node.
+     *  Each node stores its interior plus a halo of haloWidth cells. Halo cells are simulated redundantly, so after an
+     *  exchange a node can do haloWidth iterations before its interior depends on stale values.
+     *  All rectangles returned by the Get...Rect methods are relative to the extended (interior + halo) rectangle.
+     */
+    class DomainDecomposition
+    {
+    public:
+        DomainDecomposition(unsigned int globalWidth, unsigned int globalHeight, unsigned int tilesX, unsigned int tilesY, unsigned int nodeIndex, unsigned int haloWidth);
+
+        unsigned int GetGlobalWidth() const { return globalWidth_; }
+        unsigned int GetGlobalHeight() const { return globalHeight_; }
+        unsigned int GetNodeIndex() const { return nodeIndex_; }
+        unsigned int GetNumNodes() const { return tilesX_ * tilesY_; }
+        unsigned int GetHaloWidth() const { return haloWidth_; }
+        /** The cells owned by this node (global coordinates). */
+        const DomainRect& GetInterior() const { return interior_; }
+        /** The cells stored by this node (global coordinates). */
+        const DomainRect& GetExtended() const { return extended_; }
+        /** The cells owned by this node relative to the extended rectangle. */
+        DomainRect GetLocalInterior() const;
+
+        /** Returns the node index of the neighbour or -1 at the border of the global domain. */
+        int GetNeighbourIndex(Neighbour neighbour) const { return neighbours_[static_cast<std::size_t>(neighbour)]; }
+        /** The cells the neighbour needs from this node. */
+        DomainRect GetSendRect(Neighbour neighbour) const;
+        /** The halo cells the neighbour sends to this node. */
+        DomainRect GetReceiveRect(Neighbour neighbour) const;
+
+        /** Computes the interior of any node. */
+        static DomainRect ComputeInterior(unsigned int globalWidth, unsigned int globalHeight, unsigned int tilesX, unsigned int tilesY, unsigned int nodeIndex);
+
+    private:
+        /** Holds the global domain width. */
+        unsigned int globalWidth_;
+        /** Holds the global domain height. */
+        unsigned int globalHeight_;
+        /** Holds the number of nodes in x direction. */
+        unsigned int tilesX_;
+        /** Holds the number of nodes in y direction. */
+        unsigned int tilesY_;
+        /** Holds the index of this node. */
+        unsigned int nodeIndex_;
+        /** Holds the halo width. */
+        unsigned int haloWidth_;
+        /** Holds the interior. */
+        DomainRect interior_;
+        /** Holds the interior plus halo. */
+        DomainRect extended_;
+        /** Holds the neighbour indices. */
+        std::array<int, 4> neighbours_;
+    };
+}
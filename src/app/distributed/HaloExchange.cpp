@@ -0,0 +1,105 @@
+/**
+ * @file   HaloExchange.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the halo exchange of a node local simulation field.
+ */
+
+#include "HaloExchange.h"
+#include <algorithm>
+
+namespace viscom::distributed {
+
+    HaloExchange::HaloExchange(const DomainDecomposition& decomposition, HaloTransport& transport) :
+        decomposition_{ decomposition },
+        transport_{ transport }
+    {
+        InitPhase(phases_[0], Neighbour::LEFT, Neighbour::RIGHT);
+        InitPhase(phases_[1], Neighbour::DOWN, Neighbour::UP);
+    }
+
+    bool HaloExchange::Exchange(std::uint64_t iteration, HaloField& field, unsigned int timeoutMilliseconds)
+    {
+        for (auto& phase : phases_) {
+            if (!ExchangePhase(iteration, field, phase, timeoutMilliseconds)) return false;
+        }
+        return true;
+    }
+
+    bool HaloExchange::Exchange(std::uint64_t iteration, float* field, unsigned int timeoutMilliseconds)
+    {
+        HostHaloField hostField{ field, decomposition_.GetExtended().width_ };
+        return Exchange(iteration, hostField, timeoutMilliseconds);
+    }
+
+    std::size_t HaloExchange::GetMaxStripSize() const
+    {
+        std::size_t maxSize = 0;
+        for (auto neighbour : { Neighbour::LEFT, Neighbour::RIGHT, Neighbour::DOWN, Neighbour::UP }) {
+            if (decomposition_.GetNeighbourIndex(neighbour) == -1) continue;
+            const auto rect = decomposition_.GetSendRect(neighbour);
+            maxSize = std::max(maxSize, 2 * static_cast<std::size_t>(rect.width_) * rect.height_);
+        }
+        return maxSize;
+    }
+
+    void HaloExchange::InitPhase(Phase& phase, Neighbour first, Neighbour second) const
+    {
+        for (auto neighbour : { first, second }) {
+            auto node = decomposition_.GetNeighbourIndex(neighbour);
+            if (node == -1) continue;
+
+            const auto sendRect = decomposition_.GetSendRect(neighbour);
+            const auto receiveRect = decomposition_.GetReceiveRect(neighbour);
+            phase.send_.emplace_back();
+            phase.send_.back().node_ = node;
+            phase.send_.back().data_.resize(2 * static_cast<std::size_t>(sendRect.width_) * sendRect.height_);
+            phase.receive_.emplace_back();
+            phase.receive_.back().node_ = node;
+            phase.receive_.back().data_.resize(2 * static_cast<std::size_t>(receiveRect.width_) * receiveRect.height_);
+            phase.neighbours_.push_back(neighbour);
+        }
+    }
+
+    bool HaloExchange::ExchangePhase(std::uint64_t iteration, HaloField& field, Phase& phase, unsigned int timeoutMilliseconds)
+    {
+        if (phase.send_.empty()) return true;
+
+        // all strips of the phase are read before the first one is needed, a GPU field waits only once.
+        for (std::size_t i = 0; i < phase.send_.size(); ++i) field.ReadRect(decomposition_.GetSendRect(phase.neighbours_[i]), phase.send_[i].data_);
+        field.FinishReads();
+
+        if (!transport_.Exchange(iteration, phase.send_, phase.receive_, timeoutMilliseconds)) return false;
+
+        for (std::size_t i = 0; i < phase.receive_.size(); ++i) field.WriteRect(decomposition_.GetReceiveRect(phase.neighbours_[i]), phase.receive_[i].data_);
+        return true;
+    }
+
+    void HostHaloField::ReadRect(const DomainRect& rect, std::vector<float>& data)
+    {
+        HaloExchange::ExtractRect(field_, fieldWidth_, rect, data);
+    }
+
+    void HostHaloField::WriteRect(const DomainRect& rect, const std::vector<float>& data)
+    {
+        HaloExchange::InsertRect(field_, fieldWidth_, rect, data);
+    }
+
+    void HaloExchange::ExtractRect(const float* field, unsigned int fieldWidth, const DomainRect& rect, std::vector<float>& data)
+    {
+        data.resize(2 * static_cast<std::size_t>(rect.width_) * rect.height_);
+        for (unsigned int y = 0; y < rect.height_; ++y) {
+            auto src = field + 2 * (static_cast<std::size_t>(rect.y_ + y) * fieldWidth + rect.x_);
+            std::copy(src, src + 2 * rect.width_, data.data() + 2 * static_cast<std::size_t>(y) * rect.width_);
+        }
+    }
+
+    void HaloExchange::InsertRect(float* field, unsigned int fieldWidth, const DomainRect& rect, const std::vector<float>& data)
+    {
+        for (unsigned int y = 0; y < rect.height_; ++y) {
+            auto src = data.data() + 2 * static_cast<std::size_t>(y) * rect.width_;
+            std::copy(src, src + 2 * rect.width_, field + 2 * (static_cast<std::size_t>(rect.y_ + y) * fieldWidth + rect.x_));
+        }
+    }
+}
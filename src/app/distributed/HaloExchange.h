@@ -0,0 +1,91 @@
+/**
+ * @file   HaloExchange.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the halo exchange of a node local simulation field.
+ */
+
+#pragma once
+
+#include "DomainDecomposition.h"
+#include "HaloTransport.h"
+#include <array>
+
+namespace viscom::distributed {
+
+    /**
+     *  Access to the strips of a field covering the extended rectangle of a node (interleaved A/B, row 0 at the bottom).
+     *  The exchange only touches the strips, so the field can stay on the GPU.
+     */
+    class HaloField
+    {
+    public:
+        virtual ~HaloField() = default;
+        /** Starts reading a rectangle into data (sized by the caller), the data is valid after FinishReads. */
+        virtual void ReadRect(const DomainRect& rect, std::vector<float>& data) = 0;
+        /** Completes all reads started since the last call. */
+        virtual void FinishReads() {}
+        /** Writes data into a rectangle. */
+        virtual void WriteRect(const DomainRect& rect, const std::vector<float>& data) = 0;
+    };
+
+    /** A field in host memory. */
+    class HostHaloField : public HaloField
+    {
+    public:
+        HostHaloField(float* field, unsigned int fieldWidth) : field_{ field }, fieldWidth_{ fieldWidth } {}
+
+        void ReadRect(const DomainRect& rect, std::vector<float>& data) override;
+        void WriteRect(const DomainRect& rect, const std::vector<float>& data) override;
+
+    private:
+        /** Holds the field. */
+        float* field_;
+        /** Holds the width of the field. */
+        unsigned int fieldWidth_;
+    };
+
+    /**
+     *  Exchanges the halo strips of a field with the neighbour nodes.
+     *  Left/right strips are exchanged first, then down/up strips spanning the whole extended width so the corners are
+     *  filled without talking to diagonal neighbours.
+     */
+    class HaloExchange
+    {
+    public:
+        HaloExchange(const DomainDecomposition& decomposition, HaloTransport& transport);
+
+        bool Exchange(std::uint64_t iteration, HaloField& field, unsigned int timeoutMilliseconds);
+        /** Exchanges the halos of a field in host memory. */
+        bool Exchange(std::uint64_t iteration, float* field, unsigned int timeoutMilliseconds);
+        /** Size of the largest strip in floats, read back buffers for a GPU field need two of them. */
+        std::size_t GetMaxStripSize() const;
+
+        /** Copies a rectangle of the field to a dense buffer. */
+        static void ExtractRect(const float* field, unsigned int fieldWidth, const DomainRect& rect, std::vector<float>& data);
+        /** Copies a dense buffer into a rectangle of the field. */
+        static void InsertRect(float* field, unsigned int fieldWidth, const DomainRect& rect, const std::vector<float>& data);
+
+    private:
+        /** The strips of one phase, the neighbours of a phase never change, so the buffers are reused. */
+        struct Phase {
+            /** Holds the buffers of outgoing strips. */
+            std::vector<HaloTransport::Transfer> send_;
+            /** Holds the buffers of incoming strips. */
+            std::vector<HaloTransport::Transfer> receive_;
+            /** Holds the neighbours of the strips. */
+            std::vector<Neighbour> neighbours_;
+        };
+
+        void InitPhase(Phase& phase, Neighbour first, Neighbour second) const;
+        bool ExchangePhase(std::uint64_t iteration, HaloField& field, Phase& phase, unsigned int timeoutMilliseconds);
+
+        /** Holds the decomposition. */
+        const DomainDecomposition& decomposition_;
+        /** Holds the transport. */
+        HaloTransport& transport_;
+        /** Holds the left/right and the down/up phase. */
+        std::array<Phase, 2> phases_;
+    };
+}
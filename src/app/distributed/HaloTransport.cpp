@@ -0,0 +1,175 @@
+/**
+ * @file   HaloTransport.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the socket transport exchanging halo strips between neighbouring nodes.
+ */
+
+#include "HaloTransport.h"
+#include "app/util/Socket.h"
+#include <chrono>
+
+namespace viscom::distributed {
+
+    using util::ToSocket;
+
+    namespace {
+        /** Header in front of every strip. */
+        struct StripHeader {
+            std::uint64_t iteration_;
+            std::uint32_t node_;
+            std::uint32_t count_;
+        };
+
+        /** State of one direction of one connection during an exchange. */
+        struct PendingTransfer {
+            socket_t socket_;
+            StripHeader header_;
+            char* data_;
+            std::size_t size_;
+            std::size_t offset_ = 0;
+        };
+    }
+
+    HaloTransport::HaloTransport(unsigned int nodeIndex, const std::vector<std::string>& nodeAddresses, unsigned short basePort) :
+        nodeIndex_{ nodeIndex },
+        nodeAddresses_{ nodeAddresses },
+        basePort_{ basePort }
+    {
+        util::StartSockets();
+    }
+
+    HaloTransport::~HaloTransport()
+    {
+        CloseAll();
+        util::StopSockets();
+    }
+
+    void HaloTransport::CloseAll()
+    {
+        for (auto& connection : connections_) util::CloseSocket(connection.second);
+        connections_.clear();
+        util::CloseSocket(listenSocket_);
+    }
+
+    bool HaloTransport::Connect(const DomainDecomposition& decomposition, unsigned int timeoutMilliseconds)
+    {
+        CloseAll();
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMilliseconds);
+
+        std::vector<int> lowerNeighbours;
+        std::size_t numHigherNeighbours = 0;
+        for (auto n : { Neighbour::LEFT, Neighbour::RIGHT, Neighbour::DOWN, Neighbour::UP }) {
+            auto neighbour = decomposition.GetNeighbourIndex(n);
+            if (neighbour == -1) continue;
+            if (neighbour < static_cast<int>(nodeIndex_)) lowerNeighbours.push_back(neighbour);
+            else ++numHigherNeighbours;
+        }
+
+        if (numHigherNeighbours > 0) {
+            auto listenSocket = util::ListenTCP(std::string(), static_cast<unsigned short>(basePort_ + nodeIndex_));
+            if (listenSocket == VISCOM_INVALID_SOCKET) return false;
+            listenSocket_ = static_cast<std::intptr_t>(listenSocket);
+        }
+
+        for (auto neighbour : lowerNeighbours) {
+            auto s = util::ConnectTCP(nodeAddresses_[neighbour], static_cast<unsigned short>(basePort_ + neighbour), deadline);
+            std::uint32_t ownIndex = nodeIndex_;
+            if (s == VISCOM_INVALID_SOCKET || !util::SendAll(s, &ownIndex, sizeof(ownIndex))) {
+                if (s != VISCOM_INVALID_SOCKET) VISCOM_CLOSE_SOCKET(s);
+                CloseAll();
+                return false;
+            }
+            connections_[neighbour] = static_cast<std::intptr_t>(s);
+        }
+
+        for (std::size_t i = 0; i < numHigherNeighbours; ++i) {
+            pollfd listenPoll{ ToSocket(listenSocket_), POLLIN, 0 };
+            auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+            if (remaining <= 0 || VISCOM_POLL(&listenPoll, 1, static_cast<int>(remaining)) <= 0) {
+                CloseAll();
+                return false;
+            }
+
+            auto s = util::AcceptSocket(ToSocket(listenSocket_));
+            std::uint32_t neighbourIndex = 0;
+            if (s == VISCOM_INVALID_SOCKET || !util::ReceiveAll(s, &neighbourIndex, sizeof(neighbourIndex))) {
+                if (s != VISCOM_INVALID_SOCKET) VISCOM_CLOSE_SOCKET(s);
+                CloseAll();
+                return false;
+            }
+            connections_[static_cast<int>(neighbourIndex)] = static_cast<std::intptr_t>(s);
+        }
+
+        for (const auto& connection : connections_) {
+            util::SetNonBlocking(ToSocket(connection.second));
+            util::SetNoDelay(ToSocket(connection.second));
+        }
+        return true;
+    }
+
+    bool HaloTransport::Exchange(std::uint64_t iteration, const std::vector<Transfer>& send, std::vector<Transfer>& receive, unsigned int timeoutMilliseconds)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMilliseconds);
+
+        std::vector<PendingTransfer> sends;
+        std::vector<PendingTransfer> receives;
+        for (const auto& transfer : send) {
+            auto connection = connections_.find(transfer.node_);
+            if (connection == connections_.end()) return false;
+            StripHeader header{ iteration, nodeIndex_, static_cast<std::uint32_t>(transfer.data_.size()) };
+            sends.push_back(PendingTransfer{ ToSocket(connection->second), header, const_cast<char*>(reinterpret_cast<const char*>(transfer.data_.data())), transfer.data_.size() * sizeof(float) });
+        }
+        for (auto& transfer : receive) {
+            auto connection = connections_.find(transfer.node_);
+            if (connection == connections_.end()) return false;
+            receives.push_back(PendingTransfer{ ToSocket(connection->second), StripHeader{}, reinterpret_cast<char*>(transfer.data_.data()), transfer.data_.size() * sizeof(float) });
+        }
+
+        // header and data are handled as one contiguous stream per transfer.
+        auto progress = [](PendingTransfer& transfer, bool sending) {
+            const auto totalSize = sizeof(StripHeader) + transfer.size_;
+            while (transfer.offset_ < totalSize) {
+                const auto inHeader = transfer.offset_ < sizeof(StripHeader);
+                auto buffer = inHeader ? reinterpret_cast<char*>(&transfer.header_) + transfer.offset_ : transfer.data_ + (transfer.offset_ - sizeof(StripHeader));
+                auto chunk = inHeader ? sizeof(StripHeader) - transfer.offset_ : totalSize - transfer.offset_;
+                auto result = sending ? util::SendSome(transfer.socket_, buffer, chunk) : util::ReceiveSome(transfer.socket_, buffer, chunk);
+                if (result > 0) transfer.offset_ += static_cast<std::size_t>(result);
+                else if (result < 0 && util::WouldBlock()) return true;
+                else return false;
+            }
+            return true;
+        };
+        auto done = [](const PendingTransfer& transfer) { return transfer.offset_ == sizeof(StripHeader) + transfer.size_; };
+
+        for (;;) {
+            std::vector<pollfd> polls;
+            std::vector<std::pair<PendingTransfer*, bool>> pollTransfers;
+            for (auto& transfer : sends) if (!done(transfer)) {
+                polls.push_back(pollfd{ transfer.socket_, POLLOUT, 0 });
+                pollTransfers.emplace_back(&transfer, true);
+            }
+            for (auto& transfer : receives) if (!done(transfer)) {
+                polls.push_back(pollfd{ transfer.socket_, POLLIN, 0 });
+                pollTransfers.emplace_back(&transfer, false);
+            }
+            if (polls.empty()) break;
+
+            auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+            if (remaining <= 0 || VISCOM_POLL(polls.data(), static_cast<unsigned int>(polls.size()), static_cast<int>(remaining)) < 0) return false;
+            for (std::size_t i = 0; i < polls.size(); ++i) {
+                if (polls[i].revents == 0) continue;
+                if ((polls[i].revents & (POLLERR | POLLNVAL)) != 0) return false;
+                if (!progress(*pollTransfers[i].first, pollTransfers[i].second)) return false;
+            }
+        }
+
+        for (std::size_t i = 0; i < receives.size(); ++i) {
+            const auto& header = receives[i].header_;
+            if (header.iteration_ != iteration || header.node_ != static_cast<std::uint32_t>(receive[i].node_) || header.count_ != receive[i].data_.size()) return false;
+        }
+        for (const auto& transfer : sends) bytesSent_ += sizeof(StripHeader) + transfer.size_;
+        return true;
+    }
+}
@@ -0,0 +1,67 @@
+/**
+ * @file   HaloTransport.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the socket transport exchanging halo strips between neighbouring nodes.
+ */
+
+#pragma once
+
+#include "DomainDecomposition.h"
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace viscom::distributed {
+
+    /**
+     *  TCP connections to the direct neighbours of a node. Node i listens on basePort + i, connections are opened by the
+     *  node with the higher index. All transfers of an exchange run interleaved on non-blocking sockets, so large strips
+     *  cannot dead lock on full socket buffers.
+     */
+    class HaloTransport
+    {
+    public:
+        /** A strip sent to or received from a neighbour. */
+        struct Transfer {
+            /** The node index of the neighbour. */
+            int node_ = -1;
+            /** The data of the strip (interleaved A/B). */
+            std::vector<float> data_;
+        };
+
+        HaloTransport(unsigned int nodeIndex, const std::vector<std::string>& nodeAddresses, unsigned short basePort);
+        HaloTransport(const HaloTransport&) = delete;
+        HaloTransport& operator=(const HaloTransport&) = delete;
+        ~HaloTransport();
+
+        /** Opens the connections to all neighbours of the decomposition. */
+        bool Connect(const DomainDecomposition& decomposition, unsigned int timeoutMilliseconds);
+        /**
+         *  Sends all strips and receives the strips from the neighbours in the receive list (data_ must be sized).
+         *  The iteration is used to detect nodes that are out of step.
+         */
+        bool Exchange(std::uint64_t iteration, const std::vector<Transfer>& send, std::vector<Transfer>& receive, unsigned int timeoutMilliseconds);
+
+        /** Number of bytes sent so far. */
+        std::uint64_t GetBytesSent() const { return bytesSent_; }
+
+    private:
+        void CloseAll();
+
+        /** Holds the index of this node. */
+        unsigned int nodeIndex_;
+        /** Holds the addresses of all nodes. */
+        std::vector<std::string> nodeAddresses_;
+        /** Holds the port of node 0. */
+        unsigned short basePort_;
+        /** Holds the connected sockets by neighbour index. */
+        std::map<int, std::intptr_t> connections_;
+        /** Holds the listening socket. */
+        std::intptr_t listenSocket_ = -1;
+        /** Number of bytes sent so far. */
+        std::uint64_t bytesSent_ = 0;
+    };
+}
@@ -0,0 +1,68 @@
+/**
+ * @file   TextureHaloField.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the halo exchange access to the strips of the simulation texture.
+ */
+
+#include "TextureHaloField.h"
+#include "core/open_gl.h"
+#include <cstring>
+
+namespace viscom::distributed {
+
+    TextureHaloField::TextureHaloField(std::size_t maxStripSize) :
+        pboSize_{ MAX_PENDING_READS * maxStripSize * sizeof(float) },
+        memory_{ util::ResourceType::Buffer, "HaloExchange", "strip read back", MAX_PENDING_READS * maxStripSize * sizeof(float) }
+    {
+        glCreateBuffers(1, &pbo_);
+        glNamedBufferData(pbo_, static_cast<GLsizeiptr>(pboSize_), nullptr, GL_STREAM_READ);
+    }
+
+    TextureHaloField::~TextureHaloField()
+    {
+        if (pbo_ != 0) glDeleteBuffers(1, &pbo_);
+        pbo_ = 0;
+    }
+
+    void TextureHaloField::ReadRect(const DomainRect& rect, std::vector<float>& data)
+    {
+        const auto offset = numPendingReads_ == 0 ? std::size_t{ 0 } : pendingReads_[numPendingReads_ - 1].first + pendingReads_[numPendingReads_ - 1].second->size() * sizeof(float);
+        const auto size = data.size() * sizeof(float);
+        if (numPendingReads_ == MAX_PENDING_READS || offset + size > pboSize_) {
+            LOG(WARNING) << "Halo strip does not fit into the read back buffer.";
+            return;
+        }
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, pbo_);
+        glPixelStorei(GL_PACK_ALIGNMENT, 4);
+        glGetTextureSubImage(texture_, 0, static_cast<GLint>(rect.x_), static_cast<GLint>(rect.y_), 0, static_cast<GLsizei>(rect.width_),
+            static_cast<GLsizei>(rect.height_), 1, GL_RG, GL_FLOAT, static_cast<GLsizei>(size), reinterpret_cast<void*>(offset));
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        pendingReads_[numPendingReads_++] = std::make_pair(offset, &data);
+    }
+
+    void TextureHaloField::FinishReads()
+    {
+        if (numPendingReads_ == 0) return;
+        // the strips are sent right away, so this is the one wait of the phase (for the strips only).
+        const auto& last = pendingReads_[numPendingReads_ - 1];
+        const auto mappedSize = last.first + last.second->size() * sizeof(float);
+        auto src = static_cast<const std::uint8_t*>(glMapNamedBufferRange(pbo_, 0, static_cast<GLsizeiptr>(mappedSize), GL_MAP_READ_BIT));
+        if (src != nullptr) {
+            for (std::size_t i = 0; i < numPendingReads_; ++i) {
+                std::memcpy(pendingReads_[i].second->data(), src + pendingReads_[i].first, pendingReads_[i].second->size() * sizeof(float));
+            }
+            glUnmapNamedBuffer(pbo_);
+        } else LOG(WARNING) << "Could not map the halo read back buffer.";
+        numPendingReads_ = 0;
+    }
+
+    void TextureHaloField::WriteRect(const DomainRect& rect, const std::vector<float>& data)
+    {
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glTextureSubImage2D(texture_, 0, static_cast<GLint>(rect.x_), static_cast<GLint>(rect.y_), static_cast<GLsizei>(rect.width_),
+            static_cast<GLsizei>(rect.height_), GL_RG, GL_FLOAT, data.data());
+    }
+}
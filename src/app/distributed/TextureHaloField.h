@@ -0,0 +1,56 @@
+/**
+ * @file   TextureHaloField.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the halo exchange access to the strips of the simulation texture.
+ */
+
+#pragma once
+
+#include "core/main.h"
+#include "HaloExchange.h"
+#include "app/util/ResourceRegistry.h"
+#include <array>
+#include <utility>
+
+namespace viscom::distributed {
+
+    /**
+     *  Reads the send strips of an RG32F texture into one pixel buffer and writes the received strips back with
+     *  glTextureSubImage2D. Only the strips cross the bus, the rest of the field stays on the GPU.
+     */
+    class TextureHaloField : public HaloField
+    {
+    public:
+        /** maxStripSize is the size of the largest strip in floats (HaloExchange::GetMaxStripSize). */
+        explicit TextureHaloField(std::size_t maxStripSize);
+        TextureHaloField(const TextureHaloField&) = delete;
+        TextureHaloField& operator=(const TextureHaloField&) = delete;
+        ~TextureHaloField() override;
+
+        /** Sets the texture the next exchange uses (the current A/B texture). */
+        void SetTexture(GLuint texture) { texture_ = texture; }
+
+        void ReadRect(const DomainRect& rect, std::vector<float>& data) override;
+        void FinishReads() override;
+        void WriteRect(const DomainRect& rect, const std::vector<float>& data) override;
+
+    private:
+        /** Number of strips per exchange phase. */
+        static constexpr std::size_t MAX_PENDING_READS = 2;
+
+        /** Holds the texture. */
+        GLuint texture_ = 0;
+        /** Holds the pixel buffer the strips are read into. */
+        GLuint pbo_ = 0;
+        /** Holds the size of the pixel buffer in bytes. */
+        std::size_t pboSize_;
+        /** Holds the offset in the pixel buffer and the destination of the started reads. */
+        std::array<std::pair<std::size_t, std::vector<float>*>, MAX_PENDING_READS> pendingReads_;
+        /** Number of started reads. */
+        std::size_t numPendingReads_ = 0;
+        /** Tracks the pixel buffer. */
+        util::TrackedResource memory_;
+    };
+}
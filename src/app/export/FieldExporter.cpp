@@ -0,0 +1,103 @@
+/**
+ * @file   FieldExporter.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the exporter publishing the simulation field to shared memory.
+ */
+
+#include "FieldExporter.h"
+#include <cstring>
+#include "core/open_gl.h"
+
+namespace viscom::exporter {
+
+    FieldExporter::FieldExporter(unsigned int width, unsigned int height, unsigned int frameInterval) :
+        width_{ width },
+        height_{ height },
+        frameInterval_{ glm::max(frameInterval, 1U) }
+    {
+    }
+
+    FieldExporter::~FieldExporter()
+    {
+        for (auto& readback : readbacks_) {
+            if (readback.fence_ != nullptr) glDeleteSync(readback.fence_);
+            if (readback.pbo_ != 0) glDeleteBuffers(1, &readback.pbo_);
+            readback.fence_ = nullptr;
+            readback.pbo_ = 0;
+        }
+    }
+
+    bool FieldExporter::Initialize(const std::string& name, unsigned int ringSlots)
+    {
+        if (!ring_.Create(name, width_, height_, 2, glm::max(ringSlots, 2U))) {
+            LOG(WARNING) << "Could not create shared memory ring buffer '" << name << "'.";
+            return false;
+        }
+
+        const auto frameSize = static_cast<GLsizeiptr>(ring_.GetFrameSize());
+        for (auto& readback : readbacks_) {
+            glGenBuffers(1, &readback.pbo_);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pbo_);
+            glBufferData(GL_PIXEL_PACK_BUFFER, frameSize, nullptr, GL_STREAM_READ);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        memory_[0] = util::TrackedResource{ util::ResourceType::Buffer, "FieldExporter", "read back", NUM_READBACKS * ring_.GetFrameSize() };
+        memory_[1] = util::TrackedResource{ util::ResourceType::Host, "FieldExporter", "shared memory ring '" + name + "'",
+            glm::max(ringSlots, 2U) * ring_.GetFrameSize() };
+
+        LOG(INFO) << "Exporting simulation field (" << width_ << "x" << height_ << ") to shared memory '" << name << "'.";
+        return true;
+    }
+
+    void FieldExporter::ExportFrame(GLuint abTexture, std::uint64_t iteration)
+    {
+        PublishFinishedReadbacks();
+
+        if (++frameCounter_ < frameInterval_) return;
+        frameCounter_ = 0;
+
+        if (readbacksInFlight_ == NUM_READBACKS) {
+            ++skippedFrames_;
+            return;
+        }
+
+        auto& readback = readbacks_[(oldestReadback_ + readbacksInFlight_) % NUM_READBACKS];
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pbo_);
+        glPixelStorei(GL_PACK_ALIGNMENT, 4);
+        glBindTexture(GL_TEXTURE_2D, abTexture);
+        glGetTexImage(GL_TEXTURE_2D, 0, GL_RG, GL_FLOAT, nullptr);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        readback.fence_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        readback.iteration_ = iteration;
+        ++readbacksInFlight_;
+    }
+
+    void FieldExporter::PublishFinishedReadbacks()
+    {
+        while (readbacksInFlight_ > 0) {
+            auto& readback = readbacks_[oldestReadback_];
+            auto status = glClientWaitSync(readback.fence_, 0, 0);
+            if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) return;
+
+            glDeleteSync(readback.fence_);
+            readback.fence_ = nullptr;
+
+            const auto frameSize = ring_.GetFrameSize();
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pbo_);
+            auto src = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(frameSize), GL_MAP_READ_BIT);
+            if (src != nullptr) {
+                std::memcpy(ring_.BeginFrame(), src, frameSize);
+                ring_.EndFrame(readback.iteration_);
+                glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            }
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+            oldestReadback_ = (oldestReadback_ + 1) % NUM_READBACKS;
+            --readbacksInFlight_;
+        }
+    }
+}
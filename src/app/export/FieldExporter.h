@@ -0,0 +1,74 @@
+/**
+ * @file   FieldExporter.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the exporter publishing the simulation field to shared memory.
+ */
+
+#pragma once
+
+#include "core/main.h"
+#include "SharedFieldRing.h"
+#include "app/util/ResourceRegistry.h"
+#include <array>
+
+namespace viscom::exporter {
+
+    /**
+     *  Reads the A/B simulation field back asynchronously (PBO + fence) and publishes it to a shared memory ring buffer.
+     *  The GL thread never waits for a read back, if all PBOs are in flight the frame is skipped.
+     */
+    class FieldExporter
+    {
+    public:
+        FieldExporter(unsigned int width, unsigned int height, unsigned int frameInterval);
+        FieldExporter(const FieldExporter&) = delete;
+        FieldExporter& operator=(const FieldExporter&) = delete;
+        ~FieldExporter();
+
+        bool Initialize(const std::string& name, unsigned int ringSlots);
+        /** Publishes finished read backs and starts a new one for abTexture if this frame is due. */
+        void ExportFrame(GLuint abTexture, std::uint64_t iteration);
+        /** Publishes the read backs finished by now, called every frame so the last fields arrive while the simulation is idle. */
+        void PublishFinishedReadbacks();
+
+        std::uint64_t GetExportedFrames() const { return ring_.GetLastSequence(); }
+        std::uint64_t GetSkippedFrames() const { return skippedFrames_; }
+
+    private:
+        struct Readback {
+            /** The pixel buffer object the field is read into. */
+            GLuint pbo_ = 0;
+            /** Fence signaled when the read back is complete. */
+            GLsync fence_ = nullptr;
+            /** The iteration of the field. */
+            std::uint64_t iteration_ = 0;
+        };
+
+        /** Number of read backs in flight. */
+        static constexpr std::size_t NUM_READBACKS = 3;
+
+        /** Holds the field width. */
+        unsigned int width_;
+        /** Holds the field height. */
+        unsigned int height_;
+        /** Export every n-th frame. */
+        unsigned int frameInterval_;
+        /** Frames since the last export. */
+        unsigned int frameCounter_ = 0;
+        /** Counts frames skipped because no PBO was available. */
+        std::uint64_t skippedFrames_ = 0;
+
+        /** Holds the read back buffers, used round robin. */
+        std::array<Readback, NUM_READBACKS> readbacks_;
+        /** Index of the oldest read back in flight. */
+        std::size_t oldestReadback_ = 0;
+        /** Number of read backs in flight. */
+        std::size_t readbacksInFlight_ = 0;
+        /** Holds the shared memory ring buffer. */
+        SharedFieldRingWriter ring_;
+        /** Tracks the read back buffers and the ring buffer. */
+        std::array<util::TrackedResource, 2> memory_;
+    };
+}
@@ -0,0 +1,230 @@
+/**
+ * @file   MonitorStream.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the low bandwidth TCP stream of the simulation result for remote monitoring.
+ */
+
+#include "MonitorStream.h"
+#include "app/util/ByteCodec.h"
+#include "app/util/Socket.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace viscom::exporter {
+
+    using util::ToSocket;
+
+    namespace {
+        /** Clients that do not take a frame within this time are dropped. */
+        constexpr int SEND_TIMEOUT_MILLISECONDS = 1000;
+        /** The worker checks for new clients at least this often. */
+        constexpr std::chrono::milliseconds ACCEPT_INTERVAL{ 100 };
+        /** Largest accepted frame (16k x 16k cells). */
+        constexpr std::uint64_t MAX_FRAME_SIZE = 16384ull * 16384ull;
+    }
+
+    void EncodeMonitorFrame(const std::uint8_t* frame, const std::uint8_t* previous, std::size_t size, std::vector<std::uint8_t>& delta,
+        std::vector<std::uint8_t>& payload)
+    {
+        delta.resize(size);
+        if (previous == nullptr) std::memcpy(delta.data(), frame, size);
+        else for (std::size_t i = 0; i < size; ++i) delta[i] = static_cast<std::uint8_t>(frame[i] - previous[i]);
+        payload.clear();
+        util::EncodeRLE(delta.data(), size, payload);
+    }
+
+    bool DecodeMonitorFrame(const std::uint8_t* payload, std::size_t payloadSize, bool keyFrame, std::vector<std::uint8_t>& delta,
+        std::uint8_t* frame, std::size_t size)
+    {
+        if (keyFrame) return util::DecodeRLE(payload, payloadSize, frame, size);
+
+        delta.resize(size);
+        if (!util::DecodeRLE(payload, payloadSize, delta.data(), size)) return false;
+        for (std::size_t i = 0; i < size; ++i) frame[i] = static_cast<std::uint8_t>(frame[i] + delta[i]);
+        return true;
+    }
+
+    MonitorServer::MonitorServer(unsigned int width, unsigned int height) :
+        width_{ width },
+        height_{ height },
+        frameSize_{ static_cast<std::size_t>(width) * height },
+        submittedFrame_(frameSize_),
+        currentFrame_(frameSize_),
+        previousFrame_(frameSize_)
+    {
+        util::StartSockets();
+    }
+
+    MonitorServer::~MonitorServer()
+    {
+        Stop();
+        util::StopSockets();
+    }
+
+    bool MonitorServer::Start(unsigned short port)
+    {
+        Stop();
+        auto listenSocket = util::ListenTCP(std::string(), port);
+        if (listenSocket == VISCOM_INVALID_SOCKET) return false;
+        listenSocket_ = static_cast<std::intptr_t>(listenSocket);
+
+        stopWorker_ = false;
+        worker_ = std::thread([this]() { WorkerLoop(); });
+        return true;
+    }
+
+    void MonitorServer::Stop()
+    {
+        if (worker_.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock{ mutex_ };
+                stopWorker_ = true;
+            }
+            condition_.notify_all();
+            worker_.join();
+        }
+
+        for (auto& client : clients_) util::CloseSocket(client);
+        clients_.clear();
+        numClients_ = 0;
+        util::CloseSocket(listenSocket_);
+    }
+
+    void MonitorServer::Submit(std::uint64_t iteration, const std::uint8_t* frame)
+    {
+        {
+            std::lock_guard<std::mutex> lock{ mutex_ };
+            std::memcpy(submittedFrame_.data(), frame, frameSize_);
+            submittedIteration_ = iteration;
+            frameSubmitted_ = true;
+        }
+        condition_.notify_one();
+    }
+
+    void MonitorServer::WorkerLoop()
+    {
+        while (true) {
+            auto frameReady = false;
+            {
+                std::unique_lock<std::mutex> lock{ mutex_ };
+                condition_.wait_for(lock, ACCEPT_INTERVAL, [this]() { return stopWorker_ || frameSubmitted_; });
+                if (stopWorker_) return;
+                if (frameSubmitted_) {
+                    std::swap(submittedFrame_, currentFrame_);
+                    currentIteration_ = submittedIteration_;
+                    frameSubmitted_ = false;
+                    frameReady = true;
+                }
+            }
+
+            AcceptClients();
+            if (frameReady && !clients_.empty()) SendFrame();
+        }
+    }
+
+    void MonitorServer::AcceptClients()
+    {
+        pollfd listenPoll{ ToSocket(listenSocket_), POLLIN, 0 };
+        while (VISCOM_POLL(&listenPoll, 1, 0) > 0 && (listenPoll.revents & POLLIN) != 0) {
+            auto s = util::AcceptSocket(ToSocket(listenSocket_));
+            if (s == VISCOM_INVALID_SOCKET) return;
+
+            util::SetTimeouts(s, 0, SEND_TIMEOUT_MILLISECONDS);
+            MonitorStreamHeader header{ MONITOR_STREAM_MAGIC, MONITOR_STREAM_VERSION, width_, height_ };
+            if (!util::SendAll(s, &header, sizeof(header))) {
+                VISCOM_CLOSE_SOCKET(s);
+                continue;
+            }
+            clients_.push_back(static_cast<std::intptr_t>(s));
+            keyFrameNeeded_ = true;
+        }
+        numClients_ = clients_.size();
+    }
+
+    void MonitorServer::SendFrame()
+    {
+        const auto keyFrame = keyFrameNeeded_;
+        EncodeMonitorFrame(currentFrame_.data(), keyFrame ? nullptr : previousFrame_.data(), frameSize_, delta_, payload_);
+        std::swap(currentFrame_, previousFrame_);
+        keyFrameNeeded_ = false;
+
+        MonitorFrameHeader header{ MONITOR_FRAME_MAGIC, keyFrame ? 1u : 0u, currentIteration_, payload_.size() };
+        auto client = clients_.begin();
+        while (client != clients_.end()) {
+            const auto s = ToSocket(*client);
+            if (util::SendAll(s, &header, sizeof(header)) && util::SendAll(s, payload_.data(), payload_.size())) {
+                bytesSent_ += sizeof(header) + payload_.size();
+                ++client;
+                continue;
+            }
+            // a partially sent frame leaves the stream out of step, the client has to reconnect.
+            VISCOM_CLOSE_SOCKET(s);
+            client = clients_.erase(client);
+        }
+        numClients_ = clients_.size();
+        ++framesSent_;
+    }
+
+    MonitorClient::MonitorClient()
+    {
+        util::StartSockets();
+    }
+
+    MonitorClient::~MonitorClient()
+    {
+        Close();
+        util::StopSockets();
+    }
+
+    void MonitorClient::Close()
+    {
+        util::CloseSocket(socket_);
+        hasKeyFrame_ = false;
+    }
+
+    bool MonitorClient::Connect(const std::string& address, unsigned short port, unsigned int timeoutMilliseconds)
+    {
+        Close();
+        auto s = util::ConnectTCP(address, port, std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMilliseconds));
+        if (s == VISCOM_INVALID_SOCKET) return false;
+        socket_ = static_cast<std::intptr_t>(s);
+
+        if (!util::ReceiveAll(s, &header_, sizeof(header_)) || header_.magic_ != MONITOR_STREAM_MAGIC || header_.version_ != MONITOR_STREAM_VERSION
+            || static_cast<std::uint64_t>(header_.width_) * header_.height_ > MAX_FRAME_SIZE) {
+            Close();
+            return false;
+        }
+        bytesReceived_ += sizeof(header_);
+        frame_.assign(static_cast<std::size_t>(header_.width_) * header_.height_, 0);
+        return true;
+    }
+
+    bool MonitorClient::Receive()
+    {
+        if (socket_ == -1) return false;
+        MonitorFrameHeader header;
+        if (!util::ReceiveAll(ToSocket(socket_), &header, sizeof(header)) || header.magic_ != MONITOR_FRAME_MAGIC || header.payloadSize_ > 2 * MAX_FRAME_SIZE) {
+            Close();
+            return false;
+        }
+        payload_.resize(static_cast<std::size_t>(header.payloadSize_));
+        if (!util::ReceiveAll(ToSocket(socket_), payload_.data(), payload_.size())) {
+            Close();
+            return false;
+        }
+        bytesReceived_ += sizeof(header) + payload_.size();
+
+        // the server starts every client with a key frame.
+        keyFrame_ = header.keyFrame_ != 0;
+        if ((!keyFrame_ && !hasKeyFrame_) || !DecodeMonitorFrame(payload_.data(), payload_.size(), keyFrame_, delta_, frame_.data(), frame_.size())) {
+            Close();
+            return false;
+        }
+        hasKeyFrame_ = true;
+        iteration_ = header.iteration_;
+        return true;
+    }
+}
@@ -0,0 +1,164 @@
+/**
+ * @file   MonitorStream.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the low bandwidth TCP stream of the simulation result for remote monitoring.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace viscom::exporter {
+
+    /** Magic number of the stream header ("RDMS"). */
+    constexpr std::uint32_t MONITOR_STREAM_MAGIC = 0x534D4452;
+    /** Magic number of every frame ("RDMF"). */
+    constexpr std::uint32_t MONITOR_FRAME_MAGIC = 0x464D4452;
+    /** Version of the protocol. */
+    constexpr std::uint32_t MONITOR_STREAM_VERSION = 1;
+
+    /** Sent once after a client connected. */
+    struct MonitorStreamHeader {
+        std::uint32_t magic_;
+        std::uint32_t version_;
+        /** Size of the field in cells (one byte each). */
+        std::uint32_t width_;
+        std::uint32_t height_;
+    };
+
+    /** Sent in front of every frame payload. */
+    struct MonitorFrameHeader {
+        std::uint32_t magic_;
+        /** The payload is no delta to the previous frame. */
+        std::uint32_t keyFrame_;
+        std::uint64_t iteration_;
+        /** Size of the run length encoded payload in bytes. */
+        std::uint64_t payloadSize_;
+    };
+
+    /**
+     *  Encodes an 8 bit frame as the byte wise difference (mod 256) to the previous frame, run length encoded. Regions
+     *  that did not change become long zero runs. Key frames are encoded against an all zero frame.
+     */
+    void EncodeMonitorFrame(const std::uint8_t* frame, const std::uint8_t* previous, std::size_t size, std::vector<std::uint8_t>& delta,
+        std::vector<std::uint8_t>& payload);
+    /** Applies a payload to the frame (the previous frame, ignored for key frames), returns false if it is malformed. */
+    bool DecodeMonitorFrame(const std::uint8_t* payload, std::size_t payloadSize, bool keyFrame, std::vector<std::uint8_t>& delta,
+        std::uint8_t* frame, std::size_t size);
+
+    /**
+     *  Serves the stream to any number of TCP clients. Frames are handed over by the GL thread and compressed and sent
+     *  on a worker thread, only the newest frame is kept if the worker falls behind. Clients that cannot keep up (send
+     *  times out) are dropped, a new client triggers a key frame.
+     */
+    class MonitorServer
+    {
+    public:
+        MonitorServer(unsigned int width, unsigned int height);
+        MonitorServer(const MonitorServer&) = delete;
+        MonitorServer& operator=(const MonitorServer&) = delete;
+        ~MonitorServer();
+
+        /** Listens on the port and starts the worker. */
+        bool Start(unsigned short port);
+        /** Hands a frame of width * height bytes to the worker (copied, replaces a frame not sent yet). */
+        void Submit(std::uint64_t iteration, const std::uint8_t* frame);
+
+        std::size_t GetFrameSize() const { return frameSize_; }
+        std::size_t GetNumClients() const { return numClients_; }
+        /** Frames sent and bytes sent (headers included) so far. */
+        std::uint64_t GetFramesSent() const { return framesSent_; }
+        std::uint64_t GetBytesSent() const { return bytesSent_; }
+
+    private:
+        void WorkerLoop();
+        void AcceptClients();
+        void SendFrame();
+        void Stop();
+
+        /** Holds the field size. */
+        unsigned int width_;
+        unsigned int height_;
+        std::size_t frameSize_;
+
+        /** Holds the listening socket. */
+        std::intptr_t listenSocket_ = -1;
+        /** Holds the connected clients (worker thread only). */
+        std::vector<std::intptr_t> clients_;
+        /** A client connected since the last frame, the next frame is a key frame. */
+        bool keyFrameNeeded_ = true;
+
+        /** Protects the submitted frame. */
+        std::mutex mutex_;
+        std::condition_variable condition_;
+        /** Holds the newest submitted frame and its iteration. */
+        std::vector<std::uint8_t> submittedFrame_;
+        std::uint64_t submittedIteration_ = 0;
+        bool frameSubmitted_ = false;
+        bool stopWorker_ = false;
+
+        /** Frame being sent and the frame sent before (worker thread only). */
+        std::vector<std::uint8_t> currentFrame_;
+        std::vector<std::uint8_t> previousFrame_;
+        std::uint64_t currentIteration_ = 0;
+        /** Scratch buffers of the encoder. */
+        std::vector<std::uint8_t> delta_;
+        std::vector<std::uint8_t> payload_;
+
+        std::atomic<std::size_t> numClients_{ 0 };
+        std::atomic<std::uint64_t> framesSent_{ 0 };
+        std::atomic<std::uint64_t> bytesSent_{ 0 };
+        /** Holds the worker thread. */
+        std::thread worker_;
+    };
+
+    /** Receives the stream and reconstructs the frames. */
+    class MonitorClient
+    {
+    public:
+        MonitorClient();
+        MonitorClient(const MonitorClient&) = delete;
+        MonitorClient& operator=(const MonitorClient&) = delete;
+        ~MonitorClient();
+
+        /** Connects and reads the stream header, retries until the timeout. */
+        bool Connect(const std::string& address, unsigned short port, unsigned int timeoutMilliseconds);
+        /** Waits for the next frame and applies it, returns false if the connection closed or the stream is malformed. */
+        bool Receive();
+
+        unsigned int GetWidth() const { return header_.width_; }
+        unsigned int GetHeight() const { return header_.height_; }
+        /** The reconstructed frame (one byte per cell, rows bottom to top). */
+        const std::vector<std::uint8_t>& GetFrame() const { return frame_; }
+        std::uint64_t GetIteration() const { return iteration_; }
+        bool IsKeyFrame() const { return keyFrame_; }
+        /** Bytes received so far (headers included). */
+        std::uint64_t GetBytesReceived() const { return bytesReceived_; }
+
+    private:
+        void Close();
+
+        /** Holds the connected socket. */
+        std::intptr_t socket_ = -1;
+        /** Holds the stream header. */
+        MonitorStreamHeader header_{};
+        /** Holds the reconstructed frame. */
+        std::vector<std::uint8_t> frame_;
+        std::uint64_t iteration_ = 0;
+        bool keyFrame_ = false;
+        /** A key frame was received, deltas can be applied. */
+        bool hasKeyFrame_ = false;
+        /** Buffers of the decoder. */
+        std::vector<std::uint8_t> payload_;
+        std::vector<std::uint8_t> delta_;
+        std::uint64_t bytesReceived_ = 0;
+    };
+}
@@ -0,0 +1,97 @@
+/**
+ * @file   MonitorStreamer.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the read back feeding the remote monitoring stream.
+ */
+
+#include "MonitorStreamer.h"
+#include "core/open_gl.h"
+
+namespace viscom::exporter {
+
+    MonitorStreamer::MonitorStreamer(unsigned int width, unsigned int height, float framesPerSecond) :
+        width_{ width },
+        height_{ height },
+        frameInterval_{ std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / glm::max(framesPerSecond, 0.1f))) },
+        server_{ std::make_unique<MonitorServer>(width, height) }
+    {
+    }
+
+    MonitorStreamer::~MonitorStreamer()
+    {
+        for (auto& readback : readbacks_) {
+            if (readback.fence_ != nullptr) glDeleteSync(readback.fence_);
+            if (readback.pbo_ != 0) glDeleteBuffers(1, &readback.pbo_);
+            readback.fence_ = nullptr;
+            readback.pbo_ = 0;
+        }
+        server_ = nullptr;
+    }
+
+    bool MonitorStreamer::Initialize(unsigned short port)
+    {
+        if (!server_->Start(port)) {
+            LOG(WARNING) << "Could not listen for monitoring clients on port " << port << ".";
+            return false;
+        }
+
+        for (auto& readback : readbacks_) {
+            glGenBuffers(1, &readback.pbo_);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pbo_);
+            glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(server_->GetFrameSize()), nullptr, GL_STREAM_READ);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        memory_ = util::TrackedResource{ util::ResourceType::Buffer, "MonitorStreamer", "read back", NUM_READBACKS * server_->GetFrameSize() };
+
+        LOG(INFO) << "Streaming the simulation result (" << width_ << "x" << height_ << ", 8 bit) to monitoring clients on port " << port << ".";
+        return true;
+    }
+
+    void MonitorStreamer::Update(GLuint resultTexture, std::uint64_t iteration)
+    {
+        SubmitFinishedReadbacks();
+
+        const auto now = std::chrono::steady_clock::now();
+        if (now < nextFrame_ || server_->GetNumClients() == 0 || readbacksInFlight_ == NUM_READBACKS) return;
+        nextFrame_ = now + frameInterval_;
+
+        // the GPU quantizes the result to 8 bits during the read back.
+        auto& readback = readbacks_[(oldestReadback_ + readbacksInFlight_) % NUM_READBACKS];
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pbo_);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glBindTexture(GL_TEXTURE_2D, resultTexture);
+        glGetTexImage(GL_TEXTURE_2D, 0, GL_RED, GL_UNSIGNED_BYTE, nullptr);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glPixelStorei(GL_PACK_ALIGNMENT, 4);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        readback.fence_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        readback.iteration_ = iteration;
+        ++readbacksInFlight_;
+    }
+
+    void MonitorStreamer::SubmitFinishedReadbacks()
+    {
+        while (readbacksInFlight_ > 0) {
+            auto& readback = readbacks_[oldestReadback_];
+            auto status = glClientWaitSync(readback.fence_, 0, 0);
+            if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) return;
+
+            glDeleteSync(readback.fence_);
+            readback.fence_ = nullptr;
+
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pbo_);
+            auto src = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(server_->GetFrameSize()), GL_MAP_READ_BIT);
+            if (src != nullptr) {
+                server_->Submit(readback.iteration_, static_cast<const std::uint8_t*>(src));
+                glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            }
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+            oldestReadback_ = (oldestReadback_ + 1) % NUM_READBACKS;
+            --readbacksInFlight_;
+        }
+    }
+}
@@ -0,0 +1,75 @@
+/**
+ * @file   MonitorStreamer.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the read back feeding the remote monitoring stream.
+ */
+
+#pragma once
+
+#include "core/main.h"
+#include "MonitorStream.h"
+#include "app/util/ResourceRegistry.h"
+#include <array>
+#include <chrono>
+#include <memory>
+
+namespace viscom::exporter {
+
+    /**
+     *  Reads the simulation result back at a fixed rate, converted to 8 bits by the GPU, and hands it to the stream
+     *  server. Read backs are asynchronous (PBO + fence) and compression and sending run on the worker of the server,
+     *  so the GL thread only issues the read back and copies a finished one. Nothing is read back without clients.
+     */
+    class MonitorStreamer
+    {
+    public:
+        MonitorStreamer(unsigned int width, unsigned int height, float framesPerSecond);
+        MonitorStreamer(const MonitorStreamer&) = delete;
+        MonitorStreamer& operator=(const MonitorStreamer&) = delete;
+        ~MonitorStreamer();
+
+        bool Initialize(unsigned short port);
+        /** Hands finished read backs to the server and starts a new one of resultTexture if it is due. */
+        void Update(GLuint resultTexture, std::uint64_t iteration);
+
+        const MonitorServer& GetServer() const { return *server_; }
+        /** Returns the size of the streamed result. */
+        glm::uvec2 GetSize() const { return glm::uvec2(width_, height_); }
+
+    private:
+        struct Readback {
+            /** The pixel buffer object the result is read into. */
+            GLuint pbo_ = 0;
+            /** Fence signaled when the read back is complete. */
+            GLsync fence_ = nullptr;
+            /** The iteration of the result. */
+            std::uint64_t iteration_ = 0;
+        };
+
+        void SubmitFinishedReadbacks();
+
+        /** Number of read backs in flight. */
+        static constexpr std::size_t NUM_READBACKS = 2;
+
+        /** Holds the result size. */
+        unsigned int width_;
+        unsigned int height_;
+        /** Time between two frames of the stream. */
+        std::chrono::steady_clock::duration frameInterval_;
+        /** Time the next frame is due. */
+        std::chrono::steady_clock::time_point nextFrame_;
+
+        /** Holds the read back buffers, used round robin. */
+        std::array<Readback, NUM_READBACKS> readbacks_;
+        /** Index of the oldest read back in flight. */
+        std::size_t oldestReadback_ = 0;
+        /** Number of read backs in flight. */
+        std::size_t readbacksInFlight_ = 0;
+        /** Compresses and sends the frames. */
+        std::unique_ptr<MonitorServer> server_;
+        /** Tracks the read back buffers. */
+        util::TrackedResource memory_;
+    };
+}
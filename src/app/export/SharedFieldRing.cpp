@@ -0,0 +1,113 @@
+/**
+ * @file   SharedFieldRing.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the shared memory ring buffer holding simulation fields.
+ */
+
+#include "SharedFieldRing.h"
+#include <cstring>
+#include <new>
+
+namespace viscom::exporter {
+
+    namespace {
+        constexpr std::uint64_t AlignTo(std::uint64_t value, std::uint64_t alignment)
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+    }
+
+    bool SharedFieldRingWriter::Create(const std::string& name, unsigned int width, unsigned int height, unsigned int channels, unsigned int slotCount)
+    {
+        const auto frameSize = static_cast<std::uint64_t>(width) * height * channels * sizeof(float);
+        const auto firstSlotOffset = AlignTo(sizeof(SharedFieldHeader), 4096);
+        const auto slotStride = AlignTo(sizeof(SharedFieldSlotHeader) + frameSize, 4096);
+
+        if (!region_.Create(name, static_cast<std::size_t>(firstSlotOffset + slotStride * slotCount))) return false;
+
+        auto header = new (region_.GetData()) SharedFieldHeader;
+        header->magic_ = SHARED_FIELD_MAGIC;
+        header->version_ = SHARED_FIELD_VERSION;
+        header->width_ = width;
+        header->height_ = height;
+        header->channels_ = channels;
+        header->slotCount_ = slotCount;
+        header->firstSlotOffset_ = firstSlotOffset;
+        header->slotStride_ = slotStride;
+        header->latestSequence_.store(0, std::memory_order_relaxed);
+
+        for (std::uint64_t i = 0; i < slotCount; ++i) {
+            auto slot = new (static_cast<std::uint8_t*>(region_.GetData()) + firstSlotOffset + i * slotStride) SharedFieldSlotHeader;
+            slot->lock_.store(0, std::memory_order_relaxed);
+            slot->sequence_ = 0;
+            slot->iteration_ = 0;
+            slot->width_ = width;
+            slot->height_ = height;
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        sequence_ = 0;
+        return true;
+    }
+
+    std::size_t SharedFieldRingWriter::GetFrameSize() const
+    {
+        auto header = GetHeader();
+        return static_cast<std::size_t>(header->width_) * header->height_ * header->channels_ * sizeof(float);
+    }
+
+    SharedFieldSlotHeader* SharedFieldRingWriter::GetSlot(std::uint64_t sequence) const
+    {
+        auto header = GetHeader();
+        auto slotIdx = (sequence - 1) % header->slotCount_;
+        return reinterpret_cast<SharedFieldSlotHeader*>(static_cast<std::uint8_t*>(region_.GetData()) + header->firstSlotOffset_ + slotIdx * header->slotStride_);
+    }
+
+    float* SharedFieldRingWriter::BeginFrame()
+    {
+        auto slot = GetSlot(sequence_ + 1);
+        slot->lock_.fetch_add(1, std::memory_order_acq_rel);
+        std::atomic_thread_fence(std::memory_order_release);
+        return reinterpret_cast<float*>(slot + 1);
+    }
+
+    void SharedFieldRingWriter::EndFrame(std::uint64_t iteration)
+    {
+        ++sequence_;
+        auto slot = GetSlot(sequence_);
+        slot->sequence_ = sequence_;
+        slot->iteration_ = iteration;
+        slot->lock_.fetch_add(1, std::memory_order_release);
+        GetHeader()->latestSequence_.store(sequence_, std::memory_order_release);
+    }
+
+    bool SharedFieldRingReader::Open(const std::string& name)
+    {
+        if (!region_.Open(name, true)) return false;
+        if (region_.GetSize() < sizeof(SharedFieldHeader) || GetHeader()->magic_ != SHARED_FIELD_MAGIC || GetHeader()->version_ != SHARED_FIELD_VERSION) {
+            region_.Close();
+            return false;
+        }
+        return true;
+    }
+
+    const SharedFieldSlotHeader* SharedFieldRingReader::AcquireFrame(std::uint64_t sequence, const float** data, std::uint64_t& lock) const
+    {
+        auto header = GetHeader();
+        if (sequence == 0) return nullptr;
+        auto slotIdx = (sequence - 1) % header->slotCount_;
+        auto slot = reinterpret_cast<const SharedFieldSlotHeader*>(static_cast<const std::uint8_t*>(region_.GetData()) + header->firstSlotOffset_ + slotIdx * header->slotStride_);
+
+        lock = slot->lock_.load(std::memory_order_acquire);
+        if ((lock & 1) != 0 || slot->sequence_ != sequence) return nullptr;
+        *data = reinterpret_cast<const float*>(slot + 1);
+        return slot;
+    }
+
+    bool SharedFieldRingReader::ValidateFrame(const SharedFieldSlotHeader* slot, std::uint64_t lock) const
+    {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return slot->lock_.load(std::memory_order_relaxed) == lock;
+    }
+}
@@ -0,0 +1,109 @@
+/**
+ * @file   SharedFieldRing.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the shared memory ring buffer holding simulation fields.
+ */
+
+#pragma once
+
+#include "SharedMemoryRegion.h"
+#include <atomic>
+#include <cstdint>
+
+namespace viscom::exporter {
+
+    /** Magic number at the start of the shared memory region ("RDFR"). */
+    constexpr std::uint32_t SHARED_FIELD_MAGIC = 0x52464452;
+    /** Version of the memory layout. */
+    constexpr std::uint32_t SHARED_FIELD_VERSION = 1;
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Shared field ring needs lock free 64 bit atomics.");
+
+    /** Header at the beginning of the shared memory region. */
+    struct SharedFieldHeader {
+        /** Magic number for validation. */
+        std::uint32_t magic_;
+        /** Layout version. */
+        std::uint32_t version_;
+        /** Width of the field. */
+        std::uint32_t width_;
+        /** Height of the field. */
+        std::uint32_t height_;
+        /** Number of float channels per cell (A and B). */
+        std::uint32_t channels_;
+        /** Number of slots in the ring. */
+        std::uint32_t slotCount_;
+        /** Offset of the first slot from the beginning of the region. */
+        std::uint64_t firstSlotOffset_;
+        /** Distance between two slots in bytes. */
+        std::uint64_t slotStride_;
+        /** Sequence number of the most recently completed frame (0 if none). */
+        std::atomic<std::uint64_t> latestSequence_;
+    };
+
+    /**
+     *  Header in front of each frame. The slot is protected by a sequence lock: lock_ is odd while the producer writes.
+     *  Readers copy or use the data in place and check afterwards that lock_ did not change.
+     */
+    struct alignas(64) SharedFieldSlotHeader {
+        /** Sequence lock of the slot. */
+        std::atomic<std::uint64_t> lock_;
+        /** Sequence number of the frame in this slot (starts with 1). */
+        std::uint64_t sequence_;
+        /** Global simulation iteration of the frame. */
+        std::uint64_t iteration_;
+        /** Width of the field. */
+        std::uint32_t width_;
+        /** Height of the field. */
+        std::uint32_t height_;
+    };
+
+    /** Producer side of the ring buffer. */
+    class SharedFieldRingWriter
+    {
+    public:
+        bool Create(const std::string& name, unsigned int width, unsigned int height, unsigned int channels, unsigned int slotCount);
+
+        /** Returns the data pointer of the slot for the next frame and locks it. */
+        float* BeginFrame();
+        /** Publishes the frame started with BeginFrame. */
+        void EndFrame(std::uint64_t iteration);
+
+        bool IsValid() const { return region_.IsValid(); }
+        std::size_t GetFrameSize() const;
+        std::uint64_t GetLastSequence() const { return sequence_; }
+
+    private:
+        SharedFieldHeader* GetHeader() const { return static_cast<SharedFieldHeader*>(region_.GetData()); }
+        SharedFieldSlotHeader* GetSlot(std::uint64_t sequence) const;
+
+        /** Holds the shared memory. */
+        SharedMemoryRegion region_;
+        /** Sequence number of the last frame written. */
+        std::uint64_t sequence_ = 0;
+    };
+
+    /** Consumer side of the ring buffer. */
+    class SharedFieldRingReader
+    {
+    public:
+        bool Open(const std::string& name);
+
+        const SharedFieldHeader* GetHeader() const { return static_cast<const SharedFieldHeader*>(region_.GetData()); }
+        std::uint64_t GetLatestSequence() const { return GetHeader()->latestSequence_.load(std::memory_order_acquire); }
+
+        /**
+         *  Gives access to the frame with the given sequence number in place.
+         *  @return a pointer to the slot or nullptr if the frame was already overwritten or is not written yet.
+         */
+        const SharedFieldSlotHeader* AcquireFrame(std::uint64_t sequence, const float** data, std::uint64_t& lock) const;
+        /** Checks that the frame was not overwritten while it was used. */
+        bool ValidateFrame(const SharedFieldSlotHeader* slot, std::uint64_t lock) const;
+
+    private:
+        /** Holds the shared memory. */
+        SharedMemoryRegion region_;
+    };
+}
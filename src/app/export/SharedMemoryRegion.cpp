@@ -0,0 +1,174 @@
+/**
+ * @file   SharedMemoryRegion.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of a named shared memory region.
+ */
+
+#include "SharedMemoryRegion.h"
+#include <cstdint>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace viscom::exporter {
+
+    SharedMemoryRegion::SharedMemoryRegion(SharedMemoryRegion&& rhs) noexcept :
+        name_{ std::move(rhs.name_) },
+        data_{ std::exchange(rhs.data_, nullptr) },
+        size_{ std::exchange(rhs.size_, 0) },
+        owner_{ std::exchange(rhs.owner_, false) }
+#ifdef _WIN32
+        , mappingHandle_{ std::exchange(rhs.mappingHandle_, nullptr) }
+#endif
+    {
+    }
+
+    SharedMemoryRegion& SharedMemoryRegion::operator=(SharedMemoryRegion&& rhs) noexcept
+    {
+        if (this != &rhs) {
+            Close();
+            name_ = std::move(rhs.name_);
+            data_ = std::exchange(rhs.data_, nullptr);
+            size_ = std::exchange(rhs.size_, 0);
+            owner_ = std::exchange(rhs.owner_, false);
+#ifdef _WIN32
+            mappingHandle_ = std::exchange(rhs.mappingHandle_, nullptr);
+#endif
+        }
+        return *this;
+    }
+
+    SharedMemoryRegion::~SharedMemoryRegion()
+    {
+        Close();
+    }
+
+#ifdef _WIN32
+    bool SharedMemoryRegion::Create(const std::string& name, std::size_t size)
+    {
+        Close();
+        const auto sizeHigh = static_cast<DWORD>(static_cast<std::uint64_t>(size) >> 32);
+        const auto sizeLow = static_cast<DWORD>(size & 0xFFFFFFFFu);
+        auto handle = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, sizeHigh, sizeLow, name.c_str());
+        if (handle == nullptr) return false;
+
+        auto data = MapViewOfFile(handle, FILE_MAP_ALL_ACCESS, 0, 0, size);
+        if (data == nullptr) {
+            CloseHandle(handle);
+            return false;
+        }
+
+        name_ = name;
+        data_ = data;
+        size_ = size;
+        owner_ = true;
+        mappingHandle_ = handle;
+        return true;
+    }
+
+    bool SharedMemoryRegion::Open(const std::string& name, bool readOnly)
+    {
+        Close();
+        auto handle = OpenFileMappingA(readOnly ? FILE_MAP_READ : FILE_MAP_ALL_ACCESS, FALSE, name.c_str());
+        if (handle == nullptr) return false;
+
+        auto data = MapViewOfFile(handle, readOnly ? FILE_MAP_READ : FILE_MAP_ALL_ACCESS, 0, 0, 0);
+        if (data == nullptr) {
+            CloseHandle(handle);
+            return false;
+        }
+
+        MEMORY_BASIC_INFORMATION info;
+        VirtualQuery(data, &info, sizeof(info));
+
+        name_ = name;
+        data_ = data;
+        size_ = info.RegionSize;
+        owner_ = false;
+        mappingHandle_ = handle;
+        return true;
+    }
+
+    void SharedMemoryRegion::Close()
+    {
+        if (data_ != nullptr) UnmapViewOfFile(data_);
+        if (mappingHandle_ != nullptr) CloseHandle(mappingHandle_);
+        data_ = nullptr;
+        mappingHandle_ = nullptr;
+        size_ = 0;
+        owner_ = false;
+    }
+#else
+    bool SharedMemoryRegion::Create(const std::string& name, std::size_t size)
+    {
+        Close();
+        // remove stale regions of crashed runs so the new size is used.
+        shm_unlink(name.c_str());
+        auto fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+        if (fd == -1) return false;
+
+        if (ftruncate(fd, static_cast<off_t>(size)) == -1) {
+            close(fd);
+            shm_unlink(name.c_str());
+            return false;
+        }
+
+        auto data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (data == MAP_FAILED) {
+            shm_unlink(name.c_str());
+            return false;
+        }
+
+        name_ = name;
+        data_ = data;
+        size_ = size;
+        owner_ = true;
+        return true;
+    }
+
+    bool SharedMemoryRegion::Open(const std::string& name, bool readOnly)
+    {
+        Close();
+        auto fd = shm_open(name.c_str(), readOnly ? O_RDONLY : O_RDWR, 0);
+        if (fd == -1) return false;
+
+        struct stat fileStat;
+        if (fstat(fd, &fileStat) == -1 || fileStat.st_size == 0) {
+            close(fd);
+            return false;
+        }
+
+        const auto size = static_cast<std::size_t>(fileStat.st_size);
+        auto data = mmap(nullptr, size, readOnly ? PROT_READ : PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (data == MAP_FAILED) return false;
+
+        name_ = name;
+        data_ = data;
+        size_ = size;
+        owner_ = false;
+        return true;
+    }
+
+    void SharedMemoryRegion::Close()
+    {
+        if (data_ != nullptr) munmap(data_, size_);
+        if (owner_) shm_unlink(name_.c_str());
+        data_ = nullptr;
+        size_ = 0;
+        owner_ = false;
+    }
+#endif
+}
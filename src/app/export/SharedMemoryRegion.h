@@ -0,0 +1,52 @@
+/**
+ * @file   SharedMemoryRegion.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of a named shared memory region.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace viscom::exporter {
+
+    /** A named memory region that can be mapped by several processes (POSIX shm or a Win32 file mapping). */
+    class SharedMemoryRegion
+    {
+    public:
+        SharedMemoryRegion() = default;
+        SharedMemoryRegion(const SharedMemoryRegion&) = delete;
+        SharedMemoryRegion(SharedMemoryRegion&&) noexcept;
+        SharedMemoryRegion& operator=(const SharedMemoryRegion&) = delete;
+        SharedMemoryRegion& operator=(SharedMemoryRegion&&) noexcept;
+        ~SharedMemoryRegion();
+
+        /** Creates (or replaces) the region with the given size, the creator removes the name again on destruction. */
+        bool Create(const std::string& name, std::size_t size);
+        /** Opens an existing region created by another process. */
+        bool Open(const std::string& name, bool readOnly);
+        void Close();
+
+        bool IsValid() const { return data_ != nullptr; }
+        void* GetData() const { return data_; }
+        std::size_t GetSize() const { return size_; }
+        const std::string& GetName() const { return name_; }
+
+    private:
+        /** Holds the name of the region. */
+        std::string name_;
+        /** Holds the mapped memory. */
+        void* data_ = nullptr;
+        /** Holds the size of the mapped memory. */
+        std::size_t size_ = 0;
+        /** Is this process the owner of the region. */
+        bool owner_ = false;
+#ifdef _WIN32
+        /** Holds the file mapping handle. */
+        void* mappingHandle_ = nullptr;
+#endif
+    };
+}
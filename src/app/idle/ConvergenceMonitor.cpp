@@ -0,0 +1,99 @@
+/**
+ * @file   ConvergenceMonitor.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the GPU change statistics used to detect a converged simulation.
+ */
+
+#include "ConvergenceMonitor.h"
+#include "core/ApplicationNodeBase.h"
+#include "core/open_gl.h"
+#include <cstring>
+
+namespace viscom::idle {
+
+    ConvergenceMonitor::ConvergenceMonitor(ApplicationNodeBase* appNode)
+    {
+        changeProgram_ = appNode->GetGPUProgramManager().GetResource("simulationChange", std::vector<std::string>{ "simulationChange.comp" });
+        currentTextureLoc_ = changeProgram_->getUniformLocation("currentTexture");
+        previousTextureLoc_ = changeProgram_->getUniformLocation("previousTexture");
+
+        for (auto& pending : pending_) {
+            glGenBuffers(1, &pending.buffer_);
+            glBindBuffer(GL_SHADER_STORAGE_BUFFER, pending.buffer_);
+            glBufferData(GL_SHADER_STORAGE_BUFFER, 3 * sizeof(std::uint32_t), nullptr, GL_DYNAMIC_READ);
+        }
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    }
+
+    ConvergenceMonitor::~ConvergenceMonitor()
+    {
+        for (auto& pending : pending_) {
+            if (pending.fence_ != nullptr) glDeleteSync(pending.fence_);
+            if (pending.buffer_ != 0) glDeleteBuffers(1, &pending.buffer_);
+        }
+    }
+
+    bool ConvergenceMonitor::Compute(GLuint currentTexture, GLuint previousTexture, std::uint64_t iteration)
+    {
+        if (numPending_ == NUM_PENDING) return false;
+        auto& pending = pending_[(oldestPending_ + numPending_) % NUM_PENDING];
+
+        const std::uint32_t zero[3] = { 0, 0, 0 };
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, pending.buffer_);
+        glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(zero), zero);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, pending.buffer_);
+
+        GLint width = 0, height = 0;
+        glActiveTexture(GL_TEXTURE1);
+        glBindTexture(GL_TEXTURE_2D, previousTexture);
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, currentTexture);
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+
+        glUseProgram(changeProgram_->getProgramId());
+        glUniform1i(currentTextureLoc_, 0);
+        glUniform1i(previousTextureLoc_, 1);
+        glDispatchCompute((width + 15) / 16, (height + 15) / 16, 1);
+        glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, 0);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+        glActiveTexture(GL_TEXTURE1);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glUseProgram(0);
+
+        pending.fence_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        pending.iteration_ = iteration;
+        ++numPending_;
+        return true;
+    }
+
+    bool ConvergenceMonitor::Poll(ChangeStatistics& statistics)
+    {
+        if (numPending_ == 0) return false;
+        auto& pending = pending_[oldestPending_];
+        auto status = glClientWaitSync(pending.fence_, 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) return false;
+
+        std::uint32_t result[3] = { 0, 0, 0 };
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, pending.buffer_);
+        glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(result), result);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+        statistics.iteration_ = pending.iteration_;
+        std::memcpy(&statistics.maxDeltaA_, &result[0], sizeof(float));
+        std::memcpy(&statistics.maxDeltaB_, &result[1], sizeof(float));
+        statistics.coverage_ = result[2];
+
+        glDeleteSync(pending.fence_);
+        pending.fence_ = nullptr;
+        oldestPending_ = (oldestPending_ + 1) % NUM_PENDING;
+        --numPending_;
+        return true;
+    }
+}
@@ -0,0 +1,76 @@
+/**
+ * @file   ConvergenceMonitor.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the GPU change statistics used to detect a converged simulation.
+ */
+
+#pragma once
+
+#include "core/main.h"
+#include <array>
+
+namespace viscom {
+    class ApplicationNodeBase;
+    class GPUProgram;
+}
+
+namespace viscom::idle {
+
+    /** Change of the simulation state in one iteration. */
+    struct ChangeStatistics {
+        /** Iteration the statistics were computed for. */
+        std::uint64_t iteration_ = 0;
+        /** Maximum change of A. */
+        float maxDeltaA_ = 0.0f;
+        /** Maximum change of B. */
+        float maxDeltaB_ = 0.0f;
+        /** Number of cells with B above the coverage threshold. */
+        std::uint32_t coverage_ = 0;
+    };
+
+    /**
+     *  Computes change statistics between the last two iterations with a compute shader reduction and reads the 12 byte
+     *  result back after its fence signaled.
+     */
+    class ConvergenceMonitor
+    {
+    public:
+        explicit ConvergenceMonitor(ApplicationNodeBase* appNode);
+        ConvergenceMonitor(const ConvergenceMonitor&) = delete;
+        ConvergenceMonitor& operator=(const ConvergenceMonitor&) = delete;
+        ~ConvergenceMonitor();
+
+        /** Starts the reduction, returns false if all result buffers are in use. */
+        bool Compute(GLuint currentTexture, GLuint previousTexture, std::uint64_t iteration);
+        /** Returns the oldest finished statistics. */
+        bool Poll(ChangeStatistics& statistics);
+
+    private:
+        struct PendingStatistics {
+            /** Buffer the reduction writes to. */
+            GLuint buffer_ = 0;
+            /** Fence signaled when the reduction is finished. */
+            GLsync fence_ = nullptr;
+            /** Iteration of the statistics. */
+            std::uint64_t iteration_ = 0;
+        };
+
+        /** Number of reductions in flight. */
+        static constexpr std::size_t NUM_PENDING = 3;
+
+        /** Holds the reduction program. */
+        std::shared_ptr<GPUProgram> changeProgram_;
+        /** Holds the location of the current A/B texture. */
+        GLint currentTextureLoc_ = -1;
+        /** Holds the location of the previous A/B texture. */
+        GLint previousTextureLoc_ = -1;
+        /** Holds the result buffers, used round robin. */
+        std::array<PendingStatistics, NUM_PENDING> pending_;
+        /** Index of the oldest reduction in flight. */
+        std::size_t oldestPending_ = 0;
+        /** Number of reductions in flight. */
+        std::size_t numPending_ = 0;
+    };
+}
@@ -0,0 +1,87 @@
+/**
+ * @file   FrameCache.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the cache reusing rendered frames while the simulation is idle.
+ */
+
+#include "FrameCache.h"
+#include "core/gfx/FrameBuffer.h"
+#include "core/open_gl.h"
+
+namespace viscom::idle {
+
+    FrameCache::~FrameCache()
+    {
+        for (auto& frame : frames_) {
+            glDeleteFramebuffers(1, &frame.second.fbo_);
+            glDeleteTextures(1, &frame.second.texture_);
+        }
+    }
+
+    void FrameCache::Store(FrameBuffer& fbo, const glm::mat4& viewProjection)
+    {
+        auto& frame = frames_[&fbo];
+        fbo.DrawToFBO([&frame]() {
+            GLint viewport[4];
+            GLint drawFramebuffer = 0;
+            glGetIntegerv(GL_VIEWPORT, viewport);
+            glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &drawFramebuffer);
+
+            if (frame.width_ != viewport[2] || frame.height_ != viewport[3]) {
+                if (frame.fbo_ == 0) glGenFramebuffers(1, &frame.fbo_);
+                if (frame.texture_ != 0) glDeleteTextures(1, &frame.texture_);
+                glGenTextures(1, &frame.texture_);
+                glBindTexture(GL_TEXTURE_2D, frame.texture_);
+                glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA16F, viewport[2], viewport[3]);
+                glBindTexture(GL_TEXTURE_2D, 0);
+                glBindFramebuffer(GL_DRAW_FRAMEBUFFER, frame.fbo_);
+                glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, frame.texture_, 0);
+                frame.width_ = viewport[2];
+                frame.height_ = viewport[3];
+                if (!frame.memory_.IsRegistered()) frame.memory_ = util::TrackedResource(util::ResourceType::Texture, "FrameCache", "cached frame");
+                frame.memory_.SetSize(util::QueryTextureSize(frame.texture_));
+            }
+
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, static_cast<GLuint>(drawFramebuffer));
+            glBindFramebuffer(GL_DRAW_FRAMEBUFFER, frame.fbo_);
+            glBlitFramebuffer(viewport[0], viewport[1], viewport[0] + viewport[2], viewport[1] + viewport[3],
+                0, 0, viewport[2], viewport[3], GL_COLOR_BUFFER_BIT, GL_NEAREST);
+            glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(drawFramebuffer));
+        });
+        frame.viewProjection_ = viewProjection;
+        frame.valid_ = true;
+    }
+
+    bool FrameCache::Restore(FrameBuffer& fbo, const glm::mat4& viewProjection) const
+    {
+        if (!IsValid(fbo, viewProjection)) return false;
+
+        const auto& cached = frames_.find(&fbo)->second;
+        fbo.DrawToFBO([&cached]() {
+            GLint viewport[4];
+            GLint drawFramebuffer = 0;
+            glGetIntegerv(GL_VIEWPORT, viewport);
+            glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &drawFramebuffer);
+
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, cached.fbo_);
+            glBlitFramebuffer(0, 0, cached.width_, cached.height_, viewport[0], viewport[1], viewport[0] + viewport[2], viewport[1] + viewport[3],
+                GL_COLOR_BUFFER_BIT, GL_NEAREST);
+            glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(drawFramebuffer));
+        });
+        return true;
+    }
+
+    bool FrameCache::IsValid(const FrameBuffer& fbo, const glm::mat4& viewProjection) const
+    {
+        // head tracking changes the view of a node without waking the simulation.
+        auto frame = frames_.find(&fbo);
+        return frame != frames_.end() && frame->second.valid_ && frame->second.viewProjection_ == viewProjection;
+    }
+
+    void FrameCache::Invalidate()
+    {
+        for (auto& frame : frames_) frame.second.valid_ = false;
+    }
+}
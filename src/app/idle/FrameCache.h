@@ -0,0 +1,52 @@
+/**
+ * @file   FrameCache.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the cache reusing rendered frames while the simulation is idle.
+ */
+
+#pragma once
+
+#include "core/main.h"
+#include "app/util/ResourceRegistry.h"
+#include <map>
+
+namespace viscom {
+    class FrameBuffer;
+}
+
+namespace viscom::idle {
+
+    /** Keeps a copy of the last frame rendered to each frame buffer (one per window and eye). */
+    class FrameCache
+    {
+    public:
+        FrameCache() = default;
+        FrameCache(const FrameCache&) = delete;
+        FrameCache& operator=(const FrameCache&) = delete;
+        ~FrameCache();
+
+        /** Copies the content of the frame buffer rendered with the given view projection to the cache. */
+        void Store(FrameBuffer& fbo, const glm::mat4& viewProjection);
+        /** Copies the cached frame to the frame buffer, returns false if there is none for the view projection. */
+        bool Restore(FrameBuffer& fbo, const glm::mat4& viewProjection) const;
+        bool IsValid(const FrameBuffer& fbo, const glm::mat4& viewProjection) const;
+        void Invalidate();
+
+    private:
+        struct CachedFrame {
+            GLuint fbo_ = 0;
+            GLuint texture_ = 0;
+            GLint width_ = 0;
+            GLint height_ = 0;
+            glm::mat4 viewProjection_;
+            bool valid_ = false;
+            /** Registers the texture. */
+            util::TrackedResource memory_;
+        };
+
+        /** Holds the cached frames by frame buffer. */
+        std::map<const FrameBuffer*, CachedFrame> frames_;
+    };
+}
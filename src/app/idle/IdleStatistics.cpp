@@ -0,0 +1,58 @@
+/**
+ * @file   IdleStatistics.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the statistics of the periods the simulation is idle.
+ */
+
+#include "IdleStatistics.h"
+#include "app/ApplicationNodeImplementation.h"
+
+namespace viscom::idle {
+
+    void IdleStatistics::UpdateFrame()
+    {
+        const auto& simData = GetAppNode()->GetSimulationData();
+        const auto now = std::chrono::steady_clock::now();
+        if (simData.simulationIdle_) {
+            if (!wasIdle_) {
+                // the pace of the global iteration count before idling is what the clock (or the frame rate) held back since.
+                const auto activeSeconds = std::chrono::duration<double>(now - activeStartTime_).count();
+                if (activeFrames_ > 0 && activeSeconds > 0.0) {
+                    activeIterationRate_ = static_cast<double>(simData.currentGlobalIterationCount_ - activeStartIteration_) / activeSeconds;
+                }
+                idleStartTime_ = now;
+                idleFrames_ = 0;
+                gpuTime_[1] = 0.0;
+            }
+            ++idleFrames_;
+        } else {
+            if (wasIdle_) ReportIdlePeriod();
+            if (wasIdle_ || activeFrames_ == 0) {
+                activeStartTime_ = now;
+                activeStartIteration_ = simData.currentGlobalIterationCount_;
+            }
+            ++activeFrames_;
+        }
+        wasIdle_ = simData.simulationIdle_;
+    }
+
+    void IdleStatistics::CleanUp()
+    {
+        if (wasIdle_) ReportIdlePeriod();
+    }
+
+    void IdleStatistics::ReportIdlePeriod() const
+    {
+        if (idleFrames_ == 0 || activeFrames_ == 0) return;
+        const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - idleStartTime_).count();
+        const auto activeFrameTime = gpuTime_[0] / static_cast<double>(activeFrames_);
+        const auto idleFrameTime = gpuTime_[1] / static_cast<double>(idleFrames_);
+        const auto saved = activeFrameTime > 0.0 ? 100.0 * (1.0 - idleFrameTime / activeFrameTime) : 0.0;
+        const auto skippedIterations = static_cast<std::uint64_t>(seconds * activeIterationRate_);
+        LOG(INFO) << "Idle for " << seconds << "s (" << idleFrames_ << " frames, " << skippedIterations << " iterations skipped): GPU time "
+            << idleFrameTime << "ms per idle frame vs. " << activeFrameTime << "ms per active frame (" << saved << "% saved, "
+            << (activeFrameTime - idleFrameTime) * static_cast<double>(idleFrames_) / 1000.0 << "s GPU time).";
+    }
+}
@@ -0,0 +1,52 @@
+/**
+ * @file   IdleStatistics.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the statistics of the periods the simulation is idle.
+ */
+
+#pragma once
+
+#include "app/NodeComponent.h"
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+namespace viscom::idle {
+
+    /**
+     *  Follows the active and idle periods of the simulation (SimulationData::simulationIdle_) and reports the GPU time
+     *  and the iterations saved at the end of each idle period.
+     */
+    class IdleStatistics final : public NodeComponent
+    {
+    public:
+        explicit IdleStatistics(ApplicationNodeImplementation* appNode) : NodeComponent{ appNode } {}
+
+        void UpdateFrame() override;
+        void CleanUp() override;
+
+        /** Adds GPU time in milliseconds measured in an active (tag 0) or idle (tag 1) frame. */
+        void AddGPUTime(int tag, double milliseconds) { gpuTime_[tag] += milliseconds; }
+
+    private:
+        void ReportIdlePeriod() const;
+
+        /** The simulation was idle in the last frame. */
+        bool wasIdle_ = false;
+        /** Start of the current idle period. */
+        std::chrono::steady_clock::time_point idleStartTime_;
+        /** Number of frames in the current idle period. */
+        std::uint64_t idleFrames_ = 0;
+        /** Number of active frames measured. */
+        std::uint64_t activeFrames_ = 0;
+        /** Start and global iteration count of the current active period. */
+        std::chrono::steady_clock::time_point activeStartTime_;
+        std::uint64_t activeStartIteration_ = 0;
+        /** Rate the global iteration count advanced at in the last active period (iterations per second). */
+        double activeIterationRate_ = 0.0;
+        /** GPU time of simulation, shared passes and all views in active (0) and idle (1) frames in milliseconds. */
+        std::array<double, 2> gpuTime_ = { { 0.0, 0.0 } };
+    };
+}
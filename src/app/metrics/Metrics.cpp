@@ -0,0 +1,230 @@
+/**
+ * @file   Metrics.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the registry of performance metrics exposed in the Prometheus text format.
+ */
+
+#include "Metrics.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace viscom::metrics {
+
+    namespace {
+        void AddAtomic(std::atomic<double>& target, double value)
+        {
+            auto current = target.load(std::memory_order_relaxed);
+            while (!target.compare_exchange_weak(current, current + value, std::memory_order_relaxed)) {}
+        }
+
+        void AppendValue(double value, std::string& text)
+        {
+            if (std::isnan(value)) text += "NaN";
+            else if (std::isinf(value)) text += value > 0.0 ? "+Inf" : "-Inf";
+            else {
+                char buffer[32];
+                std::snprintf(buffer, sizeof(buffer), "%.10g", value);
+                text += buffer;
+            }
+        }
+
+        /** Appends name{labels,extra} value. */
+        void AppendSample(const std::string& name, const char* suffix, const std::string& labels, const std::string& extraLabel, double value, std::string& text)
+        {
+            text += name;
+            text += suffix;
+            if (!labels.empty() || !extraLabel.empty()) {
+                text += '{';
+                text += labels;
+                if (!labels.empty() && !extraLabel.empty()) text += ',';
+                text += extraLabel;
+                text += '}';
+            }
+            text += ' ';
+            AppendValue(value, text);
+            text += '\n';
+        }
+
+        std::string FormatLabelValue(double value)
+        {
+            std::string text;
+            AppendValue(value, text);
+            return text;
+        }
+    }
+
+    void Counter::Increment(double value)
+    {
+        AddAtomic(value_, value);
+    }
+
+    void Counter::Write(const std::string& name, const std::string& labels, std::string& text) const
+    {
+        AppendSample(name, "", labels, "", GetValue(), text);
+    }
+
+    void Gauge::Write(const std::string& name, const std::string& labels, std::string& text) const
+    {
+        AppendSample(name, "", labels, "", GetValue(), text);
+    }
+
+    Histogram::Histogram(std::vector<double> bounds) :
+        bounds_{ std::move(bounds) },
+        counts_{ std::make_unique<std::atomic<std::uint64_t>[]>(bounds_.size() + 1) }
+    {
+        std::sort(bounds_.begin(), bounds_.end());
+        for (std::size_t i = 0; i <= bounds_.size(); ++i) counts_[i].store(0, std::memory_order_relaxed);
+    }
+
+    void Histogram::Observe(double value)
+    {
+        const auto bucket = static_cast<std::size_t>(std::lower_bound(bounds_.begin(), bounds_.end(), value) - bounds_.begin());
+        counts_[bucket].fetch_add(1, std::memory_order_relaxed);
+        AddAtomic(sum_, value);
+    }
+
+    void Histogram::Write(const std::string& name, const std::string& labels, std::string& text) const
+    {
+        // the buckets are read one after the other, a scrape may see an observation in the sum but not yet in a bucket.
+        std::uint64_t cumulative = 0;
+        for (std::size_t i = 0; i < bounds_.size(); ++i) {
+            cumulative += counts_[i].load(std::memory_order_relaxed);
+            AppendSample(name, "_bucket", labels, MetricLabel("le", FormatLabelValue(bounds_[i])), static_cast<double>(cumulative), text);
+        }
+        cumulative += counts_[bounds_.size()].load(std::memory_order_relaxed);
+        AppendSample(name, "_bucket", labels, MetricLabel("le", "+Inf"), static_cast<double>(cumulative), text);
+        AppendSample(name, "_sum", labels, "", sum_.load(std::memory_order_relaxed), text);
+        AppendSample(name, "_count", labels, "", static_cast<double>(cumulative), text);
+    }
+
+    Summary::Summary(std::size_t window, std::vector<double> quantiles) :
+        quantiles_{ std::move(quantiles) },
+        window_(std::max(window, std::size_t{ 1 })),
+        sorted_(window_.size())
+    {
+    }
+
+    void Summary::Observe(double value)
+    {
+        std::lock_guard<std::mutex> lock{ mutex_ };
+        window_[next_] = value;
+        next_ = (next_ + 1) % window_.size();
+        size_ = std::min(size_ + 1, window_.size());
+        ++count_;
+        sum_ += value;
+    }
+
+    void Summary::GetQuantiles(double* values) const
+    {
+        std::lock_guard<std::mutex> lock{ mutex_ };
+        ComputeQuantiles(values);
+    }
+
+    void Summary::ComputeQuantiles(double* values) const
+    {
+        if (size_ == 0) {
+            std::fill(values, values + quantiles_.size(), std::nan(""));
+            return;
+        }
+        std::copy(window_.begin(), window_.begin() + static_cast<std::ptrdiff_t>(size_), sorted_.begin());
+        const auto sortedEnd = sorted_.begin() + static_cast<std::ptrdiff_t>(size_);
+        std::sort(sorted_.begin(), sortedEnd);
+        for (std::size_t i = 0; i < quantiles_.size(); ++i) {
+            // nearest rank, the quantiles of frame times should be values that actually occurred.
+            const auto rank = static_cast<std::size_t>(std::ceil(std::clamp(quantiles_[i], 0.0, 1.0) * static_cast<double>(size_)));
+            values[i] = sorted_[std::min(std::max(rank, std::size_t{ 1 }), size_) - 1];
+        }
+    }
+
+    void Summary::Write(const std::string& name, const std::string& labels, std::string& text) const
+    {
+        std::vector<double> values(quantiles_.size());
+        std::uint64_t count = 0;
+        double sum = 0.0;
+        {
+            std::lock_guard<std::mutex> lock{ mutex_ };
+            ComputeQuantiles(values.data());
+            count = count_;
+            sum = sum_;
+        }
+        for (std::size_t i = 0; i < quantiles_.size(); ++i) {
+            AppendSample(name, "", labels, MetricLabel("quantile", FormatLabelValue(quantiles_[i])), values[i], text);
+        }
+        AppendSample(name, "_sum", labels, "", sum, text);
+        AppendSample(name, "_count", labels, "", static_cast<double>(count), text);
+    }
+
+    std::string MetricLabel(const std::string& name, const std::string& value)
+    {
+        std::string label = name + "=\"";
+        for (auto c : value) {
+            if (c == '\\') label += "\\\\";
+            else if (c == '"') label += "\\\"";
+            else if (c == '\n') label += "\\n";
+            else label += c;
+        }
+        label += '"';
+        return label;
+    }
+
+    Metric* MetricsRegistry::Find(const std::string& name, const std::string& labels) const
+    {
+        for (const auto& entry : entries_) {
+            if (entry.name_ == name && entry.labels_ == labels) return entry.metric_.get();
+        }
+        return nullptr;
+    }
+
+    Counter& MetricsRegistry::AddCounter(const std::string& name, const std::string& help, const std::string& labels)
+    {
+        std::lock_guard<std::mutex> lock{ mutex_ };
+        if (auto counter = dynamic_cast<Counter*>(Find(name, labels))) return *counter;
+        entries_.push_back(Entry{ name, help, labels, std::make_unique<Counter>() });
+        return static_cast<Counter&>(*entries_.back().metric_);
+    }
+
+    Gauge& MetricsRegistry::AddGauge(const std::string& name, const std::string& help, const std::string& labels)
+    {
+        std::lock_guard<std::mutex> lock{ mutex_ };
+        if (auto gauge = dynamic_cast<Gauge*>(Find(name, labels))) return *gauge;
+        entries_.push_back(Entry{ name, help, labels, std::make_unique<Gauge>() });
+        return static_cast<Gauge&>(*entries_.back().metric_);
+    }
+
+    Histogram& MetricsRegistry::AddHistogram(const std::string& name, const std::string& help, std::vector<double> bounds, const std::string& labels)
+    {
+        std::lock_guard<std::mutex> lock{ mutex_ };
+        if (auto histogram = dynamic_cast<Histogram*>(Find(name, labels))) return *histogram;
+        entries_.push_back(Entry{ name, help, labels, std::make_unique<Histogram>(std::move(bounds)) });
+        return static_cast<Histogram&>(*entries_.back().metric_);
+    }
+
+    Summary& MetricsRegistry::AddSummary(const std::string& name, const std::string& help, std::size_t window, std::vector<double> quantiles, const std::string& labels)
+    {
+        std::lock_guard<std::mutex> lock{ mutex_ };
+        if (auto summary = dynamic_cast<Summary*>(Find(name, labels))) return *summary;
+        entries_.push_back(Entry{ name, help, labels, std::make_unique<Summary>(window, std::move(quantiles)) });
+        return static_cast<Summary&>(*entries_.back().metric_);
+    }
+
+    void MetricsRegistry::WriteText(std::string& text) const
+    {
+        std::lock_guard<std::mutex> lock{ mutex_ };
+        // the format needs the samples of a family together, they may have been added at different times.
+        for (std::size_t i = 0; i < entries_.size(); ++i) {
+            const auto& family = entries_[i];
+            auto written = false;
+            for (std::size_t j = 0; j < i && !written; ++j) written = entries_[j].name_ == family.name_;
+            if (written) continue;
+
+            text += "# HELP " + family.name_ + " " + family.help_ + "\n";
+            text += "# TYPE " + family.name_ + " " + family.metric_->GetType() + "\n";
+            for (std::size_t j = i; j < entries_.size(); ++j) {
+                if (entries_[j].name_ == family.name_) entries_[j].metric_->Write(family.name_, entries_[j].labels_, text);
+            }
+        }
+    }
+}
@@ -0,0 +1,165 @@
+/**
+ * @file   Metrics.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the registry of performance metrics exposed in the Prometheus text format.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace viscom::metrics {
+
+    /** Base of all metrics, values are updated on the GL thread and written by the metrics server thread. */
+    class Metric
+    {
+    public:
+        virtual ~Metric() = default;
+        /** The Prometheus type name. */
+        virtual const char* GetType() const = 0;
+        /** Appends the samples of the metric (labels without braces, may be empty). */
+        virtual void Write(const std::string& name, const std::string& labels, std::string& text) const = 0;
+    };
+
+    /** A value that only increases. */
+    class Counter : public Metric
+    {
+    public:
+        void Increment(double value = 1.0);
+        double GetValue() const { return value_.load(std::memory_order_relaxed); }
+
+        virtual const char* GetType() const override { return "counter"; }
+        virtual void Write(const std::string& name, const std::string& labels, std::string& text) const override;
+
+    private:
+        std::atomic<double> value_{ 0.0 };
+    };
+
+    /** A value that is set. */
+    class Gauge : public Metric
+    {
+    public:
+        void Set(double value) { value_.store(value, std::memory_order_relaxed); }
+        double GetValue() const { return value_.load(std::memory_order_relaxed); }
+
+        virtual const char* GetType() const override { return "gauge"; }
+        virtual void Write(const std::string& name, const std::string& labels, std::string& text) const override;
+
+    private:
+        std::atomic<double> value_{ 0.0 };
+    };
+
+    /** Counts observations in fixed buckets (the quantiles are estimated by the server). */
+    class Histogram : public Metric
+    {
+    public:
+        /** The upper bounds of the buckets in increasing order (+Inf is added). */
+        explicit Histogram(std::vector<double> bounds);
+        void Observe(double value);
+
+        virtual const char* GetType() const override { return "histogram"; }
+        virtual void Write(const std::string& name, const std::string& labels, std::string& text) const override;
+
+    private:
+        std::vector<double> bounds_;
+        /** Holds the count of each bucket (not cumulative) and of the +Inf bucket. */
+        std::unique_ptr<std::atomic<std::uint64_t>[]> counts_;
+        std::atomic<double> sum_{ 0.0 };
+    };
+
+    /** Computes quantiles over the newest observations (exact, for the frame time percentiles). */
+    class Summary : public Metric
+    {
+    public:
+        /** Quantiles over the newest window observations. */
+        Summary(std::size_t window, std::vector<double> quantiles);
+        void Observe(double value);
+        /** Writes the quantiles in the order they were given to the constructor (no allocation). */
+        void GetQuantiles(double* values) const;
+        std::size_t GetNumQuantiles() const { return quantiles_.size(); }
+
+        virtual const char* GetType() const override { return "summary"; }
+        virtual void Write(const std::string& name, const std::string& labels, std::string& text) const override;
+
+    private:
+        void ComputeQuantiles(double* values) const;
+
+        std::vector<double> quantiles_;
+        /** Protects the observations. */
+        mutable std::mutex mutex_;
+        /** Holds the newest observations (ring buffer) and a scratch copy to select the quantiles in. */
+        std::vector<double> window_;
+        mutable std::vector<double> sorted_;
+        std::size_t next_ = 0;
+        std::size_t size_ = 0;
+        std::uint64_t count_ = 0;
+        double sum_ = 0.0;
+    };
+
+    /** Formats a label as name="value" (escaped). */
+    std::string MetricLabel(const std::string& name, const std::string& value);
+
+    /**
+     *  Holds the metrics of a node. Metrics are added at start up (or when a node reports for the first time), the
+     *  references stay valid for the lifetime of the registry. Updating a metric does not lock or allocate, so it can
+     *  be done in the frame loop. Metrics with the same name and different labels form one family.
+     */
+    class MetricsRegistry
+    {
+    public:
+        MetricsRegistry() = default;
+        MetricsRegistry(const MetricsRegistry&) = delete;
+        MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+        /** Adds a metric or returns the one with the same name and labels. */
+        Counter& AddCounter(const std::string& name, const std::string& help, const std::string& labels = "");
+        Gauge& AddGauge(const std::string& name, const std::string& help, const std::string& labels = "");
+        Histogram& AddHistogram(const std::string& name, const std::string& help, std::vector<double> bounds, const std::string& labels = "");
+        Summary& AddSummary(const std::string& name, const std::string& help, std::size_t window, std::vector<double> quantiles, const std::string& labels = "");
+
+        /** Writes all metrics in the Prometheus text exposition format (version 0.0.4). */
+        void WriteText(std::string& text) const;
+
+    private:
+        struct Entry {
+            std::string name_;
+            std::string help_;
+            std::string labels_;
+            std::unique_ptr<Metric> metric_;
+        };
+
+        Metric* Find(const std::string& name, const std::string& labels) const;
+
+        /** Protects the entries (not the values). */
+        mutable std::mutex mutex_;
+        /** Holds the metrics in the order they were added. */
+        std::vector<Entry> entries_;
+    };
+
+    /** Performance summary of a node over the last second (reported by the slaves to the master). */
+    struct NodeMetricsSnapshot {
+        double iterationsPerSecond_ = 0.0;
+        /** Global iteration count minus the iteration displayed. */
+        double iterationLag_ = 0.0;
+        /** GPU time per frame in milliseconds. */
+        double simulationGPUTime_ = 0.0;
+        double sharedPassGPUTime_ = 0.0;
+        double viewGPUTime_ = 0.0;
+        double seedPointsPerFrame_ = 0.0;
+        double syncBytesPerSecond_ = 0.0;
+        /** Frame time percentiles in milliseconds. */
+        double frameTimeP50_ = 0.0;
+        double frameTimeP95_ = 0.0;
+        double frameTimeP99_ = 0.0;
+        /** Tracked GPU and host memory in bytes (see util::ResourceRegistry). */
+        double gpuMemoryBytes_ = 0.0;
+        double hostMemoryBytes_ = 0.0;
+    };
+}
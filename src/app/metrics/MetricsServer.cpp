@@ -0,0 +1,112 @@
+/**
+ * @file   MetricsServer.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the HTTP endpoint serving the metrics of a node in the Prometheus text format.
+ */
+
+#include "MetricsServer.h"
+#include "Metrics.h"
+#include "app/util/Socket.h"
+#include <cstring>
+
+namespace viscom::metrics {
+
+    using util::ToSocket;
+
+    namespace {
+        /** The worker checks for the stop flag at least this often. */
+        constexpr int ACCEPT_INTERVAL_MILLISECONDS = 100;
+        /** Clients that do not send their request or take the response within this time are dropped. */
+        constexpr int CLIENT_TIMEOUT_MILLISECONDS = 1000;
+        /** Largest request header read, scrapers send a few hundred bytes. */
+        constexpr std::size_t MAX_REQUEST_SIZE = 8192;
+
+        std::string MakeResponse(const char* status, const char* contentType, const std::string& body)
+        {
+            return std::string("HTTP/1.0 ") + status + "\r\nContent-Type: " + contentType + "\r\nContent-Length: " + std::to_string(body.size())
+                + "\r\nConnection: close\r\n\r\n" + body;
+        }
+    }
+
+    MetricsServer::MetricsServer(const MetricsRegistry& registry) :
+        registry_{ registry }
+    {
+        util::StartSockets();
+    }
+
+    MetricsServer::~MetricsServer()
+    {
+        Stop();
+        util::StopSockets();
+    }
+
+    bool MetricsServer::Start(const std::string& address, unsigned short port)
+    {
+        Stop();
+        auto listenSocket = util::ListenTCP(address, port);
+        if (listenSocket == VISCOM_INVALID_SOCKET) return false;
+        listenSocket_ = static_cast<std::intptr_t>(listenSocket);
+
+        stopWorker_ = false;
+        worker_ = std::thread([this]() { WorkerLoop(); });
+        return true;
+    }
+
+    void MetricsServer::Stop()
+    {
+        if (worker_.joinable()) {
+            stopWorker_ = true;
+            worker_.join();
+        }
+        util::CloseSocket(listenSocket_);
+    }
+
+    void MetricsServer::WorkerLoop()
+    {
+        while (!stopWorker_) {
+            pollfd listenPoll{ ToSocket(listenSocket_), POLLIN, 0 };
+            if (VISCOM_POLL(&listenPoll, 1, ACCEPT_INTERVAL_MILLISECONDS) <= 0 || (listenPoll.revents & POLLIN) == 0) continue;
+
+            auto s = util::AcceptSocket(ToSocket(listenSocket_));
+            if (s == VISCOM_INVALID_SOCKET) continue;
+            util::SetTimeouts(s, CLIENT_TIMEOUT_MILLISECONDS, CLIENT_TIMEOUT_MILLISECONDS);
+            Serve(static_cast<std::intptr_t>(s));
+            VISCOM_CLOSE_SOCKET(s);
+        }
+    }
+
+    void MetricsServer::Serve(std::intptr_t client)
+    {
+        const auto s = ToSocket(client);
+        std::string request;
+        char buffer[1024];
+        while (request.find("\r\n\r\n") == std::string::npos && request.size() < MAX_REQUEST_SIZE) {
+            auto received = util::ReceiveSome(s, buffer, sizeof(buffer));
+            if (received <= 0) return;
+            request.append(buffer, static_cast<std::size_t>(received));
+        }
+
+        // only the request line matters, e.g. "GET /metrics HTTP/1.1".
+        const auto lineEnd = request.find("\r\n");
+        const auto requestLine = request.substr(0, lineEnd);
+        const auto pathStart = requestLine.find(' ');
+        const auto pathEnd = requestLine.find(' ', pathStart + 1);
+        const auto method = requestLine.substr(0, pathStart);
+        auto path = pathStart == std::string::npos ? std::string{} : requestLine.substr(pathStart + 1, pathEnd - pathStart - 1);
+        path = path.substr(0, path.find('?'));
+
+        std::string response;
+        if (method != "GET" && method != "HEAD") response = MakeResponse("405 Method Not Allowed", "text/plain", "Only GET is supported.\n");
+        else if (path != "/metrics" && path != "/") response = MakeResponse("404 Not Found", "text/plain", "Metrics are served at /metrics.\n");
+        else {
+            std::string body;
+            registry_.WriteText(body);
+            response = MakeResponse("200 OK", "text/plain; version=0.0.4; charset=utf-8", body);
+            if (method == "HEAD") response.resize(response.size() - body.size());
+            ++scrapes_;
+        }
+        util::SendAll(s, response.data(), response.size());
+    }
+}
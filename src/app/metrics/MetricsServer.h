@@ -0,0 +1,53 @@
+/**
+ * @file   MetricsServer.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the HTTP endpoint serving the metrics of a node in the Prometheus text format.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+namespace viscom::metrics {
+
+    class MetricsRegistry;
+
+    /**
+     *  Minimal HTTP/1.0 server for scrapes: answers GET /metrics (and GET /) with the registry in the text format and
+     *  closes the connection. Requests are handled one after the other on a worker thread, so a scrape never stalls
+     *  the frame loop. Bind it to localhost unless a collector on another host needs access.
+     */
+    class MetricsServer
+    {
+    public:
+        explicit MetricsServer(const MetricsRegistry& registry);
+        MetricsServer(const MetricsServer&) = delete;
+        MetricsServer& operator=(const MetricsServer&) = delete;
+        ~MetricsServer();
+
+        /** Listens on the interface with the given IPv4 address (0.0.0.0 for all) and starts the worker. */
+        bool Start(const std::string& address, unsigned short port);
+
+        /** Number of scrapes served so far. */
+        std::uint64_t GetNumScrapes() const { return scrapes_; }
+
+    private:
+        void WorkerLoop();
+        void Serve(std::intptr_t client);
+        void Stop();
+
+        /** The registry served. */
+        const MetricsRegistry& registry_;
+        /** Holds the listening socket. */
+        std::intptr_t listenSocket_ = -1;
+        std::atomic<bool> stopWorker_{ false };
+        std::atomic<std::uint64_t> scrapes_{ 0 };
+        /** Holds the worker thread. */
+        std::thread worker_;
+    };
+}
@@ -0,0 +1,129 @@
+/**
+ * @file   NodeMetrics.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the performance metrics of an application node.
+ */
+
+#include "NodeMetrics.h"
+#include "MetricsServer.h"
+#include "app/ApplicationNodeImplementation.h"
+#include "app/sync/SustainableRate.h"
+#include "app/util/ResourceRegistry.h"
+#include <algorithm>
+#include <cassert>
+
+namespace viscom::metrics {
+
+    NodeMetrics::NodeMetrics(ApplicationNodeImplementation* appNode) :
+        NodeComponent{ appNode }
+    {
+    }
+
+    NodeMetrics::~NodeMetrics() = default;
+
+    void NodeMetrics::Init()
+    {
+        const auto& settings = GetAppNode()->GetAppSettings();
+        const std::vector<double> gpuTimeBuckets = { 0.25, 0.5, 1.0, 2.0, 4.0, 8.0, 16.0, 33.0, 66.0 };
+        const auto gpuTimeHelp = "GPU time of the passes per frame (views: per window and eye) in milliseconds.";
+        iterationsMetric_ = &registry_.AddCounter("rd_iterations_total", "Simulation iterations computed by this node.");
+        iterationRateMetric_ = &registry_.AddGauge("rd_iterations_per_second", "Simulation iterations computed per second (last metrics interval).");
+        sustainableRateMetric_ = &registry_.AddGauge("rd_sustainable_iterations_per_second", "Iterations per second this node can simulate within its budget.");
+        iterationLagMetric_ = &registry_.AddGauge("rd_iteration_lag", "Global iteration count minus the iteration displayed by this node.");
+        gpuTimeMetrics_[static_cast<std::size_t>(GPUPass::Simulation)] = &registry_.AddHistogram("rd_gpu_pass_milliseconds", gpuTimeHelp, gpuTimeBuckets, MetricLabel("pass", "simulation"));
+        gpuTimeMetrics_[static_cast<std::size_t>(GPUPass::Shared)] = &registry_.AddHistogram("rd_gpu_pass_milliseconds", gpuTimeHelp, gpuTimeBuckets, MetricLabel("pass", "shared"));
+        gpuTimeMetrics_[static_cast<std::size_t>(GPUPass::View)] = &registry_.AddHistogram("rd_gpu_pass_milliseconds", gpuTimeHelp, gpuTimeBuckets, MetricLabel("pass", "view"));
+        seedPointsMetric_ = &registry_.AddHistogram("rd_seed_points_per_frame", "Seed points applied per frame.", { 0.0, 1.0, 2.0, 4.0, 8.0, 16.0, 32.0 });
+        syncBytesMetric_ = &registry_.AddCounter("rd_sync_bytes_total", "Bytes of simulation data, seed points and resync states sent (master) or received (slaves).");
+        registry_.AddGauge("rd_fixed_point_simulation", "1 if this node simulates in deterministic fixed point, 0 for floating point.")
+            .Set(settings.fixedPointSimulation_ ? 1.0 : 0.0);
+        registry_.AddGauge("rd_in_place_simulation", "1 if this node updates a single state in four colour order, 0 for ping-pong.")
+            .Set(settings.inPlaceSimulation_ ? 1.0 : 0.0);
+        gpuMemoryMetric_ = &registry_.AddGauge("rd_gpu_memory_bytes", "Tracked textures, renderbuffers and buffers of this node in bytes.");
+        hostMemoryMetric_ = &registry_.AddGauge("rd_host_memory_bytes", "Tracked host allocations of this node in bytes.");
+        frameTimeMetric_ = &registry_.AddSummary("rd_frame_time_milliseconds", "Time between two frames of this node in milliseconds (last 600 frames).",
+            FRAME_TIME_WINDOW, { 0.5, 0.95, 0.99 });
+
+        if (settings.metricsPort_ == 0) return;
+        server_ = std::make_unique<MetricsServer>(registry_);
+        if (server_->Start(settings.metricsAddress_, static_cast<unsigned short>(settings.metricsPort_))) {
+            LOG(INFO) << "Serving metrics at http://" << settings.metricsAddress_ << ":" << settings.metricsPort_ << "/metrics.";
+        } else {
+            LOG(WARNING) << "Could not serve metrics on " << settings.metricsAddress_ << ":" << settings.metricsPort_ << ".";
+            server_ = nullptr;
+        }
+    }
+
+    void NodeMetrics::CleanUp()
+    {
+        if (server_) LOG(INFO) << "Served " << server_->GetNumScrapes() << " metrics scrapes.";
+        server_ = nullptr;
+    }
+
+    void NodeMetrics::CountSimulation(std::uint64_t iterations, std::uint64_t seedPoints)
+    {
+        iterationsMetric_->Increment(static_cast<double>(iterations));
+        intervalIterations_ += iterations;
+        seedPointsMetric_->Observe(static_cast<double>(seedPoints));
+        intervalSeedPoints_ += seedPoints;
+    }
+
+    void NodeMetrics::ObserveGPUTime(GPUPass pass, double milliseconds)
+    {
+        gpuTimeMetrics_[static_cast<std::size_t>(pass)]->Observe(milliseconds);
+        intervalGPUTime_[static_cast<std::size_t>(pass)] += milliseconds;
+    }
+
+    void NodeMetrics::CountSyncBytes(std::size_t bytes)
+    {
+        syncBytesMetric_->Increment(static_cast<double>(bytes));
+        intervalSyncBytes_ += bytes;
+    }
+
+    void NodeMetrics::UpdateFrame()
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (lastFrameStart_ != std::chrono::steady_clock::time_point{}) {
+            frameTimeMetric_->Observe(std::chrono::duration<double, std::milli>(now - lastFrameStart_).count());
+        }
+        lastFrameStart_ = now;
+
+        const auto globalIterations = GetAppNode()->GetSimulationData().currentGlobalIterationCount_;
+        iterationLagMetric_->Set(static_cast<double>(globalIterations - std::min(GetAppNode()->GetDisplayedIterationCount(), globalIterations)));
+        sustainableRateMetric_->Set(GetAppNode()->GetSustainableRate().GetRate());
+        ++intervalFrames_;
+
+        const auto seconds = std::chrono::duration<double>(now - intervalStart_).count();
+        if (now - intervalStart_ < METRICS_INTERVAL) return;
+        intervalStart_ = now;
+
+        const auto frames = static_cast<double>(intervalFrames_);
+        snapshot_.iterationsPerSecond_ = static_cast<double>(intervalIterations_) / seconds;
+        snapshot_.iterationLag_ = iterationLagMetric_->GetValue();
+        snapshot_.simulationGPUTime_ = intervalGPUTime_[static_cast<std::size_t>(GPUPass::Simulation)] / frames;
+        snapshot_.sharedPassGPUTime_ = intervalGPUTime_[static_cast<std::size_t>(GPUPass::Shared)] / frames;
+        snapshot_.viewGPUTime_ = intervalGPUTime_[static_cast<std::size_t>(GPUPass::View)] / frames;
+        snapshot_.seedPointsPerFrame_ = static_cast<double>(intervalSeedPoints_) / frames;
+        snapshot_.syncBytesPerSecond_ = static_cast<double>(intervalSyncBytes_) / seconds;
+        std::array<double, 3> frameTimes;
+        assert(frameTimeMetric_->GetNumQuantiles() == frameTimes.size());
+        frameTimeMetric_->GetQuantiles(frameTimes.data());
+        snapshot_.frameTimeP50_ = frameTimes[0];
+        snapshot_.frameTimeP95_ = frameTimes[1];
+        snapshot_.frameTimeP99_ = frameTimes[2];
+        iterationRateMetric_->Set(snapshot_.iterationsPerSecond_);
+        const auto memory = util::GetResourceTotals();
+        snapshot_.gpuMemoryBytes_ = static_cast<double>(memory.GetGPUBytes());
+        snapshot_.hostMemoryBytes_ = static_cast<double>(memory.GetHostBytes());
+        gpuMemoryMetric_->Set(snapshot_.gpuMemoryBytes_);
+        hostMemoryMetric_->Set(snapshot_.hostMemoryBytes_);
+
+        intervalFrames_ = 0;
+        intervalIterations_ = 0;
+        intervalGPUTime_ = { { 0.0, 0.0, 0.0 } };
+        intervalSeedPoints_ = 0;
+        intervalSyncBytes_ = 0;
+    }
+}
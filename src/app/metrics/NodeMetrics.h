@@ -0,0 +1,84 @@
+/**
+ * @file   NodeMetrics.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the performance metrics of an application node.
+ */
+
+#pragma once
+
+#include "app/NodeComponent.h"
+#include "Metrics.h"
+#include <array>
+#include <chrono>
+#include <memory>
+
+namespace viscom::metrics {
+
+    class MetricsServer;
+
+    /** Passes whose GPU time is measured. */
+    enum class GPUPass { Simulation, Shared, View };
+
+    /**
+     *  Holds the metrics of a node, serves them if a metrics port is set (AppSettings::metricsPort_) and summarizes
+     *  them once per interval (sent to the master by the slaves).
+     */
+    class NodeMetrics final : public NodeComponent
+    {
+    public:
+        explicit NodeMetrics(ApplicationNodeImplementation* appNode);
+        ~NodeMetrics() override;
+
+        /** Adds the metrics of this node and starts the endpoint if a port is set. */
+        void Init() override;
+        /** Updates the per frame metrics and takes a snapshot once per metrics interval. */
+        void UpdateFrame() override;
+        void CleanUp() override;
+
+        /** Counts the iterations and seed points simulated this frame. */
+        void CountSimulation(std::uint64_t iterations, std::uint64_t seedPoints);
+        /** Adds a GPU time measurement of a pass in milliseconds. */
+        void ObserveGPUTime(GPUPass pass, double milliseconds);
+        /** Counts the bytes sent or received by the synchronization of this frame. */
+        void CountSyncBytes(std::size_t bytes);
+
+        /** The metrics of this node (served if a metrics port is set). */
+        MetricsRegistry& GetRegistry() { return registry_; }
+        /** Performance summary of the last metrics interval. */
+        const NodeMetricsSnapshot& GetSnapshot() const { return snapshot_; }
+
+    private:
+        /** Holds the metrics of this node. */
+        MetricsRegistry registry_;
+        /** Serves the metrics over HTTP (optional). */
+        std::unique_ptr<MetricsServer> server_;
+        /** The metrics updated in the frame loop (owned by the registry). */
+        Counter* iterationsMetric_ = nullptr;
+        Gauge* iterationRateMetric_ = nullptr;
+        Gauge* sustainableRateMetric_ = nullptr;
+        Gauge* iterationLagMetric_ = nullptr;
+        std::array<Histogram*, 3> gpuTimeMetrics_ = { { nullptr, nullptr, nullptr } };
+        Histogram* seedPointsMetric_ = nullptr;
+        Counter* syncBytesMetric_ = nullptr;
+        Summary* frameTimeMetric_ = nullptr;
+        Gauge* gpuMemoryMetric_ = nullptr;
+        Gauge* hostMemoryMetric_ = nullptr;
+        /** Start of the last frame (frame time metric). */
+        std::chrono::steady_clock::time_point lastFrameStart_;
+        /** Performance summary of the last metrics interval. */
+        NodeMetricsSnapshot snapshot_;
+        /** Start of the current metrics interval and the frames, iterations, GPU time in milliseconds (per GPUPass), seed points and sync bytes since. */
+        std::chrono::steady_clock::time_point intervalStart_ = std::chrono::steady_clock::now();
+        std::uint64_t intervalFrames_ = 0;
+        std::uint64_t intervalIterations_ = 0;
+        std::array<double, 3> intervalGPUTime_ = { { 0.0, 0.0, 0.0 } };
+        std::uint64_t intervalSeedPoints_ = 0;
+        std::uint64_t intervalSyncBytes_ = 0;
+        /** Interval of the metrics snapshots. */
+        static constexpr std::chrono::seconds METRICS_INTERVAL{ 1 };
+        /** Frames the frame time percentiles are computed over. */
+        static constexpr std::size_t FRAME_TIME_WINDOW = 600;
+    };
+}
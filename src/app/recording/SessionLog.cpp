@@ -0,0 +1,276 @@
+/**
+ * @file   SessionLog.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the binary log of recorded input sessions.
+ */
+
+#include "SessionLog.h"
+#include <algorithm>
+#include <cstring>
+
+namespace viscom::recording {
+
+    namespace {
+        /** File magic ("RDSL"). */
+        constexpr std::uint32_t SESSION_MAGIC = 0x4C534452;
+        constexpr std::uint32_t SESSION_VERSION = 2;
+        /** Buffered bytes written to the file at once. */
+        constexpr std::size_t FLUSH_SIZE = 64 * 1024;
+
+        void WriteVarint(std::vector<std::uint8_t>& buffer, std::uint64_t value)
+        {
+            while (value >= 0x80) {
+                buffer.push_back(static_cast<std::uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            buffer.push_back(static_cast<std::uint8_t>(value));
+        }
+
+        void WriteSigned(std::vector<std::uint8_t>& buffer, std::int64_t value)
+        {
+            WriteVarint(buffer, (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+        }
+
+        template<typename T> void WriteRaw(std::vector<std::uint8_t>& buffer, const T& value)
+        {
+            const auto bytes = reinterpret_cast<const std::uint8_t*>(&value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        void WriteParameters(std::vector<std::uint8_t>& buffer, const SessionParameters& parameters)
+        {
+            WriteRaw(buffer, parameters.drawDistance_);
+            WriteRaw(buffer, parameters.height_);
+            WriteRaw(buffer, parameters.eta_);
+            for (auto sigma : parameters.sigmaA_) WriteRaw(buffer, sigma);
+            WriteVarint(buffer, parameters.resetIteration_);
+            WriteSigned(buffer, parameters.warmStartPreset_);
+            WriteVarint(buffer, parameters.warmStartIteration_);
+            WriteRaw(buffer, parameters.diffusionRateA_);
+            WriteRaw(buffer, parameters.diffusionRateB_);
+            WriteRaw(buffer, parameters.feedRate_);
+            WriteRaw(buffer, parameters.killRate_);
+            WriteRaw(buffer, parameters.dt_);
+            WriteRaw(buffer, parameters.seedPointRadius_);
+            buffer.push_back(parameters.useManhattanDistance_ ? 1 : 0);
+            WriteSigned(buffer, parameters.simulationScale_);
+            WriteSigned(buffer, parameters.renderer_);
+        }
+
+        /** Bounds checked reading from the mapped log. */
+        class Reader
+        {
+        public:
+            Reader(const std::uint8_t* data, std::size_t size, std::size_t position) : data_{ data }, size_{ size }, position_{ position } {}
+
+            bool Varint(std::uint64_t& value)
+            {
+                value = 0;
+                for (unsigned int shift = 0; shift < 64; shift += 7) {
+                    if (position_ >= size_) return false;
+                    const auto byte = data_[position_++];
+                    value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+                    if ((byte & 0x80) == 0) return true;
+                }
+                return false;
+            }
+
+            template<typename T> bool Signed(T& value)
+            {
+                std::uint64_t encoded = 0;
+                if (!Varint(encoded)) return false;
+                value = static_cast<T>(static_cast<std::int64_t>(encoded >> 1) ^ -static_cast<std::int64_t>(encoded & 1));
+                return true;
+            }
+
+            template<typename T> bool Raw(T& value)
+            {
+                if (size_ - position_ < sizeof(T)) return false;
+                std::memcpy(&value, data_ + position_, sizeof(T));
+                position_ += sizeof(T);
+                return true;
+            }
+
+            bool Parameters(SessionParameters& parameters)
+            {
+                std::uint8_t manhattan = 0;
+                auto ok = Raw(parameters.drawDistance_) && Raw(parameters.height_) && Raw(parameters.eta_);
+                for (auto& sigma : parameters.sigmaA_) ok = ok && Raw(sigma);
+                ok = ok && Varint(parameters.resetIteration_) && Signed(parameters.warmStartPreset_) && Varint(parameters.warmStartIteration_)
+                    && Raw(parameters.diffusionRateA_) && Raw(parameters.diffusionRateB_) && Raw(parameters.feedRate_) && Raw(parameters.killRate_)
+                    && Raw(parameters.dt_) && Raw(parameters.seedPointRadius_) && Raw(manhattan) && Signed(parameters.simulationScale_)
+                    && Signed(parameters.renderer_);
+                parameters.useManhattanDistance_ = manhattan != 0;
+                return ok;
+            }
+
+            std::size_t GetPosition() const { return position_; }
+
+        private:
+            const std::uint8_t* data_;
+            std::size_t size_;
+            std::size_t position_;
+        };
+    }
+
+    bool SessionParameters::operator==(const SessionParameters& rhs) const
+    {
+        return drawDistance_ == rhs.drawDistance_ && height_ == rhs.height_ && eta_ == rhs.eta_ && sigmaA_[0] == rhs.sigmaA_[0]
+            && sigmaA_[1] == rhs.sigmaA_[1] && sigmaA_[2] == rhs.sigmaA_[2] && resetIteration_ == rhs.resetIteration_
+            && warmStartPreset_ == rhs.warmStartPreset_ && warmStartIteration_ == rhs.warmStartIteration_ && diffusionRateA_ == rhs.diffusionRateA_
+            && diffusionRateB_ == rhs.diffusionRateB_ && feedRate_ == rhs.feedRate_ && killRate_ == rhs.killRate_ && dt_ == rhs.dt_
+            && seedPointRadius_ == rhs.seedPointRadius_ && useManhattanDistance_ == rhs.useManhattanDistance_
+            && simulationScale_ == rhs.simulationScale_ && renderer_ == rhs.renderer_;
+    }
+
+    SessionRecorder::~SessionRecorder()
+    {
+        if (IsOpen()) Close(lastIteration_);
+    }
+
+    bool SessionRecorder::Open(const std::string& filename, const SessionParameters& initialParameters)
+    {
+        ofs_.open(filename, std::ofstream::binary | std::ofstream::trunc);
+        if (!ofs_.is_open()) return false;
+
+        startTime_ = std::chrono::steady_clock::now();
+        lastIteration_ = 0;
+        lastTime_ = 0;
+        numRecords_ = 0;
+        buffer_.clear();
+        WriteRaw(buffer_, SESSION_MAGIC);
+        WriteRaw(buffer_, SESSION_VERSION);
+        WriteParameters(buffer_, initialParameters);
+        return true;
+    }
+
+    void SessionRecorder::BeginRecord(RecordType type, std::uint64_t iteration)
+    {
+        const auto time = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime_).count());
+        buffer_.push_back(static_cast<std::uint8_t>(type));
+        // the global iteration never decreases, a reset only schedules a reset iteration.
+        WriteVarint(buffer_, iteration >= lastIteration_ ? iteration - lastIteration_ : 0);
+        WriteVarint(buffer_, time - lastTime_);
+        lastIteration_ = std::max(lastIteration_, iteration);
+        lastTime_ = time;
+        ++numRecords_;
+    }
+
+    void SessionRecorder::RecordMouseButton(std::uint64_t iteration, int button, int action)
+    {
+        if (!IsOpen()) return;
+        BeginRecord(RecordType::MOUSE_BUTTON, iteration);
+        WriteSigned(buffer_, button);
+        WriteSigned(buffer_, action);
+        if (buffer_.size() >= FLUSH_SIZE) Flush();
+    }
+
+    void SessionRecorder::RecordMousePosition(std::uint64_t iteration, float x, float y)
+    {
+        if (!IsOpen()) return;
+        BeginRecord(RecordType::MOUSE_POSITION, iteration);
+        WriteRaw(buffer_, x);
+        WriteRaw(buffer_, y);
+        if (buffer_.size() >= FLUSH_SIZE) Flush();
+    }
+
+    void SessionRecorder::RecordTuio(RecordType type, std::uint64_t iteration, int cursorId, float x, float y)
+    {
+        if (!IsOpen()) return;
+        BeginRecord(type, iteration);
+        WriteSigned(buffer_, cursorId);
+        WriteRaw(buffer_, x);
+        WriteRaw(buffer_, y);
+        if (buffer_.size() >= FLUSH_SIZE) Flush();
+    }
+
+    void SessionRecorder::RecordSeed(std::uint64_t iteration, std::uint64_t seedIteration, float x, float y)
+    {
+        if (!IsOpen()) return;
+        BeginRecord(RecordType::SEED, iteration);
+        WriteVarint(buffer_, seedIteration - iteration);
+        WriteRaw(buffer_, x);
+        WriteRaw(buffer_, y);
+        if (buffer_.size() >= FLUSH_SIZE) Flush();
+    }
+
+    void SessionRecorder::RecordParameters(std::uint64_t iteration, const SessionParameters& parameters)
+    {
+        if (!IsOpen()) return;
+        BeginRecord(RecordType::PARAMETERS, iteration);
+        WriteParameters(buffer_, parameters);
+        if (buffer_.size() >= FLUSH_SIZE) Flush();
+    }
+
+    void SessionRecorder::Close(std::uint64_t finalIteration)
+    {
+        if (!IsOpen()) return;
+        BeginRecord(RecordType::END, finalIteration);
+        Flush();
+        ofs_.close();
+    }
+
+    void SessionRecorder::Flush()
+    {
+        ofs_.write(reinterpret_cast<const char*>(buffer_.data()), static_cast<std::streamsize>(buffer_.size()));
+        buffer_.clear();
+    }
+
+    bool SessionPlayer::Open(const std::string& filename)
+    {
+        hasNext_ = false;
+        if (!file_.Open(filename)) return false;
+
+        Reader reader{ static_cast<const std::uint8_t*>(file_.GetData()), file_.GetSize(), 0 };
+        std::uint32_t magic = 0, version = 0;
+        if (!reader.Raw(magic) || !reader.Raw(version) || magic != SESSION_MAGIC || version != SESSION_VERSION) return false;
+        if (!reader.Parameters(initialParameters_)) return false;
+
+        position_ = reader.GetPosition();
+        next_ = SessionRecord{};
+        hasNext_ = Decode();
+        return true;
+    }
+
+    bool SessionPlayer::Next(SessionRecord& record)
+    {
+        if (!hasNext_) return false;
+        record = next_;
+        hasNext_ = next_.type_ != RecordType::END && Decode();
+        return true;
+    }
+
+    bool SessionPlayer::Decode()
+    {
+        Reader reader{ static_cast<const std::uint8_t*>(file_.GetData()), file_.GetSize(), position_ };
+        std::uint8_t type = 0;
+        std::uint64_t iterationDelta = 0, timeDelta = 0;
+        if (!reader.Raw(type) || type > static_cast<std::uint8_t>(RecordType::END) || !reader.Varint(iterationDelta) || !reader.Varint(timeDelta)) return false;
+
+        next_.type_ = static_cast<RecordType>(type);
+        next_.iteration_ += iterationDelta;
+        next_.time_ += static_cast<double>(timeDelta) * 1e-6;
+
+        auto ok = true;
+        switch (next_.type_) {
+        case RecordType::MOUSE_BUTTON: ok = reader.Signed(next_.id_) && reader.Signed(next_.action_); break;
+        case RecordType::MOUSE_POSITION: ok = reader.Raw(next_.x_) && reader.Raw(next_.y_); break;
+        case RecordType::TUIO_ADD:
+        case RecordType::TUIO_UPDATE:
+        case RecordType::TUIO_REMOVE: ok = reader.Signed(next_.id_) && reader.Raw(next_.x_) && reader.Raw(next_.y_); break;
+        case RecordType::SEED: {
+            std::uint64_t seedDelta = 0;
+            ok = reader.Varint(seedDelta) && reader.Raw(next_.x_) && reader.Raw(next_.y_);
+            next_.seedIteration_ = next_.iteration_ + seedDelta;
+        } break;
+        case RecordType::PARAMETERS: ok = reader.Parameters(next_.parameters_); break;
+        case RecordType::END: break;
+        }
+        if (!ok) return false;
+
+        position_ = reader.GetPosition();
+        return true;
+    }
+}
@@ -0,0 +1,144 @@
+/**
+ * @file   SessionLog.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the binary log of recorded input sessions.
+ */
+
+#pragma once
+
+#include "app/util/MappedFile.h"
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace viscom::recording {
+
+    /** Type of a record in a session log. */
+    enum class RecordType : std::uint8_t {
+        MOUSE_BUTTON,
+        MOUSE_POSITION,
+        TUIO_ADD,
+        TUIO_UPDATE,
+        TUIO_REMOVE,
+        SEED,
+        PARAMETERS,
+        END
+    };
+
+    /** The user controlled simulation and rendering parameters (the recorded part of SimulationData). */
+    struct SessionParameters {
+        float drawDistance_ = 0.0f;
+        float height_ = 0.0f;
+        float eta_ = 0.0f;
+        float sigmaA_[3] = { 0.0f, 0.0f, 0.0f };
+        std::uint64_t resetIteration_ = 0;
+        std::int32_t warmStartPreset_ = 0;
+        std::uint64_t warmStartIteration_ = 0;
+        float diffusionRateA_ = 0.0f;
+        float diffusionRateB_ = 0.0f;
+        float feedRate_ = 0.0f;
+        float killRate_ = 0.0f;
+        float dt_ = 0.0f;
+        float seedPointRadius_ = 0.0f;
+        bool useManhattanDistance_ = false;
+        std::int32_t simulationScale_ = 1;
+        std::int32_t renderer_ = 0;
+
+        bool operator==(const SessionParameters& rhs) const;
+        bool operator!=(const SessionParameters& rhs) const { return !(*this == rhs); }
+    };
+
+    /** One decoded record. */
+    struct SessionRecord {
+        RecordType type_ = RecordType::END;
+        /** The global iteration count when the record was written (before the frame increment). */
+        std::uint64_t iteration_ = 0;
+        /** Seconds since the start of the recording. */
+        double time_ = 0.0;
+        /** Mouse button or TUIO cursor id (events). */
+        std::int32_t id_ = 0;
+        /** Mouse action (mouse button events). */
+        std::int32_t action_ = 0;
+        /** Screen position (events) or position on the simulation plane (seeds). */
+        float x_ = 0.0f;
+        float y_ = 0.0f;
+        /** Iteration a seed point is applied in. */
+        std::uint64_t seedIteration_ = 0;
+        /** The new parameters (parameter records). */
+        SessionParameters parameters_;
+    };
+
+    /**
+     *  Writes a session log. After a header with the initial parameters every record stores its type, the iteration
+     *  and time as variable length deltas to the previous record and a type dependent payload. Mouse movement is
+     *  typically a few bytes per event.
+     */
+    class SessionRecorder
+    {
+    public:
+        SessionRecorder() = default;
+        SessionRecorder(const SessionRecorder&) = delete;
+        SessionRecorder& operator=(const SessionRecorder&) = delete;
+        ~SessionRecorder();
+
+        bool Open(const std::string& filename, const SessionParameters& initialParameters);
+        bool IsOpen() const { return ofs_.is_open(); }
+
+        void RecordMouseButton(std::uint64_t iteration, int button, int action);
+        void RecordMousePosition(std::uint64_t iteration, float x, float y);
+        void RecordTuio(RecordType type, std::uint64_t iteration, int cursorId, float x, float y);
+        void RecordSeed(std::uint64_t iteration, std::uint64_t seedIteration, float x, float y);
+        void RecordParameters(std::uint64_t iteration, const SessionParameters& parameters);
+        /** Writes the end record, the final iteration is where a replay compares the state. */
+        void Close(std::uint64_t finalIteration);
+
+        /** Number of records written so far. */
+        std::uint64_t GetNumRecords() const { return numRecords_; }
+
+    private:
+        void BeginRecord(RecordType type, std::uint64_t iteration);
+        void Flush();
+
+        /** Holds the output file. */
+        std::ofstream ofs_;
+        /** Holds records not written to the file yet. */
+        std::vector<std::uint8_t> buffer_;
+        /** Start of the recording. */
+        std::chrono::steady_clock::time_point startTime_;
+        /** Iteration and time (in microseconds) of the last record. */
+        std::uint64_t lastIteration_ = 0;
+        std::uint64_t lastTime_ = 0;
+        /** Number of records written so far. */
+        std::uint64_t numRecords_ = 0;
+    };
+
+    /** Reads a session log mapped into memory. */
+    class SessionPlayer
+    {
+    public:
+        bool Open(const std::string& filename);
+
+        const SessionParameters& GetInitialParameters() const { return initialParameters_; }
+        /** Returns the next record without consuming it, nullptr at the end of the log. */
+        const SessionRecord* Peek() const { return hasNext_ ? &next_ : nullptr; }
+        /** Consumes the next record, returns false at the end of the log. */
+        bool Next(SessionRecord& record);
+
+    private:
+        bool Decode();
+
+        /** Holds the mapped log. */
+        util::MappedFile file_;
+        /** Read position in the log. */
+        std::size_t position_ = 0;
+        /** Holds the initial parameters. */
+        SessionParameters initialParameters_;
+        /** Holds the decoded next record. */
+        SessionRecord next_;
+        bool hasNext_ = false;
+    };
+}
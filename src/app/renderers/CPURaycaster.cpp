@@ -0,0 +1,318 @@
+/**
+ * @file   CPURaycaster.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the multi-threaded CPU implementation of the height field raycaster.
+ */
+
+#include "CPURaycaster.h"
+#include <algorithm>
+#include <cmath>
+
+namespace viscom::renderers {
+
+    namespace {
+        struct Vec3 {
+            float x, y, z;
+        };
+
+        Vec3 operator+(const Vec3& a, const Vec3& b) { return Vec3{ a.x + b.x, a.y + b.y, a.z + b.z }; }
+        Vec3 operator-(const Vec3& a, const Vec3& b) { return Vec3{ a.x - b.x, a.y - b.y, a.z - b.z }; }
+        Vec3 operator*(float s, const Vec3& a) { return Vec3{ s * a.x, s * a.y, s * a.z }; }
+        float Dot(const Vec3& a, const Vec3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+        Vec3 Normalize(const Vec3& a) { return (1.0f / std::sqrt(Dot(a, a))) * a; }
+
+        /** reflect() of GLSL. */
+        Vec3 Reflect(const Vec3& i, const Vec3& n) { return i - (2.0f * Dot(n, i)) * n; }
+
+        /** refract() of GLSL, returns false on total internal reflection (the shader gets a zero vector then). */
+        bool Refract(const Vec3& i, const Vec3& n, float eta, Vec3& result)
+        {
+            const auto cosI = Dot(n, i);
+            const auto k = 1.0f - eta * eta * (1.0f - cosI * cosI);
+            if (k < 0.0f) return false;
+            result = eta * i - (eta * cosI + std::sqrt(k)) * n;
+            return true;
+        }
+
+        /** Transforms a point of normalized device coordinates to world space. */
+        Vec3 Unproject(const std::array<float, 16>& m, float x, float y, float z)
+        {
+            const auto w = m[3] * x + m[7] * y + m[11] * z + m[15];
+            return (1.0f / w) * Vec3{ m[0] * x + m[4] * y + m[8] * z + m[12], m[1] * x + m[5] * y + m[9] * z + m[13], m[2] * x + m[6] * y + m[10] * z + m[14] };
+        }
+
+        /** Bilinear lookup with repeat addressing (like the textures loaded by the TextureLoader). */
+        Vec3 SampleRepeat(const CPURaycastImage& image, float u, float v)
+        {
+            if (image.rgb_.empty()) return Vec3{ 0.0f, 0.0f, 0.0f };
+            // the coordinates of extreme rays can be far outside, wrap them before converting to texels.
+            const auto px = (u - std::floor(u)) * static_cast<float>(image.width_) - 0.5f;
+            const auto py = (v - std::floor(v)) * static_cast<float>(image.height_) - 0.5f;
+            const auto fx0 = std::floor(px);
+            const auto fy0 = std::floor(py);
+            const auto fx = px - fx0;
+            const auto fy = py - fy0;
+            const auto w = static_cast<int>(image.width_);
+            const auto h = static_cast<int>(image.height_);
+            const auto x0 = std::clamp(static_cast<int>(fx0), -1, w - 1);
+            const auto y0 = std::clamp(static_cast<int>(fy0), -1, h - 1);
+            const auto x1 = x0 + 1 == w ? 0 : x0 + 1;
+            const auto y1 = y0 + 1 == h ? 0 : y0 + 1;
+
+            const auto texel = [&image, w](int x, int y) { return &image.rgb_[3 * (static_cast<std::size_t>(y) * w + x)]; };
+            const auto t00 = texel(x0 < 0 ? w - 1 : x0, y0 < 0 ? h - 1 : y0);
+            const auto t10 = texel(x1, y0 < 0 ? h - 1 : y0);
+            const auto t01 = texel(x0 < 0 ? w - 1 : x0, y1);
+            const auto t11 = texel(x1, y1);
+            float result[3];
+            for (int c = 0; c < 3; ++c) {
+                const auto bottom = t00[c] + fx * (t10[c] - t00[c]);
+                const auto top = t01[c] + fx * (t11[c] - t01[c]);
+                result[c] = bottom + fy * (top - bottom);
+            }
+            return Vec3{ result[0], result[1], result[2] };
+        }
+
+        std::uint8_t ToUNorm8(float value)
+        {
+            return static_cast<std::uint8_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+        }
+    }
+
+    CPURaycaster::CPURaycaster(unsigned int numThreads, unsigned int tileSize) :
+        tileSize_{ std::max(RAY_PACKET_SIZE, tileSize) }
+    {
+        if (numThreads == 0) numThreads = std::max(1u, std::thread::hardware_concurrency());
+        heights_.assign(1, 0.0f);
+        for (unsigned int i = 1; i < numThreads; ++i) workers_.emplace_back([this]() { WorkerLoop(); });
+    }
+
+    CPURaycaster::~CPURaycaster()
+    {
+        {
+            std::lock_guard<std::mutex> lock{ mutex_ };
+            stopWorkers_ = true;
+        }
+        startCondition_.notify_all();
+        for (auto& worker : workers_) worker.join();
+    }
+
+    void CPURaycaster::SetHeightField(const float* heights, unsigned int width, unsigned int height, const std::array<float, 4>& region)
+    {
+        heights_.assign(heights, heights + static_cast<std::size_t>(width) * height);
+        heightsWidth_ = width;
+        heightsHeight_ = height;
+        heightsRegion_ = region;
+        heightsScale_ = { { static_cast<float>(width) / region[2], static_cast<float>(height) / region[3] } };
+        heightsOffset_ = { { -region[0] * heightsScale_[0] - 0.5f, -region[1] * heightsScale_[1] - 0.5f } };
+    }
+
+    void CPURaycaster::Render(const CPURaycastView& view, const CPURaycastParameters& params, std::uint8_t* rgba)
+    {
+        view_ = &view;
+        params_ = &params;
+        output_ = rgba;
+        tilesX_ = (view.width_ + tileSize_ - 1) / tileSize_;
+        numTiles_ = tilesX_ * ((view.height_ + tileSize_ - 1) / tileSize_);
+        nextTile_ = 0;
+
+        {
+            std::lock_guard<std::mutex> lock{ mutex_ };
+            ++frameId_;
+            busyWorkers_ = static_cast<unsigned int>(workers_.size());
+        }
+        startCondition_.notify_all();
+        RenderTiles();
+
+        std::unique_lock<std::mutex> lock{ mutex_ };
+        doneCondition_.wait(lock, [this]() { return busyWorkers_ == 0; });
+    }
+
+    void CPURaycaster::WorkerLoop()
+    {
+        std::uint64_t renderedFrameId = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock{ mutex_ };
+                startCondition_.wait(lock, [this, renderedFrameId]() { return stopWorkers_ || frameId_ != renderedFrameId; });
+                if (stopWorkers_) return;
+                renderedFrameId = frameId_;
+            }
+
+            RenderTiles();
+
+            std::lock_guard<std::mutex> lock{ mutex_ };
+            if (--busyWorkers_ == 0) doneCondition_.notify_all();
+        }
+    }
+
+    void CPURaycaster::RenderTiles()
+    {
+        for (auto tile = nextTile_.fetch_add(1); tile < numTiles_; tile = nextTile_.fetch_add(1)) {
+            const auto tileX = (tile % tilesX_) * tileSize_;
+            const auto tileY = (tile / tilesX_) * tileSize_;
+            const auto endX = std::min(tileX + tileSize_, view_->width_);
+            const auto endY = std::min(tileY + tileSize_, view_->height_);
+            for (auto y = tileY; y < endY; ++y) {
+                for (auto x = tileX; x < endX; x += RAY_PACKET_SIZE) RenderPacket(x, y, std::min(RAY_PACKET_SIZE, endX - x));
+            }
+        }
+    }
+
+    void CPURaycaster::SampleHeights(const float* x, const float* y, float* heights) const
+    {
+        // bilinear with clamp to edge addressing like the simulation textures, only the fetches are done per lane.
+        constexpr auto N = RAY_PACKET_SIZE;
+        const auto maxX = static_cast<float>(heightsWidth_ - 1);
+        const auto maxY = static_cast<float>(heightsHeight_ - 1);
+        float fx[N], fy[N];
+        std::uint32_t index[N], stepX[N], stepY[N];
+        for (unsigned int l = 0; l < N; ++l) {
+            const auto cx = std::min(std::max(x[l] * heightsScale_[0] + heightsOffset_[0], 0.0f), maxX);
+            const auto cy = std::min(std::max(y[l] * heightsScale_[1] + heightsOffset_[1], 0.0f), maxY);
+            const auto x0 = static_cast<std::uint32_t>(cx);
+            const auto y0 = static_cast<std::uint32_t>(cy);
+            fx[l] = cx - static_cast<float>(x0);
+            fy[l] = cy - static_cast<float>(y0);
+            index[l] = y0 * heightsWidth_ + x0;
+            stepX[l] = x0 + 1 < heightsWidth_ ? 1 : 0;
+            stepY[l] = y0 + 1 < heightsHeight_ ? heightsWidth_ : 0;
+        }
+
+        float h00[N], h10[N], h01[N], h11[N];
+        for (unsigned int l = 0; l < N; ++l) {
+            h00[l] = heights_[index[l]];
+            h10[l] = heights_[index[l] + stepX[l]];
+            h01[l] = heights_[index[l] + stepY[l]];
+            h11[l] = heights_[index[l] + stepY[l] + stepX[l]];
+        }
+
+        for (unsigned int l = 0; l < N; ++l) {
+            const auto bottom = h00[l] + fx[l] * (h10[l] - h00[l]);
+            const auto top = h01[l] + fx[l] * (h11[l] - h01[l]);
+            heights[l] = bottom + fy[l] * (top - bottom);
+        }
+    }
+
+    void CPURaycaster::RenderPacket(unsigned int x, unsigned int y, unsigned int numRays)
+    {
+        constexpr auto N = RAY_PACKET_SIZE;
+        const auto& view = *view_;
+        const auto& params = *params_;
+        const auto& quadSize = params.quadSize_;
+        const auto frontDistance = params.drawDistance_ - params.simulationHeight_;
+
+        // t0 on the back quad and t1 on the front quad in texture coordinates of the quads (z: 0 back, 1 front).
+        float t0x[N], t0y[N], dx[N], dy[N];
+        bool hit[N];
+        const auto ndcY = (static_cast<float>(y) + 0.5f) / static_cast<float>(view.height_) * 2.0f - 1.0f;
+        for (unsigned int l = 0; l < N; ++l) {
+            const auto ndcX = (static_cast<float>(x + l) + 0.5f) / static_cast<float>(view.width_) * 2.0f - 1.0f;
+            const auto nearPoint = Unproject(view.inverseViewProjection_, ndcX, ndcY, -1.0f);
+            const auto dir = Unproject(view.inverseViewProjection_, ndcX, ndcY, 1.0f) - nearPoint;
+            const auto sBack = (-params.drawDistance_ - nearPoint.z) / dir.z;
+            const auto sFront = (-frontDistance - nearPoint.z) / dir.z;
+            const auto back = nearPoint + sBack * dir;
+            const auto front = nearPoint + sFront * dir;
+
+            t0x[l] = 0.5f * (back.x / quadSize[0] + 1.0f);
+            t0y[l] = 0.5f * (back.y / quadSize[1] + 1.0f);
+            dx[l] = 0.5f * (front.x / quadSize[0] + 1.0f) - t0x[l];
+            dy[l] = 0.5f * (front.y / quadSize[1] + 1.0f) - t0y[l];
+            // both quads have to be hit between the near and far plane (the shader discards pixels without back position).
+            hit[l] = l < numRays && sBack >= 0.0f && sBack <= 1.0f && sFront >= 0.0f && sFront <= 1.0f
+                && std::abs(back.x) <= quadSize[0] && std::abs(back.y) <= quadSize[1]
+                && std::abs(front.x) <= quadSize[0] && std::abs(front.y) <= quadSize[1];
+            if (!hit[l]) {
+                // keeps the lane finite, it is marched with the others but not shaded.
+                t0x[l] = t0y[l] = 0.5f;
+                dx[l] = dy[l] = 0.0f;
+            }
+        }
+
+        // fixed point iteration t = t0 + h(t) * (t1 - t0), the lanes are independent so their fetches overlap.
+        float tx[N], ty[N], tz[N];
+        for (unsigned int l = 0; l < N; ++l) {
+            tx[l] = t0x[l];
+            ty[l] = t0y[l];
+            tz[l] = 0.0f;
+        }
+        for (unsigned int step = 0; step < MARCH_STEPS; ++step) {
+            float h[N];
+            SampleHeights(tx, ty, h);
+            auto converged = true;
+            for (unsigned int l = 0; l < N; ++l) {
+                h[l] *= params.simulationHeight_;
+                converged = converged && h[l] == tz[l];
+                tx[l] = t0x[l] + h[l] * dx[l];
+                ty[l] = t0y[l] + h[l] * dy[l];
+                tz[l] = h[l];
+            }
+            // all lanes reached the fixed point exactly, the remaining steps would not change the result.
+            if (converged) break;
+        }
+
+        const auto deltaX = heightsRegion_[2] / static_cast<float>(heightsWidth_);
+        const auto deltaY = heightsRegion_[3] / static_cast<float>(heightsHeight_);
+        const Vec3 camPos{ (view.cameraPosition_[0] + quadSize[0]) / (2.0f * quadSize[0]), (view.cameraPosition_[1] + quadSize[1]) / (2.0f * quadSize[1]),
+            view.cameraPosition_[2] + frontDistance + 1.0f };
+        const auto r0 = (1.0f - params.eta_) / (1.0f + params.eta_);
+        const auto R0 = r0 * r0;
+
+        // normals from central differences of the height field (cross(tDX, tDY) in the shader).
+        float offsetX[2][N], offsetY[2][N], hx[2][N], hy[2][N];
+        for (unsigned int l = 0; l < N; ++l) {
+            offsetX[0][l] = tx[l] - deltaX;
+            offsetX[1][l] = tx[l] + deltaX;
+            offsetY[0][l] = ty[l] - deltaY;
+            offsetY[1][l] = ty[l] + deltaY;
+        }
+        for (unsigned int i = 0; i < 2; ++i) {
+            SampleHeights(offsetX[i], ty, hx[i]);
+            SampleHeights(tx, offsetY[i], hy[i]);
+        }
+
+        auto pixel = &output_[4 * (static_cast<std::size_t>(y) * view.width_ + x)];
+        for (unsigned int l = 0; l < numRays; ++l, pixel += 4) {
+            if (!hit[l]) {
+                std::fill(pixel, pixel + 4, std::uint8_t{ 0 });
+                continue;
+            }
+
+            const auto dhx = params.simulationHeight_ * (hx[1][l] - hx[0][l]);
+            const auto dhy = params.simulationHeight_ * (hy[1][l] - hy[0][l]);
+            const auto normal = Normalize(Vec3{ -2.0f * deltaY * dhx, -2.0f * deltaX * dhy, 4.0f * deltaX * deltaY });
+
+            const Vec3 t{ tx[l], ty[l], tz[l] };
+            const auto v = Normalize(t - camPos);
+            const auto rr = Normalize(Reflect(v, normal));
+            const auto rp = rr + Vec3{ 0.0f, 0.0f, 1.0f };
+            const auto m = 2.0f * std::sqrt(Dot(rp, rp));
+            const auto cReflection = SampleRepeat(environment_, rr.x / m + 0.5f, rr.y / m + 0.5f);
+
+            const auto cosTerm = 1.0f - std::max(-Dot(normal, v), 0.0f);
+            const auto cosTerm2 = cosTerm * cosTerm;
+            const auto R = R0 + (1.0f - R0) * cosTerm2 * cosTerm2 * cosTerm;
+
+            Vec3 color = R * cReflection;
+            Vec3 rt;
+            if (Refract(v, normal, 1.0f / params.eta_, rt)) {
+                rt = Normalize(rt);
+                const auto bgHit = (t.z / rt.z) * rt;
+                const auto bgHitLen = std::sqrt(Dot(bgHit, bgHit));
+                const auto bgCoords = t - bgHit;
+                const auto cRefraction = SampleRepeat(background_, bgCoords.x, bgCoords.y);
+                color.x += (1.0f - R) * std::exp(-params.sigmaA_[0] * bgHitLen) * cRefraction.x;
+                color.y += (1.0f - R) * std::exp(-params.sigmaA_[1] * bgHitLen) * cRefraction.y;
+                color.z += (1.0f - R) * std::exp(-params.sigmaA_[2] * bgHitLen) * cRefraction.z;
+            }
+
+            pixel[0] = ToUNorm8(std::sqrt(color.x));
+            pixel[1] = ToUNorm8(std::sqrt(color.y));
+            pixel[2] = ToUNorm8(std::sqrt(color.z));
+            pixel[3] = 255;
+        }
+    }
+}
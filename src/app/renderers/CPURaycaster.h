@@ -0,0 +1,124 @@
+/**
+ * @file   CPURaycaster.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the multi-threaded CPU implementation of the height field raycaster.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace viscom::renderers {
+
+    /** RGB float image sampled by the CPU raycaster, row 0 is the bottom row (like glGetTexImage returns it). */
+    struct CPURaycastImage {
+        unsigned int width_ = 0;
+        unsigned int height_ = 0;
+        std::vector<float> rgb_;
+    };
+
+    /** The view a frame is raycast for. */
+    struct CPURaycastView {
+        /** Inverse of the view projection matrix (column major like glm). */
+        std::array<float, 16> inverseViewProjection_;
+        /** Position of the camera (cameraPosition in raycastHeightfield.frag). */
+        std::array<float, 3> cameraPosition_;
+        /** Size of the output image. */
+        unsigned int width_ = 0;
+        unsigned int height_ = 0;
+    };
+
+    /** The parameters of the height field (see SimulationData). */
+    struct CPURaycastParameters {
+        /** Half size of the simulation quad (ApplicationNodeImplementation::GetSimulationOutputSize). */
+        std::array<float, 2> quadSize_ = { { 1.0f, 1.0f } };
+        float drawDistance_ = 15.0f;
+        float simulationHeight_ = 0.1f;
+        float eta_ = 1.5f;
+        std::array<float, 3> sigmaA_ = { { 2.0f, 2.0f, 2.0f } };
+    };
+
+    /**
+     *  Computes the same refraction, reflection and absorption shading as raycastHeightfield.frag (with normals from
+     *  central differences of the height field) on the CPU. The image is split into tiles that a pool of threads takes
+     *  from a shared counter, each thread marches packets of RAY_PACKET_SIZE neighbouring rays in lock step so the
+     *  independent height fetches of the lanes overlap and the per lane math is vectorized by the compiler.
+     *  Environment and background are sampled bilinearly from level 0 (the GPU filters them trilinearly).
+     */
+    class CPURaycaster
+    {
+    public:
+        /** Uses numThreads threads including the calling one (0 for one per hardware thread) and tiles of tileSize pixels. */
+        explicit CPURaycaster(unsigned int numThreads, unsigned int tileSize = DEFAULT_TILE_SIZE);
+        CPURaycaster(const CPURaycaster&) = delete;
+        CPURaycaster& operator=(const CPURaycaster&) = delete;
+        ~CPURaycaster();
+
+        /** Copies the height field (one float per cell, row 0 at the bottom) and its region in the domain (xy: offset, zw: size). */
+        void SetHeightField(const float* heights, unsigned int width, unsigned int height, const std::array<float, 4>& region);
+        void SetEnvironment(CPURaycastImage environment) { environment_ = std::move(environment); }
+        void SetBackground(CPURaycastImage background) { background_ = std::move(background); }
+        /** Raycasts the view into RGBA8 pixels (rows bottom to top, pixels not covered by the simulation are transparent black). */
+        void Render(const CPURaycastView& view, const CPURaycastParameters& params, std::uint8_t* rgba);
+
+        unsigned int GetNumThreads() const { return static_cast<unsigned int>(workers_.size()) + 1; }
+        unsigned int GetTileSize() const { return tileSize_; }
+
+        /** Number of rays marched together. */
+        static constexpr unsigned int RAY_PACKET_SIZE = 8;
+        /** Default size of the tiles distributed to the threads in pixels (the autotuner may pick another one). */
+        static constexpr unsigned int DEFAULT_TILE_SIZE = 32;
+        /** Number of fixed point iterations of the height field intersection (as in the shader). */
+        static constexpr unsigned int MARCH_STEPS = 40;
+
+    private:
+        void WorkerLoop();
+        void RenderTiles();
+        void RenderPacket(unsigned int x, unsigned int y, unsigned int numRays);
+        /** Samples the height field for a packet of RAY_PACKET_SIZE positions. */
+        void SampleHeights(const float* x, const float* y, float* heights) const;
+
+        /** Holds the height field. */
+        std::vector<float> heights_;
+        unsigned int heightsWidth_ = 1;
+        unsigned int heightsHeight_ = 1;
+        std::array<float, 4> heightsRegion_ = { { 0.0f, 0.0f, 1.0f, 1.0f } };
+        /** Maps domain coordinates to texel coordinates of the height field. */
+        std::array<float, 2> heightsScale_ = { { 1.0f, 1.0f } };
+        std::array<float, 2> heightsOffset_ = { { -0.5f, -0.5f } };
+        /** Holds the environment map and the background texture. */
+        CPURaycastImage environment_;
+        CPURaycastImage background_;
+
+        /** Size of the tiles distributed to the threads in pixels. */
+        unsigned int tileSize_;
+        /** The frame currently rendered. */
+        const CPURaycastView* view_ = nullptr;
+        const CPURaycastParameters* params_ = nullptr;
+        std::uint8_t* output_ = nullptr;
+        unsigned int tilesX_ = 0;
+        unsigned int numTiles_ = 0;
+        /** Index of the next tile to render. */
+        std::atomic<unsigned int> nextTile_{ 0 };
+
+        /** Protects the frame hand over to the workers. */
+        std::mutex mutex_;
+        std::condition_variable startCondition_;
+        std::condition_variable doneCondition_;
+        /** Incremented for every frame, the workers start when it changes. */
+        std::uint64_t frameId_ = 0;
+        /** Number of workers still rendering the current frame. */
+        unsigned int busyWorkers_ = 0;
+        bool stopWorkers_ = false;
+        /** Holds the worker threads (the calling thread renders too). */
+        std::vector<std::thread> workers_;
+    };
+}
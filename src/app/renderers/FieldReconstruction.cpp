@@ -0,0 +1,130 @@
+/**
+ * @file   FieldReconstruction.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the reconstruction of the display field from the simulation result.
+ */
+
+#include "FieldReconstruction.h"
+#include "app/ApplicationNodeImplementation.h"
+#include "app/metrics/NodeMetrics.h"
+#include "app/simulation/ComparisonSimulation.h"
+#include "app/util/GPUTimer.h"
+#include <imgui.h>
+#include "core/open_gl.h"
+
+namespace viscom::renderers {
+
+    namespace {
+        const char* FILTER_NAMES[] = { "Bilinear", "Cubic B-spline", "Catmull-Rom" };
+    }
+
+    FieldReconstruction::FieldReconstruction(ApplicationNodeImplementation* appNode) :
+        appNode_{ appNode },
+        timer_{ std::make_unique<util::GPUTimer>() }
+    {
+        program_ = appNode_->GetGPUProgramManager().GetResource("fieldReconstruction", std::vector<std::string>{ "fieldReconstruction.comp" });
+        heightTextureLoc_ = program_->getUniformLocation("heightTexture");
+        reconstructedImageLoc_ = program_->getUniformLocation("reconstructedImage");
+        filterLoc_ = program_->getUniformLocation("reconstructionFilter");
+    }
+
+    FieldReconstruction::~FieldReconstruction()
+    {
+        if (texture_ != 0) glDeleteTextures(1, &texture_);
+        texture_ = 0;
+    }
+
+    void FieldReconstruction::Update(const SimulationData& simData, GLuint heightTexture)
+    {
+        double milliseconds = 0.0;
+        int tag = 0;
+        while (timer_->Collect(milliseconds, tag)) gpuTime_ = gpuTime_ > 0.0 ? 0.9 * gpuTime_ + 0.1 * milliseconds : milliseconds;
+
+        filter_ = static_cast<ReconstructionFilter>(glm::clamp(simData.reconstructionFilter_, 0, 2));
+        // the comparison reconstructs the coarse grid, the renderers show the full grid bilinearly next to it.
+        const auto comparison = appNode_->GetComparisonSimulation();
+        if (simData.reconstructionComparison_ && comparison != nullptr) heightTexture = comparison->GetResultTexture();
+        const auto scale = glm::clamp(simData.reconstructionScale_, 1, MAX_SCALE);
+        glm::ivec2 size;
+        glBindTexture(GL_TEXTURE_2D, heightTexture);
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &size.x);
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &size.y);
+        size *= scale;
+        if (size != textureSize_) {
+            if (texture_ != 0) glDeleteTextures(1, &texture_);
+            textureSize_ = size;
+            auto numLevels = 1;
+            while ((glm::max(size.x, size.y) >> numLevels) > 0) ++numLevels;
+            glGenTextures(1, &texture_);
+            glBindTexture(GL_TEXTURE_2D, texture_);
+            // 32 bit heights, the raycaster intersects the reconstructed height field.
+            glTexStorage2D(GL_TEXTURE_2D, numLevels, GL_RGBA32F, size.x, size.y);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            memory_.SetSize(util::QueryTextureSize(texture_));
+        }
+
+        timer_->Begin();
+        glUseProgram(program_->getProgramId());
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, heightTexture);
+        glUniform1i(heightTextureLoc_, 0);
+        glUniform1i(filterLoc_, static_cast<GLint>(filter_));
+        glBindImageTexture(0, texture_, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RGBA32F);
+        glUniform1i(reconstructedImageLoc_, 0);
+        glDispatchCompute((size.x + 15) / 16, (size.y + 15) / 16, 1);
+        glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_TEXTURE_UPDATE_BARRIER_BIT);
+
+        glBindTexture(GL_TEXTURE_2D, texture_);
+        glGenerateMipmap(GL_TEXTURE_2D);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glUseProgram(0);
+        timer_->End();
+        valid_ = true;
+    }
+
+    FieldReconstruction::SamplingLocations FieldReconstruction::GetSamplingLocations(GLuint program)
+    {
+        SamplingLocations locations;
+        locations.derivedTexture_ = glGetUniformLocation(program, "derivedTexture");
+        locations.derivedNormals_ = glGetUniformLocation(program, "derivedNormals");
+        locations.derivedHeights_ = glGetUniformLocation(program, "derivedHeights");
+        locations.comparisonSplit_ = glGetUniformLocation(program, "comparisonSplit");
+        return locations;
+    }
+
+    void FieldReconstruction::SetSamplingUniforms(const SamplingLocations& locations, const SimulationData& simData, GLint textureUnit) const
+    {
+        glActiveTexture(GL_TEXTURE0 + textureUnit);
+        glBindTexture(GL_TEXTURE_2D, valid_ ? texture_ : 0);
+        glUniform1i(locations.derivedTexture_, textureUnit);
+        glUniform1i(locations.derivedNormals_, valid_ ? GL_TRUE : GL_FALSE);
+        // bilinear heights are what sampling the result gives, only the normals come from the reconstruction then.
+        glUniform1i(locations.derivedHeights_, valid_ && filter_ != ReconstructionFilter::Bilinear ? GL_TRUE : GL_FALSE);
+        glUniform1f(locations.comparisonSplit_, valid_ && simData.reconstructionComparison_ ? 0.5f : -1.0f);
+    }
+
+    void FieldReconstruction::DrawOptionsGUI(SimulationData& simData) const
+    {
+        ImGui::Combo("Reconstruction", &simData.reconstructionFilter_, FILTER_NAMES, static_cast<int>(sizeof(FILTER_NAMES) / sizeof(FILTER_NAMES[0])));
+        ImGui::SliderInt("Reconstruction Scale", &simData.reconstructionScale_, 1, MAX_SCALE);
+        ImGui::Checkbox("Compare (left: full grid bilinear, right: coarse grid reconstructed)", &simData.reconstructionComparison_);
+
+        const auto& size = appNode_->GetSimulationSize();
+        const auto simulationTime = appNode_->GetNodeMetrics().GetSnapshot().simulationGPUTime_;
+        const auto comparison = appNode_->GetComparisonSimulation();
+        if (simData.reconstructionComparison_ && comparison != nullptr) {
+            ImGui::Text("Full grid %ux%u: simulation %.3fms GPU time per frame", size.x, size.y, simulationTime);
+            ImGui::Text("Coarse grid %ux%u: simulation %.3fms GPU time per frame", comparison->GetSize().x, comparison->GetSize().y, comparison->GetGPUTime());
+        } else {
+            if (simData.reconstructionComparison_) ImGui::Text("The comparison needs the full grid simulated on the GPU of the whole domain.");
+            ImGui::Text("Grid %ux%u: simulation %.3fms GPU time per frame", size.x, size.y, simulationTime);
+        }
+        if (!valid_) ImGui::Text("Reconstruction off (sampled bilinearly)");
+        else ImGui::Text("Reconstruction %dx%d: %.3fms GPU time per frame", textureSize_.x, textureSize_.y, gpuTime_);
+    }
+}
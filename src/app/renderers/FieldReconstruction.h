@@ -0,0 +1,100 @@
+/**
+ * @file   FieldReconstruction.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the reconstruction of the display field from the simulation result.
+ */
+
+#pragma once
+
+#include "core/main.h"
+#include "app/util/ResourceRegistry.h"
+
+namespace viscom {
+    class ApplicationNodeImplementation;
+    class GPUProgram;
+    struct SimulationData;
+}
+
+namespace viscom::util {
+    class GPUTimer;
+}
+
+namespace viscom::renderers {
+
+    /** Filters reconstructing the display field (indexed like SimulationData::reconstructionFilter_). */
+    enum class ReconstructionFilter {
+        /** Bilinear heights and central difference gradients (what sampling the result directly gives). */
+        Bilinear = 0,
+        /** Cubic B-spline, smooth (C2) but slightly blurs the field. */
+        BSpline = 1,
+        /** Catmull-Rom spline, interpolates the simulated values (C1). */
+        CatmullRom = 2
+    };
+
+    /**
+     *  Reconstructs height and gradient from the simulation result with a cubic filter at a multiple of its resolution,
+     *  once per node frame for all windows and eyes. The renderers sample the reconstruction bilinearly, so a coarse
+     *  simulation does not show the texel grid. The gradients are the analytic derivatives of the filter. A comparison
+     *  mode shows the left half of the domain bilinear on the full grid and the right half reconstructed from the coarse
+     *  grid of the node's comparison simulation, with the simulation times of both grids.
+     */
+    class FieldReconstruction
+    {
+    public:
+        /** Uniforms of a renderer program sampling the reconstruction. */
+        struct SamplingLocations {
+            GLint derivedTexture_ = -1;
+            GLint derivedNormals_ = -1;
+            GLint derivedHeights_ = -1;
+            GLint comparisonSplit_ = -1;
+        };
+
+        explicit FieldReconstruction(ApplicationNodeImplementation* appNode);
+        FieldReconstruction(const FieldReconstruction&) = delete;
+        FieldReconstruction& operator=(const FieldReconstruction&) = delete;
+        ~FieldReconstruction();
+
+        /** Reconstructs the field from the result texture (of the coarse grid when comparing) with the filter and scale of the simulation data. */
+        void Update(const SimulationData& simData, GLuint heightTexture);
+        /** Invalidates the reconstruction (the result cannot be reconstructed, e.g. the atlas of a tiled domain). */
+        void Invalidate() { valid_ = false; }
+
+        static SamplingLocations GetSamplingLocations(GLuint program);
+        /** Sets the sampling uniforms and binds the reconstruction to the given unit (bilinear sampling if it is invalid). */
+        void SetSamplingUniforms(const SamplingLocations& locations, const SimulationData& simData, GLint textureUnit) const;
+
+        /** Average GPU time of the reconstruction in milliseconds. */
+        double GetGPUTime() const { return gpuTime_; }
+        /** Draws the filter, scale and comparison options. */
+        void DrawOptionsGUI(SimulationData& simData) const;
+
+        /** Largest multiple of the result resolution reconstructed. */
+        static constexpr int MAX_SCALE = 4;
+
+    private:
+        /** Holds the application node. */
+        ApplicationNodeImplementation* appNode_;
+        /** Holds the reconstruction program. */
+        std::shared_ptr<GPUProgram> program_;
+        GLint heightTextureLoc_ = -1;
+        GLint reconstructedImageLoc_ = -1;
+        GLint filterLoc_ = -1;
+
+        /** Holds height and gradient with a mip chain. */
+        GLuint texture_ = 0;
+        glm::ivec2 textureSize_ = glm::ivec2(0);
+        /** Registers the texture. */
+        util::TrackedResource memory_{ util::ResourceType::Texture, "FieldReconstruction", "height and gradient" };
+        /** The texture holds the current result. */
+        bool valid_ = false;
+        /** Filter of the current reconstruction. */
+        ReconstructionFilter filter_ = ReconstructionFilter::Bilinear;
+
+        /** Measures the reconstruction. */
+        std::unique_ptr<util::GPUTimer> timer_;
+        /** Smoothed GPU time in milliseconds. */
+        double gpuTime_ = 0.0;
+    };
+}
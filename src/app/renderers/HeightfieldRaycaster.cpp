@@ -8,6 +8,7 @@
 
 #include "HeightfieldRaycaster.h"
 #include "app/ApplicationNodeImplementation.h"
+#include "app/util/TextureLoader.h"
 #include <imgui.h>
 #include <glm/gtc/type_ptr.hpp>
 #include "core/open_gl.h"
@@ -15,13 +16,8 @@
 namespace viscom::renderers {
 
     HeightfieldRaycaster::HeightfieldRaycaster(ApplicationNodeImplementation* appNode) :
-        RDRenderer{ "HeightfieldRaycaster", appNode }
+        RDRenderer{ NAME, appNode }
     {
-        FrameBufferDescriptor simulationBackFBDesc;
-        simulationBackFBDesc.texDesc_.emplace_back(GL_RG32F, GL_TEXTURE_2D);
-        simulationBackFBDesc.rbDesc_.emplace_back(GL_DEPTH_COMPONENT32);
-        simulationBackFBOs_ = appNode_->CreateOffscreenBuffers(simulationBackFBDesc);
-
         raycastBackProgram_ = appNode_->GetGPUProgramManager().GetResource("raycastHeightfieldBack", std::vector<std::string>{ "raycastHeightfield.vert", "raycastHeightfieldBack.frag" });
         raycastBackVPLoc_ = raycastBackProgram_->getUniformLocation("viewProjectionMatrix");
         raycastBackQuadSizeLoc_ = raycastBackProgram_->getUniformLocation("quadSize");
@@ -37,11 +33,16 @@ namespace viscom::renderers {
         raycastEnvMapLoc_ = raycastProgram_->getUniformLocation("environment");
         raycastBGTexLoc_ = raycastProgram_->getUniformLocation("backgroundTexture");
         raycastHeightTextureLoc_ = raycastProgram_->getUniformLocation("heightTexture");
+        raycastHeightTextureRegionLoc_ = raycastProgram_->getUniformLocation("heightTextureRegion");
+        raycastTiledLocs_ = simulation::TiledSimulation::GetSamplingLocations(raycastProgram_->getProgramId());
         raycastPositionBackTexLoc_ = raycastProgram_->getUniformLocation("backPositionTexture");
+        raycastReconstructionLocs_ = FieldReconstruction::GetSamplingLocations(raycastProgram_->getProgramId());
+        reconstruction_ = std::make_unique<FieldReconstruction>(appNode_);
 
         glGenVertexArrays(1, &simDummyVAO_);
-        backgroundTexture_ = appNode_->GetTextureManager().GetResource("models/teapot/default.png");
-        environmentMap_ = appNode_->GetTextureManager().GetResource("textures/grace_probe.hdr");
+        // the textures show a placeholder until they are decoded, so selecting the renderer does not wait for the disk.
+        backgroundTexture_ = appNode_->GetTextureLoader().Request("models/teapot/default.png");
+        environmentMap_ = appNode_->GetTextureLoader().Request("textures/grace_probe.hdr");
     }
 
     HeightfieldRaycaster::~HeightfieldRaycaster()
@@ -52,11 +53,6 @@ namespace viscom::renderers {
 
     void HeightfieldRaycaster::ClearBuffers(FrameBuffer& fbo)
     {
-        appNode_->SelectOffscreenBuffer(simulationBackFBOs_)->DrawToFBO([]() {
-            glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
-            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-        });
-
         fbo.DrawToFBO([]() {
             glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
             glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -67,22 +63,60 @@ namespace viscom::renderers {
     {
     }
 
-    void HeightfieldRaycaster::RenderRDResults(FrameBuffer& fbo, const SimulationData& simData, const glm::mat4& perspectiveMatrix, GLuint rdTexture)
+    void HeightfieldRaycaster::UpdateSharedPasses(const SimulationData& simData, GLuint rdTexture)
     {
-        appNode_->SelectOffscreenBuffer(simulationBackFBOs_)->DrawToFBO([this, &perspectiveMatrix, &simData]() {
-            glBindVertexArray(simDummyVAO_);
-            glUseProgram(raycastBackProgram_->getProgramId());
-            glUniformMatrix4fv(raycastBackVPLoc_, 1, GL_FALSE, glm::value_ptr(perspectiveMatrix));
-            glUniform2fv(raycastBackQuadSizeLoc_, 1, glm::value_ptr(appNode_->GetSimulationOutputSize()));
-            glUniform1f(raycastBackDistanceLoc_, simData.simulationDrawDistance_);
-            glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+        // the result atlas of a tiled domain is no height field, the raycaster samples it bilinearly then.
+        if (appNode_->GetTiledSimulation() != nullptr) reconstruction_->Invalidate();
+        else reconstruction_->Update(simData, rdTexture);
+    }
+
+    void HeightfieldRaycaster::AddPasses(rendergraph::RenderGraph& graph, rendergraph::ResourceId result, rendergraph::ResourceId output)
+    {
+        using namespace rendergraph;
+        // the back positions only live while one view is drawn, all windows and eyes share their memory.
+        const auto backPositions = graph.CreateTexture("HeightfieldRaycaster.backPositions", TextureDesc{ 0, 0, GL_RG32F });
+        const auto backDepth = graph.CreateTexture("HeightfieldRaycaster.backDepth", TextureDesc{ 0, 0, GL_DEPTH_COMPONENT32 });
+        const auto reconstructed = graph.Import("HeightfieldRaycaster.reconstructed");
+
+        graph.AddPass("HeightfieldRaycaster::Reconstruct", PassPhase::Shared, { result }, { reconstructed }, [this](const RenderGraph&, const PassContext& context) {
+            UpdateSharedPasses(*context.simData_, context.resultTexture_);
+        });
+        graph.AddPass("HeightfieldRaycaster::BackPositions", PassPhase::View, {}, { backPositions, backDepth }, [this](const RenderGraph&, const PassContext& context) {
+            RenderBackPositions(context);
+        });
+        graph.AddPass("HeightfieldRaycaster::Raycast", PassPhase::View, { result, reconstructed, backPositions }, { output },
+            [this, backPositions](const RenderGraph& passGraph, const PassContext& context) {
+            RenderHeightfield(context, passGraph.GetTexture(backPositions));
         });
+    }
 
-        fbo.DrawToFBO([this, &perspectiveMatrix, &simData, rdTexture]() {
+    void HeightfieldRaycaster::RenderBackPositions(const rendergraph::PassContext& context) const
+    {
+        GLint drawFramebuffer = 0;
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &drawFramebuffer);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, context.framebuffer_);
+        // same viewport as the window, so the raycast pass reads the back position at gl_FragCoord.
+        glViewport(context.viewport_.x, context.viewport_.y, context.viewport_.z, context.viewport_.w);
+        glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+        glBindVertexArray(simDummyVAO_);
+        glUseProgram(raycastBackProgram_->getProgramId());
+        glUniformMatrix4fv(raycastBackVPLoc_, 1, GL_FALSE, glm::value_ptr(context.viewProjection_));
+        glUniform2fv(raycastBackQuadSizeLoc_, 1, glm::value_ptr(appNode_->GetSimulationOutputSize()));
+        glUniform1f(raycastBackDistanceLoc_, context.simData_->simulationDrawDistance_);
+        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, static_cast<GLuint>(drawFramebuffer));
+    }
+
+    void HeightfieldRaycaster::RenderHeightfield(const rendergraph::PassContext& context, GLuint backPositionTexture) const
+    {
+        const auto& simData = *context.simData_;
+        context.target_->DrawToFBO([this, &context, &simData, backPositionTexture]() {
             glm::vec3 camPos = appNode_->GetCamera()->GetPosition();
             glBindVertexArray(simDummyVAO_);
             glUseProgram(raycastProgram_->getProgramId());
-            glUniformMatrix4fv(raycastVPLoc_, 1, GL_FALSE, glm::value_ptr(perspectiveMatrix));
+            glUniformMatrix4fv(raycastVPLoc_, 1, GL_FALSE, glm::value_ptr(context.viewProjection_));
             glUniform2fv(raycastQuadSizeLoc_, 1, glm::value_ptr(appNode_->GetSimulationOutputSize()));
             glUniform1f(raycastDistanceLoc_, simData.simulationDrawDistance_ - simData.simulationHeight_);
             glUniform1f(raycastSimHeightLoc_, simData.simulationHeight_);
@@ -91,20 +125,25 @@ namespace viscom::renderers {
             glUniform3fv(raycastSigmaALoc_, 1, glm::value_ptr(simData.sigma_a_));
 
             glActiveTexture(GL_TEXTURE0);
-            glBindTexture(GL_TEXTURE_2D, environmentMap_->getTextureId());
+            glBindTexture(GL_TEXTURE_2D, environmentMap_->GetTextureId());
             glUniform1i(raycastEnvMapLoc_, 0);
 
             glActiveTexture(GL_TEXTURE0 + 1);
-            glBindTexture(GL_TEXTURE_2D, backgroundTexture_->getTextureId());
+            glBindTexture(GL_TEXTURE_2D, backgroundTexture_->GetTextureId());
             glUniform1i(raycastBGTexLoc_, 1);
 
             glActiveTexture(GL_TEXTURE0 + 2);
-            glBindTexture(GL_TEXTURE_2D, rdTexture);
+            glBindTexture(GL_TEXTURE_2D, context.resultTexture_);
             glUniform1i(raycastHeightTextureLoc_, 2);
+            glUniform4fv(raycastHeightTextureRegionLoc_, 1, glm::value_ptr(appNode_->GetSimulationTextureRegion()));
+            SetHeightTextureSampling(raycastTiledLocs_, 3);
 
-            glBindImageTexture(0, appNode_->SelectOffscreenBuffer(simulationBackFBOs_)->GetTextures()[0], 0, GL_FALSE, 0, GL_READ_ONLY, GL_RG32F);
+            glBindImageTexture(0, backPositionTexture, 0, GL_FALSE, 0, GL_READ_ONLY, GL_RG32F);
             glUniform1i(raycastPositionBackTexLoc_, 0);
 
+            // heights and normals come from the shared reconstruction instead of extra height samples per pixel and eye.
+            reconstruction_->SetSamplingUniforms(raycastReconstructionLocs_, simData, 5);
+
             glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
         });
     }
@@ -116,5 +155,6 @@ namespace viscom::renderers {
         ImGui::SliderFloat("Absorption Red", &simData.sigma_a_.r, 0.0f, 100.0f);
         ImGui::SliderFloat("Absorption Green", &simData.sigma_a_.g, 0.0f, 100.0f);
         ImGui::SliderFloat("Absorption Blue", &simData.sigma_a_.b, 0.0f, 100.0f);
+        reconstruction_->DrawOptionsGUI(simData);
     }
 }
@@ -11,30 +11,39 @@
 #include "core/main.h"
 #include "core/gfx/FrameBuffer.h"
 #include "RDRenderer.h"
+#include "FieldReconstruction.h"
 
 namespace viscom {
     class ApplicationNodeImplementation;
     class GPUProgram;
-    class Texture;
     struct SimulationData;
 }
 
+namespace viscom::util {
+    class AsyncTexture;
+}
+
 namespace viscom::renderers {
 
     class HeightfieldRaycaster : public RDRenderer
     {
     public:
+        static constexpr const char* NAME = "HeightfieldRaycaster";
+
         HeightfieldRaycaster(ApplicationNodeImplementation* appNode);
         virtual ~HeightfieldRaycaster() override;
 
         virtual void ClearBuffers(FrameBuffer& fbo) override;
         virtual void UpdateFrame(double currentTime, double elapsedTime, const SimulationData& simData, const glm::vec2& nearPlaneSize) override;
-        virtual void RenderRDResults(FrameBuffer& fbo, const SimulationData& simData, const glm::mat4& perspectiveMatrix, GLuint rdTexture) override;
+        virtual void UpdateSharedPasses(const SimulationData& simData, GLuint rdTexture) override;
+        virtual void AddPasses(rendergraph::RenderGraph& graph, rendergraph::ResourceId result, rendergraph::ResourceId output) override;
         virtual void DrawOptionsGUI(SimulationData& simData) const override;
 
     private:
-        /** The frame buffer objects for the simulation height field back. */
-        std::vector<FrameBuffer> simulationBackFBOs_;
+        /** Raycasts the back side of the height field volume into the frame buffer of the pass. */
+        void RenderBackPositions(const rendergraph::PassContext& context) const;
+        /** Raycasts the height field into the window with the back positions of the view. */
+        void RenderHeightfield(const rendergraph::PassContext& context, GLuint backPositionTexture) const;
 
         /** Holds the shader program for raycasting the height field back side. */
         std::shared_ptr<GPUProgram> raycastBackProgram_;
@@ -67,15 +76,24 @@ namespace viscom::renderers {
         GLint raycastBGTexLoc_ = -1;
         /** Holds the location of the height texture. */
         GLint raycastHeightTextureLoc_ = -1;
+        /** Holds the location of the height texture region. */
+        GLint raycastHeightTextureRegionLoc_ = -1;
+        /** Holds the locations for sampling a tiled domain. */
+        simulation::TiledSimulation::SamplingLocations raycastTiledLocs_;
         /** Holds the location of the back position texture. */
         GLint raycastPositionBackTexLoc_ = -1;
+        /** Holds the locations for sampling the reconstructed field. */
+        FieldReconstruction::SamplingLocations raycastReconstructionLocs_;
+
+        /** Reconstructs height and gradient once per node frame, shared by all windows and eyes (not for tiled domains). */
+        std::unique_ptr<FieldReconstruction> reconstruction_;
 
         /** Holds the dummy VAO for the simulation quad. */
         GLuint simDummyVAO_ = 0;
-        /** Holds the background texture for the simulation. */
-        std::shared_ptr<Texture> backgroundTexture_;
-        /** Holds the environment map texture. */
-        std::shared_ptr<Texture> environmentMap_;
+        /** Holds the background texture for the simulation (loaded in the background). */
+        std::shared_ptr<util::AsyncTexture> backgroundTexture_;
+        /** Holds the environment map texture (loaded in the background). */
+        std::shared_ptr<util::AsyncTexture> environmentMap_;
     };
 
 }
@@ -0,0 +1,169 @@
+/**
+ * @file   HeightfieldRaycasterCPU.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the height field raycaster renderer running on the CPU.
+ */
+
+#include "HeightfieldRaycasterCPU.h"
+#include "app/ApplicationNodeImplementation.h"
+#include "app/util/TextureLoader.h"
+#include <imgui.h>
+#include <chrono>
+#include <glm/gtc/type_ptr.hpp>
+#include "core/open_gl.h"
+
+namespace viscom::renderers {
+
+    HeightfieldRaycasterCPU::HeightfieldRaycasterCPU(ApplicationNodeImplementation* appNode) :
+        RDRenderer{ NAME, appNode },
+        raycaster_{ std::make_unique<CPURaycaster>(appNode->GetAppSettings().cpuRaycasterThreads_ > 0 ? appNode->GetAppSettings().cpuRaycasterThreads_
+            : appNode->GetTuningProfile().cpuRaycasterThreads_, appNode->GetTuningProfile().cpuRaycasterTileSize_) },
+        memory_{ util::ResourceType::Host, "HeightfieldRaycasterCPU", "height field and images" }
+    {
+        // same resources as the HeightfieldRaycaster, the loader shares the textures if both are used.
+        backgroundTexture_ = appNode_->GetTextureLoader().Request("models/teapot/default.png");
+        environmentMap_ = appNode_->GetTextureLoader().Request("textures/grace_probe.hdr");
+        LOG(INFO) << "CPU raycaster uses " << raycaster_->GetNumThreads() << " threads and " << raycaster_->GetTileSize() << "px tiles.";
+    }
+
+    HeightfieldRaycasterCPU::~HeightfieldRaycasterCPU() = default;
+
+    void HeightfieldRaycasterCPU::ClearBuffers(FrameBuffer& fbo)
+    {
+        fbo.DrawToFBO([]() {
+            glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        });
+    }
+
+    void HeightfieldRaycasterCPU::UpdateFrame(double, double, const SimulationData&, const glm::vec2&)
+    {
+        // the textures show a placeholder until they are loaded, read them back once.
+        if (!backgroundRead_ && backgroundTexture_->IsLoaded()) {
+            CPURaycastImage background;
+            ReadTexture(backgroundTexture_->GetTextureId(), background);
+            imageBytes_ += background.rgb_.size() * sizeof(float);
+            raycaster_->SetBackground(std::move(background));
+            backgroundRead_ = true;
+            UpdateMemory();
+        }
+        if (!environmentRead_ && environmentMap_->IsLoaded()) {
+            CPURaycastImage environment;
+            ReadTexture(environmentMap_->GetTextureId(), environment);
+            imageBytes_ += environment.rgb_.size() * sizeof(float);
+            raycaster_->SetEnvironment(std::move(environment));
+            environmentRead_ = true;
+            UpdateMemory();
+        }
+    }
+
+    void HeightfieldRaycasterCPU::UpdateSharedPasses(const SimulationData&, GLuint rdTexture)
+    {
+        if (appNode_->GetTiledSimulation() != nullptr) {
+            if (!tiledDomainReported_) LOG(WARNING) << "The CPU raycaster does not support the tiled mode, the height field stays flat.";
+            tiledDomainReported_ = true;
+            return;
+        }
+
+        glm::ivec2 size;
+        glBindTexture(GL_TEXTURE_2D, rdTexture);
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &size.x);
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &size.y);
+        heights_.resize(static_cast<std::size_t>(size.x) * size.y);
+        UpdateMemory();
+        // synchronous read back, once per node frame for all windows and eyes.
+        glGetTexImage(GL_TEXTURE_2D, 0, GL_RED, GL_FLOAT, heights_.data());
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        const auto& region = appNode_->GetSimulationTextureRegion();
+        raycaster_->SetHeightField(heights_.data(), static_cast<unsigned int>(size.x), static_cast<unsigned int>(size.y), { { region.x, region.y, region.z, region.w } });
+    }
+
+    void HeightfieldRaycasterCPU::AddPasses(rendergraph::RenderGraph& graph, rendergraph::ResourceId result, rendergraph::ResourceId output)
+    {
+        using namespace rendergraph;
+        const auto heights = graph.Import("HeightfieldRaycasterCPU.heights");
+        // the uploaded image is only needed for the blit, all windows and eyes share its memory.
+        const auto image = graph.CreateTexture("HeightfieldRaycasterCPU.image", TextureDesc{ 0, 0, GL_RGBA8 });
+
+        graph.AddPass("HeightfieldRaycasterCPU::ReadHeights", PassPhase::Shared, { result }, { heights }, [this](const RenderGraph&, const PassContext& context) {
+            UpdateSharedPasses(*context.simData_, context.resultTexture_);
+        });
+        graph.AddPass("HeightfieldRaycasterCPU::Raycast", PassPhase::View, { heights }, { image, output }, [this, image](const RenderGraph& passGraph, const PassContext& context) {
+            RenderView(context, passGraph.GetTexture(image));
+        });
+    }
+
+    void HeightfieldRaycasterCPU::RenderView(const rendergraph::PassContext& context, GLuint imageTexture)
+    {
+        const auto& simData = *context.simData_;
+        const auto width = context.viewport_.z;
+        const auto height = context.viewport_.w;
+        pixels_.resize(4 * static_cast<std::size_t>(width) * height);
+        UpdateMemory();
+
+        CPURaycastView rayView;
+        const auto inverseViewProjection = glm::inverse(context.viewProjection_);
+        std::copy(glm::value_ptr(inverseViewProjection), glm::value_ptr(inverseViewProjection) + 16, rayView.inverseViewProjection_.begin());
+        const auto camPos = appNode_->GetCamera()->GetPosition();
+        rayView.cameraPosition_ = { { camPos.x, camPos.y, camPos.z } };
+        rayView.width_ = static_cast<unsigned int>(width);
+        rayView.height_ = static_cast<unsigned int>(height);
+
+        CPURaycastParameters params;
+        params.quadSize_ = { { appNode_->GetSimulationOutputSize().x, appNode_->GetSimulationOutputSize().y } };
+        params.drawDistance_ = simData.simulationDrawDistance_;
+        params.simulationHeight_ = simData.simulationHeight_;
+        params.eta_ = simData.eta_;
+        params.sigmaA_ = { { simData.sigma_a_.r, simData.sigma_a_.g, simData.sigma_a_.b } };
+
+        const auto raycastStart = std::chrono::steady_clock::now();
+        raycaster_->Render(rayView, params, pixels_.data());
+        raycastTime_ = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - raycastStart).count();
+
+        // the pooled image has the size of the window, the view is uploaded to its lower left corner.
+        glBindTexture(GL_TEXTURE_2D, imageTexture);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels_.data());
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        context.target_->DrawToFBO([&context, width, height]() {
+            GLint drawFramebuffer = 0;
+            glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &drawFramebuffer);
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, context.framebuffer_);
+            glBlitFramebuffer(0, 0, width, height, context.viewport_.x, context.viewport_.y, context.viewport_.x + width, context.viewport_.y + height,
+                GL_COLOR_BUFFER_BIT, GL_NEAREST);
+            glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(drawFramebuffer));
+        });
+    }
+
+    void HeightfieldRaycasterCPU::UpdateMemory()
+    {
+        memory_.SetSize(heights_.capacity() * sizeof(float) + pixels_.capacity() + imageBytes_);
+    }
+
+    void HeightfieldRaycasterCPU::DrawOptionsGUI(SimulationData& simData) const
+    {
+        ImGui::SliderFloat("Height", &simData.simulationHeight_, 0.02f, 0.5f);
+        ImGui::SliderFloat("Eta", &simData.eta_, 1.0f, 5.0f);
+        ImGui::SliderFloat("Absorption Red", &simData.sigma_a_.r, 0.0f, 100.0f);
+        ImGui::SliderFloat("Absorption Green", &simData.sigma_a_.g, 0.0f, 100.0f);
+        ImGui::SliderFloat("Absorption Blue", &simData.sigma_a_.b, 0.0f, 100.0f);
+        ImGui::Text("CPU raycast: %.1fms per view on %u threads", raycastTime_, raycaster_->GetNumThreads());
+    }
+
+    void HeightfieldRaycasterCPU::ReadTexture(GLuint textureId, CPURaycastImage& image)
+    {
+        GLint width = 0;
+        GLint height = 0;
+        glBindTexture(GL_TEXTURE_2D, textureId);
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+        image.width_ = static_cast<unsigned int>(width);
+        image.height_ = static_cast<unsigned int>(height);
+        image.rgb_.resize(3 * static_cast<std::size_t>(width) * height);
+        glGetTexImage(GL_TEXTURE_2D, 0, GL_RGB, GL_FLOAT, image.rgb_.data());
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+}
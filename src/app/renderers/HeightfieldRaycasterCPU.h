@@ -0,0 +1,77 @@
+/**
+ * @file   HeightfieldRaycasterCPU.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the height field raycaster renderer running on the CPU.
+ */
+
+#pragma once
+
+#include "core/main.h"
+#include "core/gfx/FrameBuffer.h"
+#include "RDRenderer.h"
+#include "CPURaycaster.h"
+#include "app/util/ResourceRegistry.h"
+
+namespace viscom {
+    class ApplicationNodeImplementation;
+    struct SimulationData;
+}
+
+namespace viscom::util {
+    class AsyncTexture;
+}
+
+namespace viscom::renderers {
+
+    /**
+     *  Renders the same image as the HeightfieldRaycaster with the CPURaycaster (reference for the shader and previews
+     *  without a capable GPU). The height field, environment map and background are read back once when they change,
+     *  every window and eye is raycast on the CPU and uploaded.
+     */
+    class HeightfieldRaycasterCPU : public RDRenderer
+    {
+    public:
+        static constexpr const char* NAME = "HeightfieldRaycasterCPU";
+
+        HeightfieldRaycasterCPU(ApplicationNodeImplementation* appNode);
+        virtual ~HeightfieldRaycasterCPU() override;
+
+        virtual void ClearBuffers(FrameBuffer& fbo) override;
+        virtual void UpdateFrame(double currentTime, double elapsedTime, const SimulationData& simData, const glm::vec2& nearPlaneSize) override;
+        virtual void UpdateSharedPasses(const SimulationData& simData, GLuint rdTexture) override;
+        virtual void AddPasses(rendergraph::RenderGraph& graph, rendergraph::ResourceId result, rendergraph::ResourceId output) override;
+        virtual void DrawOptionsGUI(SimulationData& simData) const override;
+
+    private:
+        /** Reads level 0 of a texture back as RGB floats. */
+        static void ReadTexture(GLuint textureId, CPURaycastImage& image);
+        /** Raycasts a view, uploads it to the image texture attached to the frame buffer of the pass and blits it to the window. */
+        void RenderView(const rendergraph::PassContext& context, GLuint imageTexture);
+        /** Sets the tracked size of the host buffers. */
+        void UpdateMemory();
+
+        /** Raycasts on a pool of threads. */
+        std::unique_ptr<CPURaycaster> raycaster_;
+        /** Holds the height field read back from the result texture. */
+        std::vector<float> heights_;
+        /** Holds the raycast RGBA8 image of the view drawn (the views are drawn one after the other). */
+        std::vector<std::uint8_t> pixels_;
+
+        /** Holds the background texture and environment map (loaded in the background, read back once they are loaded). */
+        std::shared_ptr<util::AsyncTexture> backgroundTexture_;
+        std::shared_ptr<util::AsyncTexture> environmentMap_;
+        bool backgroundRead_ = false;
+        bool environmentRead_ = false;
+        /** The tiled domain was reported as unsupported. */
+        bool tiledDomainReported_ = false;
+        /** Time the last view took to raycast in milliseconds. */
+        double raycastTime_ = 0.0;
+        /** Bytes of the background and environment copies handed to the raycaster. */
+        std::size_t imageBytes_ = 0;
+        /** Tracks the host buffers. */
+        util::TrackedResource memory_;
+    };
+
+}
@@ -7,6 +7,7 @@
  */
 
 #include "RDRenderer.h"
+#include "app/ApplicationNodeImplementation.h"
 
 namespace viscom::renderers {
 
@@ -17,4 +18,23 @@ namespace viscom::renderers {
     }
 
     RDRenderer::~RDRenderer() = default;
+
+    void RDRenderer::AddPasses(rendergraph::RenderGraph& graph, rendergraph::ResourceId result, rendergraph::ResourceId output)
+    {
+        using namespace rendergraph;
+        // the shared passes hand their results over inside the renderer, the imported resource only orders the passes.
+        const auto shared = graph.Import(name_ + ".shared");
+        graph.AddPass(name_ + "::UpdateSharedPasses", PassPhase::Shared, { result }, { shared }, [this](const RenderGraph&, const PassContext& context) {
+            UpdateSharedPasses(*context.simData_, context.resultTexture_);
+        });
+        graph.AddPass(name_ + "::RenderRDResults", PassPhase::View, { result, shared }, { output }, [this](const RenderGraph&, const PassContext& context) {
+            RenderRDResults(*context.target_, *context.simData_, context.viewProjection_, context.resultTexture_);
+        });
+    }
+
+    void RDRenderer::SetHeightTextureSampling(const simulation::TiledSimulation::SamplingLocations& locations, GLint textureUnit) const
+    {
+        if (auto tiledSimulation = appNode_->GetTiledSimulation()) tiledSimulation->SetSamplingUniforms(locations, textureUnit);
+        else simulation::TiledSimulation::SetNoTilingUniforms(locations);
+    }
 }
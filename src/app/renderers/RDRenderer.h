@@ -10,6 +10,8 @@
 
 #include "core/main.h"
 #include "core/gfx/FrameBuffer.h"
+#include "app/simulation/TiledSimulation.h"
+#include "app/rendergraph/RenderGraph.h"
 
 namespace viscom {
     class ApplicationNodeImplementation;
@@ -27,10 +29,21 @@ namespace viscom::renderers {
         std::string GetName() const { return name_; }
         virtual void ClearBuffers(FrameBuffer& fbo) = 0;
         virtual void UpdateFrame(double currentTime, double elapsedTime, const SimulationData& simData, const glm::vec2& nearPlaneSize) = 0;
-        virtual void RenderRDResults(FrameBuffer& fbo, const SimulationData& simData, const glm::mat4& perspectiveMatrix, GLuint rdTexture) = 0;
+        /** Runs the view independent passes once per node frame when the result changed, all windows and eyes share them. */
+        virtual void UpdateSharedPasses(const SimulationData& simData, GLuint rdTexture) {}
+        /** Draws one window and eye (used by the default passes, renderers declaring their own view passes do not need it). */
+        virtual void RenderRDResults(FrameBuffer& fbo, const SimulationData& simData, const glm::mat4& perspectiveMatrix, GLuint rdTexture) {}
+        /**
+         *  Declares the passes of the renderer, the view passes read the simulation result and write the output of the
+         *  renderer (the window frame buffer). The default passes call UpdateSharedPasses and RenderRDResults.
+         */
+        virtual void AddPasses(rendergraph::RenderGraph& graph, rendergraph::ResourceId result, rendergraph::ResourceId output);
         virtual void DrawOptionsGUI(SimulationData& simData) const = 0;
 
     protected:
+        /** Sets the uniforms for sampling the height texture directly or through the tiled domain tables. */
+        void SetHeightTextureSampling(const simulation::TiledSimulation::SamplingLocations& locations, GLint textureUnit) const;
+
         /** Holds the application node. */
         ApplicationNodeImplementation* appNode_;
 
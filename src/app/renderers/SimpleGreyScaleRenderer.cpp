@@ -14,13 +14,17 @@
 namespace viscom::renderers {
 
     SimpleGreyScaleRenderer::SimpleGreyScaleRenderer(ApplicationNodeImplementation* appNode) :
-        RDRenderer{ "SimpleGreyScaleRenderer", appNode }
+        RDRenderer{ NAME, appNode }
     {
         drawGSProgram_ = appNode_->GetGPUProgramManager().GetResource("simpleGreyscaleRD", std::vector<std::string>{ "raycastHeightfield.vert", "drawGreyscale.frag" });
         drawGSVPLoc_ = drawGSProgram_->getUniformLocation("viewProjectionMatrix");
         drawGSQuadSizeLoc_ = drawGSProgram_->getUniformLocation("quadSize");
         drawGSDistanceLoc_ = drawGSProgram_->getUniformLocation("distance");
         drawGSHeightTextureLoc_ = drawGSProgram_->getUniformLocation("heightTexture");
+        drawGSHeightTextureRegionLoc_ = drawGSProgram_->getUniformLocation("heightTextureRegion");
+        drawGSTiledLocs_ = simulation::TiledSimulation::GetSamplingLocations(drawGSProgram_->getProgramId());
+        drawGSReconstructionLocs_ = FieldReconstruction::GetSamplingLocations(drawGSProgram_->getProgramId());
+        reconstruction_ = std::make_unique<FieldReconstruction>(appNode_);
 
         glGenVertexArrays(1, &simDummyVAO_);
     }
@@ -43,6 +47,14 @@ namespace viscom::renderers {
     {
     }
 
+    void SimpleGreyScaleRenderer::UpdateSharedPasses(const SimulationData& simData, GLuint rdTexture)
+    {
+        // the bilinear reconstruction only has normals to offer, which the greyscale view does not need.
+        const auto filter = static_cast<ReconstructionFilter>(simData.reconstructionFilter_);
+        if (appNode_->GetTiledSimulation() != nullptr || filter == ReconstructionFilter::Bilinear) reconstruction_->Invalidate();
+        else reconstruction_->Update(simData, rdTexture);
+    }
+
     void SimpleGreyScaleRenderer::RenderRDResults(FrameBuffer& fbo, const SimulationData& simData, const glm::mat4& perspectiveMatrix, GLuint rdTexture)
     {
         fbo.DrawToFBO([this, &perspectiveMatrix, &simData, rdTexture]() {
@@ -55,6 +67,9 @@ namespace viscom::renderers {
             glActiveTexture(GL_TEXTURE0 + 2);
             glBindTexture(GL_TEXTURE_2D, rdTexture);
             glUniform1i(drawGSHeightTextureLoc_, 2);
+            glUniform4fv(drawGSHeightTextureRegionLoc_, 1, glm::value_ptr(appNode_->GetSimulationTextureRegion()));
+            SetHeightTextureSampling(drawGSTiledLocs_, 3);
+            reconstruction_->SetSamplingUniforms(drawGSReconstructionLocs_, simData, 5);
 
             glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
         });
@@ -62,6 +77,6 @@ namespace viscom::renderers {
 
     void SimpleGreyScaleRenderer::DrawOptionsGUI(SimulationData& simData) const
     {
-        // No parameters yet that make any difference. [5/28/2017 Sebastian Maisch]
+        reconstruction_->DrawOptionsGUI(simData);
     }
 }
@@ -11,6 +11,7 @@
 #include "core/main.h"
 #include "core/gfx/FrameBuffer.h"
 #include "RDRenderer.h"
+#include "FieldReconstruction.h"
 
 namespace viscom {
     class ApplicationNodeImplementation;
@@ -23,11 +24,14 @@ namespace viscom::renderers {
     class SimpleGreyScaleRenderer : public RDRenderer
     {
     public:
+        static constexpr const char* NAME = "SimpleGreyScaleRenderer";
+
         SimpleGreyScaleRenderer(ApplicationNodeImplementation* appNode);
         virtual ~SimpleGreyScaleRenderer() override;
 
         virtual void ClearBuffers(FrameBuffer& fbo) override;
         virtual void UpdateFrame(double currentTime, double elapsedTime, const SimulationData& simData, const glm::vec2& nearPlaneSize) override;
+        virtual void UpdateSharedPasses(const SimulationData& simData, GLuint rdTexture) override;
         virtual void RenderRDResults(FrameBuffer& fbo, const SimulationData& simData, const glm::mat4& perspectiveMatrix, GLuint rdTexture) override;
         virtual void DrawOptionsGUI(SimulationData& simData) const override;
 
@@ -42,6 +46,15 @@ namespace viscom::renderers {
         GLint drawGSDistanceLoc_ = -1;
         /** Holds the location of the height texture. */
         GLint drawGSHeightTextureLoc_ = -1;
+        /** Holds the location of the height texture region. */
+        GLint drawGSHeightTextureRegionLoc_ = -1;
+        /** Holds the locations for sampling a tiled domain. */
+        simulation::TiledSimulation::SamplingLocations drawGSTiledLocs_;
+        /** Holds the locations for sampling the reconstructed field. */
+        FieldReconstruction::SamplingLocations drawGSReconstructionLocs_;
+
+        /** Reconstructs the height field once per node frame, shared by all windows and eyes (not for tiled domains). */
+        std::unique_ptr<FieldReconstruction> reconstruction_;
 
         /** Holds the dummy VAO for the simulation quad. */
         GLuint simDummyVAO_ = 0;
@@ -0,0 +1,337 @@
+/**
+ * @file   RenderGraph.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the render graph culling unused passes and pooling transient textures.
+ */
+
+#include "RenderGraph.h"
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include "core/open_gl.h"
+
+namespace viscom::rendergraph {
+
+    namespace {
+
+        struct FormatInfo {
+            GLenum format_;
+            /** Bytes per texel. */
+            GLsizei bytes_;
+            /** Formats of the same class can view the storage of each other (negative: no compatible format). */
+            GLint viewClass_;
+            GLenum attachment_;
+        };
+
+        /** The formats the renderers use, views are compatible within the size classes of the OpenGL specification. */
+        const FormatInfo FORMATS[] = {
+            { GL_RGBA32F, 16, 128, GL_COLOR_ATTACHMENT0 },
+            { GL_RGBA32UI, 16, 128, GL_COLOR_ATTACHMENT0 },
+            { GL_RG32F, 8, 64, GL_COLOR_ATTACHMENT0 },
+            { GL_RGBA16F, 8, 64, GL_COLOR_ATTACHMENT0 },
+            { GL_RG32UI, 8, 64, GL_COLOR_ATTACHMENT0 },
+            { GL_RGBA16, 8, 64, GL_COLOR_ATTACHMENT0 },
+            { GL_R32F, 4, 32, GL_COLOR_ATTACHMENT0 },
+            { GL_R32UI, 4, 32, GL_COLOR_ATTACHMENT0 },
+            { GL_RG16F, 4, 32, GL_COLOR_ATTACHMENT0 },
+            { GL_RGBA8, 4, 32, GL_COLOR_ATTACHMENT0 },
+            { GL_RGB10_A2, 4, 32, GL_COLOR_ATTACHMENT0 },
+            { GL_R11F_G11F_B10F, 4, 32, GL_COLOR_ATTACHMENT0 },
+            { GL_R16F, 2, 16, GL_COLOR_ATTACHMENT0 },
+            { GL_RG8, 2, 16, GL_COLOR_ATTACHMENT0 },
+            { GL_R8, 1, 8, GL_COLOR_ATTACHMENT0 },
+            { GL_DEPTH_COMPONENT32F, 4, -1, GL_DEPTH_ATTACHMENT },
+            { GL_DEPTH_COMPONENT32, 4, -2, GL_DEPTH_ATTACHMENT },
+            { GL_DEPTH_COMPONENT24, 4, -3, GL_DEPTH_ATTACHMENT },
+            { GL_DEPTH24_STENCIL8, 4, -4, GL_DEPTH_STENCIL_ATTACHMENT },
+            { GL_DEPTH32F_STENCIL8, 8, -5, GL_DEPTH_STENCIL_ATTACHMENT }
+        };
+
+        FormatInfo GetFormatInfo(GLenum format)
+        {
+            for (const auto& info : FORMATS) {
+                if (info.format_ == format) return info;
+            }
+            // unknown formats are never aliased with a different one.
+            return { format, 4, -static_cast<GLint>(format), GL_COLOR_ATTACHMENT0 };
+        }
+    }
+
+    RenderGraph::~RenderGraph()
+    {
+        ReleaseTextures();
+    }
+
+    void RenderGraph::Reset()
+    {
+        ReleaseTextures();
+        resources_.clear();
+        passes_.clear();
+        outputs_.clear();
+        order_.clear();
+        slots_.clear();
+    }
+
+    ResourceId RenderGraph::Import(const std::string& name)
+    {
+        resources_.emplace_back();
+        resources_.back().name_ = name;
+        return resources_.size() - 1;
+    }
+
+    ResourceId RenderGraph::CreateTexture(const std::string& name, const TextureDesc& desc)
+    {
+        resources_.emplace_back();
+        resources_.back().name_ = name;
+        resources_.back().transient_ = true;
+        resources_.back().desc_ = desc;
+        return resources_.size() - 1;
+    }
+
+    void RenderGraph::AddPass(const std::string& name, PassPhase phase, std::vector<ResourceId> reads, std::vector<ResourceId> writes, PassFunction execute)
+    {
+        passes_.emplace_back();
+        auto& pass = passes_.back();
+        pass.name_ = name;
+        pass.phase_ = phase;
+        pass.reads_ = std::move(reads);
+        pass.writes_ = std::move(writes);
+        pass.execute_ = std::move(execute);
+    }
+
+    void RenderGraph::MarkOutput(ResourceId resource)
+    {
+        outputs_.push_back(resource);
+    }
+
+    void RenderGraph::Compile()
+    {
+        ReleaseTextures();
+
+        // passes run in phase order, the stable sort keeps the declaration order within a phase.
+        std::vector<std::size_t> sorted(passes_.size());
+        std::iota(sorted.begin(), sorted.end(), std::size_t{ 0 });
+        std::stable_sort(sorted.begin(), sorted.end(), [this](std::size_t a, std::size_t b) { return passes_[a].phase_ < passes_[b].phase_; });
+
+        // walking backwards from the outputs keeps the passes whose results are read by a live pass.
+        std::vector<bool> needed(resources_.size(), false);
+        for (auto output : outputs_) needed[output] = true;
+        for (auto it = sorted.rbegin(); it != sorted.rend(); ++it) {
+            auto& pass = passes_[*it];
+            pass.live_ = std::any_of(pass.writes_.begin(), pass.writes_.end(), [&needed](ResourceId resource) { return needed[resource]; });
+            if (pass.live_) for (auto resource : pass.reads_) needed[resource] = true;
+        }
+
+        order_.clear();
+        for (auto index : sorted) {
+            if (passes_[index].live_) order_.push_back(index);
+        }
+
+        for (auto& resource : resources_) resource.used_ = false;
+        for (std::size_t position = 0; position < order_.size(); ++position) {
+            const auto& pass = passes_[order_[position]];
+            for (const auto* resources : { &pass.reads_, &pass.writes_ }) {
+                for (auto id : *resources) {
+                    auto& resource = resources_[id];
+                    if (!resource.used_) resource.firstUse_ = position;
+                    resource.used_ = true;
+                    resource.lastUse_ = position;
+                }
+            }
+        }
+
+        std::vector<ResourceId> transients;
+        for (ResourceId id = 0; id < resources_.size(); ++id) {
+            auto& resource = resources_[id];
+            if (!resource.transient_ || !resource.used_) continue;
+            const auto firstPhase = passes_[order_[resource.firstUse_]].phase_;
+            if (firstPhase != PassPhase::View && (resource.desc_.width_ == 0 || resource.desc_.height_ == 0)) {
+                LOG(WARNING) << "Render graph texture '" << resource.name_ << "' has the size of the view but is used outside of the view passes.";
+            }
+            // the view passes run again for the next window and eye, a texture handed over from an earlier phase has to survive all of them.
+            if (firstPhase != PassPhase::View && passes_[order_[resource.lastUse_]].phase_ == PassPhase::View) resource.lastUse_ = order_.size();
+            transients.push_back(id);
+        }
+
+        // a slot is reused by the next texture of the same size and view class that is first used after the last one in it died.
+        std::stable_sort(transients.begin(), transients.end(), [this](ResourceId a, ResourceId b) { return resources_[a].firstUse_ < resources_[b].firstUse_; });
+        slots_.clear();
+        for (auto id : transients) {
+            auto& resource = resources_[id];
+            const auto info = GetFormatInfo(resource.desc_.format_);
+            auto slot = std::find_if(slots_.begin(), slots_.end(), [&resource, &info](const Slot& candidate) {
+                return candidate.width_ == resource.desc_.width_ && candidate.height_ == resource.desc_.height_ && candidate.viewClass_ == info.viewClass_
+                    && candidate.lastUse_ < resource.firstUse_;
+            });
+            if (slot == slots_.end()) {
+                slots_.emplace_back();
+                slot = std::prev(slots_.end());
+                slot->width_ = resource.desc_.width_;
+                slot->height_ = resource.desc_.height_;
+                slot->viewClass_ = info.viewClass_;
+                slot->format_ = resource.desc_.format_;
+            }
+            slot->lastUse_ = resource.lastUse_;
+            resource.slot_ = static_cast<std::size_t>(slot - slots_.begin());
+        }
+
+        LOG(INFO) << "Render graph compiled: " << order_.size() << " of " << passes_.size() << " passes live, " << transients.size() << " transient textures in "
+            << slots_.size() << " pool slots.";
+        for (const auto& pass : passes_) {
+            if (!pass.live_) LOG(INFO) << "  culled pass " << pass.name_ << ".";
+        }
+    }
+
+    void RenderGraph::Execute(PassPhase phase, const PassContext& context)
+    {
+        GLsizei viewWidth = 0;
+        GLsizei viewHeight = 0;
+        if (phase == PassPhase::View) {
+            viewWidth = context.viewport_.x + context.viewport_.z;
+            viewHeight = context.viewport_.y + context.viewport_.w;
+            auto view = std::find_if(views_.begin(), views_.end(), [&context](const View& candidate) { return candidate.target_ == context.target_; });
+            if (view == views_.end()) views_.push_back(View{ context.target_, viewWidth, viewHeight });
+            else {
+                view->width_ = viewWidth;
+                view->height_ = viewHeight;
+            }
+        }
+
+        auto passContext = context;
+        for (auto index : order_) {
+            const auto& pass = passes_[index];
+            if (pass.phase_ != phase) continue;
+            for (auto id : pass.reads_) {
+                if (resources_[id].transient_) resources_[id].texture_ = ResolveTexture(id, viewWidth, viewHeight);
+            }
+            for (auto id : pass.writes_) {
+                if (resources_[id].transient_) resources_[id].texture_ = ResolveTexture(id, viewWidth, viewHeight);
+            }
+            passContext.framebuffer_ = ResolveFramebuffer(index, viewWidth, viewHeight);
+            pass.execute_(*this, passContext);
+        }
+    }
+
+    std::size_t RenderGraph::GetTransientBytes() const
+    {
+        std::size_t viewTexels = 0;
+        for (const auto& view : views_) viewTexels += static_cast<std::size_t>(view.width_) * view.height_;
+
+        std::size_t bytes = 0;
+        for (const auto& resource : resources_) {
+            if (!resource.transient_ || !resource.used_) continue;
+            const auto texels = resource.desc_.width_ > 0 ? static_cast<std::size_t>(resource.desc_.width_) * resource.desc_.height_ : viewTexels;
+            bytes += texels * GetFormatInfo(resource.desc_.format_).bytes_;
+        }
+        return bytes;
+    }
+
+    std::size_t RenderGraph::GetAllocatedBytes() const
+    {
+        std::size_t bytes = 0;
+        for (const auto& slot : slots_) {
+            for (const auto& texture : slot.textures_) bytes += static_cast<std::size_t>(texture.width_) * texture.height_ * GetFormatInfo(slot.format_).bytes_;
+        }
+        return bytes;
+    }
+
+    GLuint RenderGraph::ResolveTexture(ResourceId id, GLsizei viewWidth, GLsizei viewHeight)
+    {
+        const auto& resource = resources_[id];
+        auto& slot = slots_[resource.slot_];
+        const auto width = slot.width_ > 0 ? slot.width_ : viewWidth;
+        const auto height = slot.height_ > 0 ? slot.height_ : viewHeight;
+
+        auto storage = std::find_if(slot.textures_.begin(), slot.textures_.end(), [width, height](const SlotTexture& texture) {
+            return texture.width_ == width && texture.height_ == height;
+        });
+        if (storage == slot.textures_.end()) {
+            SlotTexture texture{ width, height, 0 };
+            glGenTextures(1, &texture.texture_);
+            glBindTexture(GL_TEXTURE_2D, texture.texture_);
+            glTexStorage2D(GL_TEXTURE_2D, 1, slot.format_, width, height);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glBindTexture(GL_TEXTURE_2D, 0);
+            slot.textures_.push_back(texture);
+            storage = std::prev(slot.textures_.end());
+            poolMemory_.SetSize(GetAllocatedBytes());
+        }
+        if (resource.desc_.format_ == slot.format_) return storage->texture_;
+
+        // a different format of the same view class reinterprets the storage of the slot.
+        for (const auto& view : resourceViews_) {
+            if (view.resource_ == id && view.storage_ == storage->texture_) return view.texture_;
+        }
+        ResourceView view{ id, storage->texture_, 0 };
+        glGenTextures(1, &view.texture_);
+        glTextureView(view.texture_, GL_TEXTURE_2D, storage->texture_, resource.desc_.format_, 0, 1, 0, 1);
+        glBindTexture(GL_TEXTURE_2D, view.texture_);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        resourceViews_.push_back(view);
+        return view.texture_;
+    }
+
+    GLuint RenderGraph::ResolveFramebuffer(std::size_t index, GLsizei viewWidth, GLsizei viewHeight)
+    {
+        const auto& pass = passes_[index];
+        if (std::none_of(pass.writes_.begin(), pass.writes_.end(), [this](ResourceId id) { return resources_[id].transient_; })) return 0;
+
+        for (const auto& framebuffer : framebuffers_) {
+            if (framebuffer.pass_ == index && framebuffer.width_ == viewWidth && framebuffer.height_ == viewHeight) return framebuffer.fbo_;
+        }
+
+        GLint drawFramebuffer = 0;
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &drawFramebuffer);
+        PassFramebuffer framebuffer{ index, viewWidth, viewHeight, 0 };
+        glGenFramebuffers(1, &framebuffer.fbo_);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer.fbo_);
+
+        std::array<GLenum, 8> drawBuffers;
+        GLsizei numDrawBuffers = 0;
+        for (auto id : pass.writes_) {
+            const auto& resource = resources_[id];
+            if (!resource.transient_) continue;
+            auto attachment = GetFormatInfo(resource.desc_.format_).attachment_;
+            if (attachment == GL_COLOR_ATTACHMENT0) {
+                if (numDrawBuffers == static_cast<GLsizei>(drawBuffers.size())) {
+                    LOG(WARNING) << "Render graph pass " << pass.name_ << " writes more than " << drawBuffers.size() << " color textures.";
+                    continue;
+                }
+                attachment = GL_COLOR_ATTACHMENT0 + numDrawBuffers;
+                drawBuffers[numDrawBuffers++] = attachment;
+            }
+            glFramebufferTexture(GL_DRAW_FRAMEBUFFER, attachment, resource.texture_, 0);
+        }
+        if (numDrawBuffers > 0) glDrawBuffers(numDrawBuffers, drawBuffers.data());
+        else glDrawBuffer(GL_NONE);
+        if (glCheckFramebufferStatus(GL_DRAW_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) LOG(WARNING) << "Render graph frame buffer of pass " << pass.name_ << " is incomplete.";
+
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, static_cast<GLuint>(drawFramebuffer));
+        framebuffers_.push_back(framebuffer);
+        return framebuffer.fbo_;
+    }
+
+    void RenderGraph::ReleaseTextures()
+    {
+        for (auto& framebuffer : framebuffers_) glDeleteFramebuffers(1, &framebuffer.fbo_);
+        framebuffers_.clear();
+        for (auto& view : resourceViews_) glDeleteTextures(1, &view.texture_);
+        resourceViews_.clear();
+        for (auto& slot : slots_) {
+            for (auto& texture : slot.textures_) glDeleteTextures(1, &texture.texture_);
+            slot.textures_.clear();
+        }
+        for (auto& resource : resources_) resource.texture_ = 0;
+        views_.clear();
+        poolMemory_.SetSize(0);
+    }
+}
@@ -0,0 +1,184 @@
+/**
+ * @file   RenderGraph.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the render graph culling unused passes and pooling transient textures.
+ */
+
+#pragma once
+
+#include "core/main.h"
+#include "app/util/ResourceRegistry.h"
+#include <functional>
+
+namespace viscom {
+    class FrameBuffer;
+    struct SimulationData;
+}
+
+namespace viscom::rendergraph {
+
+    /** Identifies a resource of the graph (index in declaration order). */
+    using ResourceId = std::size_t;
+
+    /** The points in the node frame a pass runs at, passes run in phase order and in declaration order within a phase. */
+    enum class PassPhase {
+        /** Once per node frame in UpdateFrame. */
+        Simulation,
+        /** Once per node frame after the simulation, shared by all windows and eyes. */
+        Shared,
+        /** Once per window and eye in DrawFrame. */
+        View
+    };
+
+    /** Describes a transient texture (single level 2D texture with immutable storage). */
+    struct TextureDesc {
+        /** Size in texels, 0 for the size of the view drawn (view passes only). */
+        GLsizei width_ = 0;
+        GLsizei height_ = 0;
+        GLenum format_ = GL_RGBA8;
+    };
+
+    /** Everything a pass needs from the node when it runs. */
+    struct PassContext {
+        /** The window and eye drawn (view passes only). */
+        FrameBuffer* target_ = nullptr;
+        /** Viewport of the target (view passes only), textures with the size of the view cover (x + width, y + height). */
+        glm::ivec4 viewport_ = glm::ivec4(0);
+        const SimulationData* simData_ = nullptr;
+        glm::mat4 viewProjection_ = glm::mat4(1.0f);
+        /** The texture the renderers display (result atlas of a tiled domain). */
+        GLuint resultTexture_ = 0;
+        /** Frame buffer with the transient textures written by the pass attached (0 if it writes none). */
+        GLuint framebuffer_ = 0;
+    };
+
+    class RenderGraph;
+    using PassFunction = std::function<void(const RenderGraph& graph, const PassContext& context)>;
+
+    /**
+     *  Passes declare the resources they read and write. Compile keeps only the passes that contribute to an output and
+     *  assigns the transient textures to pool slots, textures whose lifetimes do not overlap share a slot. Textures of the
+     *  same size and view class share the storage through texture views, so e.g. an RG32F and an RGBA16F target alias.
+     *  The graph is built once and executed every frame, it is rebuilt when the passes change (selecting a renderer).
+     */
+    class RenderGraph
+    {
+    public:
+        RenderGraph() = default;
+        RenderGraph(const RenderGraph&) = delete;
+        RenderGraph& operator=(const RenderGraph&) = delete;
+        ~RenderGraph();
+
+        /** Removes all passes and resources and releases the pooled textures. */
+        void Reset();
+        /** Declares a resource owned outside the graph (simulation state, the window frame buffer), it is never pooled. */
+        ResourceId Import(const std::string& name);
+        /** Declares a texture that only lives between the first and the last pass using it. */
+        ResourceId CreateTexture(const std::string& name, const TextureDesc& desc);
+        /** Adds a pass, the passes writing a resource have to be added before the ones reading it. */
+        void AddPass(const std::string& name, PassPhase phase, std::vector<ResourceId> reads, std::vector<ResourceId> writes, PassFunction execute);
+        /** Keeps the passes writing the resource and all passes they depend on. */
+        void MarkOutput(ResourceId resource);
+        /** Culls the passes not contributing to an output and assigns the transient textures to pool slots. */
+        void Compile();
+        /** Runs the passes of a phase (the textures are created on first use for each view size). */
+        void Execute(PassPhase phase, const PassContext& context);
+
+        /** Returns the texture of a transient resource in the pass currently running. */
+        GLuint GetTexture(ResourceId resource) const { return resources_[resource].texture_; }
+        std::size_t GetNumPasses() const { return passes_.size(); }
+        std::size_t GetNumCulledPasses() const { return passes_.size() - order_.size(); }
+        /** Bytes the transient textures would need as separate allocations for every view drawn so far. */
+        std::size_t GetTransientBytes() const;
+        /** Bytes allocated by the pool. */
+        std::size_t GetAllocatedBytes() const;
+
+    private:
+        struct Resource {
+            std::string name_;
+            bool transient_ = false;
+            TextureDesc desc_;
+            /** Positions of the first and last live pass using it (in execution order). */
+            std::size_t firstUse_ = 0;
+            std::size_t lastUse_ = 0;
+            bool used_ = false;
+            /** Pool slot of a transient texture. */
+            std::size_t slot_ = 0;
+            /** The texture in the pass currently running. */
+            GLuint texture_ = 0;
+        };
+
+        struct Pass {
+            std::string name_;
+            PassPhase phase_ = PassPhase::View;
+            std::vector<ResourceId> reads_;
+            std::vector<ResourceId> writes_;
+            PassFunction execute_;
+            bool live_ = false;
+        };
+
+        struct SlotTexture {
+            GLsizei width_ = 0;
+            GLsizei height_ = 0;
+            /** The storage of the slot. */
+            GLuint texture_ = 0;
+        };
+
+        struct Slot {
+            /** Resources in a slot have the same declared size and view class. */
+            GLsizei width_ = 0;
+            GLsizei height_ = 0;
+            GLint viewClass_ = 0;
+            /** Format of the storage (the one of the first resource). */
+            GLenum format_ = GL_RGBA8;
+            std::size_t lastUse_ = 0;
+            /** Holds the storage for each size the slot was used with. */
+            std::vector<SlotTexture> textures_;
+        };
+
+        struct ResourceView {
+            ResourceId resource_ = 0;
+            GLuint storage_ = 0;
+            GLuint texture_ = 0;
+        };
+
+        struct PassFramebuffer {
+            std::size_t pass_ = 0;
+            GLsizei width_ = 0;
+            GLsizei height_ = 0;
+            GLuint fbo_ = 0;
+        };
+
+        struct View {
+            const FrameBuffer* target_ = nullptr;
+            GLsizei width_ = 0;
+            GLsizei height_ = 0;
+        };
+
+        /** Returns the texture of a transient resource for the given size of the view. */
+        GLuint ResolveTexture(ResourceId resource, GLsizei viewWidth, GLsizei viewHeight);
+        /** Returns the frame buffer with the transient textures written by the pass attached (0 if there are none). */
+        GLuint ResolveFramebuffer(std::size_t pass, GLsizei viewWidth, GLsizei viewHeight);
+        void ReleaseTextures();
+
+        /** Holds the resources and passes in declaration order. */
+        std::vector<Resource> resources_;
+        std::vector<Pass> passes_;
+        /** Resources the graph has to produce. */
+        std::vector<ResourceId> outputs_;
+        /** Indices of the live passes in execution order. */
+        std::vector<std::size_t> order_;
+        /** Holds the pool slots. */
+        std::vector<Slot> slots_;
+        /** Holds the texture views of resources whose format differs from the one of their slot. */
+        std::vector<ResourceView> resourceViews_;
+        /** Holds the frame buffers of the passes writing transient textures. */
+        std::vector<PassFramebuffer> framebuffers_;
+        /** Holds the views drawn since the graph was compiled. */
+        std::vector<View> views_;
+        /** Registers the textures allocated by the pool. */
+        util::TrackedResource poolMemory_{ util::ResourceType::Texture, "RenderGraph", "transient texture pool" };
+    };
+}
@@ -0,0 +1,278 @@
+/**
+ * @file   CPUSimulation.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the CPU simulation backend with optional worker thread.
+ */
+
+#include "CPUSimulation.h"
+#include "core/open_gl.h"
+#include "app/util/FrameTrace.h"
+#include <algorithm>
+#include <chrono>
+
+namespace viscom::simulation {
+
+    CPUSimulation::CPUSimulation(unsigned int width, unsigned int height, bool pipelined, bool fixedPoint, bool inPlace) :
+        width_{ width },
+        height_{ height },
+        pipelined_{ pipelined },
+        grid_{ width, height, inPlace },
+        slotFloats_{ 3 * static_cast<std::size_t>(width) * height }
+    {
+        if (fixedPoint) fixedGrid_ = std::make_unique<GrayScottFixedGrid>(width, height);
+        const auto bufferSize = static_cast<GLsizeiptr>(NUM_SLOTS * slotFloats_ * sizeof(float));
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glGenBuffers(1, &pbo_);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo_);
+        glBufferStorage(GL_PIXEL_UNPACK_BUFFER, bufferSize, nullptr, flags);
+        mappedSlots_ = static_cast<float*>(glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, bufferSize, flags));
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        if (mappedSlots_ == nullptr) LOG(WARNING) << "Could not map the CPU simulation upload buffer.";
+
+        // the grids hold a current and a next field with two components per cell (the in-place grid only the current one).
+        const auto cells = static_cast<std::size_t>(width) * height;
+        const auto gridBytes = 2 * cells * ((inPlace ? 1 : 2) * sizeof(float) + (fixedGrid_ ? 2 * sizeof(std::int32_t) : 0));
+        memory_[0] = util::TrackedResource{ util::ResourceType::Host, "CPUSimulation", "grid", gridBytes };
+        memory_[1] = util::TrackedResource{ util::ResourceType::Buffer, "CPUSimulation", "upload slots", static_cast<std::size_t>(bufferSize) };
+
+        recycledWork_.reserve(MAX_RECYCLED_WORK);
+        if (pipelined_) worker_ = std::thread([this]() { WorkerLoop(); });
+    }
+
+    CPUSimulation::~CPUSimulation()
+    {
+        if (worker_.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock{ mutex_ };
+                stopWorker_ = true;
+            }
+            condition_.notify_all();
+            worker_.join();
+        }
+
+        for (auto& slot : slots_) {
+            if (slot.fence_ != nullptr) glDeleteSync(slot.fence_);
+        }
+        if (pbo_ != 0) {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo_);
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            glDeleteBuffers(1, &pbo_);
+        }
+    }
+
+    CPUSimulation::FrameWork CPUSimulation::AcquireWork()
+    {
+        FrameWork work;
+        {
+            std::lock_guard<std::mutex> lock{ mutex_ };
+            if (!recycledWork_.empty()) {
+                work = std::move(recycledWork_.back());
+                recycledWork_.pop_back();
+            }
+        }
+        work.firstIteration_ = 0;
+        work.iterations_ = 0;
+        work.resetIteration_ = 0;
+        work.warmStartIteration_ = 0;
+        work.seedPoints_.clear();
+        return work;
+    }
+
+    void CPUSimulation::RecycleWork(FrameWork&& work)
+    {
+        // the warm start field is rare and large, only the seed point buffer is worth keeping.
+        work.warmStartField_ = std::vector<float>{};
+        std::lock_guard<std::mutex> lock{ mutex_ };
+        if (recycledWork_.size() < MAX_RECYCLED_WORK) recycledWork_.push_back(std::move(work));
+    }
+
+    void CPUSimulation::Submit(FrameWork work)
+    {
+        if (!pipelined_) {
+            Simulate(work);
+            RecycleWork(std::move(work));
+            return;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock{ mutex_ };
+            // the worker may wait for an upload slot, so the uploads in flight are reclaimed while waiting for it.
+            while (workQueue_.size() == MAX_QUEUED_WORK) {
+                lock.unlock();
+                ReclaimSlots(true);
+                lock.lock();
+                condition_.wait_for(lock, SUBMIT_WAIT, [this]() { return workQueue_.size() < MAX_QUEUED_WORK; });
+            }
+            workQueue_.emplace_back(std::move(work));
+        }
+        condition_.notify_all();
+    }
+
+    void CPUSimulation::WorkerLoop()
+    {
+        util::SetTraceThreadName("CPU simulation");
+        while (true) {
+            FrameWork work;
+            {
+                std::unique_lock<std::mutex> lock{ mutex_ };
+                condition_.wait(lock, [this]() { return stopWorker_ || !workQueue_.empty(); });
+                if (stopWorker_) return;
+                work = std::move(workQueue_.front());
+                workQueue_.pop_front();
+            }
+            // Submit may wait for a free queue entry.
+            condition_.notify_all();
+            Simulate(work);
+            RecycleWork(std::move(work));
+        }
+    }
+
+    void CPUSimulation::Simulate(FrameWork& work)
+    {
+        VISCOM_TRACE_ZONE("SimulateCPU");
+        const auto start = std::chrono::steady_clock::now();
+        const auto fixedParams = ToFixedParameters(work.params_, height_);
+        for (std::uint64_t i = 0; i < work.iterations_; ++i) {
+            const auto iteration = work.firstIteration_ + i;
+            if (iteration == work.resetIteration_) {
+                grid_.Reset();
+                if (fixedGrid_) fixedGrid_->Reset();
+            }
+            if (iteration == work.warmStartIteration_ && work.warmStartField_.size() == grid_.GetField().size()) {
+                if (fixedGrid_) fixedGrid_->SetState(work.warmStartField_.data());
+                else std::copy(work.warmStartField_.begin(), work.warmStartField_.end(), grid_.GetField().begin());
+            }
+
+            stepSeedPoints_.clear();
+            stepFixedSeedPoints_.clear();
+            for (const auto& seedPoint : work.seedPoints_) {
+                if (seedPoint.first != iteration) continue;
+                stepSeedPoints_.push_back(seedPoint.second.x);
+                stepSeedPoints_.push_back(seedPoint.second.y);
+                std::int32_t quantized[2];
+                QuantizeSeedPoint(seedPoint.second.x, seedPoint.second.y, width_, height_, quantized);
+                stepFixedSeedPoints_.push_back(quantized[0]);
+                stepFixedSeedPoints_.push_back(quantized[1]);
+            }
+            if (fixedGrid_) fixedGrid_->Step(fixedParams, stepFixedSeedPoints_.data(), stepFixedSeedPoints_.size() / 2);
+            else grid_.Step(work.params_, stepSeedPoints_.data(), stepSeedPoints_.size() / 2);
+        }
+        if (fixedGrid_) fixedGrid_->GetState(grid_.GetField().data());
+        {
+            std::lock_guard<std::mutex> lock{ mutex_ };
+            simulatedIterations_ += work.iterations_;
+            simulationSeconds_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        PublishResult(work.firstIteration_ + work.iterations_);
+    }
+
+    void CPUSimulation::CollectTiming(std::uint64_t& iterations, double& seconds)
+    {
+        std::lock_guard<std::mutex> lock{ mutex_ };
+        iterations = simulatedIterations_;
+        seconds = simulationSeconds_;
+        simulatedIterations_ = 0;
+        simulationSeconds_ = 0.0;
+    }
+
+    void CPUSimulation::PublishResult(std::uint64_t iterationCount)
+    {
+        if (mappedSlots_ == nullptr) return;
+
+        std::size_t slotIdx = NUM_SLOTS;
+        {
+            std::unique_lock<std::mutex> lock{ mutex_ };
+            auto findSlot = [this, &slotIdx]() {
+                for (std::size_t i = 0; i < NUM_SLOTS; ++i) {
+                    if (slots_[i].state_ == SlotState::FREE) slotIdx = i;
+                }
+                // a ready frame nobody displayed yet is outdated by this one.
+                for (std::size_t i = 0; i < NUM_SLOTS && slotIdx == NUM_SLOTS; ++i) {
+                    if (slots_[i].state_ == SlotState::READY) slotIdx = i;
+                }
+                return slotIdx != NUM_SLOTS;
+            };
+
+            if (pipelined_) condition_.wait(lock, [this, &findSlot]() { return stopWorker_ || findSlot(); });
+            else {
+                while (!findSlot()) {
+                    lock.unlock();
+                    ReclaimSlots(true);
+                    lock.lock();
+                }
+            }
+            if (slotIdx == NUM_SLOTS) return;
+            slots_[slotIdx].state_ = SlotState::WRITING;
+        }
+
+        // the buffer is mapped coherently, the mutex orders these writes before the upload commands.
+        const auto& field = grid_.GetField();
+        const auto numCells = static_cast<std::size_t>(width_) * height_;
+        auto ab = mappedSlots_ + slotIdx * slotFloats_;
+        auto result = ab + 2 * numCells;
+        std::copy(field.begin(), field.end(), ab);
+        for (std::size_t i = 0; i < numCells; ++i) result[i] = 1.0f - std::clamp(field[2 * i] - field[2 * i + 1], 0.0f, 1.0f);
+
+        std::lock_guard<std::mutex> lock{ mutex_ };
+        slots_[slotIdx].iterationCount_ = iterationCount;
+        slots_[slotIdx].state_ = SlotState::READY;
+    }
+
+    void CPUSimulation::ReclaimSlots(bool wait)
+    {
+        std::lock_guard<std::mutex> lock{ mutex_ };
+        auto freed = false;
+        for (auto& slot : slots_) {
+            if (slot.state_ != SlotState::IN_FLIGHT) continue;
+            auto status = glClientWaitSync(slot.fence_, wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0, wait ? 1000000000 : 0);
+            if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED) {
+                glDeleteSync(slot.fence_);
+                slot.fence_ = nullptr;
+                slot.state_ = SlotState::FREE;
+                freed = true;
+            }
+        }
+        if (freed) condition_.notify_all();
+    }
+
+    bool CPUSimulation::Upload(GLuint abTexture, GLuint resultTexture, std::uint64_t& iterationCount)
+    {
+        VISCOM_TRACE_ZONE("UploadCPUResult");
+        ReclaimSlots(false);
+
+        std::size_t slotIdx = NUM_SLOTS;
+        {
+            std::lock_guard<std::mutex> lock{ mutex_ };
+            for (std::size_t i = 0; i < NUM_SLOTS; ++i) {
+                if (slots_[i].state_ != SlotState::READY) continue;
+                if (slotIdx == NUM_SLOTS || slots_[i].iterationCount_ > slots_[slotIdx].iterationCount_) slotIdx = i;
+            }
+            if (slotIdx == NUM_SLOTS) return false;
+            // older ready frames will never be shown.
+            for (auto& slot : slots_) {
+                if (slot.state_ == SlotState::READY && slot.iterationCount_ < slots_[slotIdx].iterationCount_) slot.state_ = SlotState::FREE;
+            }
+            slots_[slotIdx].state_ = SlotState::IN_FLIGHT;
+            iterationCount = slots_[slotIdx].iterationCount_;
+        }
+        condition_.notify_all();
+
+        const auto offset = slotIdx * slotFloats_ * sizeof(float);
+        const auto resultOffset = offset + 2 * static_cast<std::size_t>(width_) * height_ * sizeof(float);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo_);
+        glBindTexture(GL_TEXTURE_2D, abTexture);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width_, height_, GL_RG, GL_FLOAT, reinterpret_cast<const void*>(offset));
+        glBindTexture(GL_TEXTURE_2D, resultTexture);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width_, height_, GL_RED, GL_FLOAT, reinterpret_cast<const void*>(resultOffset));
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        std::lock_guard<std::mutex> lock{ mutex_ };
+        slots_[slotIdx].fence_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        return true;
+    }
+}
@@ -0,0 +1,151 @@
+/**
+ * @file   CPUSimulation.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the CPU simulation backend with optional worker thread.
+ */
+
+#pragma once
+
+#include "core/main.h"
+#include "GrayScottCPU.h"
+#include "app/util/ResourceRegistry.h"
+#include "app/util/RingBuffer.h"
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <vector>
+#include <mutex>
+#include <thread>
+
+namespace viscom::simulation {
+
+    /**
+     *  Simulates on the CPU and hands the results to the GL thread through three slots of a persistently mapped pixel
+     *  buffer. In pipelined mode a worker thread simulates frame N+1 while the GL thread displays frame N, otherwise the
+     *  simulation runs on the GL thread when work is submitted. In fixed point mode GrayScottFixedGrid is simulated and
+     *  converted to floats for the upload.
+     */
+    class CPUSimulation
+    {
+    public:
+        /** The iterations of one frame with everything that has to be applied at a specific iteration. */
+        struct FrameWork {
+            /** First iteration to simulate. */
+            std::uint64_t firstIteration_ = 0;
+            /** Number of iterations to simulate. */
+            std::uint64_t iterations_ = 0;
+            /** Parameters (from the synchronized simulation data of this frame). */
+            GrayScottParameters params_;
+            /** Iteration the grid is reset at. */
+            std::uint64_t resetIteration_ = 0;
+            /** Iteration the warm start field is applied at (if the field is not empty). */
+            std::uint64_t warmStartIteration_ = 0;
+            /** Warm start field (interleaved A/B of the whole grid). */
+            std::vector<float> warmStartField_;
+            /** Seed points keyed by the iteration they are applied in. */
+            std::vector<std::pair<std::uint64_t, glm::vec2>> seedPoints_;
+        };
+
+        /** inPlace keeps a single float field updated in four colour order (see GrayScottGrid). */
+        CPUSimulation(unsigned int width, unsigned int height, bool pipelined, bool fixedPoint, bool inPlace);
+        CPUSimulation(const CPUSimulation&) = delete;
+        CPUSimulation& operator=(const CPUSimulation&) = delete;
+        ~CPUSimulation();
+
+        /** Returns an empty work item, its buffers are reused from earlier frames. */
+        FrameWork AcquireWork();
+        /**
+         *  Queues the work for the worker thread (pipelined) or simulates it right away. While MAX_QUEUED_WORK items
+         *  are waiting the call blocks until the worker takes one, so a slow CPU slows the frames down instead of
+         *  queueing ever more iterations.
+         */
+        void Submit(FrameWork work);
+        /**
+         *  Uploads the newest finished frame to the textures (RG32F A/B and R32F result).
+         *  @return true if a new frame was uploaded, iterationCount is the number of iterations it contains.
+         */
+        bool Upload(GLuint abTexture, GLuint resultTexture, std::uint64_t& iterationCount);
+
+        bool IsPipelined() const { return pipelined_; }
+        bool IsFixedPoint() const { return fixedGrid_ != nullptr; }
+        /** Returns the iterations simulated and the time it took since the last call. */
+        void CollectTiming(std::uint64_t& iterations, double& seconds);
+
+    private:
+        enum class SlotState {
+            FREE,
+            WRITING,
+            READY,
+            IN_FLIGHT
+        };
+
+        struct Slot {
+            SlotState state_ = SlotState::FREE;
+            /** Number of iterations contained in the slot. */
+            std::uint64_t iterationCount_ = 0;
+            /** Fence of the texture upload from this slot. */
+            GLsync fence_ = nullptr;
+        };
+
+        void WorkerLoop();
+        void RecycleWork(FrameWork&& work);
+        void Simulate(FrameWork& work);
+        /** Writes the grid to a free slot and marks it ready. */
+        void PublishResult(std::uint64_t iterationCount);
+        /** Frees all slots whose upload has finished (GL thread only). */
+        void ReclaimSlots(bool wait);
+
+        /** Number of slots in the pixel buffer. */
+        static constexpr std::size_t NUM_SLOTS = 3;
+        /** Number of finished work items kept for reuse. */
+        static constexpr std::size_t MAX_RECYCLED_WORK = 8;
+        /** Number of work items waiting for the worker before Submit blocks (a power of two, the queue never grows). */
+        static constexpr std::size_t MAX_QUEUED_WORK = 4;
+        /** Time Submit waits for the worker between two checks of the uploads in flight. */
+        static constexpr std::chrono::milliseconds SUBMIT_WAIT{ 1 };
+
+        /** Holds the grid width. */
+        unsigned int width_;
+        /** Holds the grid height. */
+        unsigned int height_;
+        /** Simulate on a worker thread. */
+        bool pipelined_;
+        /** Holds the simulation grid (owned by the worker in pipelined mode). */
+        GrayScottGrid grid_;
+        /** Holds the fixed point simulation grid (fixed point mode only, grid_ holds its float copy then). */
+        std::unique_ptr<GrayScottFixedGrid> fixedGrid_;
+        /** Holds the seed points of one step. */
+        std::vector<float> stepSeedPoints_;
+        /** Holds the quantized seed points of one step (fixed point mode). */
+        std::vector<std::int32_t> stepFixedSeedPoints_;
+
+        /** Holds the pixel buffer with all slots. */
+        GLuint pbo_ = 0;
+        /** Persistent mapping of the pixel buffer. */
+        float* mappedSlots_ = nullptr;
+        /** Number of floats per slot (A/B followed by the result). */
+        std::size_t slotFloats_;
+        /** Holds the slots. */
+        std::array<Slot, NUM_SLOTS> slots_;
+        /** Tracks the grids and the pixel buffer. */
+        std::array<util::TrackedResource, 2> memory_;
+
+        /** Protects the slot states and the work queue. */
+        std::mutex mutex_;
+        /** Signals new work or freed slots. */
+        std::condition_variable condition_;
+        /** Holds the work not yet started by the worker (oldest first, usually one item). */
+        util::RingBuffer<FrameWork> workQueue_{ MAX_QUEUED_WORK };
+        /** Holds finished work items for reuse. */
+        std::vector<FrameWork> recycledWork_;
+        /** Iterations simulated and the time it took since the last CollectTiming. */
+        std::uint64_t simulatedIterations_ = 0;
+        double simulationSeconds_ = 0.0;
+        /** Tells the worker to stop. */
+        bool stopWorker_ = false;
+        /** Holds the worker thread (pipelined mode only). */
+        std::thread worker_;
+    };
+}
@@ -0,0 +1,94 @@
+/**
+ * @file   ComparisonSimulation.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the coarse grid simulation shown in the reconstruction comparison.
+ */
+
+#include "ComparisonSimulation.h"
+#include "PingPongSimulation.h"
+#include "core/ApplicationNodeBase.h"
+#include "core/gfx/FrameBuffer.h"
+#include "app/util/GPUTimer.h"
+#include "core/open_gl.h"
+
+namespace viscom::simulation {
+
+    ComparisonSimulation::ComparisonSimulation(ApplicationNodeBase* appNode, unsigned int width, unsigned int height) :
+        size_{ width, height },
+        timer_{ std::make_unique<util::GPUTimer>() }
+    {
+        FrameBufferDescriptor fbDesc;
+        fbDesc.texDesc_.emplace_back(GL_RG32F, GL_TEXTURE_2D);
+        fbDesc.texDesc_.emplace_back(GL_RG32F, GL_TEXTURE_2D);
+        fbDesc.texDesc_.emplace_back(GL_R32F, GL_TEXTURE_2D);
+        simulationFBO_ = std::make_unique<FrameBuffer>(width, height, fbDesc);
+        simulation_ = std::make_unique<PingPongSimulation>(appNode, *simulationFBO_, width, height, true);
+
+        std::size_t bytes = 0;
+        for (const auto texture : simulationFBO_->GetTextures()) bytes += util::QueryTextureSize(texture);
+        memory_ = util::TrackedResource(util::ResourceType::Texture, "ComparisonSimulation", "A/B and result", bytes);
+    }
+
+    ComparisonSimulation::~ComparisonSimulation() = default;
+
+    void ComparisonSimulation::Restart(GLuint fullABTexture)
+    {
+        glm::ivec2 fullSize;
+        glBindTexture(GL_TEXTURE_2D, fullABTexture);
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &fullSize.x);
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &fullSize.y);
+        state_.width_ = static_cast<unsigned int>(fullSize.x);
+        state_.height_ = static_cast<unsigned int>(fullSize.y);
+        state_.field_.resize(2 * static_cast<std::size_t>(state_.width_) * state_.height_);
+        glGetTexImage(GL_TEXTURE_2D, 0, GL_RG, GL_FLOAT, state_.field_.data());
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        const auto factor = state_.width_ / glm::max(size_.x, 1u);
+        if (!DownsampleStateSnapshot(state_, factor) || state_.width_ != size_.x || state_.height_ != size_.y) {
+            LOG(WARNING) << "The full grid (" << fullSize.x << "x" << fullSize.y << ") is no multiple of the comparison grid.";
+            return;
+        }
+
+        // the result is what reactionDiffusionSimulation.frag writes, the comparison shows it before the next iteration.
+        result_.resize(static_cast<std::size_t>(size_.x) * size_.y);
+        for (std::size_t i = 0; i < result_.size(); ++i) result_[i] = 1.0f - glm::clamp(state_.field_[2 * i] - state_.field_[2 * i + 1], 0.0f, 1.0f);
+
+        const auto& textures = simulationFBO_->GetTextures();
+        for (std::size_t i = 0; i + 1 < textures.size(); ++i) {
+            glBindTexture(GL_TEXTURE_2D, textures[i]);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, size_.x, size_.y, GL_RG, GL_FLOAT, state_.field_.data());
+        }
+        glBindTexture(GL_TEXTURE_2D, textures.back());
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, size_.x, size_.y, GL_RED, GL_FLOAT, result_.data());
+        glBindTexture(GL_TEXTURE_2D, 0);
+        simulation_->Reset();
+    }
+
+    void ComparisonSimulation::BeginFrame(const GrayScottParameters& params)
+    {
+        double milliseconds = 0.0;
+        int tag = 0;
+        while (timer_->Collect(milliseconds, tag)) gpuTime_ = gpuTime_ > 0.0 ? 0.9 * gpuTime_ + 0.1 * milliseconds : milliseconds;
+
+        timer_->Begin();
+        simulation_->BeginFrame(params, glm::vec4(0.0f, 0.0f, 1.0f, 1.0f));
+    }
+
+    void ComparisonSimulation::Step(const glm::vec2* seedPoints, std::size_t numSeedPoints)
+    {
+        simulation_->Step(seedPoints, numSeedPoints);
+    }
+
+    void ComparisonSimulation::EndFrame()
+    {
+        simulation_->EndFrame();
+        timer_->End();
+    }
+
+    GLuint ComparisonSimulation::GetResultTexture() const
+    {
+        return simulationFBO_->GetTextures().back();
+    }
+}
@@ -0,0 +1,78 @@
+/**
+ * @file   ComparisonSimulation.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the coarse grid simulation shown in the reconstruction comparison.
+ */
+
+#pragma once
+
+#include "core/main.h"
+#include "GrayScottCPU.h"
+#include "StateSnapshot.h"
+#include "app/util/ResourceRegistry.h"
+#include <memory>
+
+namespace viscom {
+    class ApplicationNodeBase;
+    class FrameBuffer;
+}
+
+namespace viscom::util {
+    class GPUTimer;
+}
+
+namespace viscom::simulation {
+
+    class PingPongSimulation;
+
+    /**
+     *  Simulates a grid coarser by a constant factor alongside the full grid simulation of the node, with the same
+     *  parameters (diffusion rates scaled to the grid) and seed points. The reconstruction comparison shows its cubic
+     *  reconstruction next to the bilinear full grid and both simulation times. Resets, warm starts and resyncs are
+     *  followed by averaging the full grid state down.
+     */
+    class ComparisonSimulation
+    {
+    public:
+        /** The size is the one of the coarse grid. */
+        ComparisonSimulation(ApplicationNodeBase* appNode, unsigned int width, unsigned int height);
+        ComparisonSimulation(const ComparisonSimulation&) = delete;
+        ComparisonSimulation& operator=(const ComparisonSimulation&) = delete;
+        ~ComparisonSimulation();
+
+        /** Takes over the full grid state of an A/B texture, averaged down to the coarse grid (reads the texture back). */
+        void Restart(GLuint fullABTexture);
+        /** Simulates the iterations of a frame, the parameters are the ones of the coarse grid. */
+        void BeginFrame(const GrayScottParameters& params);
+        void Step(const glm::vec2* seedPoints, std::size_t numSeedPoints);
+        void EndFrame();
+
+        /** Returns the result texture of the coarse grid. */
+        GLuint GetResultTexture() const;
+        /** Returns the size of the coarse grid. */
+        const glm::uvec2& GetSize() const { return size_; }
+        /** Smoothed GPU time of the coarse simulation per frame in milliseconds. */
+        double GetGPUTime() const { return gpuTime_; }
+
+    private:
+        /** Holds the grid size. */
+        glm::uvec2 size_;
+        /** Holds the A/B textures and the result texture of the coarse grid. */
+        std::unique_ptr<FrameBuffer> simulationFBO_;
+        /** Holds the simulation of the coarse grid. */
+        std::unique_ptr<PingPongSimulation> simulation_;
+        /** Registers the coarse grid textures. */
+        util::TrackedResource memory_;
+        /** Holds the full grid state read back by a restart. */
+        StateSnapshot state_;
+        /** Holds the result computed from the state of a restart. */
+        std::vector<float> result_;
+
+        /** Measures the coarse simulation. */
+        std::unique_ptr<util::GPUTimer> timer_;
+        /** Smoothed GPU time in milliseconds. */
+        double gpuTime_ = 0.0;
+    };
+}
@@ -0,0 +1,95 @@
+/**
+ * @file   FixedPointSimulation.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the deterministic fixed point GPU simulation.
+ */
+
+#include "FixedPointSimulation.h"
+#include "core/ApplicationNodeBase.h"
+#include "core/open_gl.h"
+#include <algorithm>
+
+namespace viscom::simulation {
+
+    namespace {
+        /** Uniform buffer binding of the FixedSimulationParameters block. */
+        constexpr GLuint PARAMETERS_BINDING = 0;
+    }
+
+    static_assert(sizeof(GrayScottFixedParameters) == 7 * sizeof(std::int32_t), "GrayScottFixedParameters has to match the std140 layout of the shader.");
+
+    FixedPointSimulation::FixedPointSimulation(ApplicationNodeBase* appNode, unsigned int width, unsigned int height, const std::vector<GLuint>& textures) :
+        width_{ width },
+        height_{ height },
+        abTextures_{ { textures[0], textures[1] } },
+        resultTexture_{ textures.back() },
+        uploadBuffer_(2 * static_cast<std::size_t>(width) * height)
+    {
+        program_ = appNode->GetGPUProgramManager().GetResource("reactionDiffusionFixed", std::vector<std::string>{ "reactionDiffusionFixed.comp" });
+        numSeedPointsLoc_ = program_->getUniformLocation("num_seed_points");
+        seedPointsLoc_ = program_->getUniformLocation("seed_points");
+
+        glCreateTextures(GL_TEXTURE_2D, static_cast<GLsizei>(stateTextures_.size()), stateTextures_.data());
+        for (auto texture : stateTextures_) glTextureStorage2D(texture, 1, GL_RG32I, static_cast<GLsizei>(width_), static_cast<GLsizei>(height_));
+        glCreateBuffers(1, &parametersUBO_);
+        glNamedBufferStorage(parametersUBO_, sizeof(GrayScottFixedParameters), nullptr, GL_DYNAMIC_STORAGE_BIT);
+        memory_[0] = util::TrackedResource(util::ResourceType::Texture, "FixedPointSimulation", "state", GetGPUMemorySize());
+        memory_[1] = util::TrackedResource(util::ResourceType::Buffer, "FixedPointSimulation", "parameters", sizeof(GrayScottFixedParameters));
+        memory_[2] = util::TrackedResource(util::ResourceType::Host, "FixedPointSimulation", "upload buffer", uploadBuffer_.size() * sizeof(std::int32_t));
+        Reset();
+    }
+
+    FixedPointSimulation::~FixedPointSimulation()
+    {
+        glDeleteTextures(static_cast<GLsizei>(stateTextures_.size()), stateTextures_.data());
+        if (parametersUBO_ != 0) glDeleteBuffers(1, &parametersUBO_);
+    }
+
+    void FixedPointSimulation::Reset()
+    {
+        const GLint resting[2] = { FIXED_POINT_ONE, 0 };
+        for (auto texture : stateTextures_) glClearTexImage(texture, 0, GL_RG_INTEGER, GL_INT, resting);
+        currentABTexture_ = 0;
+    }
+
+    void FixedPointSimulation::SetState(const float* field)
+    {
+        // quantized on the CPU, a conversion on the GPU could round differently on each node.
+        for (std::size_t i = 0; i < uploadBuffer_.size(); ++i) uploadBuffer_[i] = std::clamp(ToFixedPoint(field[i]), 0, FIXED_POINT_ONE);
+        glTextureSubImage2D(stateTextures_[currentState_], 0, 0, 0, static_cast<GLsizei>(width_), static_cast<GLsizei>(height_), GL_RG_INTEGER, GL_INT, uploadBuffer_.data());
+    }
+
+    void FixedPointSimulation::BeginFrame(const GrayScottParameters& params, const glm::vec4&)
+    {
+        const auto fixedParams = ToFixedParameters(params, height_);
+        glNamedBufferSubData(parametersUBO_, 0, sizeof(GrayScottFixedParameters), &fixedParams);
+    }
+
+    void FixedPointSimulation::Step(const glm::vec2* seedPoints, std::size_t numSeedPoints)
+    {
+        numSeedPoints = glm::min(numSeedPoints, GrayScottGrid::MAX_SEED_POINTS);
+        // quantized on the CPU from the synchronized positions, so all nodes seed the same cells.
+        for (std::size_t i = 0; i < numSeedPoints; ++i) QuantizeSeedPoint(seedPoints[i].x, seedPoints[i].y, width_, height_, &quantizedSeedPoints_[i].x);
+        glUseProgram(program_->getProgramId());
+        glBindBufferBase(GL_UNIFORM_BUFFER, PARAMETERS_BINDING, parametersUBO_);
+        glUniform1ui(numSeedPointsLoc_, static_cast<GLuint>(numSeedPoints));
+        if (numSeedPoints > 0) glUniform2iv(seedPointsLoc_, static_cast<GLsizei>(numSeedPoints), reinterpret_cast<const GLint*>(quantizedSeedPoints_.data()));
+
+        glBindImageTexture(0, stateTextures_[currentState_], 0, GL_FALSE, 0, GL_READ_ONLY, GL_RG32I);
+        glBindImageTexture(1, stateTextures_[1 - currentState_], 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RG32I);
+        glBindImageTexture(2, abTextures_[currentABTexture_], 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RG32F);
+        glBindImageTexture(3, resultTexture_, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+        glDispatchCompute((width_ + 15) / 16, (height_ + 15) / 16, 1);
+        // the next step loads the state, renderers, state hash and read backs use the float copies.
+        glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_TEXTURE_FETCH_BARRIER_BIT | GL_TEXTURE_UPDATE_BARRIER_BIT);
+        currentState_ = 1 - currentState_;
+        currentABTexture_ = 1 - currentABTexture_;
+    }
+
+    std::size_t FixedPointSimulation::GetGPUMemorySize() const
+    {
+        return stateTextures_.size() * 2 * sizeof(std::int32_t) * width_ * height_;
+    }
+}
@@ -0,0 +1,79 @@
+/**
+ * @file   FixedPointSimulation.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the deterministic fixed point GPU simulation.
+ */
+
+#pragma once
+
+#include "GPUSimulation.h"
+#include "app/util/ResourceRegistry.h"
+#include <array>
+#include <vector>
+
+namespace viscom {
+    class ApplicationNodeBase;
+    class GPUProgram;
+}
+
+namespace viscom::simulation {
+
+    /**
+     *  Simulates with reactionDiffusionFixed.comp on RG32I state textures (ping-pong, image load/store). The result
+     *  is bit identical on every conforming GPU and to GrayScottFixedGrid, so nodes with different GPUs or drivers do
+     *  not drift apart. Each step also writes the state as floats to the A/B texture of the regular simulation, the
+     *  renderers, the state hash and the exporters use that one unchanged.
+     */
+    class FixedPointSimulation final : public GPUSimulation
+    {
+    public:
+        /** The textures are the two A/B textures of the simulation frame buffer followed by its result texture. */
+        FixedPointSimulation(ApplicationNodeBase* appNode, unsigned int width, unsigned int height, const std::vector<GLuint>& textures);
+        ~FixedPointSimulation() override;
+
+        /** Sets A to 1 and B to 0 everywhere. */
+        void Reset() override;
+        /** Sets the state from interleaved float A/B values of the whole grid (warm start, resync). */
+        void SetState(const float* field) override;
+        /** Uploads the parameters of the coming iterations, the fixed point simulation always covers the whole texture. */
+        void BeginFrame(const GrayScottParameters& params, const glm::vec4& domainRegion) override;
+        /** Simulates one iteration, the seed points are quantized on the CPU (see QuantizeSeedPoint). */
+        void Step(const glm::vec2* seedPoints, std::size_t numSeedPoints) override;
+
+        GLuint GetCurrentABTexture() const override { return abTextures_[1 - currentABTexture_]; }
+        GLuint GetPreviousABTexture() const override { return abTextures_[currentABTexture_]; }
+
+        /** Size of the GPU memory used by the state textures in bytes. */
+        std::size_t GetGPUMemorySize() const;
+
+    private:
+        /** Holds the grid width. */
+        unsigned int width_;
+        /** Holds the grid height. */
+        unsigned int height_;
+        /** Holds the float copies of the state written for the renderers (owned by the application node). */
+        std::array<GLuint, 2> abTextures_;
+        /** Holds the result texture (owned by the application node). */
+        GLuint resultTexture_;
+        /** Index of the A/B texture the next step writes. */
+        std::size_t currentABTexture_ = 0;
+        /** Holds the simulation program. */
+        std::shared_ptr<GPUProgram> program_;
+        GLint numSeedPointsLoc_ = -1;
+        GLint seedPointsLoc_ = -1;
+        /** Holds the fixed point A/B state (ping-pong). */
+        std::array<GLuint, 2> stateTextures_ = { { 0, 0 } };
+        /** Index of the state texture holding the current state. */
+        std::size_t currentState_ = 0;
+        /** Holds the parameters (FixedSimulationParameters block of the shader). */
+        GLuint parametersUBO_ = 0;
+        /** Holds the quantized state for uploads. */
+        std::vector<std::int32_t> uploadBuffer_;
+        /** Holds the quantized seed points of a step. */
+        std::array<glm::ivec2, GrayScottGrid::MAX_SEED_POINTS> quantizedSeedPoints_;
+        /** Registers the state textures, the parameters and the upload buffer. */
+        std::array<util::TrackedResource, 3> memory_;
+    };
+}
@@ -0,0 +1,27 @@
+/**
+ * @file   GPUSimulation.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the helpers shared by the full domain GPU simulations.
+ */
+
+#include "GPUSimulation.h"
+
+namespace viscom::simulation {
+
+    SimulationUniforms GetSimulationUniforms(const GrayScottParameters& params, const glm::vec4& domainRegion)
+    {
+        SimulationUniforms uniforms;
+        uniforms.diffusionRateA_ = params.diffusionRateA_;
+        uniforms.diffusionRateB_ = params.diffusionRateB_;
+        uniforms.feedRate_ = params.feedRate_;
+        uniforms.killRate_ = params.killRate_;
+        uniforms.dt_ = params.dt_;
+        uniforms.seedPointRadius_ = params.seedPointRadius_;
+        uniforms.useManhattanDistance_ = params.useManhattanDistance_ ? 1 : 0;
+        uniforms.domainOffset_ = glm::vec2(domainRegion.x, domainRegion.y);
+        uniforms.domainScale_ = glm::vec2(domainRegion.z, domainRegion.w);
+        return uniforms;
+    }
+}
@@ -0,0 +1,63 @@
+/**
+ * @file   GPUSimulation.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the interface of the full domain GPU simulations.
+ */
+
+#pragma once
+
+#include "core/main.h"
+#include "GrayScottCPU.h"
+
+namespace viscom::simulation {
+
+    /**
+     *  A full domain GPU simulation on the A/B textures of the simulation frame buffer (the result texture is the last
+     *  one). The node selects one in InitOpenGL, clears and uploads the A/B textures itself and tells the simulation.
+     */
+    class GPUSimulation
+    {
+    public:
+        GPUSimulation() = default;
+        GPUSimulation(const GPUSimulation&) = delete;
+        GPUSimulation& operator=(const GPUSimulation&) = delete;
+        virtual ~GPUSimulation() = default;
+
+        /** Restarts after the node cleared the A/B textures to A = 1 and B = 0. */
+        virtual void Reset() = 0;
+        /** Takes over the interleaved float A/B values of the whole grid the node uploaded (warm start, resync). */
+        virtual void SetState(const float* field) = 0;
+        /** Prepares the iterations of a frame, the parameters and the simulated region of the texture are the same for all. */
+        virtual void BeginFrame(const GrayScottParameters& params, const glm::vec4& domainRegion) = 0;
+        /** Simulates one iteration, seed points are given as global texture coordinates. */
+        virtual void Step(const glm::vec2* seedPoints, std::size_t numSeedPoints) = 0;
+        /** Tells that the GL state was changed between two iterations (resets, halo exchanges, state hashes). */
+        virtual void InvalidateState() {}
+        virtual void EndFrame() {}
+
+        /** Returns the A/B texture written by the last iteration. */
+        virtual GLuint GetCurrentABTexture() const = 0;
+        /** Returns the A/B texture written by the iteration before the last one (the current one if updated in place). */
+        virtual GLuint GetPreviousABTexture() const = 0;
+    };
+
+    /** The SimulationParameters block of reactionDiffusionSimulation.frag and reactionDiffusionInPlace.comp (std140). */
+    struct SimulationUniforms {
+        float diffusionRateA_;
+        float diffusionRateB_;
+        float feedRate_;
+        float killRate_;
+        float dt_;
+        float seedPointRadius_;
+        GLuint useManhattanDistance_;
+        float padding_ = 0.0f;
+        glm::vec2 domainOffset_;
+        glm::vec2 domainScale_;
+    };
+    static_assert(sizeof(SimulationUniforms) == 48, "SimulationUniforms has to match the std140 layout of the shaders.");
+
+    /** Fills the SimulationParameters block, the domain region is (offset, scale) of the simulated part of the texture. */
+    SimulationUniforms GetSimulationUniforms(const GrayScottParameters& params, const glm::vec4& domainRegion);
+}
@@ -0,0 +1,231 @@
+/**
+ * @file   GrayScottCPU.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the CPU implementation of the Gray-Scott reaction diffusion simulation.
+ */
+
+#include "GrayScottCPU.h"
+#include <algorithm>
+#include <cmath>
+
+namespace viscom::simulation {
+
+    namespace {
+        /** Largest fixed point seed point radius, the squared distances of the Euclidean test stay below 2^31. */
+        constexpr std::int32_t MAX_FIXED_SEED_POINT_RADIUS = 32767;
+    }
+
+    std::int32_t ToFixedPoint(double value)
+    {
+        // clamped before rounding, llround of a value outside of long long is undefined.
+        const auto fixed = std::clamp(value * static_cast<double>(FIXED_POINT_ONE), static_cast<double>(INT32_MIN), static_cast<double>(INT32_MAX));
+        return static_cast<std::int32_t>(std::llround(fixed));
+    }
+
+    std::int32_t MultiplyFixedPoint(std::int32_t a, std::int32_t b)
+    {
+        // written without shifting a negative value, ~(~p >> n) is floor(p / 2^n) like the arithmetic shift of the shader.
+        const auto product = static_cast<std::int64_t>(a) * b;
+        return static_cast<std::int32_t>(product >= 0 ? product >> FIXED_POINT_FRACTION_BITS : ~(~product >> FIXED_POINT_FRACTION_BITS));
+    }
+
+    GrayScottFixedParameters ToFixedParameters(const GrayScottParameters& params, unsigned int globalHeight)
+    {
+        // computed in double on the CPU from the synchronized floats, so all nodes get the same integers.
+        const auto dt = static_cast<double>(params.dt_);
+        GrayScottFixedParameters fixed;
+        fixed.diffusionRateA_ = ToFixedPoint(static_cast<double>(params.diffusionRateA_) * dt / 20.0);
+        fixed.diffusionRateB_ = ToFixedPoint(static_cast<double>(params.diffusionRateB_) * dt / 20.0);
+        fixed.feedRate_ = ToFixedPoint(static_cast<double>(params.feedRate_) * dt);
+        fixed.killFeedRate_ = ToFixedPoint((static_cast<double>(params.killRate_) + static_cast<double>(params.feedRate_)) * dt);
+        fixed.dt_ = ToFixedPoint(dt);
+        const auto radius = std::llround(static_cast<double>(params.seedPointRadius_) * globalHeight * FIXED_POINT_SUBCELLS);
+        fixed.seedPointRadius_ = static_cast<std::int32_t>(std::clamp<long long>(radius, 0, MAX_FIXED_SEED_POINT_RADIUS));
+        fixed.useManhattanDistance_ = params.useManhattanDistance_ ? 1 : 0;
+        return fixed;
+    }
+
+    void QuantizeSeedPoint(float x, float y, unsigned int globalWidth, unsigned int globalHeight, std::int32_t* quantized)
+    {
+        quantized[0] = static_cast<std::int32_t>(std::llround(static_cast<double>(x) * globalWidth * FIXED_POINT_SUBCELLS));
+        quantized[1] = static_cast<std::int32_t>(std::llround(static_cast<double>(y) * globalHeight * FIXED_POINT_SUBCELLS));
+    }
+
+    GrayScottGrid::GrayScottGrid(unsigned int width, unsigned int height, bool inPlace) :
+        width_{ width },
+        height_{ height },
+        globalWidth_{ width },
+        globalHeight_{ height },
+        current_(2 * static_cast<std::size_t>(width) * height),
+        next_(inPlace ? 0 : 2 * static_cast<std::size_t>(width) * height)
+    {
+        Reset();
+    }
+
+    void GrayScottGrid::SetGlobalDomain(unsigned int offsetX, unsigned int offsetY, unsigned int globalWidth, unsigned int globalHeight)
+    {
+        offsetX_ = offsetX;
+        offsetY_ = offsetY;
+        globalWidth_ = globalWidth;
+        globalHeight_ = globalHeight;
+    }
+
+    void GrayScottGrid::Reset()
+    {
+        for (std::size_t i = 0; i < current_.size(); i += 2) {
+            current_[i] = 1.0f;
+            current_[i + 1] = 0.0f;
+        }
+    }
+
+    void GrayScottGrid::Step(const GrayScottParameters& params, const float* seedPoints, std::size_t numSeedPoints)
+    {
+        numSeedPoints = std::min(numSeedPoints, MAX_SEED_POINTS);
+        if (!IsInPlace()) {
+            for (unsigned int y = 0; y < height_; ++y) StepRow(params, seedPoints, numSeedPoints, current_.data(), next_.data(), y, 0, 1);
+            std::swap(current_, next_);
+            return;
+        }
+
+        // the colours are (x mod 2, y mod 2) in the order (0, 0), (1, 0), (0, 1), (1, 1). An odd row needs both even rows
+        // next to it finished, so it runs one row pair behind, which gives the same result as four sweeps over the grid.
+        for (unsigned int y = 0; y <= height_; y += 2) {
+            if (y < height_) {
+                StepRow(params, seedPoints, numSeedPoints, current_.data(), current_.data(), y, 0, 2);
+                StepRow(params, seedPoints, numSeedPoints, current_.data(), current_.data(), y, 1, 2);
+            }
+            if (y > 0) {
+                StepRow(params, seedPoints, numSeedPoints, current_.data(), current_.data(), y - 1, 0, 2);
+                StepRow(params, seedPoints, numSeedPoints, current_.data(), current_.data(), y - 1, 1, 2);
+            }
+        }
+    }
+
+    void GrayScottGrid::StepRow(const GrayScottParameters& params, const float* seedPoints, std::size_t numSeedPoints, const float* source, float* target,
+        unsigned int y, unsigned int firstX, unsigned int stepX) const
+    {
+        const auto aspect = static_cast<float>(globalWidth_) / static_cast<float>(globalHeight_);
+        const auto seedRadiusSq = params.seedPointRadius_ * params.seedPointRadius_;
+
+        const auto yUp = std::min(y + 1, height_ - 1);
+        const auto yDown = y == 0 ? 0 : y - 1;
+        const float* rowUp = &source[2 * static_cast<std::size_t>(yUp) * width_];
+        const float* row = &source[2 * static_cast<std::size_t>(y) * width_];
+        const float* rowDown = &source[2 * static_cast<std::size_t>(yDown) * width_];
+        float* rowNext = &target[2 * static_cast<std::size_t>(y) * width_];
+        const auto texCoordY = (static_cast<float>(offsetY_ + y) + 0.5f) / static_cast<float>(globalHeight_);
+
+        for (unsigned int x = firstX; x < width_; x += stepX) {
+            const auto xl = 2 * (x == 0 ? 0 : x - 1);
+            const auto xc = 2 * x;
+            const auto xr = 2 * std::min(x + 1, width_ - 1);
+
+            const auto A = row[xc];
+            auto B = row[xc + 1];
+
+            if (numSeedPoints > 0) {
+                const auto texCoordX = (static_cast<float>(offsetX_ + x) + 0.5f) / static_cast<float>(globalWidth_);
+                for (std::size_t i = 0; i < numSeedPoints; ++i) {
+                    const auto dx = std::abs(texCoordX - seedPoints[2 * i]) * aspect;
+                    const auto dy = std::abs(texCoordY - seedPoints[2 * i + 1]);
+                    if (params.useManhattanDistance_) {
+                        if (dx + dy < params.seedPointRadius_) B = 1.0f;
+                    } else if (dx * dx + dy * dy < seedRadiusSq) B = 1.0f;
+                }
+            }
+
+            float laplace[2];
+            for (unsigned int c = 0; c < 2; ++c) {
+                laplace[c] = 0.05f * rowUp[xl + c] + 0.20f * rowUp[xc + c] + 0.05f * rowUp[xr + c]
+                    + 0.20f * row[xl + c] - row[xc + c] + 0.20f * row[xr + c]
+                    + 0.05f * rowDown[xl + c] + 0.20f * rowDown[xc + c] + 0.05f * rowDown[xr + c];
+            }
+
+            // in place the cell is written after all of its values were read.
+            const auto ABB = A * B * B;
+            const auto nextA = A + (params.diffusionRateA_ * laplace[0] - ABB + params.feedRate_ * (1.0f - A)) * params.dt_;
+            const auto nextB = B + (params.diffusionRateB_ * laplace[1] + ABB - (params.killRate_ + params.feedRate_) * B) * params.dt_;
+            rowNext[xc] = std::clamp(nextA, 0.0f, 1.0f);
+            rowNext[xc + 1] = std::clamp(nextB, 0.0f, 1.0f);
+        }
+    }
+
+    GrayScottFixedGrid::GrayScottFixedGrid(unsigned int width, unsigned int height) :
+        width_{ width },
+        height_{ height },
+        current_(2 * static_cast<std::size_t>(width) * height),
+        next_(2 * static_cast<std::size_t>(width) * height)
+    {
+        Reset();
+    }
+
+    void GrayScottFixedGrid::Reset()
+    {
+        for (std::size_t i = 0; i < current_.size(); i += 2) {
+            current_[i] = FIXED_POINT_ONE;
+            current_[i + 1] = 0;
+        }
+    }
+
+    void GrayScottFixedGrid::SetState(const float* field)
+    {
+        for (std::size_t i = 0; i < current_.size(); ++i) current_[i] = std::clamp(ToFixedPoint(field[i]), 0, FIXED_POINT_ONE);
+    }
+
+    void GrayScottFixedGrid::GetState(float* field) const
+    {
+        for (std::size_t i = 0; i < current_.size(); ++i) field[i] = FromFixedPoint(current_[i]);
+    }
+
+    void GrayScottFixedGrid::Step(const GrayScottFixedParameters& params, const std::int32_t* seedPoints, std::size_t numSeedPoints)
+    {
+        numSeedPoints = std::min(numSeedPoints, GrayScottGrid::MAX_SEED_POINTS);
+        const auto radius = params.seedPointRadius_;
+
+        for (unsigned int y = 0; y < height_; ++y) {
+            const auto yUp = std::min(y + 1, height_ - 1);
+            const auto yDown = y == 0 ? 0 : y - 1;
+            const std::int32_t* rowUp = &current_[2 * static_cast<std::size_t>(yUp) * width_];
+            const std::int32_t* row = &current_[2 * static_cast<std::size_t>(y) * width_];
+            const std::int32_t* rowDown = &current_[2 * static_cast<std::size_t>(yDown) * width_];
+            std::int32_t* rowNext = &next_[2 * static_cast<std::size_t>(y) * width_];
+            const auto cellY = static_cast<std::int32_t>(y) * FIXED_POINT_SUBCELLS + FIXED_POINT_SUBCELLS / 2;
+
+            for (unsigned int x = 0; x < width_; ++x) {
+                const auto xl = 2 * (x == 0 ? 0 : x - 1);
+                const auto xc = 2 * x;
+                const auto xr = 2 * std::min(x + 1, width_ - 1);
+
+                const auto A = row[xc];
+                auto B = row[xc + 1];
+
+                const auto cellX = static_cast<std::int32_t>(x) * FIXED_POINT_SUBCELLS + FIXED_POINT_SUBCELLS / 2;
+                for (std::size_t i = 0; i < numSeedPoints; ++i) {
+                    const auto dx = std::abs(cellX - seedPoints[2 * i]);
+                    const auto dy = std::abs(cellY - seedPoints[2 * i + 1]);
+                    if (params.useManhattanDistance_ != 0) {
+                        if (dx + dy < radius) B = FIXED_POINT_ONE;
+                    } else if (dx < radius && dy < radius && dx * dx + dy * dy < radius * radius) B = FIXED_POINT_ONE;
+                }
+
+                // 20 times the Laplacian, the 1/20 is part of the diffusion rates.
+                std::int32_t laplace[2];
+                for (unsigned int c = 0; c < 2; ++c) {
+                    laplace[c] = rowUp[xl + c] + rowUp[xr + c] + rowDown[xl + c] + rowDown[xr + c]
+                        + 4 * (rowUp[xc + c] + row[xl + c] + row[xr + c] + rowDown[xc + c]) - 20 * row[xc + c];
+                }
+
+                const auto ABB = MultiplyFixedPoint(MultiplyFixedPoint(A, B), B);
+                const auto reaction = MultiplyFixedPoint(params.dt_, ABB);
+                const auto nextA = A + MultiplyFixedPoint(params.diffusionRateA_, laplace[0]) - reaction + MultiplyFixedPoint(params.feedRate_, FIXED_POINT_ONE - A);
+                const auto nextB = B + MultiplyFixedPoint(params.diffusionRateB_, laplace[1]) + reaction - MultiplyFixedPoint(params.killFeedRate_, B);
+                rowNext[xc] = std::clamp(nextA, 0, FIXED_POINT_ONE);
+                rowNext[xc + 1] = std::clamp(nextB, 0, FIXED_POINT_ONE);
+            }
+        }
+
+        std::swap(current_, next_);
+    }
+}
@@ -0,0 +1,144 @@
+/**
+ * @file   GrayScottCPU.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the CPU implementation of the Gray-Scott reaction diffusion simulation.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace viscom::simulation {
+
+    /** The parameters of one simulation step (see SimulationData). */
+    struct GrayScottParameters {
+        float diffusionRateA_ = 1.0f;
+        float diffusionRateB_ = 0.5f;
+        float feedRate_ = 0.055f;
+        float killRate_ = 0.062f;
+        float dt_ = 1.0f;
+        float seedPointRadius_ = 0.1f;
+        bool useManhattanDistance_ = true;
+    };
+
+    /** Number of fractional bits of the fixed point state, 1.0 is FIXED_POINT_ONE (A and B are in [0, 1]). */
+    constexpr int FIXED_POINT_FRACTION_BITS = 24;
+    constexpr std::int32_t FIXED_POINT_ONE = std::int32_t{ 1 } << FIXED_POINT_FRACTION_BITS;
+    /** Seed points and the seed point radius of the fixed point simulation are given in 1/FIXED_POINT_SUBCELLS cells. */
+    constexpr std::int32_t FIXED_POINT_SUBCELLS = 16;
+
+    /**
+     *  The parameters of one fixed point simulation step, dt is folded into the rates and the 1/20 of the Laplacian
+     *  into the diffusion rates. The GPU (FixedSimulationParameters in reactionDiffusionFixed.comp) gets the same values.
+     */
+    struct GrayScottFixedParameters {
+        std::int32_t diffusionRateA_ = 0;
+        std::int32_t diffusionRateB_ = 0;
+        std::int32_t feedRate_ = 0;
+        std::int32_t killFeedRate_ = 0;
+        std::int32_t dt_ = 0;
+        std::int32_t seedPointRadius_ = 0;
+        std::int32_t useManhattanDistance_ = 1;
+    };
+
+    /** Converts a value to fixed point (round to nearest, saturating). */
+    std::int32_t ToFixedPoint(double value);
+    /** Exact conversion of a fixed point state value to float (the values are below 2^24). */
+    inline float FromFixedPoint(std::int32_t value) { return static_cast<float>(value) * (1.0f / static_cast<float>(FIXED_POINT_ONE)); }
+    /** Fixed point product rounded towards negative infinity, the same as mulFixed in reactionDiffusionFixed.comp. */
+    std::int32_t MultiplyFixedPoint(std::int32_t a, std::int32_t b);
+    /** Converts the parameters for a domain of the given height (the seed point radius is relative to it). */
+    GrayScottFixedParameters ToFixedParameters(const GrayScottParameters& params, unsigned int globalHeight);
+    /** Quantizes a seed point in texture coordinates to 1/FIXED_POINT_SUBCELLS cells of the domain (x, y). */
+    void QuantizeSeedPoint(float x, float y, unsigned int globalWidth, unsigned int globalHeight, std::int32_t* quantized);
+
+    /**
+     *  Simulation grid holding A and B interleaved (like the RG32F textures), row 0 is the bottom row.
+     *  One step computes exactly what reactionDiffusionSimulation.frag computes with clamp to edge addressing.
+     *  An in-place grid keeps a single field and updates it in four colour order like reactionDiffusionInPlace.comp
+     *  (see there for how the result differs).
+     */
+    class GrayScottGrid
+    {
+    public:
+        GrayScottGrid(unsigned int width, unsigned int height, bool inPlace = false);
+
+        /**
+         *  Places the grid at the given offset in a larger global domain (used for domain decomposition).
+         *  Seed points are given in global texture coordinates then.
+         */
+        void SetGlobalDomain(unsigned int offsetX, unsigned int offsetY, unsigned int globalWidth, unsigned int globalHeight);
+        /** Sets A to 1 and B to 0 everywhere (same as ApplicationNodeImplementation::ResetSimulation). */
+        void Reset();
+        /** Does one simulation step, seed points are given as interleaved texture coordinates (x, y). */
+        void Step(const GrayScottParameters& params, const float* seedPoints, std::size_t numSeedPoints);
+
+        unsigned int GetWidth() const { return width_; }
+        unsigned int GetHeight() const { return height_; }
+        bool IsInPlace() const { return next_.empty(); }
+        const std::vector<float>& GetField() const { return current_; }
+        std::vector<float>& GetField() { return current_; }
+
+        /** The maximum number of seed points per step (max_seed_points in the shader). */
+        static constexpr std::size_t MAX_SEED_POINTS = 10;
+
+    private:
+        /** Updates every stepX-th cell of row y starting at firstX, reading source and writing target (may be the same). */
+        void StepRow(const GrayScottParameters& params, const float* seedPoints, std::size_t numSeedPoints, const float* source, float* target,
+            unsigned int y, unsigned int firstX, unsigned int stepX) const;
+
+        /** Holds the grid width. */
+        unsigned int width_;
+        /** Holds the grid height. */
+        unsigned int height_;
+        /** Holds the offset of the grid in the global domain (x). */
+        unsigned int offsetX_ = 0;
+        /** Holds the offset of the grid in the global domain (y). */
+        unsigned int offsetY_ = 0;
+        /** Holds the global domain width. */
+        unsigned int globalWidth_;
+        /** Holds the global domain height. */
+        unsigned int globalHeight_;
+        /** Holds the current A/B values. */
+        std::vector<float> current_;
+        /** Holds the A/B values of the next step (empty for an in-place grid). */
+        std::vector<float> next_;
+    };
+
+    /**
+     *  Fixed point version of GrayScottGrid, every operation is an integer operation with a defined result, so a step
+     *  gives bit identical results on every platform and matches reactionDiffusionFixed.comp on any conforming GPU.
+     */
+    class GrayScottFixedGrid
+    {
+    public:
+        GrayScottFixedGrid(unsigned int width, unsigned int height);
+
+        /** Sets A to 1 and B to 0 everywhere. */
+        void Reset();
+        /** Sets the state from interleaved float A/B values (warm start), each value is rounded to the nearest fixed point value. */
+        void SetState(const float* field);
+        /** Writes the state as interleaved float A/B values (exact). */
+        void GetState(float* field) const;
+        /** Does one simulation step, seed points are given as interleaved quantized positions (see QuantizeSeedPoint). */
+        void Step(const GrayScottFixedParameters& params, const std::int32_t* seedPoints, std::size_t numSeedPoints);
+
+        unsigned int GetWidth() const { return width_; }
+        unsigned int GetHeight() const { return height_; }
+        const std::vector<std::int32_t>& GetField() const { return current_; }
+
+    private:
+        /** Holds the grid width. */
+        unsigned int width_;
+        /** Holds the grid height. */
+        unsigned int height_;
+        /** Holds the current A/B values. */
+        std::vector<std::int32_t> current_;
+        /** Holds the A/B values of the next step. */
+        std::vector<std::int32_t> next_;
+    };
+}
@@ -0,0 +1,71 @@
+/**
+ * @file   InPlaceSimulation.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the in-place GPU simulation on a single state texture.
+ */
+
+#include "InPlaceSimulation.h"
+#include "core/ApplicationNodeBase.h"
+#include "core/open_gl.h"
+
+namespace viscom::simulation {
+
+    namespace {
+        /** Uniform buffer binding of the SimulationParameters block. */
+        constexpr GLuint PARAMETERS_BINDING = 0;
+        /** Work group size of the shader, each invocation updates one cell of a 2x2 block. */
+        constexpr unsigned int WORK_GROUP_SIZE = 16;
+        constexpr GLint NUM_COLOURS = 4;
+    }
+
+    InPlaceSimulation::InPlaceSimulation(ApplicationNodeBase* appNode, unsigned int width, unsigned int height, const std::vector<GLuint>& textures) :
+        width_{ width },
+        height_{ height },
+        abTexture_{ textures.front() },
+        resultTexture_{ textures.back() }
+    {
+        program_ = appNode->GetGPUProgramManager().GetResource("reactionDiffusionInPlace", std::vector<std::string>{ "reactionDiffusionInPlace.comp" });
+        colourLoc_ = program_->getUniformLocation("colour");
+        numSeedPointsLoc_ = program_->getUniformLocation("num_seed_points");
+        seedPointsLoc_ = program_->getUniformLocation("seed_points");
+
+        glCreateBuffers(1, &parametersUBO_);
+        glNamedBufferStorage(parametersUBO_, sizeof(SimulationUniforms), nullptr, GL_DYNAMIC_STORAGE_BIT);
+        memory_ = util::TrackedResource(util::ResourceType::Buffer, "InPlaceSimulation", "parameters", sizeof(SimulationUniforms));
+    }
+
+    InPlaceSimulation::~InPlaceSimulation()
+    {
+        if (parametersUBO_ != 0) glDeleteBuffers(1, &parametersUBO_);
+    }
+
+    void InPlaceSimulation::BeginFrame(const GrayScottParameters& params, const glm::vec4& domainRegion)
+    {
+        const auto uniforms = GetSimulationUniforms(params, domainRegion);
+        glNamedBufferSubData(parametersUBO_, 0, sizeof(SimulationUniforms), &uniforms);
+    }
+
+    void InPlaceSimulation::Step(const glm::vec2* seedPoints, std::size_t numSeedPoints)
+    {
+        numSeedPoints = glm::min(numSeedPoints, GrayScottGrid::MAX_SEED_POINTS);
+        glUseProgram(program_->getProgramId());
+        glBindBufferBase(GL_UNIFORM_BUFFER, PARAMETERS_BINDING, parametersUBO_);
+        glUniform1ui(numSeedPointsLoc_, static_cast<GLuint>(numSeedPoints));
+        if (numSeedPoints > 0) glUniform2fv(seedPointsLoc_, static_cast<GLsizei>(numSeedPoints), reinterpret_cast<const GLfloat*>(seedPoints));
+
+        glBindImageTexture(0, abTexture_, 0, GL_FALSE, 0, GL_READ_WRITE, GL_RG32F);
+        glBindImageTexture(1, resultTexture_, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+        const auto groupsX = ((width_ + 1) / 2 + WORK_GROUP_SIZE - 1) / WORK_GROUP_SIZE;
+        const auto groupsY = ((height_ + 1) / 2 + WORK_GROUP_SIZE - 1) / WORK_GROUP_SIZE;
+        for (GLint colour = 0; colour < NUM_COLOURS; ++colour) {
+            glUniform2i(colourLoc_, colour % 2, colour / 2);
+            glDispatchCompute(groupsX, groupsY, 1);
+            // the next colour loads the cells written by this one.
+            if (colour + 1 < NUM_COLOURS) glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+        }
+        // the next step loads the state, renderers, state hash and read backs fetch the textures.
+        glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_TEXTURE_FETCH_BARRIER_BIT | GL_TEXTURE_UPDATE_BARRIER_BIT);
+    }
+}
@@ -0,0 +1,63 @@
+/**
+ * @file   InPlaceSimulation.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the in-place GPU simulation on a single state texture.
+ */
+
+#pragma once
+
+#include "GPUSimulation.h"
+#include "app/util/ResourceRegistry.h"
+#include <memory>
+#include <vector>
+
+namespace viscom {
+    class ApplicationNodeBase;
+    class GPUProgram;
+}
+
+namespace viscom::simulation {
+
+    /**
+     *  Simulates with reactionDiffusionInPlace.comp, which reads and writes the one A/B texture of the regular
+     *  simulation in four colour order instead of ping-ponging between two. This halves the state memory and the
+     *  texture footprint of an iteration at the price of four dispatches per iteration and a slightly different
+     *  result (see the shader).
+     */
+    class InPlaceSimulation final : public GPUSimulation
+    {
+    public:
+        /** The textures are the one A/B texture of the simulation frame buffer followed by its result texture. */
+        InPlaceSimulation(ApplicationNodeBase* appNode, unsigned int width, unsigned int height, const std::vector<GLuint>& textures);
+        ~InPlaceSimulation() override;
+
+        void Reset() override {}
+        void SetState(const float*) override {}
+        void BeginFrame(const GrayScottParameters& params, const glm::vec4& domainRegion) override;
+        void Step(const glm::vec2* seedPoints, std::size_t numSeedPoints) override;
+
+        GLuint GetCurrentABTexture() const override { return abTexture_; }
+        GLuint GetPreviousABTexture() const override { return abTexture_; }
+
+    private:
+        /** Holds the grid width. */
+        unsigned int width_;
+        /** Holds the grid height. */
+        unsigned int height_;
+        /** Holds the A/B texture read and written in place (owned by the application node). */
+        GLuint abTexture_;
+        /** Holds the result texture (owned by the application node). */
+        GLuint resultTexture_;
+        /** Holds the parameters (SimulationParameters block of the shader). */
+        GLuint parametersUBO_ = 0;
+        /** Holds the simulation program. */
+        std::shared_ptr<GPUProgram> program_;
+        GLint colourLoc_ = -1;
+        GLint numSeedPointsLoc_ = -1;
+        GLint seedPointsLoc_ = -1;
+        /** Registers the parameters. */
+        util::TrackedResource memory_;
+    };
+}
@@ -0,0 +1,124 @@
+/**
+ * @file   PingPongSimulation.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the regular GPU simulation ping-ponging between two A/B textures.
+ */
+
+#include "PingPongSimulation.h"
+#include "core/ApplicationNodeBase.h"
+#include "core/gfx/FrameBuffer.h"
+#include "core/gfx/FullscreenQuad.h"
+#include "core/open_gl.h"
+
+namespace viscom::simulation {
+
+    namespace {
+        /** Uniform buffer binding of the SimulationParameters block. */
+        constexpr GLuint PARAMETERS_BINDING = 0;
+    }
+
+    PingPongSimulation::PingPongSimulation(ApplicationNodeBase* appNode, FrameBuffer& simulationFBO, unsigned int width, unsigned int height, bool batchedSubmission) :
+        simulationFBO_{ simulationFBO },
+        width_{ width },
+        height_{ height },
+        batchedSubmission_{ batchedSubmission },
+        uniforms_{ GetSimulationUniforms(GrayScottParameters{}, glm::vec4(0.0f, 0.0f, 1.0f, 1.0f)) }
+    {
+        quad_ = appNode->CreateFullscreenQuad("reactionDiffusionSimulation.frag");
+        const auto program = quad_->GetGPUProgram();
+        prevIterationTextureLoc_ = program->getUniformLocation("texture_0");
+        numSeedPointsLoc_ = program->getUniformLocation("num_seed_points");
+        seedPointsLoc_ = program->getUniformLocation("seed_points");
+        glProgramUniform1i(program->getProgramId(), prevIterationTextureLoc_, 0);
+
+        // the parameters of the frame and the two ping-pong configurations are set up once.
+        glCreateBuffers(1, &parametersUBO_);
+        glNamedBufferStorage(parametersUBO_, sizeof(SimulationUniforms), nullptr, GL_DYNAMIC_STORAGE_BIT);
+        memory_ = util::TrackedResource(util::ResourceType::Buffer, "Simulation", "parameters", sizeof(SimulationUniforms));
+
+        const auto& textures = simulationFBO_.GetTextures();
+        glCreateFramebuffers(static_cast<GLsizei>(framebuffers_.size()), framebuffers_.data());
+        const GLenum drawBuffers[] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1 };
+        for (std::size_t i = 0; i < framebuffers_.size(); ++i) {
+            glNamedFramebufferTexture(framebuffers_[i], GL_COLOR_ATTACHMENT0, textures[i], 0);
+            glNamedFramebufferTexture(framebuffers_[i], GL_COLOR_ATTACHMENT1, textures[2], 0);
+            glNamedFramebufferDrawBuffers(framebuffers_[i], 2, drawBuffers);
+        }
+    }
+
+    PingPongSimulation::~PingPongSimulation()
+    {
+        glDeleteFramebuffers(static_cast<GLsizei>(framebuffers_.size()), framebuffers_.data());
+        if (parametersUBO_ != 0) glDeleteBuffers(1, &parametersUBO_);
+    }
+
+    void PingPongSimulation::Reset()
+    {
+        iterationToggle_ = true;
+    }
+
+    void PingPongSimulation::BeginFrame(const GrayScottParameters& params, const glm::vec4& domainRegion)
+    {
+        // the parameters are constant within the frame, one upload serves all iterations.
+        uniforms_ = GetSimulationUniforms(params, domainRegion);
+        glNamedBufferSubData(parametersUBO_, 0, sizeof(SimulationUniforms), &uniforms_);
+        stateValid_ = false;
+        programSeedPoints_ = -1;
+    }
+
+    void PingPongSimulation::Step(const glm::vec2* seedPoints, std::size_t numSeedPoints)
+    {
+        static const std::vector<std::size_t> drawBuffers0{{0, 2}};
+        static const std::vector<std::size_t> drawBuffers1{{1, 2}};
+        const auto numPoints = static_cast<GLsizei>(numSeedPoints);
+        const auto& textures = simulationFBO_.GetTextures();
+
+        if (batchedSubmission_) {
+            if (!stateValid_) {
+                glUseProgram(quad_->GetGPUProgram()->getProgramId());
+                glBindBufferBase(GL_UNIFORM_BUFFER, PARAMETERS_BINDING, parametersUBO_);
+                glViewport(0, 0, static_cast<GLsizei>(width_), static_cast<GLsizei>(height_));
+                stateValid_ = true;
+            }
+            glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffers_[iterationToggle_ ? 0 : 1]);
+            glBindTextureUnit(0, textures[iterationToggle_ ? 1 : 0]);
+            // most iterations have no seed points, the uniforms keep their value then.
+            if (numPoints > 0 || programSeedPoints_ != 0) {
+                glUniform1ui(numSeedPointsLoc_, static_cast<GLuint>(numPoints));
+                if (numPoints > 0) glUniform2fv(seedPointsLoc_, numPoints, reinterpret_cast<const GLfloat*>(seedPoints));
+                programSeedPoints_ = numPoints;
+            }
+            quad_->Draw();
+        } else {
+            glActiveTexture(GL_TEXTURE0);
+            glBindTexture(GL_TEXTURE_2D, textures[iterationToggle_ ? 1 : 0]);
+            glUseProgram(quad_->GetGPUProgram()->getProgramId());
+            glUniform1i(prevIterationTextureLoc_, 0);
+            glNamedBufferSubData(parametersUBO_, 0, sizeof(SimulationUniforms), &uniforms_);
+            glBindBufferBase(GL_UNIFORM_BUFFER, PARAMETERS_BINDING, parametersUBO_);
+            glUniform1ui(numSeedPointsLoc_, static_cast<GLuint>(numPoints));
+            glUniform2fv(seedPointsLoc_, numPoints, reinterpret_cast<const GLfloat*>(seedPoints));
+            simulationFBO_.DrawToFBO(iterationToggle_ ? drawBuffers0 : drawBuffers1, [this]() {
+                quad_->Draw();
+            });
+        }
+        iterationToggle_ = !iterationToggle_;
+    }
+
+    void PingPongSimulation::EndFrame()
+    {
+        if (batchedSubmission_) glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+
+    GLuint PingPongSimulation::GetCurrentABTexture() const
+    {
+        return simulationFBO_.GetTextures()[iterationToggle_ ? 1 : 0];
+    }
+
+    GLuint PingPongSimulation::GetPreviousABTexture() const
+    {
+        return simulationFBO_.GetTextures()[iterationToggle_ ? 0 : 1];
+    }
+}
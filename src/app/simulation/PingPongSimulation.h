@@ -0,0 +1,74 @@
+/**
+ * @file   PingPongSimulation.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the regular GPU simulation ping-ponging between two A/B textures.
+ */
+
+#pragma once
+
+#include "GPUSimulation.h"
+#include "app/util/ResourceRegistry.h"
+#include <array>
+#include <memory>
+
+namespace viscom {
+    class ApplicationNodeBase;
+    class FrameBuffer;
+    class FullscreenQuad;
+}
+
+namespace viscom::simulation {
+
+    /**
+     *  Simulates with reactionDiffusionSimulation.frag, every iteration reads one A/B texture and writes the other one
+     *  and the result. Batched submission sets up the GL state once per frame (until it is invalidated), otherwise
+     *  every iteration sets up all of its state (submission before batching, kept for comparison).
+     */
+    class PingPongSimulation final : public GPUSimulation
+    {
+    public:
+        /** The frame buffer holds the two A/B textures and the result texture. */
+        PingPongSimulation(ApplicationNodeBase* appNode, FrameBuffer& simulationFBO, unsigned int width, unsigned int height, bool batchedSubmission);
+        ~PingPongSimulation() override;
+
+        void Reset() override;
+        void SetState(const float*) override {}
+        void BeginFrame(const GrayScottParameters& params, const glm::vec4& domainRegion) override;
+        void Step(const glm::vec2* seedPoints, std::size_t numSeedPoints) override;
+        void InvalidateState() override { stateValid_ = false; }
+        void EndFrame() override;
+
+        GLuint GetCurrentABTexture() const override;
+        GLuint GetPreviousABTexture() const override;
+
+    private:
+        /** Holds the frame buffer of the A/B and result textures (owned by the application node). */
+        FrameBuffer& simulationFBO_;
+        /** Holds the grid width. */
+        unsigned int width_;
+        /** Holds the grid height. */
+        unsigned int height_;
+        /** Set up the GL state once per frame instead of once per iteration. */
+        bool batchedSubmission_;
+        /** Holds the simulation program. */
+        std::unique_ptr<FullscreenQuad> quad_;
+        GLint prevIterationTextureLoc_ = -1;
+        GLint numSeedPointsLoc_ = -1;
+        GLint seedPointsLoc_ = -1;
+        /** Holds the parameters of the frame (SimulationParameters block of the shader). */
+        SimulationUniforms uniforms_;
+        GLuint parametersUBO_ = 0;
+        /** Frame buffers writing A/B 0 or 1 and the result (batched submission). */
+        std::array<GLuint, 2> framebuffers_ = { { 0, 0 } };
+        /** The next iteration writes A/B 0 (and reads A/B 1). */
+        bool iterationToggle_ = true;
+        /** The GL state of the batched submission is set up. */
+        bool stateValid_ = false;
+        /** Number of seed points the uniforms of the program hold (-1 if unknown). */
+        GLsizei programSeedPoints_ = -1;
+        /** Registers the parameters. */
+        util::TrackedResource memory_;
+    };
+}
@@ -0,0 +1,139 @@
+/**
+ * @file   StateSnapshot.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of compressed simulation state snapshots.
+ */
+
+#include "StateSnapshot.h"
+#include "app/util/ByteCodec.h"
+#include "app/util/MappedFile.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+namespace viscom::simulation {
+
+    namespace {
+        /** File magic ("RDSS"). */
+        constexpr std::uint32_t SNAPSHOT_MAGIC = 0x53534452;
+        constexpr std::uint32_t SNAPSHOT_VERSION = 1;
+
+        struct SnapshotFileHeader {
+            std::uint32_t magic_;
+            std::uint32_t version_;
+            std::uint32_t width_;
+            std::uint32_t height_;
+            std::uint64_t iteration_;
+            std::uint64_t compressedSize_;
+        };
+    }
+
+    bool EncodeStateSnapshot(const StateSnapshot& snapshot, std::vector<std::uint8_t>& data)
+    {
+        const auto numValues = static_cast<std::size_t>(snapshot.width_) * snapshot.height_ * 2;
+        if (snapshot.field_.size() != numValues) return false;
+
+        std::vector<std::uint8_t> shuffled(numValues * sizeof(float));
+        util::ShuffleBytes(snapshot.field_.data(), numValues, sizeof(float), shuffled.data());
+        std::vector<std::uint8_t> compressed;
+        compressed.reserve(shuffled.size() / 4);
+        util::EncodeRLE(shuffled.data(), shuffled.size(), compressed);
+
+        SnapshotFileHeader header{ SNAPSHOT_MAGIC, SNAPSHOT_VERSION, snapshot.width_, snapshot.height_, snapshot.iteration_, compressed.size() };
+        data.resize(sizeof(header) + compressed.size());
+        std::memcpy(data.data(), &header, sizeof(header));
+        std::memcpy(data.data() + sizeof(header), compressed.data(), compressed.size());
+        return true;
+    }
+
+    bool SaveStateSnapshot(const std::string& filename, const StateSnapshot& snapshot)
+    {
+        std::vector<std::uint8_t> data;
+        if (!EncodeStateSnapshot(snapshot, data)) return false;
+
+        std::ofstream ofs(filename, std::ofstream::binary | std::ofstream::trunc);
+        ofs.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        return ofs.good();
+    }
+
+    bool DecodeStateSnapshot(const void* data, std::size_t size, StateSnapshot& snapshot, unsigned int expectedWidth, unsigned int expectedHeight)
+    {
+        if (size < sizeof(SnapshotFileHeader)) return false;
+        SnapshotFileHeader header;
+        std::memcpy(&header, data, sizeof(header));
+        if (header.magic_ != SNAPSHOT_MAGIC || header.version_ != SNAPSHOT_VERSION) return false;
+        if (header.compressedSize_ > size - sizeof(header)) return false;
+        if (expectedWidth != 0 && header.width_ != expectedWidth) return false;
+        if (expectedHeight != 0 && header.height_ != expectedHeight) return false;
+
+        const auto numValues = static_cast<std::size_t>(header.width_) * header.height_ * 2;
+        if (numValues * sizeof(float) > util::MaxDecodedRLESize(static_cast<std::size_t>(header.compressedSize_))) return false;
+        std::vector<std::uint8_t> shuffled(numValues * sizeof(float));
+        auto payload = static_cast<const std::uint8_t*>(data) + sizeof(header);
+        if (!util::DecodeRLE(payload, static_cast<std::size_t>(header.compressedSize_), shuffled.data(), shuffled.size())) return false;
+
+        snapshot.width_ = header.width_;
+        snapshot.height_ = header.height_;
+        snapshot.iteration_ = header.iteration_;
+        snapshot.field_.resize(numValues);
+        util::UnshuffleBytes(shuffled.data(), numValues, sizeof(float), snapshot.field_.data());
+        return true;
+    }
+
+    bool LoadStateSnapshot(const std::string& filename, StateSnapshot& snapshot, unsigned int expectedWidth, unsigned int expectedHeight)
+    {
+        util::MappedFile file(filename);
+        if (!file.IsValid()) return false;
+        return DecodeStateSnapshot(file.GetData(), file.GetSize(), snapshot, expectedWidth, expectedHeight);
+    }
+
+    bool CompareStateSnapshots(const StateSnapshot& lhs, const StateSnapshot& rhs, StateDifference& difference)
+    {
+        difference = StateDifference{};
+        if (lhs.width_ != rhs.width_ || lhs.height_ != rhs.height_ || lhs.field_.size() != rhs.field_.size()) return false;
+
+        for (std::size_t i = 0; i < lhs.field_.size(); i += 2) {
+            const auto diffA = std::abs(lhs.field_[i] - rhs.field_[i]);
+            const auto diffB = std::abs(lhs.field_[i + 1] - rhs.field_[i + 1]);
+            if (diffA == 0.0f && diffB == 0.0f) continue;
+            difference.maxDifference_ = std::max(difference.maxDifference_, std::max(diffA, diffB));
+            ++difference.differingCells_;
+        }
+        return true;
+    }
+
+    bool DownsampleStateSnapshot(StateSnapshot& snapshot, unsigned int factor)
+    {
+        if (factor == 0 || snapshot.width_ % factor != 0 || snapshot.height_ % factor != 0
+            || snapshot.field_.size() != 2 * static_cast<std::size_t>(snapshot.width_) * snapshot.height_) return false;
+        if (factor == 1) return true;
+
+        const auto width = snapshot.width_ / factor;
+        const auto height = snapshot.height_ / factor;
+        const auto weight = 1.0f / static_cast<float>(factor * factor);
+        // coarse rows are written in front of the fine rows they are computed from, so the field is reused.
+        for (unsigned int y = 0; y < height; ++y) {
+            for (unsigned int x = 0; x < width; ++x) {
+                float sumA = 0.0f, sumB = 0.0f;
+                for (unsigned int fy = 0; fy < factor; ++fy) {
+                    const auto row = static_cast<std::size_t>(y * factor + fy) * snapshot.width_;
+                    for (unsigned int fx = 0; fx < factor; ++fx) {
+                        const auto cell = 2 * (row + x * factor + fx);
+                        sumA += snapshot.field_[cell];
+                        sumB += snapshot.field_[cell + 1];
+                    }
+                }
+                const auto cell = 2 * (static_cast<std::size_t>(y) * width + x);
+                snapshot.field_[cell] = sumA * weight;
+                snapshot.field_[cell + 1] = sumB * weight;
+            }
+        }
+        snapshot.width_ = width;
+        snapshot.height_ = height;
+        snapshot.field_.resize(2 * static_cast<std::size_t>(width) * height);
+        return true;
+    }
+}
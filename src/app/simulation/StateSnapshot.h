@@ -0,0 +1,55 @@
+/**
+ * @file   StateSnapshot.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of compressed simulation state snapshots.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace viscom::simulation {
+
+    /** A simulation state (A/B interleaved, row 0 at the bottom) used to warm start presets. */
+    struct StateSnapshot {
+        /** Width of the field. */
+        unsigned int width_ = 0;
+        /** Height of the field. */
+        unsigned int height_ = 0;
+        /** Number of iterations simulated to get this state. */
+        std::uint64_t iteration_ = 0;
+        /** The A/B values. */
+        std::vector<float> field_;
+    };
+
+    /** Difference between two states of the same size. */
+    struct StateDifference {
+        /** Largest absolute difference of an A or B value. */
+        float maxDifference_ = 0.0f;
+        /** Number of cells where A or B differ. */
+        std::size_t differingCells_ = 0;
+    };
+
+    /** Compares two snapshots cell by cell, returns false if their sizes differ. */
+    bool CompareStateSnapshots(const StateSnapshot& lhs, const StateSnapshot& rhs, StateDifference& difference);
+    /**
+     *  Averages blocks of factor x factor cells (a snapshot of the full grid on a coarser simulation grid), returns
+     *  false if the size is not a multiple of the factor.
+     */
+    bool DownsampleStateSnapshot(StateSnapshot& snapshot, unsigned int factor);
+    /** Encodes a snapshot to memory (same format as the files). */
+    bool EncodeStateSnapshot(const StateSnapshot& snapshot, std::vector<std::uint8_t>& data);
+    /** Writes a byte shuffled and run length encoded snapshot. */
+    bool SaveStateSnapshot(const std::string& filename, const StateSnapshot& snapshot);
+    /**
+     *  Decodes a snapshot from memory. Headers whose size differs from expectedWidth x expectedHeight (0 accepts any
+     *  size) or that the payload cannot hold are rejected before anything is allocated.
+     */
+    bool DecodeStateSnapshot(const void* data, std::size_t size, StateSnapshot& snapshot, unsigned int expectedWidth = 0, unsigned int expectedHeight = 0);
+    /** Maps a snapshot file into memory and decodes it (see DecodeStateSnapshot). */
+    bool LoadStateSnapshot(const std::string& filename, StateSnapshot& snapshot, unsigned int expectedWidth = 0, unsigned int expectedHeight = 0);
+}
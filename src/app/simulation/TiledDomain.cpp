@@ -0,0 +1,193 @@
+/**
+ * @file   TiledDomain.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the residency management of a tiled virtual simulation domain.
+ */
+
+#include "TiledDomain.h"
+#include "app/util/ByteCodec.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+namespace viscom::simulation {
+
+    TiledDomain::TiledDomain(unsigned int width, unsigned int height, unsigned int tileSize, unsigned int numSlots, const std::string& pageDirectory) :
+        width_{ width },
+        height_{ height },
+        tileSize_{ tileSize },
+        tilesX_{ (width + tileSize - 1) / tileSize },
+        tilesY_{ (height + tileSize - 1) / tileSize },
+        pageDirectory_{ pageDirectory },
+        tiles_(static_cast<std::size_t>(tilesX_) * tilesY_),
+        tileSlots_(tiles_.size(), -1)
+    {
+        slotsX_ = static_cast<unsigned int>(std::ceil(std::sqrt(static_cast<double>(numSlots))));
+        slotsY_ = (numSlots + slotsX_ - 1) / slotsX_;
+        slotTiles_.resize(static_cast<std::size_t>(slotsX_) * slotsY_, -1);
+    }
+
+    void TiledDomain::RequireRegion(float cellX, float cellY, float radius, std::uint64_t iteration)
+    {
+        const auto tile = static_cast<float>(tileSize_);
+        const auto minX = static_cast<int>(std::floor((cellX - radius) / tile));
+        const auto maxX = static_cast<int>(std::floor((cellX + radius) / tile));
+        const auto minY = static_cast<int>(std::floor((cellY - radius) / tile));
+        const auto maxY = static_cast<int>(std::floor((cellY + radius) / tile));
+
+        for (auto ty = std::max(minY, 0); ty <= std::min(maxY, static_cast<int>(tilesY_) - 1); ++ty) {
+            for (auto tx = std::max(minX, 0); tx <= std::min(maxX, static_cast<int>(tilesX_) - 1); ++tx) {
+                const auto tileIdx = static_cast<unsigned int>(ty) * tilesX_ + static_cast<unsigned int>(tx);
+                tiles_[tileIdx].lastActiveIteration_ = iteration;
+                tiles_[tileIdx].restingUpdates_ = 0;
+                if (!tiles_[tileIdx].required_) {
+                    tiles_[tileIdx].required_ = true;
+                    requiredTiles_.push_back(tileIdx);
+                }
+            }
+        }
+    }
+
+    void TiledDomain::UpdateActivity(const std::int32_t* activity, std::size_t count, std::uint64_t iteration)
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto active = activity[i] >= 0;
+            const auto tileIdx = static_cast<unsigned int>(active ? activity[i] : -1 - activity[i]);
+            // the tile may have been evicted since it was measured.
+            if (tileIdx >= tiles_.size() || tileSlots_[tileIdx] == -1) continue;
+
+            if (!active) {
+                ++tiles_[tileIdx].restingUpdates_;
+                continue;
+            }
+
+            // active tiles keep their neighbours resident so the pattern can grow across tile borders.
+            tiles_[tileIdx].restingUpdates_ = 0;
+            const auto tx = static_cast<int>(tileIdx % tilesX_);
+            const auto ty = static_cast<int>(tileIdx / tilesX_);
+            const auto radius = static_cast<float>(tileSize_) * 0.5f;
+            RequireRegion((static_cast<float>(tx) + 0.5f) * tileSize_, (static_cast<float>(ty) + 0.5f) * tileSize_, radius + tileSize_, iteration);
+        }
+    }
+
+    void TiledDomain::Resolve(std::vector<Eviction>& evictions, std::vector<Placement>& placements, std::uint64_t iteration)
+    {
+        evictions.clear();
+        placements.clear();
+
+        // release tiles that returned to the resting state.
+        for (std::size_t slot = 0; slot < slotTiles_.size(); ++slot) {
+            if (slotTiles_[slot] == -1) continue;
+            const auto tileIdx = static_cast<unsigned int>(slotTiles_[slot]);
+            const auto& tile = tiles_[tileIdx];
+            if (!tile.required_ && tile.restingUpdates_ >= RESTING_UPDATES && iteration > tile.lastActiveIteration_ + REQUIRED_ITERATIONS) {
+                evictions.push_back(Eviction{ tileIdx, static_cast<unsigned int>(slot), false });
+                Release(tileIdx);
+            }
+        }
+
+        auto& freeSlots = freeSlots_;
+        freeSlots.clear();
+        for (std::size_t slot = slotTiles_.size(); slot > 0; --slot) {
+            if (slotTiles_[slot - 1] == -1) freeSlots.push_back(static_cast<unsigned int>(slot - 1));
+        }
+
+        for (auto tileIdx : requiredTiles_) {
+            tiles_[tileIdx].required_ = false;
+            if (tileSlots_[tileIdx] != -1) continue;
+
+            if (freeSlots.empty()) {
+                // page out the resident tile that was inactive the longest.
+                int lruSlot = -1;
+                for (std::size_t slot = 0; slot < slotTiles_.size(); ++slot) {
+                    if (slotTiles_[slot] == -1) continue;
+                    const auto& candidate = tiles_[slotTiles_[slot]];
+                    if (candidate.lastActiveIteration_ >= iteration) continue;
+                    if (lruSlot == -1 || candidate.lastActiveIteration_ < tiles_[slotTiles_[lruSlot]].lastActiveIteration_) lruSlot = static_cast<int>(slot);
+                }
+                if (lruSlot == -1) continue;
+
+                const auto lruTile = static_cast<unsigned int>(slotTiles_[lruSlot]);
+                evictions.push_back(Eviction{ lruTile, static_cast<unsigned int>(lruSlot), true });
+                Release(lruTile);
+                freeSlots.push_back(static_cast<unsigned int>(lruSlot));
+            }
+
+            const auto slot = freeSlots.back();
+            freeSlots.pop_back();
+            tileSlots_[tileIdx] = static_cast<std::int32_t>(slot);
+            slotTiles_[slot] = static_cast<std::int32_t>(tileIdx);
+            tiles_[tileIdx].restingUpdates_ = 0;
+            ++numResident_;
+            placements.push_back(Placement{ tileIdx, slot });
+        }
+        requiredTiles_.clear();
+    }
+
+    void TiledDomain::Release(unsigned int tile)
+    {
+        const auto slot = tileSlots_[tile];
+        if (slot == -1) return;
+        slotTiles_[slot] = -1;
+        tileSlots_[tile] = -1;
+        --numResident_;
+    }
+
+    void TiledDomain::StorePagedTile(unsigned int tile, const float* data)
+    {
+        const auto numValues = 2 * static_cast<std::size_t>(tileSize_) * tileSize_;
+        auto resting = true;
+        for (std::size_t i = 0; i < numValues && resting; i += 2) resting = data[i] == 1.0f && data[i + 1] == 0.0f;
+        if (resting) return;
+
+        std::vector<std::uint8_t> shuffled(numValues * sizeof(float));
+        util::ShuffleBytes(data, numValues, sizeof(float), shuffled.data());
+        std::vector<std::uint8_t> compressed;
+        util::EncodeRLE(shuffled.data(), shuffled.size(), compressed);
+
+        if (pageDirectory_.empty()) tiles_[tile].pagedData_ = std::move(compressed);
+        else {
+            std::ofstream ofs(GetPageFile(tile), std::ofstream::binary | std::ofstream::trunc);
+            ofs.write(reinterpret_cast<const char*>(compressed.data()), static_cast<std::streamsize>(compressed.size()));
+        }
+
+        tiles_[tile].paged_ = true;
+        ++numPaged_;
+        pagedBytes_ += compressed.size();
+    }
+
+    bool TiledDomain::LoadPagedTile(unsigned int tile, std::vector<float>& data)
+    {
+        if (!tiles_[tile].paged_) return false;
+
+        std::vector<std::uint8_t> compressed;
+        if (pageDirectory_.empty()) compressed = std::move(tiles_[tile].pagedData_);
+        else {
+            std::ifstream ifs(GetPageFile(tile), std::ifstream::binary | std::ifstream::ate);
+            compressed.resize(static_cast<std::size_t>(ifs.tellg()));
+            ifs.seekg(0);
+            ifs.read(reinterpret_cast<char*>(compressed.data()), static_cast<std::streamsize>(compressed.size()));
+            ifs.close();
+            std::remove(GetPageFile(tile).c_str());
+        }
+        tiles_[tile].paged_ = false;
+        tiles_[tile].pagedData_.clear();
+        --numPaged_;
+        pagedBytes_ -= compressed.size();
+
+        const auto numValues = 2 * static_cast<std::size_t>(tileSize_) * tileSize_;
+        std::vector<std::uint8_t> shuffled(numValues * sizeof(float));
+        if (!util::DecodeRLE(compressed.data(), compressed.size(), shuffled.data(), shuffled.size())) return false;
+        data.resize(numValues);
+        util::UnshuffleBytes(shuffled.data(), numValues, sizeof(float), data.data());
+        return true;
+    }
+
+    std::string TiledDomain::GetPageFile(unsigned int tile) const
+    {
+        return pageDirectory_ + "/tile_" + std::to_string(tile) + ".rdt";
+    }
+}
@@ -0,0 +1,133 @@
+/**
+ * @file   TiledDomain.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the residency management of a tiled virtual simulation domain.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace viscom::simulation {
+
+    /**
+     *  Book keeping for a virtual domain split into square tiles, of which only a fixed number of slots is resident on
+     *  the GPU at a time. A tile is either resting (A = 1, B = 0 everywhere, no storage), resident in a slot, or paged out
+     *  in a compressed form to host memory or to disk. Only resident tiles are simulated.
+     */
+    class TiledDomain
+    {
+    public:
+        /** A tile that has to be moved out of its slot. */
+        struct Eviction {
+            unsigned int tile_;
+            unsigned int slot_;
+            /** Content has to be read back and stored (otherwise the tile is resting). */
+            bool page_;
+        };
+
+        /** A tile that has to be put into a slot. */
+        struct Placement {
+            unsigned int tile_;
+            unsigned int slot_;
+        };
+
+        TiledDomain(unsigned int width, unsigned int height, unsigned int tileSize, unsigned int numSlots, const std::string& pageDirectory);
+
+        unsigned int GetWidth() const { return width_; }
+        unsigned int GetHeight() const { return height_; }
+        unsigned int GetTileSize() const { return tileSize_; }
+        unsigned int GetTilesX() const { return tilesX_; }
+        unsigned int GetTilesY() const { return tilesY_; }
+        unsigned int GetNumSlots() const { return static_cast<unsigned int>(slotTiles_.size()); }
+        /** Slots are arranged in a square atlas with this many slots per row. */
+        unsigned int GetSlotsX() const { return slotsX_; }
+        unsigned int GetSlotsY() const { return slotsY_; }
+        const std::string& GetPageDirectory() const { return pageDirectory_; }
+
+        /** tile -> slot table (-1 if not resident), row major. */
+        const std::vector<std::int32_t>& GetTileSlots() const { return tileSlots_; }
+        /** slot -> tile table (-1 if free). */
+        const std::vector<std::int32_t>& GetSlotTiles() const { return slotTiles_; }
+
+        /** Marks all tiles within radius (in cells) around the cell position as required in the current iteration. */
+        void RequireRegion(float cellX, float cellY, float radius, std::uint64_t iteration);
+        /**
+         *  Updates the activity of resident tiles from an activity report (tile index if the tile is active, -1 - tile
+         *  index if it is at rest). Tiles staying at the resting state for a while are released.
+         */
+        void UpdateActivity(const std::int32_t* activity, std::size_t count, std::uint64_t iteration);
+        /** Computes which tiles have to leave or enter the GPU in this iteration. */
+        void Resolve(std::vector<Eviction>& evictions, std::vector<Placement>& placements, std::uint64_t iteration);
+
+        /** Stores the content of an evicted tile (tileSize^2 interleaved A/B values). */
+        void StorePagedTile(unsigned int tile, const float* data);
+        /** Retrieves the content of a tile to place, returns false if the tile is resting. */
+        bool LoadPagedTile(unsigned int tile, std::vector<float>& data);
+
+        std::size_t GetNumResidentTiles() const { return numResident_; }
+        std::size_t GetNumPagedTiles() const { return numPaged_; }
+        std::size_t GetPagedBytes() const { return pagedBytes_; }
+
+        /** Number of activity updates a tile has to be at rest before it is released. */
+        static constexpr unsigned int RESTING_UPDATES = 4;
+        /** Iterations a required tile stays active without other activity (about 120 frames). */
+        static constexpr std::uint64_t REQUIRED_ITERATIONS = 1800;
+
+    private:
+        struct Tile {
+            /** Tile content is paged out (otherwise it is resting or resident). */
+            bool paged_ = false;
+            /** Iteration in which the tile was last active. */
+            std::uint64_t lastActiveIteration_ = 0;
+            /** Number of consecutive activity updates at rest. */
+            unsigned int restingUpdates_ = 0;
+            /** Tile has to be resident in this iteration. */
+            bool required_ = false;
+            /** Compressed content when paged to host memory. */
+            std::vector<std::uint8_t> pagedData_;
+        };
+
+        void Release(unsigned int tile);
+        std::string GetPageFile(unsigned int tile) const;
+
+        /** Holds the domain width. */
+        unsigned int width_;
+        /** Holds the domain height. */
+        unsigned int height_;
+        /** Holds the tile size. */
+        unsigned int tileSize_;
+        /** Holds the number of tiles in x direction. */
+        unsigned int tilesX_;
+        /** Holds the number of tiles in y direction. */
+        unsigned int tilesY_;
+        /** Holds the number of slots per atlas row. */
+        unsigned int slotsX_;
+        /** Holds the number of slot rows. */
+        unsigned int slotsY_;
+        /** Directory for paged tiles, empty to keep them in host memory. */
+        std::string pageDirectory_;
+
+        /** Holds the tile states. */
+        std::vector<Tile> tiles_;
+        /** Holds the tile -> slot table. */
+        std::vector<std::int32_t> tileSlots_;
+        /** Holds the slot -> tile table. */
+        std::vector<std::int32_t> slotTiles_;
+        /** Tiles required in the current iteration. */
+        std::vector<unsigned int> requiredTiles_;
+        /** Free slots during Resolve (kept to reuse its memory). */
+        std::vector<unsigned int> freeSlots_;
+
+        /** Holds the number of resident tiles. */
+        std::size_t numResident_ = 0;
+        /** Holds the number of paged tiles. */
+        std::size_t numPaged_ = 0;
+        /** Holds the compressed size of all paged tiles. */
+        std::size_t pagedBytes_ = 0;
+    };
+}
@@ -0,0 +1,352 @@
+/**
+ * @file   TiledSimulation.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the GPU simulation of a tiled virtual domain.
+ */
+
+#include "TiledSimulation.h"
+#include "app/ApplicationNodeImplementation.h"
+#include "core/gfx/FullscreenQuad.h"
+#include "core/open_gl.h"
+
+namespace viscom::simulation {
+
+    namespace {
+        /** Cells closer than this to the resting state count as resting. */
+        constexpr float RESTING_EPSILON = 1e-4f;
+        /** Work group size of the activity program. */
+        constexpr unsigned int WORK_GROUP_SIZE = 16;
+    }
+
+    TiledSimulation::TiledSimulation(ApplicationNodeImplementation* appNode, unsigned int width, unsigned int height, unsigned int tileSize, unsigned int numSlots, const std::string& pageDirectory) :
+        domain_{ width, height, tileSize, numSlots, pageDirectory }
+    {
+        for (auto& atlas : abAtlas_) atlas = CreateAtlasTexture(GL_RG32F);
+        resultAtlas_ = CreateAtlasTexture(GL_R32F);
+
+        glGenFramebuffers(2, atlasFBOs_.data());
+        for (std::size_t i = 0; i < 2; ++i) {
+            const GLenum drawBuffers[] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1 };
+            glBindFramebuffer(GL_FRAMEBUFFER, atlasFBOs_[i]);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, abAtlas_[i], 0);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, resultAtlas_, 0);
+            glDrawBuffers(2, drawBuffers);
+        }
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+        glGenTextures(1, &tileIndirection_);
+        glBindTexture(GL_TEXTURE_2D, tileIndirection_);
+        glTexStorage2D(GL_TEXTURE_2D, 1, GL_R32I, domain_.GetTilesX(), domain_.GetTilesY());
+        glGenTextures(1, &slotTiles_);
+        glBindTexture(GL_TEXTURE_2D, slotTiles_);
+        glTexStorage2D(GL_TEXTURE_2D, 1, GL_R32I, domain_.GetSlotsX(), domain_.GetSlotsY());
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        glGenBuffers(1, &activityBuffer_);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, activityBuffer_);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, static_cast<GLsizeiptr>(domain_.GetNumSlots() * sizeof(std::uint32_t)), nullptr, GL_DYNAMIC_READ);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+        measuredSlotTiles_.reserve(domain_.GetNumSlots());
+        activeSlots_.resize(domain_.GetNumSlots());
+        occupiedRuns_.reserve(domain_.GetNumSlots());
+
+        activityProgram_ = appNode->GetGPUProgramManager().GetResource("tiledActivity", std::vector<std::string>{ "tiledActivity.comp" });
+        activityAtlasLoc_ = activityProgram_->getUniformLocation("abAtlas");
+        activitySlotTilesLoc_ = activityProgram_->getUniformLocation("slot_tiles");
+        activityTileSizeLoc_ = activityProgram_->getUniformLocation("tile_size");
+        activityTilesLoc_ = activityProgram_->getUniformLocation("tiles");
+        activityDomainSizeLoc_ = activityProgram_->getUniformLocation("domain_size");
+        activityRestingEpsilonLoc_ = activityProgram_->getUniformLocation("resting_epsilon");
+
+        tiledSimulationQuad_ = appNode->CreateFullscreenQuad("reactionDiffusionTiled.frag");
+        const auto program = tiledSimulationQuad_->GetGPUProgram();
+        prevAtlasLoc_ = program->getUniformLocation("texture_0");
+        tileIndirectionLoc_ = program->getUniformLocation("tile_indirection");
+        slotTilesLoc_ = program->getUniformLocation("slot_tiles");
+        tileSizeLoc_ = program->getUniformLocation("tile_size");
+        tilesLoc_ = program->getUniformLocation("tiles");
+        domainSizeLoc_ = program->getUniformLocation("domain_size");
+        diffusionRateALoc_ = program->getUniformLocation("diffusion_rate_A");
+        diffusionRateBLoc_ = program->getUniformLocation("diffusion_rate_B");
+        feedRateLoc_ = program->getUniformLocation("feed_rate");
+        killRateLoc_ = program->getUniformLocation("kill_rate");
+        dtLoc_ = program->getUniformLocation("dt");
+        seedPointRadiusLoc_ = program->getUniformLocation("seed_point_radius");
+        numSeedPointsLoc_ = program->getUniformLocation("num_seed_points");
+        seedPointsLoc_ = program->getUniformLocation("seed_points");
+        useManhattanDistanceLoc_ = program->getUniformLocation("use_manhattan_distance");
+
+        restingTile_.resize(2 * static_cast<std::size_t>(domain_.GetTileSize()) * domain_.GetTileSize());
+        for (std::size_t i = 0; i < restingTile_.size(); i += 2) {
+            restingTile_[i] = 1.0f;
+            restingTile_[i + 1] = 0.0f;
+        }
+
+        UploadTables();
+
+        memory_[0] = util::TrackedResource(util::ResourceType::Texture, "TiledSimulation", "atlases and tables", GetGPUMemorySize());
+        memory_[1] = util::TrackedResource(util::ResourceType::Buffer, "TiledSimulation", "activity flags", util::QueryBufferSize(activityBuffer_));
+        memory_[2] = util::TrackedResource(util::ResourceType::Host, "TiledSimulation", "paged tiles");
+        LOG(INFO) << "Tiled simulation: " << width << "x" << height << " cells in " << domain_.GetTilesX() << "x" << domain_.GetTilesY() << " tiles of "
+            << domain_.GetTileSize() << ", " << domain_.GetNumSlots() << " resident slots (" << GetGPUMemorySize() / (1024 * 1024) << " MiB).";
+    }
+
+    TiledSimulation::~TiledSimulation()
+    {
+        if (activityFence_ != nullptr) glDeleteSync(activityFence_);
+        if (activityBuffer_ != 0) glDeleteBuffers(1, &activityBuffer_);
+        glDeleteFramebuffers(2, atlasFBOs_.data());
+        glDeleteTextures(2, abAtlas_.data());
+        glDeleteTextures(1, &resultAtlas_);
+        glDeleteTextures(1, &tileIndirection_);
+        glDeleteTextures(1, &slotTiles_);
+    }
+
+    GLuint TiledSimulation::CreateAtlasTexture(GLenum internalFormat) const
+    {
+        GLuint texture = 0;
+        glGenTextures(1, &texture);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexStorage2D(GL_TEXTURE_2D, 1, internalFormat, domain_.GetSlotsX() * domain_.GetTileSize(), domain_.GetSlotsY() * domain_.GetTileSize());
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        return texture;
+    }
+
+    std::size_t TiledSimulation::GetGPUMemorySize() const
+    {
+        const auto atlasTexels = static_cast<std::size_t>(domain_.GetSlotsX()) * domain_.GetSlotsY() * domain_.GetTileSize() * domain_.GetTileSize();
+        const auto abAtlasSize = atlasTexels * 2 * sizeof(float);
+        const auto tableSize = (static_cast<std::size_t>(domain_.GetTilesX()) * domain_.GetTilesY() + domain_.GetNumSlots()) * sizeof(std::int32_t);
+        return 2 * abAtlasSize + atlasTexels * sizeof(float) + tableSize;
+    }
+
+    void TiledSimulation::Reset()
+    {
+        domain_ = TiledDomain(domain_.GetWidth(), domain_.GetHeight(), domain_.GetTileSize(), domain_.GetNumSlots(), domain_.GetPageDirectory());
+        UploadTables();
+        if (activityFence_ != nullptr) glDeleteSync(activityFence_);
+        activityFence_ = nullptr;
+    }
+
+    void TiledSimulation::UpdateResidency(const glm::vec2* seedPoints, std::size_t numSeedPoints, const SimulationData& simData, std::uint64_t iteration)
+    {
+        const glm::vec2 domainSize(domain_.GetWidth(), domain_.GetHeight());
+        // the seed radius is relative to the domain height in both directions (see the aspect ratio fix in the shader).
+        const auto radius = simData.seed_point_radius_ * domainSize.y;
+        for (std::size_t i = 0; i < numSeedPoints; ++i) {
+            const auto cell = seedPoints[i] * domainSize;
+            domain_.RequireRegion(cell.x, cell.y, radius, iteration);
+        }
+        ApplyResidency(iteration);
+    }
+
+    void TiledSimulation::QueueActivity(std::uint64_t iteration, const std::int32_t* activity, std::size_t count)
+    {
+        pendingActivity_.push_back({ iteration, std::vector<std::int32_t>(activity, activity + count) });
+    }
+
+    void TiledSimulation::ApplyActivity(std::uint64_t iteration)
+    {
+        if (pendingActivity_.empty() || pendingActivity_.front().iteration_ > iteration) return;
+        while (!pendingActivity_.empty() && pendingActivity_.front().iteration_ <= iteration) {
+            const auto& report = pendingActivity_.front();
+            domain_.UpdateActivity(report.activity_.data(), report.activity_.size(), iteration);
+            pendingActivity_.pop_front();
+        }
+        ApplyResidency(iteration);
+    }
+
+    void TiledSimulation::ApplyResidency(std::uint64_t iteration)
+    {
+        domain_.Resolve(evictions_, placements_, iteration);
+        for (const auto& eviction : evictions_) {
+            if (!eviction.page_) continue;
+            ReadTile(eviction.slot_, tileData_);
+            domain_.StorePagedTile(eviction.tile_, tileData_.data());
+        }
+        for (const auto& placement : placements_) {
+            if (domain_.LoadPagedTile(placement.tile_, tileData_)) UploadTile(placement.slot_, tileData_.data());
+            else UploadTile(placement.slot_, restingTile_.data());
+        }
+
+        if (!evictions_.empty() || !placements_.empty()) UploadTables();
+    }
+
+    void TiledSimulation::UploadTables()
+    {
+        glBindTexture(GL_TEXTURE_2D, tileIndirection_);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, domain_.GetTilesX(), domain_.GetTilesY(), GL_RED_INTEGER, GL_INT, domain_.GetTileSlots().data());
+        glBindTexture(GL_TEXTURE_2D, slotTiles_);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, domain_.GetSlotsX(), domain_.GetSlotsY(), GL_RED_INTEGER, GL_INT, domain_.GetSlotTiles().data());
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        // free slots are not rasterized at all, each run of occupied slots in a row is drawn with its own scissor.
+        const auto tileSize = static_cast<int>(domain_.GetTileSize());
+        const auto& slotTiles = domain_.GetSlotTiles();
+        occupiedRuns_.clear();
+        for (unsigned int y = 0; y < domain_.GetSlotsY(); ++y) {
+            for (unsigned int x = 0; x < domain_.GetSlotsX();) {
+                if (slotTiles[y * domain_.GetSlotsX() + x] < 0) {
+                    ++x;
+                    continue;
+                }
+                const auto first = x;
+                while (x < domain_.GetSlotsX() && slotTiles[y * domain_.GetSlotsX() + x] >= 0) ++x;
+                occupiedRuns_.emplace_back(first * tileSize, y * tileSize, (x - first) * tileSize, tileSize);
+            }
+        }
+    }
+
+    void TiledSimulation::UploadTile(unsigned int slot, const float* data)
+    {
+        const auto tileSize = static_cast<GLsizei>(domain_.GetTileSize());
+        const auto x = static_cast<GLint>(slot % domain_.GetSlotsX()) * tileSize;
+        const auto y = static_cast<GLint>(slot / domain_.GetSlotsX()) * tileSize;
+        glBindTexture(GL_TEXTURE_2D, abAtlas_[currentAtlas_]);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, tileSize, tileSize, GL_RG, GL_FLOAT, data);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    void TiledSimulation::ReadTile(unsigned int slot, std::vector<float>& data)
+    {
+        const auto tileSize = static_cast<GLsizei>(domain_.GetTileSize());
+        const auto x = static_cast<GLint>(slot % domain_.GetSlotsX()) * tileSize;
+        const auto y = static_cast<GLint>(slot / domain_.GetSlotsX()) * tileSize;
+        data.resize(2 * static_cast<std::size_t>(tileSize) * tileSize);
+
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, atlasFBOs_[currentAtlas_]);
+        glReadBuffer(GL_COLOR_ATTACHMENT0);
+        glReadPixels(x, y, tileSize, tileSize, GL_RG, GL_FLOAT, data.data());
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    }
+
+    void TiledSimulation::Step(const SimulationData& simData, const glm::vec2* seedPoints, std::size_t numSeedPoints)
+    {
+        // without resident tiles there is nothing to simulate, the atlases are only read at occupied slots.
+        if (occupiedRuns_.empty()) return;
+        const auto nextAtlas = 1 - currentAtlas_;
+        glBindFramebuffer(GL_FRAMEBUFFER, atlasFBOs_[nextAtlas]);
+        glViewport(0, 0, domain_.GetSlotsX() * domain_.GetTileSize(), domain_.GetSlotsY() * domain_.GetTileSize());
+
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, abAtlas_[currentAtlas_]);
+        glActiveTexture(GL_TEXTURE1);
+        glBindTexture(GL_TEXTURE_2D, tileIndirection_);
+        glActiveTexture(GL_TEXTURE2);
+        glBindTexture(GL_TEXTURE_2D, slotTiles_);
+
+        glUseProgram(tiledSimulationQuad_->GetGPUProgram()->getProgramId());
+        glUniform1i(prevAtlasLoc_, 0);
+        glUniform1i(tileIndirectionLoc_, 1);
+        glUniform1i(slotTilesLoc_, 2);
+        glUniform1i(tileSizeLoc_, static_cast<GLint>(domain_.GetTileSize()));
+        glUniform2i(tilesLoc_, static_cast<GLint>(domain_.GetTilesX()), static_cast<GLint>(domain_.GetTilesY()));
+        glUniform2i(domainSizeLoc_, static_cast<GLint>(domain_.GetWidth()), static_cast<GLint>(domain_.GetHeight()));
+        glUniform1f(diffusionRateALoc_, simData.diffusion_rate_a_);
+        glUniform1f(diffusionRateBLoc_, simData.diffusion_rate_b_);
+        glUniform1f(feedRateLoc_, simData.feed_rate_);
+        glUniform1f(killRateLoc_, simData.kill_rate_);
+        glUniform1f(dtLoc_, simData.dt_);
+        glUniform1f(seedPointRadiusLoc_, simData.seed_point_radius_);
+        glUniform1ui(numSeedPointsLoc_, static_cast<GLuint>(numSeedPoints));
+        glUniform2fv(seedPointsLoc_, static_cast<GLsizei>(numSeedPoints), reinterpret_cast<const GLfloat*>(seedPoints));
+        glUniform1i(useManhattanDistanceLoc_, simData.use_manhattan_distance_);
+
+        glEnable(GL_SCISSOR_TEST);
+        for (const auto& run : occupiedRuns_) {
+            glScissor(run.x, run.y, run.z, run.w);
+            tiledSimulationQuad_->Draw();
+        }
+        glDisable(GL_SCISSOR_TEST);
+
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glActiveTexture(GL_TEXTURE0);
+        currentAtlas_ = nextAtlas;
+    }
+
+    void TiledSimulation::MeasureActivity(std::uint64_t frame)
+    {
+        if (activityFence_ != nullptr || frame % ACTIVITY_INTERVAL != 0) return;
+
+        glClearNamedBufferData(activityBuffer_, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, activityBuffer_);
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, abAtlas_[currentAtlas_]);
+        glActiveTexture(GL_TEXTURE1);
+        glBindTexture(GL_TEXTURE_2D, slotTiles_);
+
+        glUseProgram(activityProgram_->getProgramId());
+        glUniform1i(activityAtlasLoc_, 0);
+        glUniform1i(activitySlotTilesLoc_, 1);
+        glUniform1i(activityTileSizeLoc_, static_cast<GLint>(domain_.GetTileSize()));
+        glUniform2i(activityTilesLoc_, static_cast<GLint>(domain_.GetTilesX()), static_cast<GLint>(domain_.GetTilesY()));
+        glUniform2i(activityDomainSizeLoc_, static_cast<GLint>(domain_.GetWidth()), static_cast<GLint>(domain_.GetHeight()));
+        glUniform1f(activityRestingEpsilonLoc_, RESTING_EPSILON);
+        const auto atlasWidth = domain_.GetSlotsX() * domain_.GetTileSize();
+        const auto atlasHeight = domain_.GetSlotsY() * domain_.GetTileSize();
+        glDispatchCompute((atlasWidth + WORK_GROUP_SIZE - 1) / WORK_GROUP_SIZE, (atlasHeight + WORK_GROUP_SIZE - 1) / WORK_GROUP_SIZE, 1);
+        glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, 0);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glUseProgram(0);
+
+        activityFence_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        // the flags belong to the tiles resident now, the slots may be reused before the result arrives.
+        measuredSlotTiles_.assign(domain_.GetSlotTiles().begin(), domain_.GetSlotTiles().end());
+    }
+
+    bool TiledSimulation::PollActivity(std::vector<std::int32_t>& activity)
+    {
+        if (activityFence_ == nullptr) return false;
+        const auto status = glClientWaitSync(activityFence_, 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) return false;
+        glDeleteSync(activityFence_);
+        activityFence_ = nullptr;
+
+        glGetNamedBufferSubData(activityBuffer_, 0, static_cast<GLsizeiptr>(activeSlots_.size() * sizeof(std::uint32_t)), activeSlots_.data());
+        activity.clear();
+        for (std::size_t slot = 0; slot < measuredSlotTiles_.size(); ++slot) {
+            const auto tile = measuredSlotTiles_[slot];
+            if (tile >= 0) activity.push_back(activeSlots_[slot] != 0 ? tile : -1 - tile);
+        }
+        return true;
+    }
+
+    void TiledSimulation::EndFrame()
+    {
+        // tiles paged to disk do not use host memory.
+        memory_[2].SetSize(domain_.GetPageDirectory().empty() ? domain_.GetPagedBytes() : 0);
+    }
+
+    TiledSimulation::SamplingLocations TiledSimulation::GetSamplingLocations(GLuint program)
+    {
+        SamplingLocations locations;
+        locations.tiledDomain_ = glGetUniformLocation(program, "tiledDomain");
+        locations.tileIndirection_ = glGetUniformLocation(program, "tileIndirection");
+        locations.tileSize_ = glGetUniformLocation(program, "tileSize");
+        locations.tiledDomainSize_ = glGetUniformLocation(program, "tiledDomainSize");
+        return locations;
+    }
+
+    void TiledSimulation::SetSamplingUniforms(const SamplingLocations& locations, GLint textureUnit) const
+    {
+        glActiveTexture(GL_TEXTURE0 + textureUnit);
+        glBindTexture(GL_TEXTURE_2D, tileIndirection_);
+        glUniform1i(locations.tiledDomain_, GL_TRUE);
+        glUniform1i(locations.tileIndirection_, textureUnit);
+        glUniform1i(locations.tileSize_, static_cast<GLint>(domain_.GetTileSize()));
+        glUniform2i(locations.tiledDomainSize_, static_cast<GLint>(domain_.GetWidth()), static_cast<GLint>(domain_.GetHeight()));
+    }
+
+    void TiledSimulation::SetNoTilingUniforms(const SamplingLocations& locations)
+    {
+        glUniform1i(locations.tiledDomain_, GL_FALSE);
+    }
+}
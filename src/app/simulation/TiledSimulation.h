@@ -0,0 +1,159 @@
+/**
+ * @file   TiledSimulation.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the GPU simulation of a tiled virtual domain.
+ */
+
+#pragma once
+
+#include "core/main.h"
+#include "TiledDomain.h"
+#include "app/util/ResourceRegistry.h"
+#include <array>
+#include <deque>
+
+namespace viscom {
+    class ApplicationNodeImplementation;
+    class FullscreenQuad;
+    class GPUProgram;
+    struct SimulationData;
+}
+
+namespace viscom::simulation {
+
+    /**
+     *  Simulates a virtual domain larger than a single texture. Resident tiles live in slots of an atlas (ping-pong A/B
+     *  atlases plus a result atlas), a tile -> slot indirection texture is used by the simulation shader to fetch across
+     *  tile borders and by the renderers to sample the result.
+     *
+     *  The state depends on residency (non-resident tiles are at rest), so all nodes have to page at the same
+     *  iterations: residency changes only at seed point iterations and at the iterations of activity reports. The
+     *  master measures the activity and shares the report, every node applies it at the iteration given with it.
+     */
+    class TiledSimulation
+    {
+    public:
+        /** Uniform locations a renderer needs to sample the tiled result. */
+        struct SamplingLocations {
+            GLint tiledDomain_ = -1;
+            GLint tileIndirection_ = -1;
+            GLint tileSize_ = -1;
+            GLint tiledDomainSize_ = -1;
+        };
+
+        TiledSimulation(ApplicationNodeImplementation* appNode, unsigned int width, unsigned int height, unsigned int tileSize, unsigned int numSlots, const std::string& pageDirectory);
+        TiledSimulation(const TiledSimulation&) = delete;
+        TiledSimulation& operator=(const TiledSimulation&) = delete;
+        ~TiledSimulation();
+
+        /** Resets all tiles to the resting state. */
+        void Reset();
+        /** Updates residency for the seed points (texture coordinates) placed in the given iteration. */
+        void UpdateResidency(const glm::vec2* seedPoints, std::size_t numSeedPoints, const SimulationData& simData, std::uint64_t iteration);
+        /** Queues an activity report (see TiledDomain::UpdateActivity) to be applied in the given iteration. */
+        void QueueActivity(std::uint64_t iteration, const std::int32_t* activity, std::size_t count);
+        /** Applies the queued activity reports due in the given iteration (call before simulating it). */
+        void ApplyActivity(std::uint64_t iteration);
+        /** Simulates one iteration of all resident tiles. */
+        void Step(const SimulationData& simData, const glm::vec2* seedPoints, std::size_t numSeedPoints);
+        /** Starts an activity measurement of the current state if one is due and none is in flight (master only). */
+        void MeasureActivity(std::uint64_t frame);
+        /** Returns a finished activity measurement without waiting for the GPU (master only). */
+        bool PollActivity(std::vector<std::int32_t>& activity);
+        /** Updates the memory statistics (call once per simulated frame after the iterations). */
+        void EndFrame();
+
+        GLuint GetResultAtlas() const { return resultAtlas_; }
+        const TiledDomain& GetDomain() const { return domain_; }
+        /** Size of the GPU memory used by the atlases and tables in bytes. */
+        std::size_t GetGPUMemorySize() const;
+
+        static SamplingLocations GetSamplingLocations(GLuint program);
+        /** Sets the sampling uniforms and binds the indirection texture to the given unit. */
+        void SetSamplingUniforms(const SamplingLocations& locations, GLint textureUnit) const;
+        /** Sets the sampling uniforms so a renderer samples a regular texture. */
+        static void SetNoTilingUniforms(const SamplingLocations& locations);
+
+    private:
+        /** An activity report of the master and the iteration it is applied in. */
+        struct ActivityReport {
+            std::uint64_t iteration_;
+            std::vector<std::int32_t> activity_;
+        };
+
+        void ApplyResidency(std::uint64_t iteration);
+        void UploadTables();
+        void UploadTile(unsigned int slot, const float* data);
+        void ReadTile(unsigned int slot, std::vector<float>& data);
+        GLuint CreateAtlasTexture(GLenum internalFormat) const;
+
+        /** Holds the residency book keeping. */
+        TiledDomain domain_;
+        /** Holds the A/B atlases (ping-pong). */
+        std::array<GLuint, 2> abAtlas_ = { { 0, 0 } };
+        /** Holds the result atlas. */
+        GLuint resultAtlas_ = 0;
+        /** Holds the frame buffers writing to A/B atlas 0 or 1 and the result atlas. */
+        std::array<GLuint, 2> atlasFBOs_ = { { 0, 0 } };
+        /** Holds the tile -> slot table. */
+        GLuint tileIndirection_ = 0;
+        /** Holds the slot -> tile table. */
+        GLuint slotTiles_ = 0;
+        /** Index of the A/B atlas holding the current state. */
+        std::size_t currentAtlas_ = 0;
+        /** Scissor rectangles (x, y, width, height) of the runs of occupied slots in each slot row. */
+        std::vector<glm::ivec4> occupiedRuns_;
+
+        /** Holds the simulation program. */
+        std::unique_ptr<FullscreenQuad> tiledSimulationQuad_;
+        GLint prevAtlasLoc_ = -1;
+        GLint tileIndirectionLoc_ = -1;
+        GLint slotTilesLoc_ = -1;
+        GLint tileSizeLoc_ = -1;
+        GLint tilesLoc_ = -1;
+        GLint domainSizeLoc_ = -1;
+        GLint diffusionRateALoc_ = -1;
+        GLint diffusionRateBLoc_ = -1;
+        GLint feedRateLoc_ = -1;
+        GLint killRateLoc_ = -1;
+        GLint dtLoc_ = -1;
+        GLint seedPointRadiusLoc_ = -1;
+        GLint numSeedPointsLoc_ = -1;
+        GLint seedPointsLoc_ = -1;
+        GLint useManhattanDistanceLoc_ = -1;
+
+        /** Holds the activity program. */
+        std::shared_ptr<GPUProgram> activityProgram_;
+        GLint activityAtlasLoc_ = -1;
+        GLint activitySlotTilesLoc_ = -1;
+        GLint activityTileSizeLoc_ = -1;
+        GLint activityTilesLoc_ = -1;
+        GLint activityDomainSizeLoc_ = -1;
+        GLint activityRestingEpsilonLoc_ = -1;
+        /** Holds the active flag of each slot written by the activity program. */
+        GLuint activityBuffer_ = 0;
+        /** Fence of the activity measurement in flight. */
+        GLsync activityFence_ = nullptr;
+        /** Holds the slot -> tile table at the time of the measurement in flight. */
+        std::vector<std::int32_t> measuredSlotTiles_;
+        /** Holds the flags of a finished measurement. */
+        std::vector<std::uint32_t> activeSlots_;
+        /** Frames between two activity measurements. */
+        static constexpr std::uint64_t ACTIVITY_INTERVAL = 30;
+        /** Holds the activity reports not yet applied (ordered by iteration). */
+        std::deque<ActivityReport> pendingActivity_;
+
+        /** Holds the evictions of the current iteration. */
+        std::vector<TiledDomain::Eviction> evictions_;
+        /** Holds the placements of the current iteration. */
+        std::vector<TiledDomain::Placement> placements_;
+        /** Holds tile data while paging. */
+        std::vector<float> tileData_;
+        /** Holds the data of a resting tile. */
+        std::vector<float> restingTile_;
+        /** Registers the atlases and tables, the activity buffer and the tiles paged to host memory. */
+        std::array<util::TrackedResource, 3> memory_;
+    };
+}
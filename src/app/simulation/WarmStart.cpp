@@ -0,0 +1,75 @@
+/**
+ * @file   WarmStart.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the warm start of presets from state snapshots.
+ */
+
+#include "WarmStart.h"
+#include "app/ApplicationNodeImplementation.h"
+#include "app/util/AllocationCheck.h"
+
+namespace viscom::simulation {
+
+    void WarmStart::UpdateFrame()
+    {
+        const auto& simData = GetAppNode()->GetSimulationData();
+        if (simData.warmStartFrameIdx_ == requestFrameIdx_) return;
+        requestFrameIdx_ = simData.warmStartFrameIdx_;
+        Request(simData.warmStartPreset_);
+    }
+
+    void WarmStart::Request(int preset)
+    {
+        GetAppNode()->GetAllocationCheck().AllowFrameAllocations();
+        snapshot_ = std::future<StateSnapshot>{};
+        if (preset > 0 && GetAppNode()->GetTiledSimulation()) {
+            LOG(WARNING) << "Warm starts are not supported in tiled mode.";
+            return;
+        }
+        const auto& presets = GetAppNode()->GetPresets();
+        if (preset <= 0 || preset >= static_cast<int>(presets.size()) || presets[preset].snapshotFile_.empty()) return;
+
+        auto snapshotFile = GetAppNode()->GetConfig().resourceSearchPaths_.back() + "/" + presets[preset].snapshotFile_;
+        // snapshots hold the full grid, TakeSnapshot averages them down to a coarser simulation grid.
+        const auto fullSize = GetAppNode()->GetSimulationGlobalSize() * static_cast<unsigned int>(GetAppNode()->GetSimulationScale());
+        snapshot_ = std::async(std::launch::async, [snapshotFile, fullSize]() {
+            StateSnapshot snapshot;
+            if (!LoadStateSnapshot(snapshotFile, snapshot, fullSize.x, fullSize.y)) {
+                LOG(WARNING) << "Could not load state snapshot '" << snapshotFile << "'.";
+                snapshot.field_.clear();
+            }
+            return snapshot;
+        });
+    }
+
+    std::uint64_t WarmStart::HoldIterations(std::uint64_t firstIteration, std::uint64_t iterations) const
+    {
+        const auto warmStartIteration = GetAppNode()->GetSimulationData().warmStartFrameIdx_;
+        if (!snapshot_.valid() || warmStartIteration < firstIteration || warmStartIteration >= firstIteration + iterations) return iterations;
+        // all nodes have to apply the snapshot in the same iteration, a node that is still decoding stops in front of it
+        // and catches up in the next frames instead of blocking the render thread.
+        if (snapshot_.wait_for(std::chrono::seconds(0)) == std::future_status::ready) return iterations;
+        return warmStartIteration - firstIteration;
+    }
+
+    bool WarmStart::TakeSnapshot(StateSnapshot& snapshot)
+    {
+        if (!snapshot_.valid()) return false;
+        GetAppNode()->GetAllocationCheck().AllowFrameAllocations();
+
+        // ready, HoldIterations did not let the simulation reach this iteration before.
+        snapshot = snapshot_.get();
+        if (snapshot.field_.empty()) return false;
+        const auto globalSize = GetAppNode()->GetSimulationGlobalSize();
+        // the simulation scale may have changed while the snapshot was decoded.
+        const auto factor = snapshot.width_ / glm::max(globalSize.x, 1u);
+        if (factor > 1 && snapshot.width_ == factor * globalSize.x && snapshot.height_ == factor * globalSize.y) DownsampleStateSnapshot(snapshot, factor);
+        if (snapshot.width_ != globalSize.x || snapshot.height_ != globalSize.y) {
+            LOG(WARNING) << "State snapshot size (" << snapshot.width_ << "x" << snapshot.height_ << ") does not match the simulation size.";
+            return false;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,43 @@
+/**
+ * @file   WarmStart.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the warm start of presets from state snapshots.
+ */
+
+#pragma once
+
+#include "app/NodeComponent.h"
+#include "StateSnapshot.h"
+#include <future>
+
+namespace viscom::simulation {
+
+    /**
+     *  Loads the state snapshot of a preset in the background once the master selected it for a warm start
+     *  (SimulationData::warmStartPreset_, warmStartFrameIdx_). All nodes apply it in the same iteration, a node that is
+     *  still decoding holds its simulation in front of it.
+     */
+    class WarmStart final : public NodeComponent
+    {
+    public:
+        explicit WarmStart(ApplicationNodeImplementation* appNode) : NodeComponent{ appNode } {}
+
+        /** Starts loading the snapshot when a new warm start was synchronized. */
+        void UpdateFrame() override;
+
+        /** Limits the iterations of this frame so the warm start iteration is not reached before its snapshot is loaded. */
+        std::uint64_t HoldIterations(std::uint64_t firstIteration, std::uint64_t iterations) const;
+        /** Returns the loaded snapshot (once), false if there is none or it does not match the global domain. */
+        bool TakeSnapshot(StateSnapshot& snapshot);
+
+    private:
+        void Request(int preset);
+
+        /** The warm start frame index the current snapshot was requested for. */
+        std::uint64_t requestFrameIdx_ = 0;
+        /** The snapshot for the next warm start (decoded in the background). */
+        std::future<StateSnapshot> snapshot_;
+    };
+}
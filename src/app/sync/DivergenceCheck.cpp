@@ -0,0 +1,73 @@
+/**
+ * @file   DivergenceCheck.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the state hashes of a node and the resync of its state to the master.
+ */
+
+#include "DivergenceCheck.h"
+#include "StateHasher.h"
+#include "app/ApplicationNodeImplementation.h"
+#include "app/util/AllocationCheck.h"
+
+namespace viscom::sync {
+
+    DivergenceCheck::DivergenceCheck(ApplicationNodeImplementation* appNode) :
+        NodeComponent{ appNode }
+    {
+    }
+
+    DivergenceCheck::~DivergenceCheck() = default;
+
+    void DivergenceCheck::Init()
+    {
+        if (GetAppNode()->GetAppSettings().divergenceCheckInterval_ == 0) return;
+        if (!GetAppNode()->IsFullDomainGPUSimulation()) LOG(WARNING) << "The divergence check needs the regular GPU simulation, disabling it.";
+        else stateHasher_ = std::make_unique<StateHasher>(GetAppNode());
+    }
+
+    void DivergenceCheck::UpdateFrame()
+    {
+        if (!stateHasher_) return;
+        finishedStateHashes_.clear();
+        stateHasher_->Poll(finishedStateHashes_);
+        for (const auto& hash : finishedStateHashes_) stateHashes_.push_back(hash);
+        while (stateHashes_.size() > MAX_STATE_HASHES) stateHashes_.pop_front();
+    }
+
+    void DivergenceCheck::CleanUp()
+    {
+        stateHasher_ = nullptr;
+    }
+
+    bool DivergenceCheck::HashState(GLuint abTexture, std::uint64_t iteration)
+    {
+        if (!stateHasher_ || iteration % GetAppNode()->GetAppSettings().divergenceCheckInterval_ != 0) return false;
+        if (!stateHasher_->Compute(abTexture, iteration)) LOG(WARNING) << "State hash skipped, all hash buffers are in use.";
+        return true;
+    }
+
+    void DivergenceCheck::SetResyncState(const std::vector<std::uint8_t>& data)
+    {
+        GetAppNode()->GetAllocationCheck().AllowFrameAllocations();
+        const auto& size = GetAppNode()->GetSimulationSize();
+        if (!simulation::DecodeStateSnapshot(data.data(), data.size(), resyncState_, size.x, size.y)) {
+            LOG(WARNING) << "Could not decode the resync state sent by the master.";
+            resyncState_.field_.clear();
+        }
+    }
+
+    bool DivergenceCheck::TakeResyncState(simulation::StateSnapshot& state)
+    {
+        if (resyncState_.field_.empty()) return false;
+        state = std::move(resyncState_);
+        resyncState_.field_.clear();
+        const auto& size = GetAppNode()->GetSimulationSize();
+        if (state.width_ != size.x || state.height_ != size.y) {
+            LOG(WARNING) << "Resync state size (" << state.width_ << "x" << state.height_ << ") does not match the simulation size.";
+            return false;
+        }
+        return true;
+    }
+}
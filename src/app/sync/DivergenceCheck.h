@@ -0,0 +1,59 @@
+/**
+ * @file   DivergenceCheck.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the state hashes of a node and the resync of its state to the master.
+ */
+
+#pragma once
+
+#include "app/NodeComponent.h"
+#include "app/simulation/StateSnapshot.h"
+#include "app/util/RingBuffer.h"
+#include "core/main.h"
+
+namespace viscom::sync {
+
+    class StateHasher;
+
+    /**
+     *  Hashes the state every AppSettings::divergenceCheckInterval_ iterations (needs the regular GPU simulation) and
+     *  keeps the newest hashes for the comparison with the master. Holds the state the master sent for a resync until
+     *  it is applied at SimulationData::resyncFrameIdx_.
+     */
+    class DivergenceCheck final : public NodeComponent
+    {
+    public:
+        explicit DivergenceCheck(ApplicationNodeImplementation* appNode);
+        ~DivergenceCheck() override;
+
+        void Init() override;
+        /** Collects the finished hashes. */
+        void UpdateFrame() override;
+        void CleanUp() override;
+
+        bool IsEnabled() const { return stateHasher_ != nullptr; }
+        /** Hashes the state if the iteration is a check iteration, returns true if it started a hash (changes the GL state). */
+        bool HashState(GLuint abTexture, std::uint64_t iteration);
+        /** The newest state hashes of this node as (iteration, hash). */
+        const util::RingBuffer<std::pair<std::uint64_t, std::uint64_t>>& GetStateHashes() const { return stateHashes_; }
+
+        /** Sets the state received from the master, it is applied at SimulationData::resyncFrameIdx_. */
+        void SetResyncState(const std::vector<std::uint8_t>& data);
+        /** Returns the state received from the master (once), false if there is none or it does not match the simulation size. */
+        bool TakeResyncState(simulation::StateSnapshot& state);
+
+    private:
+        /** Hashes the state (nullptr if the check is disabled). */
+        std::unique_ptr<StateHasher> stateHasher_;
+        /** Holds the newest state hashes as (iteration, hash). */
+        util::RingBuffer<std::pair<std::uint64_t, std::uint64_t>> stateHashes_{ MAX_STATE_HASHES + 1 };
+        /** Holds hashes finished this frame. */
+        std::vector<std::pair<std::uint64_t, std::uint64_t>> finishedStateHashes_;
+        /** Holds the state received from the master for a resync. */
+        simulation::StateSnapshot resyncState_;
+        /** Number of state hashes kept for comparison. */
+        static constexpr std::size_t MAX_STATE_HASHES = 32;
+    };
+}
@@ -0,0 +1,162 @@
+/**
+ * @file   DivergenceReporter.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the channel reporting diverged nodes, node capacities and node metrics to the master.
+ */
+
+#include "DivergenceReporter.h"
+#include "app/util/Socket.h"
+#include <algorithm>
+#include <cstring>
+
+namespace viscom::sync {
+
+    namespace {
+        /** Datagram magic ("RDDV"). */
+        constexpr std::uint32_t REPORT_MAGIC = 0x56444452;
+        /** Datagram magic of capacity reports ("RDCP"). */
+        constexpr std::uint32_t CAPACITY_MAGIC = 0x50434452;
+        /** Datagram magic of metrics reports ("RDMT"). */
+        constexpr std::uint32_t METRICS_MAGIC = 0x544D4452;
+
+        struct ReportDatagram {
+            std::uint32_t magic_;
+            std::uint32_t reserved_;
+            std::uint64_t iteration_;
+            std::uint64_t hash_;
+            std::uint64_t referenceHash_;
+            char node_[64];
+        };
+
+        struct CapacityDatagram {
+            std::uint32_t magic_;
+            std::uint32_t reserved_;
+            double iterationsPerSecond_;
+            char node_[64];
+        };
+
+        struct MetricsDatagram {
+            std::uint32_t magic_;
+            std::uint32_t reserved_;
+            metrics::NodeMetricsSnapshot metrics_;
+            char node_[64];
+        };
+
+        /** Size of the receive buffer (the largest datagram). */
+        constexpr std::size_t MAX_DATAGRAM_SIZE = std::max({ sizeof(ReportDatagram), sizeof(CapacityDatagram), sizeof(MetricsDatagram) });
+    }
+
+    using util::ToSocket;
+
+    DivergenceReporter::DivergenceReporter()
+    {
+        util::StartSockets();
+        char hostName[64] = {};
+        if (gethostname(hostName, sizeof(hostName) - 1) == 0) nodeName_ = hostName;
+        else nodeName_ = "unknown";
+    }
+
+    DivergenceReporter::~DivergenceReporter()
+    {
+        Close();
+        util::StopSockets();
+    }
+
+    void DivergenceReporter::Close()
+    {
+        util::CloseSocket(socket_);
+    }
+
+    bool DivergenceReporter::Listen(unsigned short port)
+    {
+        Close();
+        auto s = util::CreateSocket(SOCK_DGRAM, IPPROTO_UDP);
+        if (s == VISCOM_INVALID_SOCKET) return false;
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_ANY);
+        address.sin_port = htons(port);
+        if (bind(s, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+            VISCOM_CLOSE_SOCKET(s);
+            return false;
+        }
+        util::SetNonBlocking(s);
+        socket_ = static_cast<std::intptr_t>(s);
+        return true;
+    }
+
+    bool DivergenceReporter::Connect(const std::string& masterAddress, unsigned short port)
+    {
+        Close();
+        addrinfo hints{};
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_DGRAM;
+        addrinfo* result = nullptr;
+        if (getaddrinfo(masterAddress.c_str(), std::to_string(port).c_str(), &hints, &result) != 0 || result == nullptr) return false;
+
+        auto s = util::CreateSocket(SOCK_DGRAM, IPPROTO_UDP);
+        // a connected UDP socket only fixes the destination, nothing is sent.
+        if (s != VISCOM_INVALID_SOCKET && connect(s, result->ai_addr, static_cast<socklen_t>(result->ai_addrlen)) != 0) {
+            VISCOM_CLOSE_SOCKET(s);
+            s = VISCOM_INVALID_SOCKET;
+        }
+        freeaddrinfo(result);
+        if (s == VISCOM_INVALID_SOCKET) return false;
+        socket_ = static_cast<std::intptr_t>(s);
+        return true;
+    }
+
+    void DivergenceReporter::Send(std::uint64_t iteration, std::uint64_t hash, std::uint64_t referenceHash)
+    {
+        if (socket_ == -1) return;
+        ReportDatagram datagram{ REPORT_MAGIC, 0, iteration, hash, referenceHash, {} };
+        std::strncpy(datagram.node_, nodeName_.c_str(), sizeof(datagram.node_) - 1);
+        util::SendSome(ToSocket(socket_), &datagram, sizeof(datagram));
+    }
+
+    void DivergenceReporter::SendCapacity(double iterationsPerSecond)
+    {
+        if (socket_ == -1) return;
+        CapacityDatagram datagram{ CAPACITY_MAGIC, 0, iterationsPerSecond, {} };
+        std::strncpy(datagram.node_, nodeName_.c_str(), sizeof(datagram.node_) - 1);
+        util::SendSome(ToSocket(socket_), &datagram, sizeof(datagram));
+    }
+
+    void DivergenceReporter::SendMetrics(const metrics::NodeMetricsSnapshot& snapshot)
+    {
+        if (socket_ == -1) return;
+        MetricsDatagram datagram{ METRICS_MAGIC, 0, snapshot, {} };
+        std::strncpy(datagram.node_, nodeName_.c_str(), sizeof(datagram.node_) - 1);
+        util::SendSome(ToSocket(socket_), &datagram, sizeof(datagram));
+    }
+
+    void DivergenceReporter::Receive(std::vector<DivergenceReport>& reports, std::vector<CapacityReport>& capacities, std::vector<MetricsReport>& metrics)
+    {
+        if (socket_ == -1) return;
+        alignas(8) char buffer[MAX_DATAGRAM_SIZE];
+        for (auto size = util::ReceiveSome(ToSocket(socket_), buffer, sizeof(buffer)); size >= static_cast<long long>(sizeof(std::uint32_t));
+            size = util::ReceiveSome(ToSocket(socket_), buffer, sizeof(buffer))) {
+            std::uint32_t magic;
+            std::memcpy(&magic, buffer, sizeof(magic));
+            if (magic == REPORT_MAGIC && size == static_cast<long long>(sizeof(ReportDatagram))) {
+                ReportDatagram datagram;
+                std::memcpy(&datagram, buffer, sizeof(datagram));
+                datagram.node_[sizeof(datagram.node_) - 1] = '\0';
+                reports.push_back(DivergenceReport{ datagram.node_, datagram.iteration_, datagram.hash_, datagram.referenceHash_ });
+            } else if (magic == CAPACITY_MAGIC && size == static_cast<long long>(sizeof(CapacityDatagram))) {
+                CapacityDatagram capacity;
+                std::memcpy(&capacity, buffer, sizeof(capacity));
+                capacity.node_[sizeof(capacity.node_) - 1] = '\0';
+                capacities.push_back(CapacityReport{ capacity.node_, capacity.iterationsPerSecond_ });
+            } else if (magic == METRICS_MAGIC && size == static_cast<long long>(sizeof(MetricsDatagram))) {
+                MetricsDatagram datagram;
+                std::memcpy(&datagram, buffer, sizeof(datagram));
+                datagram.node_[sizeof(datagram.node_) - 1] = '\0';
+                metrics.push_back(MetricsReport{ datagram.node_, datagram.metrics_ });
+            }
+        }
+    }
+}
@@ -0,0 +1,76 @@
+/**
+ * @file   DivergenceReporter.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the channel reporting diverged nodes, node capacities and node metrics to the master.
+ */
+
+#pragma once
+
+#include "app/metrics/Metrics.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace viscom::sync {
+
+    /** A state hash of a node that does not match the hash of the master. */
+    struct DivergenceReport {
+        /** Name of the reporting node. */
+        std::string node_;
+        /** Iteration of the compared state. */
+        std::uint64_t iteration_ = 0;
+        /** Hash of the node. */
+        std::uint64_t hash_ = 0;
+        /** Hash of the master. */
+        std::uint64_t referenceHash_ = 0;
+    };
+
+    /** The simulation rate a node can sustain. */
+    struct CapacityReport {
+        /** Name of the reporting node. */
+        std::string node_;
+        /** Iterations per second. */
+        double iterationsPerSecond_ = 0.0;
+    };
+
+    /** The performance summary of a node (aggregated by the metrics endpoint of the master). */
+    struct MetricsReport {
+        /** Name of the reporting node. */
+        std::string node_;
+        metrics::NodeMetricsSnapshot metrics_;
+    };
+
+    /**
+     *  The synchronization only sends data from the master to the slaves, so slaves report divergence and their
+     *  capacity (and optionally their metrics) with UDP datagrams. Losing a report is harmless as the next check reports again.
+     */
+    class DivergenceReporter
+    {
+    public:
+        DivergenceReporter();
+        DivergenceReporter(const DivergenceReporter&) = delete;
+        DivergenceReporter& operator=(const DivergenceReporter&) = delete;
+        ~DivergenceReporter();
+
+        /** Receives reports on the given port (master). */
+        bool Listen(unsigned short port);
+        /** Sends reports to the master (slaves). */
+        bool Connect(const std::string& masterAddress, unsigned short port);
+
+        void Send(std::uint64_t iteration, std::uint64_t hash, std::uint64_t referenceHash);
+        void SendCapacity(double iterationsPerSecond);
+        void SendMetrics(const metrics::NodeMetricsSnapshot& snapshot);
+        /** Appends all reports received so far (non-blocking). */
+        void Receive(std::vector<DivergenceReport>& reports, std::vector<CapacityReport>& capacities, std::vector<MetricsReport>& metrics);
+
+    private:
+        void Close();
+
+        /** Holds the socket. */
+        std::intptr_t socket_ = -1;
+        /** Holds the name of this node. */
+        std::string nodeName_;
+    };
+}
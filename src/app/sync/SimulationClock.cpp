@@ -0,0 +1,44 @@
+/**
+ * @file   SimulationClock.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the wall clock driven global simulation clock.
+ */
+
+#include "SimulationClock.h"
+#include <algorithm>
+#include <cmath>
+
+namespace viscom::sync {
+
+    SimulationClock::SimulationClock(double iterationsPerSecond, std::uint64_t maxFrameIterations, std::uint64_t maxBacklog) :
+        rate_{ iterationsPerSecond },
+        maxFrameIterations_{ maxFrameIterations },
+        maxBacklog_{ static_cast<double>(std::max(maxBacklog, maxFrameIterations)) }
+    {
+    }
+
+    std::uint64_t SimulationClock::Advance(Clock::time_point now, std::uint64_t iteration)
+    {
+        // the first frame after a pause only starts the clock.
+        frameStart_ = running_ ? frameEnd_ : now;
+        frameEnd_ = now;
+        if (!running_) accumulator_ = 0.0;
+        running_ = true;
+
+        accumulator_ = std::min(accumulator_ + std::chrono::duration<double>(frameEnd_ - frameStart_).count() * rate_, maxBacklog_);
+        frameIterations_ = std::min(static_cast<std::uint64_t>(std::floor(accumulator_)), maxFrameIterations_);
+        accumulator_ -= static_cast<double>(frameIterations_);
+        frameFirstIteration_ = iteration + 1;
+        return frameIterations_;
+    }
+
+    std::uint64_t SimulationClock::GetIterationAt(Clock::time_point time) const
+    {
+        if (frameIterations_ == 0 || time <= frameStart_ || frameEnd_ <= frameStart_) return frameFirstIteration_;
+        const auto fraction = std::chrono::duration<double>(time - frameStart_).count() / std::chrono::duration<double>(frameEnd_ - frameStart_).count();
+        const auto offset = std::min(static_cast<std::uint64_t>(fraction * static_cast<double>(frameIterations_)), frameIterations_ - 1);
+        return frameFirstIteration_ + offset;
+    }
+}
@@ -0,0 +1,65 @@
+/**
+ * @file   SimulationClock.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the wall clock driven global simulation clock.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace viscom::sync {
+
+    /**
+     *  Converts wall clock time into simulation iterations at a fixed rate (fixed timestep accumulator). The master
+     *  advances the global iteration count by the result, so the simulated speed does not depend on its frame rate.
+     *  Nodes simulate at most a fixed number of iterations per frame, more is not handed out per frame and only a
+     *  small backlog is kept, so a hiccup is caught up over a few frames instead of piling up.
+     */
+    class SimulationClock
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        SimulationClock(double iterationsPerSecond, std::uint64_t maxFrameIterations, std::uint64_t maxBacklog);
+
+        /** Sets the rate in iterations per second (e.g. clamped to the slowest node). */
+        void SetRate(double iterationsPerSecond) { rate_ = iterationsPerSecond; }
+        double GetRate() const { return rate_; }
+
+        /**
+         *  Advances the clock to now.
+         *  @param iteration the global iteration count before this frame.
+         *  @return the number of iterations to add in this frame.
+         */
+        std::uint64_t Advance(Clock::time_point now, std::uint64_t iteration);
+        /** Stops the clock (idle simulation, waiting replay), the time until the next Advance is not simulated. */
+        void Pause() { running_ = false; }
+        /**
+         *  Returns the iteration matching a time of the last advanced interval, so input lands at the iteration it
+         *  happened in. Earlier times map to the first iteration of the frame.
+         */
+        std::uint64_t GetIterationAt(Clock::time_point time) const;
+
+    private:
+        /** Holds the rate in iterations per second. */
+        double rate_;
+        /** Maximum number of iterations per frame. */
+        std::uint64_t maxFrameIterations_;
+        /** Maximum number of iterations kept in the accumulator. */
+        double maxBacklog_;
+        /** Holds the iterations not handed out yet (fractional). */
+        double accumulator_ = 0.0;
+        /** The clock was advanced since the last pause. */
+        bool running_ = false;
+        /** Interval of the last advance. */
+        Clock::time_point frameStart_;
+        Clock::time_point frameEnd_;
+        /** First iteration and number of iterations of the last advance. */
+        std::uint64_t frameFirstIteration_ = 1;
+        std::uint64_t frameIterations_ = 0;
+    };
+}
@@ -0,0 +1,87 @@
+/**
+ * @file   StateHasher.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the GPU hash of the simulation state.
+ */
+
+#include "StateHasher.h"
+#include "core/ApplicationNodeBase.h"
+#include "core/open_gl.h"
+
+namespace viscom::sync {
+
+    StateHasher::StateHasher(ApplicationNodeBase* appNode)
+    {
+        hashProgram_ = appNode->GetGPUProgramManager().GetResource("stateHash", std::vector<std::string>{ "stateHash.comp" });
+        abTextureLoc_ = hashProgram_->getUniformLocation("abTexture");
+
+        for (auto& pending : pending_) {
+            glGenBuffers(1, &pending.buffer_);
+            glBindBuffer(GL_SHADER_STORAGE_BUFFER, pending.buffer_);
+            glBufferData(GL_SHADER_STORAGE_BUFFER, 2 * sizeof(std::uint32_t), nullptr, GL_DYNAMIC_READ);
+        }
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    }
+
+    StateHasher::~StateHasher()
+    {
+        for (auto& pending : pending_) {
+            if (pending.fence_ != nullptr) glDeleteSync(pending.fence_);
+            if (pending.buffer_ != 0) glDeleteBuffers(1, &pending.buffer_);
+        }
+    }
+
+    bool StateHasher::Compute(GLuint abTexture, std::uint64_t iteration)
+    {
+        if (numPending_ == NUM_PENDING) return false;
+        auto& pending = pending_[(oldestPending_ + numPending_) % NUM_PENDING];
+
+        const std::uint32_t zero[2] = { 0, 0 };
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, pending.buffer_);
+        glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(zero), zero);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, pending.buffer_);
+
+        GLint width = 0, height = 0;
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, abTexture);
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+
+        glUseProgram(hashProgram_->getProgramId());
+        glUniform1i(abTextureLoc_, 0);
+        glDispatchCompute((width + 15) / 16, (height + 15) / 16, 1);
+        glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, 0);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glUseProgram(0);
+
+        pending.fence_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        pending.iteration_ = iteration;
+        ++numPending_;
+        return true;
+    }
+
+    void StateHasher::Poll(std::vector<std::pair<std::uint64_t, std::uint64_t>>& hashes)
+    {
+        while (numPending_ > 0) {
+            auto& pending = pending_[oldestPending_];
+            auto status = glClientWaitSync(pending.fence_, 0, 0);
+            if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) break;
+
+            std::uint32_t result[2] = { 0, 0 };
+            glBindBuffer(GL_SHADER_STORAGE_BUFFER, pending.buffer_);
+            glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(result), result);
+            glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+            hashes.emplace_back(pending.iteration_, (static_cast<std::uint64_t>(result[1]) << 32) | result[0]);
+
+            glDeleteSync(pending.fence_);
+            pending.fence_ = nullptr;
+            oldestPending_ = (oldestPending_ + 1) % NUM_PENDING;
+            --numPending_;
+        }
+    }
+}
@@ -0,0 +1,62 @@
+/**
+ * @file   StateHasher.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the GPU hash of the simulation state.
+ */
+
+#pragma once
+
+#include "core/main.h"
+#include <array>
+
+namespace viscom {
+    class ApplicationNodeBase;
+    class GPUProgram;
+}
+
+namespace viscom::sync {
+
+    /**
+     *  Computes a 64 bit hash of the A/B state with a compute shader reduction. Only the 8 byte result is read back,
+     *  after its fence signaled, so the GL thread never waits for it.
+     */
+    class StateHasher
+    {
+    public:
+        explicit StateHasher(ApplicationNodeBase* appNode);
+        StateHasher(const StateHasher&) = delete;
+        StateHasher& operator=(const StateHasher&) = delete;
+        ~StateHasher();
+
+        /** Starts hashing the texture, returns false if all result buffers are in use. */
+        bool Compute(GLuint abTexture, std::uint64_t iteration);
+        /** Appends all finished hashes as (iteration, hash). */
+        void Poll(std::vector<std::pair<std::uint64_t, std::uint64_t>>& hashes);
+
+    private:
+        struct PendingHash {
+            /** Buffer the reduction writes to. */
+            GLuint buffer_ = 0;
+            /** Fence signaled when the reduction is finished. */
+            GLsync fence_ = nullptr;
+            /** Iteration of the hashed state. */
+            std::uint64_t iteration_ = 0;
+        };
+
+        /** Number of hashes in flight. */
+        static constexpr std::size_t NUM_PENDING = 4;
+
+        /** Holds the reduction program. */
+        std::shared_ptr<GPUProgram> hashProgram_;
+        /** Holds the location of the A/B texture. */
+        GLint abTextureLoc_ = -1;
+        /** Holds the result buffers, used round robin. */
+        std::array<PendingHash, NUM_PENDING> pending_;
+        /** Index of the oldest hash in flight. */
+        std::size_t oldestPending_ = 0;
+        /** Number of hashes in flight. */
+        std::size_t numPending_ = 0;
+    };
+}
@@ -0,0 +1,34 @@
+/**
+ * @file   SustainableRate.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the measurement of the simulation rate a node can sustain.
+ */
+
+#include "SustainableRate.h"
+#include "app/ApplicationNodeImplementation.h"
+
+namespace viscom::sync {
+
+    void SustainableRate::UpdateFrame()
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (now - measurementStart_ < MEASUREMENT_INTERVAL) return;
+        measurementStart_ = now;
+
+        // frames without simulation (idle, waiting) say nothing about the capacity, the last estimate stays.
+        if (measuredIterations_ >= ApplicationNodeImplementation::MAX_FRAME_ITERATIONS && measuredSimulationTime_ > 0.0) {
+            const auto rate = static_cast<double>(measuredIterations_) / (measuredSimulationTime_ * 1e-3) * GetAppNode()->GetAppSettings().simulationBudget_;
+            rate_ = rate_ > 0.0 ? 0.5 * (rate_ + rate) : rate;
+        }
+        measuredIterations_ = 0;
+        measuredSimulationTime_ = 0.0;
+    }
+
+    void SustainableRate::AddSimulationTime(std::uint64_t iterations, double milliseconds)
+    {
+        measuredIterations_ += iterations;
+        measuredSimulationTime_ += milliseconds;
+    }
+}
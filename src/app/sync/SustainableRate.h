@@ -0,0 +1,44 @@
+/**
+ * @file   SustainableRate.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the measurement of the simulation rate a node can sustain.
+ */
+
+#pragma once
+
+#include "app/NodeComponent.h"
+#include <chrono>
+#include <cstdint>
+
+namespace viscom::sync {
+
+    /**
+     *  Estimates the iterations per second this node can simulate within its budget (AppSettings::simulationBudget_)
+     *  from the measured simulation time. The master limits the simulation clock to the lowest rate of all nodes.
+     */
+    class SustainableRate final : public NodeComponent
+    {
+    public:
+        explicit SustainableRate(ApplicationNodeImplementation* appNode) : NodeComponent{ appNode } {}
+
+        void UpdateFrame() override;
+
+        /** Adds simulated iterations and the time in milliseconds they took. */
+        void AddSimulationTime(std::uint64_t iterations, double milliseconds);
+        /** Iterations per second this node can sustain (smoothed, 0 until measured). */
+        double GetRate() const { return rate_; }
+
+    private:
+        /** Iterations and time in milliseconds simulated since the start of the rate measurement. */
+        std::uint64_t measuredIterations_ = 0;
+        double measuredSimulationTime_ = 0.0;
+        /** Start of the current rate measurement. */
+        std::chrono::steady_clock::time_point measurementStart_ = std::chrono::steady_clock::now();
+        /** Iterations per second this node can sustain (smoothed, 0 until measured). */
+        double rate_ = 0.0;
+        /** Interval of the rate measurements. */
+        static constexpr std::chrono::seconds MEASUREMENT_INTERVAL{ 1 };
+    };
+}
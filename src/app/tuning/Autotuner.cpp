@@ -0,0 +1,133 @@
+/**
+ * @file   Autotuner.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the benchmarks selecting the fastest configuration of a machine.
+ */
+
+#include "Autotuner.h"
+#include "app/renderers/CPURaycaster.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <thread>
+
+namespace viscom::tuning {
+
+    namespace {
+        /** Size of the synthetic height field (the simulation size of a node). */
+        constexpr unsigned int FIELD_WIDTH = 1920 / 4;
+        constexpr unsigned int FIELD_HEIGHT = 1080 / 4;
+        /** Vertical field of view of the benchmark camera in radians. */
+        constexpr float FIELD_OF_VIEW = 1.0f;
+        /** Tile sizes of the CPU raycaster tried. */
+        constexpr unsigned int TILE_SIZES[] = { 16, 32, 64 };
+
+        renderers::CPURaycastImage CreateImage(unsigned int size, float r, float g, float b)
+        {
+            renderers::CPURaycastImage image;
+            image.width_ = image.height_ = size;
+            image.rgb_.resize(3 * static_cast<std::size_t>(size) * size);
+            for (std::size_t i = 0; i < image.rgb_.size(); i += 3) {
+                const auto shade = 0.5f + 0.5f * static_cast<float>((i / 3) % size) / static_cast<float>(size);
+                image.rgb_[i] = shade * r;
+                image.rgb_[i + 1] = shade * g;
+                image.rgb_[i + 2] = shade * b;
+            }
+            return image;
+        }
+
+        /** Camera at the origin looking down -z at the quad (as in RDRaycastBenchmark). */
+        void SetupView(unsigned int width, unsigned int height, renderers::CPURaycastView& view, renderers::CPURaycastParameters& params)
+        {
+            const auto aspect = static_cast<float>(width) / static_cast<float>(height);
+            const auto f = 1.0f / std::tan(0.5f * FIELD_OF_VIEW);
+            const auto zNear = 0.1f;
+            const auto zFar = 100.0f;
+
+            view.inverseViewProjection_.fill(0.0f);
+            view.inverseViewProjection_[0] = aspect / f;
+            view.inverseViewProjection_[5] = 1.0f / f;
+            view.inverseViewProjection_[11] = (zNear - zFar) / (2.0f * zNear * zFar);
+            view.inverseViewProjection_[14] = -1.0f;
+            view.inverseViewProjection_[15] = (zNear + zFar) / (2.0f * zNear * zFar);
+            view.cameraPosition_ = { { 0.0f, 0.0f, 0.0f } };
+            view.width_ = width;
+            view.height_ = height;
+            params.quadSize_ = { { 0.95f * params.drawDistance_ * aspect / f, 0.95f * params.drawDistance_ / f } };
+        }
+    }
+
+    Autotuner::Autotuner(double seconds) :
+        seconds_{ seconds }
+    {
+    }
+
+    void Autotuner::Measure(std::size_t numCandidates, double budgetFraction, const std::function<double(std::size_t)>& run, std::vector<double>& times) const
+    {
+        const auto share = std::chrono::duration<double>(seconds_ * budgetFraction / static_cast<double>(std::max(numCandidates, std::size_t{ 1 })));
+        times.assign(numCandidates, std::numeric_limits<double>::max());
+        for (std::size_t i = 0; i < numCandidates; ++i) {
+            const auto candidateStart = std::chrono::steady_clock::now();
+            run(i);
+            do {
+                times[i] = std::min(times[i], run(i));
+            } while (std::chrono::steady_clock::now() - candidateStart < share);
+        }
+    }
+
+    double Autotuner::GetElapsedSeconds() const
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+    }
+
+    std::size_t SelectFastest(const std::vector<double>& times)
+    {
+        return static_cast<std::size_t>(std::min_element(times.begin(), times.end()) - times.begin());
+    }
+
+    void TuneCPURaycaster(const Autotuner& tuner, double budgetFraction, unsigned int width, unsigned int height, TuningProfile& profile)
+    {
+        // all threads, one left for the GL thread of the node and half for machines with SMT.
+        const auto maxThreads = std::max(1u, std::thread::hardware_concurrency());
+        std::vector<unsigned int> threadCounts{ maxThreads };
+        if (maxThreads > 2) threadCounts.push_back(maxThreads - 1);
+        if (maxThreads > 3) threadCounts.push_back(maxThreads / 2);
+
+        std::vector<float> heights(static_cast<std::size_t>(FIELD_WIDTH) * FIELD_HEIGHT);
+        for (unsigned int y = 0; y < FIELD_HEIGHT; ++y) {
+            for (unsigned int x = 0; x < FIELD_WIDTH; ++x) {
+                heights[static_cast<std::size_t>(y) * FIELD_WIDTH + x] = 0.5f + 0.5f * std::sin(0.21f * static_cast<float>(x)) * std::cos(0.17f * static_cast<float>(y));
+            }
+        }
+        renderers::CPURaycastView view;
+        renderers::CPURaycastParameters params;
+        SetupView(width, height, view, params);
+        std::vector<std::uint8_t> image(4 * static_cast<std::size_t>(width) * height);
+
+        const auto numTileSizes = sizeof(TILE_SIZES) / sizeof(TILE_SIZES[0]);
+        std::vector<double> times;
+        std::unique_ptr<renderers::CPURaycaster> raycaster;
+        auto raycasterCandidate = std::numeric_limits<std::size_t>::max();
+        tuner.Measure(threadCounts.size() * numTileSizes, budgetFraction, [&](std::size_t candidate) {
+            if (candidate != raycasterCandidate) {
+                raycaster = nullptr;
+                raycaster = std::make_unique<renderers::CPURaycaster>(threadCounts[candidate / numTileSizes], TILE_SIZES[candidate % numTileSizes]);
+                raycaster->SetHeightField(heights.data(), FIELD_WIDTH, FIELD_HEIGHT, { { 0.0f, 0.0f, 1.0f, 1.0f } });
+                raycaster->SetEnvironment(CreateImage(64, 0.4f, 0.6f, 1.0f));
+                raycaster->SetBackground(CreateImage(64, 0.8f, 0.7f, 0.5f));
+                raycasterCandidate = candidate;
+            }
+            const auto start = std::chrono::steady_clock::now();
+            raycaster->Render(view, params, image.data());
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }, times);
+
+        const auto fastest = SelectFastest(times);
+        profile.cpuRaycasterThreads_ = threadCounts[fastest / numTileSizes];
+        profile.cpuRaycasterTileSize_ = TILE_SIZES[fastest % numTileSizes];
+        profile.cpuRaycastTime_ = times[fastest];
+    }
+}
@@ -0,0 +1,44 @@
+/**
+ * @file   Autotuner.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the benchmarks selecting the fastest configuration of a machine.
+ */
+
+#pragma once
+
+#include "TuningProfile.h"
+#include <chrono>
+#include <functional>
+#include <vector>
+
+namespace viscom::tuning {
+
+    /**
+     *  Times candidate configurations within a fixed budget of wall clock time. Every candidate is run once to warm up
+     *  and then as often as its share of the budget allows, the fastest run counts (the others were disturbed). Tuning
+     *  only runs at start up before the first frame (see AppSettings::autotune_), never while the nodes are showing.
+     */
+    class Autotuner
+    {
+    public:
+        explicit Autotuner(double seconds);
+
+        /** Measures candidates 0 to numCandidates - 1 in a fraction of the budget, run returns the milliseconds one run took. */
+        void Measure(std::size_t numCandidates, double budgetFraction, const std::function<double(std::size_t)>& run, std::vector<double>& times) const;
+        /** Seconds since the tuning started. */
+        double GetElapsedSeconds() const;
+
+    private:
+        /** Holds the budget in seconds. */
+        double seconds_;
+        /** Start of the tuning. */
+        std::chrono::steady_clock::time_point start_ = std::chrono::steady_clock::now();
+    };
+
+    /** Returns the index of the fastest candidate. */
+    std::size_t SelectFastest(const std::vector<double>& times);
+    /** Benchmarks thread counts and tile sizes of the CPU raycaster with a synthetic frame of the given size and stores the fastest. */
+    void TuneCPURaycaster(const Autotuner& tuner, double budgetFraction, unsigned int width, unsigned int height, TuningProfile& profile);
+}
@@ -0,0 +1,67 @@
+/**
+ * @file   TuningProfile.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the per machine tuning profile.
+ */
+
+#include "TuningProfile.h"
+#include "app/util/BakedTexture.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+namespace viscom::tuning {
+
+    std::string MakeMachineKey(const std::string& glVendor, const std::string& glRenderer, const std::string& glVersion)
+    {
+        // a driver update changes the version string and the profile is tuned again.
+        return glVendor + " | " + glRenderer + " | " + glVersion + " | " + std::to_string(std::thread::hardware_concurrency()) + " threads";
+    }
+
+    std::string GetTuningProfileFilename(const std::string& directory, const std::string& machineKey)
+    {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(util::HashContent(machineKey.data(), machineKey.size())));
+        return directory + "/" + name + ".txt";
+    }
+
+    bool LoadTuningProfile(const std::string& filename, const std::string& machineKey, TuningProfile& profile)
+    {
+        std::ifstream ifs(filename);
+        std::string str;
+        // the key holds spaces, it is the rest of the first line.
+        if (!(ifs >> str) || str != "machineKey=") return false;
+        ifs >> std::ws;
+        TuningProfile loaded;
+        if (!std::getline(ifs, loaded.machineKey_) || loaded.machineKey_ != machineKey) return false;
+
+        while (ifs >> str && ifs.good()) {
+            if (str == "cpuRaycasterThreads=") ifs >> loaded.cpuRaycasterThreads_;
+            else if (str == "cpuRaycasterTileSize=") ifs >> loaded.cpuRaycasterTileSize_;
+            else if (str == "maxFrameIterations=") ifs >> loaded.maxFrameIterations_;
+            else if (str == "simulationIterationTime=") ifs >> loaded.simulationIterationTime_;
+            else if (str == "cpuRaycastTime=") ifs >> loaded.cpuRaycastTime_;
+        }
+        profile = loaded;
+        return true;
+    }
+
+    bool SaveTuningProfile(const std::string& filename, const TuningProfile& profile)
+    {
+        std::error_code error;
+        const auto directory = std::filesystem::path(filename).parent_path();
+        if (!directory.empty()) std::filesystem::create_directories(directory, error);
+
+        std::ofstream ofs(filename, std::ofstream::trunc);
+        ofs << "machineKey= " << profile.machineKey_ << "\n";
+        ofs << "cpuRaycasterThreads= " << profile.cpuRaycasterThreads_ << "\n";
+        ofs << "cpuRaycasterTileSize= " << profile.cpuRaycasterTileSize_ << "\n";
+        ofs << "maxFrameIterations= " << profile.maxFrameIterations_ << "\n";
+        ofs << "simulationIterationTime= " << profile.simulationIterationTime_ << "\n";
+        ofs << "cpuRaycastTime= " << profile.cpuRaycastTime_ << "\n";
+        return ofs.good();
+    }
+}
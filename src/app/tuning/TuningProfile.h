@@ -0,0 +1,38 @@
+/**
+ * @file   TuningProfile.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the per machine tuning profile.
+ */
+
+#pragma once
+
+#include <string>
+
+namespace viscom::tuning {
+
+    /** The configuration the autotuner found fastest on one machine (see Autotuner). */
+    struct TuningProfile {
+        /** GPU, driver and CPU the profile was tuned on (see MakeMachineKey). */
+        std::string machineKey_;
+        /** Threads of the CPU raycaster (including the calling one). */
+        unsigned int cpuRaycasterThreads_ = 0;
+        /** Size of the tiles the CPU raycaster distributes to its threads in pixels. */
+        unsigned int cpuRaycasterTileSize_ = 32;
+        /** Iterations the node simulates per frame at most when it catches up. */
+        unsigned int maxFrameIterations_ = 15;
+        /** Measured time of one GPU simulation iteration in microseconds (for the log only). */
+        double simulationIterationTime_ = 0.0;
+        /** Measured time of the CPU raycaster benchmark frame in milliseconds (for the log only). */
+        double cpuRaycastTime_ = 0.0;
+    };
+
+    /** Identifies a machine by GPU vendor, renderer and driver version plus the number of hardware threads. */
+    std::string MakeMachineKey(const std::string& glVendor, const std::string& glRenderer, const std::string& glVersion);
+    /** The profile file of a machine in the profile directory (named by a hash of the key). */
+    std::string GetTuningProfileFilename(const std::string& directory, const std::string& machineKey);
+    /** Loads a profile, fails if the file does not exist or was tuned on another machine. */
+    bool LoadTuningProfile(const std::string& filename, const std::string& machineKey, TuningProfile& profile);
+    bool SaveTuningProfile(const std::string& filename, const TuningProfile& profile);
+}
@@ -0,0 +1,51 @@
+/**
+ * @file   AllocationCheck.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the check that the frame loop is allocation free.
+ */
+
+#include "AllocationCheck.h"
+#include "AllocationCounter.h"
+#include "app/ApplicationNodeImplementation.h"
+#include <algorithm>
+#include <cassert>
+
+namespace viscom::util {
+
+    void AllocationCheck::Init()
+    {
+        if (GetAppNode()->GetAppSettings().allocationCheck_ > 0 && !IsAllocationCountingEnabled()) {
+            LOG(WARNING) << "Counting heap allocations needs a build with VISCOM_RD_COUNT_ALLOCATIONS.";
+        }
+    }
+
+    void AllocationCheck::UpdateFrame()
+    {
+        // one frame of the main thread lies between two calls, including synchronization and drawing.
+        const auto allocationCount = GetThreadAllocationCount();
+        const auto frameAllocations = allocationCount - frameAllocationCount_;
+        frameAllocationCount_ = allocationCount;
+        const auto steadyFrame = !frameAllocates_;
+        frameAllocates_ = false;
+        const auto allocationCheck = GetAppNode()->GetAppSettings().allocationCheck_;
+        if (allocationCheck == 0 || !IsAllocationCountingEnabled() || ++countedFrames_ <= ALLOCATION_WARMUP_FRAMES) return;
+
+        reportedAllocations_ += frameAllocations;
+        reportedMaxFrameAllocations_ = std::max(reportedMaxFrameAllocations_, frameAllocations);
+        if (allocationCheck >= 2 && steadyFrame && frameAllocations > 0) {
+            LOG(WARNING) << "Frame " << countedFrames_ << " allocated " << frameAllocations << " times in steady state.";
+            assert(frameAllocations == 0 && "The frame loop has to be allocation free in steady state.");
+        }
+
+        if (countedFrames_ % ALLOCATION_REPORT_FRAMES == 0) {
+            const auto& frameArena = GetAppNode()->GetFrameArena();
+            LOG(INFO) << "Heap allocations in the frame loop: " << static_cast<double>(reportedAllocations_) / static_cast<double>(ALLOCATION_REPORT_FRAMES)
+                << " per frame on average, " << reportedMaxFrameAllocations_ << " maximum, frame arena high water " << frameArena.GetHighWater() << " of "
+                << frameArena.GetCapacity() << " bytes.";
+            reportedAllocations_ = 0;
+            reportedMaxFrameAllocations_ = 0;
+        }
+    }
+}
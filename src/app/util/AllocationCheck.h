@@ -0,0 +1,46 @@
+/**
+ * @file   AllocationCheck.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the check that the frame loop is allocation free.
+ */
+
+#pragma once
+
+#include "app/NodeComponent.h"
+#include <cstdint>
+
+namespace viscom::util {
+
+    /**
+     *  Counts the heap allocations of the main thread per frame (see AppSettings::allocationCheck_), reports them
+     *  periodically and warns about allocating frames in steady state.
+     */
+    class AllocationCheck final : public NodeComponent
+    {
+    public:
+        explicit AllocationCheck(ApplicationNodeImplementation* appNode) : NodeComponent{ appNode } {}
+
+        void Init() override;
+        void UpdateFrame() override;
+
+        /** The current frame legitimately allocates (warm start, resync), it does not count as steady state. */
+        void AllowFrameAllocations() { frameAllocates_ = true; }
+
+    private:
+        /** Allocation count of the main thread at the start of the frame. */
+        std::uint64_t frameAllocationCount_ = 0;
+        /** Number of frames the allocations were counted for. */
+        std::uint64_t countedFrames_ = 0;
+        /** Allocations and maximum allocations per frame since the last report. */
+        std::uint64_t reportedAllocations_ = 0;
+        std::uint64_t reportedMaxFrameAllocations_ = 0;
+        /** The frame legitimately allocates. */
+        bool frameAllocates_ = false;
+        /** Frames after start up before the frame loop has to be allocation free. */
+        static constexpr std::uint64_t ALLOCATION_WARMUP_FRAMES = 120;
+        /** Frames between two allocation reports. */
+        static constexpr std::uint64_t ALLOCATION_REPORT_FRAMES = 600;
+    };
+}
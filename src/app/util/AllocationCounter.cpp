@@ -0,0 +1,104 @@
+/**
+ * @file   AllocationCounter.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the heap allocation instrumentation.
+ */
+
+#include "AllocationCounter.h"
+
+#ifdef VISCOM_RD_COUNT_ALLOCATIONS
+#include <cstdlib>
+#include <new>
+
+namespace {
+    /** Per thread, so worker threads do not show up in the frame loop. */
+    thread_local std::uint64_t threadAllocationCount = 0;
+
+    void* CountedAllocate(std::size_t size)
+    {
+        ++threadAllocationCount;
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    void* CountedAllocate(std::size_t size, std::align_val_t alignment)
+    {
+        ++threadAllocationCount;
+        const auto align = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+        return _aligned_malloc(size == 0 ? 1 : size, align);
+#else
+        return std::aligned_alloc(align, (size + align - 1) / align * align);
+#endif
+    }
+
+    void AlignedFree(void* ptr)
+    {
+#ifdef _WIN32
+        _aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    if (auto ptr = CountedAllocate(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    if (auto ptr = CountedAllocate(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return CountedAllocate(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return CountedAllocate(size); }
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    if (auto ptr = CountedAllocate(size, alignment)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    if (auto ptr = CountedAllocate(size, alignment)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { AlignedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { AlignedFree(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { AlignedFree(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { AlignedFree(ptr); }
+#endif
+
+namespace viscom::util {
+
+    bool IsAllocationCountingEnabled()
+    {
+#ifdef VISCOM_RD_COUNT_ALLOCATIONS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    std::uint64_t GetThreadAllocationCount()
+    {
+#ifdef VISCOM_RD_COUNT_ALLOCATIONS
+        return threadAllocationCount;
+#else
+        return 0;
+#endif
+    }
+}
@@ -0,0 +1,22 @@
+/**
+ * @file   AllocationCounter.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the heap allocation instrumentation.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace viscom::util {
+
+    /**
+     *  Counting replaces the global operator new and is only compiled in with VISCOM_RD_COUNT_ALLOCATIONS (CMake option
+     *  of the same name). Allocations through malloc (ImGui, drivers) are not counted.
+     */
+    bool IsAllocationCountingEnabled();
+    /** Number of operator new calls of the calling thread so far (always 0 without counting). */
+    std::uint64_t GetThreadAllocationCount();
+}
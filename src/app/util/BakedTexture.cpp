@@ -0,0 +1,228 @@
+/**
+ * @file   BakedTexture.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of GPU ready texture files with a precomputed mip chain.
+ */
+
+#include "BakedTexture.h"
+#include <stb_image.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <thread>
+
+namespace viscom::util {
+
+    namespace {
+        /** File magic ("RDTX"). */
+        constexpr std::uint32_t BAKED_MAGIC = 0x58544452;
+        constexpr std::uint32_t BAKED_VERSION = 1;
+        /** Size of the file header (magic, version, format, number of levels, source hash). */
+        constexpr std::size_t HEADER_SIZE = 4 * sizeof(std::uint32_t) + sizeof(std::uint64_t);
+        /** Size of the description of one level. */
+        constexpr std::size_t LEVEL_HEADER_SIZE = 2 * sizeof(std::uint32_t) + 2 * sizeof(std::uint64_t);
+        /** Largest number of mip levels (a 2^31 texture). */
+        constexpr std::uint32_t MAX_LEVELS = 32;
+
+        template<typename T> void WriteRaw(std::vector<std::uint8_t>& data, const T& value)
+        {
+            const auto bytes = reinterpret_cast<const std::uint8_t*>(&value);
+            data.insert(data.end(), bytes, bytes + sizeof(T));
+        }
+
+        template<typename T> T ReadRaw(const std::uint8_t* data)
+        {
+            T value;
+            std::memcpy(&value, data, sizeof(T));
+            return value;
+        }
+
+        /** Mantissa bits, exponent bias and largest value of the shared exponent format. */
+        constexpr int RGB9E5_MANTISSA_BITS = 9;
+        constexpr int RGB9E5_EXPONENT_BIAS = 15;
+        constexpr float RGB9E5_MAX_VALUE = 511.0f / 512.0f * 65536.0f;
+
+        /** Encodes a color in the shared exponent format (EXT_texture_shared_exponent). */
+        std::uint32_t EncodeRGB9E5(float r, float g, float b)
+        {
+            const auto clampValue = [](float value) { return std::isfinite(value) ? std::min(std::max(value, 0.0f), RGB9E5_MAX_VALUE) : 0.0f; };
+            const auto rc = clampValue(r), gc = clampValue(g), bc = clampValue(b);
+            const auto maxValue = std::max({ rc, gc, bc });
+            if (maxValue <= 0.0f) return 0;
+
+            auto exponent = std::max(-RGB9E5_EXPONENT_BIAS - 1, static_cast<int>(std::floor(std::log2(maxValue)))) + 1 + RGB9E5_EXPONENT_BIAS;
+            auto scale = std::exp2(static_cast<float>(exponent - RGB9E5_EXPONENT_BIAS - RGB9E5_MANTISSA_BITS));
+            if (static_cast<int>(std::floor(maxValue / scale + 0.5f)) == (1 << RGB9E5_MANTISSA_BITS)) {
+                ++exponent;
+                scale *= 2.0f;
+            }
+
+            const auto mantissa = [scale](float value) { return static_cast<std::uint32_t>(std::floor(value / scale + 0.5f)); };
+            return mantissa(rc) | (mantissa(gc) << 9) | (mantissa(bc) << 18) | (static_cast<std::uint32_t>(exponent) << 27);
+        }
+
+        /** Averages 2x2 texels (an odd last column or row is repeated). */
+        std::vector<float> Downsample(const std::vector<float>& texels, unsigned int width, unsigned int height, unsigned int& newWidth, unsigned int& newHeight)
+        {
+            newWidth = std::max(1u, width / 2);
+            newHeight = std::max(1u, height / 2);
+            std::vector<float> result(4 * static_cast<std::size_t>(newWidth) * newHeight);
+            for (unsigned int y = 0; y < newHeight; ++y) {
+                const auto y0 = std::min(2 * y, height - 1), y1 = std::min(2 * y + 1, height - 1);
+                for (unsigned int x = 0; x < newWidth; ++x) {
+                    const auto x0 = std::min(2 * x, width - 1), x1 = std::min(2 * x + 1, width - 1);
+                    for (unsigned int c = 0; c < 4; ++c) {
+                        const auto texel = [&texels, width, c](unsigned int tx, unsigned int ty) { return texels[4 * (static_cast<std::size_t>(ty) * width + tx) + c]; };
+                        result[4 * (static_cast<std::size_t>(y) * newWidth + x) + c] = 0.25f * (texel(x0, y0) + texel(x1, y0) + texel(x0, y1) + texel(x1, y1));
+                    }
+                }
+            }
+            return result;
+        }
+
+        void EncodeLevel(const std::vector<float>& texels, BakedFormat format, std::vector<std::uint8_t>& data)
+        {
+            const auto numTexels = texels.size() / 4;
+            for (std::size_t i = 0; i < numTexels; ++i) {
+                const auto texel = &texels[4 * i];
+                if (format == BakedFormat::RGB9E5) {
+                    WriteRaw(data, EncodeRGB9E5(texel[0], texel[1], texel[2]));
+                } else {
+                    for (unsigned int c = 0; c < 4; ++c) data.push_back(static_cast<std::uint8_t>(std::clamp(texel[c], 0.0f, 1.0f) * 255.0f + 0.5f));
+                }
+            }
+        }
+    }
+
+    std::uint64_t HashContent(const void* data, std::size_t size)
+    {
+        const auto bytes = static_cast<const std::uint8_t*>(data);
+        std::uint64_t hash = 14695981039346656037ull;
+        for (std::size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    bool DecodeImage(const std::string& filename, const void* data, std::size_t size, DecodedImage& image)
+    {
+        image.hdr_ = filename.size() >= 4 && filename.compare(filename.size() - 4, 4, ".hdr") == 0;
+        const auto buffer = static_cast<const stbi_uc*>(data);
+        const auto bufferSize = static_cast<int>(size);
+        void* pixels = image.hdr_ ? static_cast<void*>(stbi_loadf_from_memory(buffer, bufferSize, &image.width_, &image.height_, &image.channels_, 0))
+            : static_cast<void*>(stbi_load_from_memory(buffer, bufferSize, &image.width_, &image.height_, &image.channels_, 0));
+        if (pixels == nullptr) return false;
+
+        // flip the rows so the first one is at the bottom.
+        const auto rowSize = static_cast<std::size_t>(image.width_) * image.channels_ * (image.hdr_ ? sizeof(float) : 1);
+        image.pixels_.resize(rowSize * image.height_);
+        for (int y = 0; y < image.height_; ++y) {
+            std::memcpy(&image.pixels_[rowSize * (image.height_ - 1 - y)], static_cast<const std::uint8_t*>(pixels) + rowSize * y, rowSize);
+        }
+        stbi_image_free(pixels);
+        return true;
+    }
+
+    void BakeTexture(const DecodedImage& image, std::uint64_t sourceHash, std::vector<std::uint8_t>& data)
+    {
+        // expand to float RGBA, grey images are replicated and a missing alpha is opaque.
+        auto width = static_cast<unsigned int>(image.width_);
+        auto height = static_cast<unsigned int>(image.height_);
+        std::vector<float> texels(4 * static_cast<std::size_t>(width) * height);
+        for (std::size_t i = 0; i < texels.size() / 4; ++i) {
+            const auto channel = [&image, i](int c) {
+                const auto index = i * image.channels_ + c;
+                return image.hdr_ ? ReadRaw<float>(&image.pixels_[index * sizeof(float)]) : static_cast<float>(image.pixels_[index]) / 255.0f;
+            };
+            const auto grey = image.channels_ < 3;
+            texels[4 * i] = channel(0);
+            texels[4 * i + 1] = grey ? channel(0) : channel(1);
+            texels[4 * i + 2] = grey ? channel(0) : channel(2);
+            texels[4 * i + 3] = image.channels_ == 2 ? channel(1) : (image.channels_ == 4 ? channel(3) : 1.0f);
+        }
+
+        auto numLevels = 1u;
+        while ((std::max(width, height) >> numLevels) > 0) ++numLevels;
+
+        const auto format = image.hdr_ ? BakedFormat::RGB9E5 : BakedFormat::RGBA8;
+        data.clear();
+        WriteRaw(data, BAKED_MAGIC);
+        WriteRaw(data, BAKED_VERSION);
+        WriteRaw(data, static_cast<std::uint32_t>(format));
+        WriteRaw(data, static_cast<std::uint32_t>(numLevels));
+        WriteRaw(data, sourceHash);
+        const auto levelHeaders = data.size();
+        data.resize(data.size() + numLevels * LEVEL_HEADER_SIZE);
+
+        for (unsigned int level = 0; level < numLevels; ++level) {
+            if (level > 0) texels = Downsample(texels, width, height, width, height);
+            const auto offset = static_cast<std::uint64_t>(data.size());
+            EncodeLevel(texels, format, data);
+            const auto size = static_cast<std::uint64_t>(data.size()) - offset;
+
+            auto header = &data[levelHeaders + level * LEVEL_HEADER_SIZE];
+            const std::uint32_t levelSize[2] = { width, height };
+            std::memcpy(header, levelSize, sizeof(levelSize));
+            std::memcpy(header + sizeof(levelSize), &offset, sizeof(offset));
+            std::memcpy(header + sizeof(levelSize) + sizeof(offset), &size, sizeof(size));
+        }
+    }
+
+    bool ParseBakedTexture(const void* data, std::size_t size, BakedTexture& texture)
+    {
+        const auto bytes = static_cast<const std::uint8_t*>(data);
+        if (size < HEADER_SIZE) return false;
+        const auto magic = ReadRaw<std::uint32_t>(bytes);
+        const auto version = ReadRaw<std::uint32_t>(bytes + 4);
+        const auto format = ReadRaw<std::uint32_t>(bytes + 8);
+        const auto numLevels = ReadRaw<std::uint32_t>(bytes + 12);
+        if (magic != BAKED_MAGIC || version != BAKED_VERSION || format > static_cast<std::uint32_t>(BakedFormat::RGBA8)) return false;
+        if (numLevels == 0 || numLevels > MAX_LEVELS || size < HEADER_SIZE + numLevels * LEVEL_HEADER_SIZE) return false;
+
+        texture.format_ = static_cast<BakedFormat>(format);
+        texture.sourceHash_ = ReadRaw<std::uint64_t>(bytes + 16);
+        texture.levels_.resize(numLevels);
+        for (std::uint32_t i = 0; i < numLevels; ++i) {
+            const auto header = bytes + HEADER_SIZE + i * LEVEL_HEADER_SIZE;
+            auto& level = texture.levels_[i];
+            level.width_ = ReadRaw<std::uint32_t>(header);
+            level.height_ = ReadRaw<std::uint32_t>(header + 4);
+            level.offset_ = ReadRaw<std::uint64_t>(header + 8);
+            level.size_ = ReadRaw<std::uint64_t>(header + 16);
+            // both formats have 4 bytes per texel.
+            if (level.size_ != 4ull * level.width_ * level.height_ || level.offset_ > size || level.size_ > size - level.offset_) return false;
+        }
+        return true;
+    }
+
+    bool SaveBakedTexture(const std::string& filename, const std::vector<std::uint8_t>& data)
+    {
+        std::error_code error;
+        const auto directory = std::filesystem::path(filename).parent_path();
+        if (!directory.empty()) std::filesystem::create_directories(directory, error);
+
+        const auto tempFilename = filename + ".tmp" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+        {
+            std::ofstream ofs(tempFilename, std::ofstream::binary | std::ofstream::trunc);
+            ofs.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+            if (!ofs.good()) return false;
+        }
+        std::filesystem::rename(tempFilename, filename, error);
+        if (!error) return true;
+        std::filesystem::remove(tempFilename, error);
+        return false;
+    }
+
+    std::string GetBakedTextureFilename(const std::string& cacheDirectory, const std::string& name)
+    {
+        auto cacheName = name;
+        std::replace_if(cacheName.begin(), cacheName.end(), [](char c) { return c == '/' || c == '\\' || c == ':'; }, '_');
+        return cacheDirectory + "/" + cacheName + ".rdtex";
+    }
+}
@@ -0,0 +1,68 @@
+/**
+ * @file   BakedTexture.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of GPU ready texture files with a precomputed mip chain.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace viscom::util {
+
+    /** Texel format of a baked texture. */
+    enum class BakedFormat : std::uint32_t {
+        /** Shared exponent HDR format (GL_RGB9_E5), 4 bytes per texel. */
+        RGB9E5,
+        /** 8 bit per channel (GL_RGBA8). */
+        RGBA8
+    };
+
+    /** One mip level of a baked texture. */
+    struct BakedLevel {
+        unsigned int width_ = 0;
+        unsigned int height_ = 0;
+        /** Offset of the texels from the start of the file. */
+        std::uint64_t offset_ = 0;
+        /** Size of the texels in bytes. */
+        std::uint64_t size_ = 0;
+    };
+
+    /** Header of a baked texture, the texels stay in the file (mapped into memory). */
+    struct BakedTexture {
+        BakedFormat format_ = BakedFormat::RGBA8;
+        /** Hash of the source image file the texture was baked from. */
+        std::uint64_t sourceHash_ = 0;
+        /** Holds the mip levels, level 0 first. */
+        std::vector<BakedLevel> levels_;
+    };
+
+    /** An image decoded from a file (rows bottom up as GL expects). */
+    struct DecodedImage {
+        int width_ = 0;
+        int height_ = 0;
+        int channels_ = 0;
+        /** The image has float components (HDR), otherwise 8 bit. */
+        bool hdr_ = false;
+        /** Holds the pixels as float (HDR) or byte values. */
+        std::vector<std::uint8_t> pixels_;
+    };
+
+    /** 64 bit FNV-1a hash of the content of a file. */
+    std::uint64_t HashContent(const void* data, std::size_t size);
+    /** Decodes an image file in memory with stb_image, Radiance files (ending in .hdr) are decoded as HDR. */
+    bool DecodeImage(const std::string& filename, const void* data, std::size_t size, DecodedImage& image);
+    /** Converts an image to RGB9E5 (HDR) or RGBA8 with a full box filtered mip chain and encodes it as a file. */
+    void BakeTexture(const DecodedImage& image, std::uint64_t sourceHash, std::vector<std::uint8_t>& data);
+    /** Reads the header of a baked texture in memory, returns false if it is malformed. */
+    bool ParseBakedTexture(const void* data, std::size_t size, BakedTexture& texture);
+    /** Writes a baked texture, a temporary file is renamed so other nodes never map a partial file. */
+    bool SaveBakedTexture(const std::string& filename, const std::vector<std::uint8_t>& data);
+    /** The cache file of a texture resource. */
+    std::string GetBakedTextureFilename(const std::string& cacheDirectory, const std::string& name);
+}
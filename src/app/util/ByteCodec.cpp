@@ -0,0 +1,97 @@
+/**
+ * @file   ByteCodec.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the byte level compression helpers.
+ */
+
+#include "ByteCodec.h"
+#include <algorithm>
+#include <cstring>
+
+namespace viscom::util {
+
+    namespace {
+        /** Minimal and maximal length of a repeat run. */
+        constexpr std::size_t MIN_REPEAT = 3;
+        constexpr std::size_t MAX_REPEAT = 130;
+        /** Maximal length of a literal run. */
+        constexpr std::size_t MAX_LITERAL = 128;
+    }
+
+    void ShuffleBytes(const void* src, std::size_t count, std::size_t elementSize, std::uint8_t* dst)
+    {
+        auto srcBytes = static_cast<const std::uint8_t*>(src);
+        for (std::size_t b = 0; b < elementSize; ++b) {
+            auto dstPlane = dst + b * count;
+            for (std::size_t i = 0; i < count; ++i) dstPlane[i] = srcBytes[i * elementSize + b];
+        }
+    }
+
+    void UnshuffleBytes(const std::uint8_t* src, std::size_t count, std::size_t elementSize, void* dst)
+    {
+        auto dstBytes = static_cast<std::uint8_t*>(dst);
+        for (std::size_t b = 0; b < elementSize; ++b) {
+            auto srcPlane = src + b * count;
+            for (std::size_t i = 0; i < count; ++i) dstBytes[i * elementSize + b] = srcPlane[i];
+        }
+    }
+
+    void EncodeRLE(const std::uint8_t* src, std::size_t size, std::vector<std::uint8_t>& dst)
+    {
+        std::size_t i = 0;
+        std::size_t literalStart = 0;
+
+        auto flushLiterals = [&dst, src](std::size_t start, std::size_t end) {
+            while (start < end) {
+                auto length = std::min(end - start, MAX_LITERAL);
+                dst.push_back(static_cast<std::uint8_t>(length - 1));
+                dst.insert(dst.end(), src + start, src + start + length);
+                start += length;
+            }
+        };
+
+        while (i < size) {
+            std::size_t run = 1;
+            while (i + run < size && run < MAX_REPEAT && src[i + run] == src[i]) ++run;
+
+            if (run >= MIN_REPEAT) {
+                flushLiterals(literalStart, i);
+                dst.push_back(static_cast<std::uint8_t>(run + 125));
+                dst.push_back(src[i]);
+                i += run;
+                literalStart = i;
+            } else i += run;
+        }
+        flushLiterals(literalStart, size);
+    }
+
+    std::size_t MaxDecodedRLESize(std::size_t size)
+    {
+        // the best case is a repeat run of MAX_REPEAT bytes per control and value byte.
+        return (size / 2) * MAX_REPEAT;
+    }
+
+    bool DecodeRLE(const std::uint8_t* src, std::size_t size, std::uint8_t* dst, std::size_t dstSize)
+    {
+        std::size_t i = 0;
+        std::size_t o = 0;
+        while (i < size && o < dstSize) {
+            const auto control = src[i++];
+            if (control < 128) {
+                const std::size_t length = control + 1;
+                if (i + length > size || o + length > dstSize) return false;
+                std::memcpy(dst + o, src + i, length);
+                i += length;
+                o += length;
+            } else {
+                const std::size_t length = control - 125;
+                if (i >= size || o + length > dstSize) return false;
+                std::memset(dst + o, src[i++], length);
+                o += length;
+            }
+        }
+        return o == dstSize;
+    }
+}
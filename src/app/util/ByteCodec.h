@@ -0,0 +1,34 @@
+/**
+ * @file   ByteCodec.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Simple lossless byte level compression helpers for simulation fields.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace viscom::util {
+
+    /**
+     *  Reorders count elements of elementSize bytes so that all first bytes come first, then all second bytes, ...
+     *  Smooth float fields have long runs in the exponent and high mantissa bytes afterwards.
+     */
+    void ShuffleBytes(const void* src, std::size_t count, std::size_t elementSize, std::uint8_t* dst);
+    /** Reverts ShuffleBytes. */
+    void UnshuffleBytes(const std::uint8_t* src, std::size_t count, std::size_t elementSize, void* dst);
+
+    /**
+     *  Run length encodes src and appends it to dst.
+     *  Control byte c < 128 is followed by c + 1 literal bytes, c >= 128 by one byte repeated c - 125 times.
+     */
+    void EncodeRLE(const std::uint8_t* src, std::size_t size, std::vector<std::uint8_t>& dst);
+    /** Largest number of bytes size encoded bytes can decode to, used to reject headers before allocating. */
+    std::size_t MaxDecodedRLESize(std::size_t size);
+    /** Decodes exactly dstSize bytes, returns false if the input is malformed. */
+    bool DecodeRLE(const std::uint8_t* src, std::size_t size, std::uint8_t* dst, std::size_t dstSize);
+}
@@ -0,0 +1,49 @@
+/**
+ * @file   FrameArena.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the linear allocator for data that lives for one frame.
+ */
+
+#include "FrameArena.h"
+#include <algorithm>
+
+namespace viscom::util {
+
+    FrameArena::FrameArena(std::size_t capacity) :
+        block_{ std::make_unique<std::byte[]>(capacity) },
+        capacity_{ capacity }
+    {
+        overflowBlocks_.reserve(16);
+    }
+
+    void FrameArena::Reset()
+    {
+        highWater_ = std::max(highWater_, frameBytes_);
+        if (!overflowBlocks_.empty()) {
+            // grow once so the next frames with the same demand fit into the main block.
+            capacity_ = std::max(2 * capacity_, highWater_ + highWater_ / 2);
+            block_ = std::make_unique<std::byte[]>(capacity_);
+            overflowBlocks_.clear();
+        }
+        offset_ = 0;
+        frameBytes_ = 0;
+    }
+
+    void* FrameArena::Allocate(std::size_t size, std::size_t alignment)
+    {
+        // overflow blocks are aligned for every fundamental type, so the padding is counted conservatively.
+        frameBytes_ += size + alignment;
+        if (size == 0) return nullptr;
+
+        const auto alignedOffset = (offset_ + alignment - 1) & ~(alignment - 1);
+        if (alignedOffset + size <= capacity_) {
+            offset_ = alignedOffset + size;
+            return block_.get() + alignedOffset;
+        }
+
+        overflowBlocks_.push_back(std::make_unique<std::byte[]>(size));
+        return overflowBlocks_.back().get();
+    }
+}
@@ -0,0 +1,72 @@
+/**
+ * @file   FrameArena.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the linear allocator for data that lives for one frame.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace viscom::util {
+
+    /**
+     *  Bump allocator reset at the beginning of every frame. Allocations that do not fit go to overflow blocks, the next
+     *  reset replaces all blocks by one block of the high water mark, so a steady frame loop does not allocate.
+     */
+    class FrameArena
+    {
+    public:
+        explicit FrameArena(std::size_t capacity);
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        /** Releases all allocations of the last frame. */
+        void Reset();
+
+        /** Allocates uninitialized storage for count trivial objects. */
+        template<typename T> T* Allocate(std::size_t count)
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "The arena does not call destructors.");
+            return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+        }
+        void* Allocate(std::size_t size, std::size_t alignment);
+
+        std::size_t GetCapacity() const { return capacity_; }
+        /** Largest number of bytes used in one frame. */
+        std::size_t GetHighWater() const { return highWater_; }
+
+    private:
+        /** Holds the main block. */
+        std::unique_ptr<std::byte[]> block_;
+        /** Holds the size of the main block. */
+        std::size_t capacity_;
+        /** Holds the bytes used of the main block. */
+        std::size_t offset_ = 0;
+        /** Holds the blocks allocated this frame because the main block was full. */
+        std::vector<std::unique_ptr<std::byte[]>> overflowBlocks_;
+        /** Holds the bytes allocated this frame (including overflow). */
+        std::size_t frameBytes_ = 0;
+        /** Largest number of bytes used in one frame. */
+        std::size_t highWater_ = 0;
+    };
+
+    /** A contiguous range of objects allocated in a frame arena. */
+    template<typename T>
+    struct FrameSpan {
+        T* data_ = nullptr;
+        std::size_t size_ = 0;
+
+        T* begin() const { return data_; }
+        T* end() const { return data_ + size_; }
+        std::size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+        T& operator[](std::size_t index) const { return data_[index]; }
+    };
+}
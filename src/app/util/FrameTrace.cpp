@@ -0,0 +1,184 @@
+/**
+ * @file   FrameTrace.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the scoped CPU trace zones exported in the Chrome trace format.
+ */
+
+#include "FrameTrace.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace viscom::util {
+
+    namespace {
+        struct TraceEvent {
+            const char* name_;
+            std::int64_t begin_;
+            std::int64_t end_;
+        };
+
+        /** Written by its thread only, read when the trace is written. */
+        struct ThreadTraceBuffer {
+            std::vector<TraceEvent> events_;
+            /** Number of zones recorded so far (the slot is this modulo the capacity). */
+            std::atomic<std::uint64_t> recorded_{ 0 };
+            std::uint32_t threadId_ = 0;
+            std::string threadName_;
+        };
+
+        std::atomic<bool> tracingEnabled{ false };
+        std::atomic<std::int64_t> traceClockOffset{ 0 };
+        std::size_t zonesPerThread = 0;
+        /** Protects the list of buffers (only locked on the first zone of a thread). */
+        std::mutex buffersMutex;
+        /** Buffers outlive their threads, so zones of finished workers are still written. */
+        std::vector<std::unique_ptr<ThreadTraceBuffer>> buffers;
+        thread_local ThreadTraceBuffer* threadBuffer = nullptr;
+
+        ThreadTraceBuffer* GetThreadBuffer()
+        {
+            if (threadBuffer != nullptr) return threadBuffer;
+            std::lock_guard<std::mutex> lock{ buffersMutex };
+            buffers.push_back(std::make_unique<ThreadTraceBuffer>());
+            threadBuffer = buffers.back().get();
+            threadBuffer->events_.resize(zonesPerThread);
+            threadBuffer->threadId_ = static_cast<std::uint32_t>(buffers.size());
+            threadBuffer->threadName_ = "thread " + std::to_string(threadBuffer->threadId_);
+            return threadBuffer;
+        }
+
+        std::string EscapeJSON(const std::string& text)
+        {
+            std::string result;
+            for (auto c : text) {
+                if (c == '"' || c == '\\') result.push_back('\\');
+                if (static_cast<unsigned char>(c) >= 0x20) result.push_back(c);
+            }
+            return result;
+        }
+
+        const char* TRACE_BEGIN = "{\"traceEvents\":[";
+        const char* TRACE_END = "]}";
+    }
+
+    void EnableTracing(std::size_t numZonesPerThread)
+    {
+        {
+            std::lock_guard<std::mutex> lock{ buffersMutex };
+            zonesPerThread = std::max(numZonesPerThread, std::size_t{ 1 });
+        }
+        tracingEnabled.store(true, std::memory_order_release);
+    }
+
+    bool IsTracingEnabled()
+    {
+        return tracingEnabled.load(std::memory_order_relaxed);
+    }
+
+    std::int64_t GetTraceTime()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void RecordTraceZone(const char* name, std::int64_t begin, std::int64_t end)
+    {
+        auto buffer = GetThreadBuffer();
+        const auto recorded = buffer->recorded_.load(std::memory_order_relaxed);
+        buffer->events_[recorded % buffer->events_.size()] = TraceEvent{ name, begin, end };
+        buffer->recorded_.store(recorded + 1, std::memory_order_release);
+    }
+
+    std::uint32_t GetTraceProcessId()
+    {
+#ifdef _WIN32
+        return static_cast<std::uint32_t>(_getpid());
+#else
+        return static_cast<std::uint32_t>(getpid());
+#endif
+    }
+
+    void SetTraceThreadName(const std::string& name)
+    {
+        if (!IsTracingEnabled()) return;
+        auto buffer = GetThreadBuffer();
+        std::lock_guard<std::mutex> lock{ buffersMutex };
+        buffer->threadName_ = name;
+    }
+
+    void SetTraceClockOffset(std::int64_t offset)
+    {
+        traceClockOffset.store(offset, std::memory_order_relaxed);
+    }
+
+    bool WriteChromeTrace(const std::string& filename, const std::string& processName, std::uint32_t processId)
+    {
+        std::ofstream ofs(filename, std::ofstream::trunc);
+        if (!ofs) return false;
+        const auto offset = traceClockOffset.load(std::memory_order_relaxed);
+
+        ofs << TRACE_BEGIN << "\n";
+        ofs << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << processId << ",\"args\":{\"name\":\"" << EscapeJSON(processName) << "\"}}";
+
+        std::lock_guard<std::mutex> lock{ buffersMutex };
+        char line[256];
+        for (const auto& buffer : buffers) {
+            ofs << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << processId << ",\"tid\":" << buffer->threadId_ << ",\"args\":{\"name\":\""
+                << EscapeJSON(buffer->threadName_) << "\"}}";
+
+            // zones overwritten while copying are dropped, the owning thread may still be running.
+            const auto capacity = static_cast<std::uint64_t>(buffer->events_.size());
+            const auto recorded = buffer->recorded_.load(std::memory_order_acquire);
+            const auto first = recorded > capacity ? recorded - capacity : 0;
+            std::vector<TraceEvent> events;
+            events.reserve(static_cast<std::size_t>(recorded - first));
+            for (auto i = first; i < recorded; ++i) events.push_back(buffer->events_[i % capacity]);
+            const auto recordedAfter = buffer->recorded_.load(std::memory_order_acquire);
+            const auto firstValid = recordedAfter > capacity ? recordedAfter - capacity : 0;
+
+            for (auto i = std::max(first, firstValid); i < recorded; ++i) {
+                const auto& event = events[static_cast<std::size_t>(i - first)];
+                // microseconds with nanosecond precision on the timeline of the master.
+                std::snprintf(line, sizeof(line), ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%u,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", EscapeJSON(event.name_).c_str(),
+                    processId, buffer->threadId_, static_cast<double>(event.begin_ + offset) * 1e-3, static_cast<double>(event.end_ - event.begin_) * 1e-3);
+                ofs << line;
+            }
+        }
+        ofs << "\n" << TRACE_END << "\n";
+        return ofs.good();
+    }
+
+    bool MergeChromeTraces(const std::vector<std::string>& filenames, const std::string& filename)
+    {
+        std::ofstream ofs(filename, std::ofstream::trunc);
+        if (!ofs) return false;
+
+        ofs << TRACE_BEGIN;
+        auto firstEvent = true;
+        for (const auto& input : filenames) {
+            std::ifstream ifs(input);
+            std::string line;
+            if (!std::getline(ifs, line) || line != TRACE_BEGIN) return false;
+            while (std::getline(ifs, line) && line != TRACE_END) {
+                if (!line.empty() && line.back() == ',') line.pop_back();
+                if (line.empty()) continue;
+                ofs << (firstEvent ? "\n" : ",\n") << line;
+                firstEvent = false;
+            }
+        }
+        ofs << "\n" << TRACE_END << "\n";
+        return ofs.good();
+    }
+}
@@ -0,0 +1,62 @@
+/**
+ * @file   FrameTrace.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the scoped CPU trace zones exported in the Chrome trace format.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace viscom::util {
+
+    /**
+     *  Starts recording trace zones. Every thread records into its own fixed size buffer (lock free, the oldest zones
+     *  are overwritten), the buffer is allocated on the first zone of the thread.
+     */
+    void EnableTracing(std::size_t zonesPerThread);
+    bool IsTracingEnabled();
+    /** Nanoseconds of the trace clock (steady clock of this node). */
+    std::int64_t GetTraceTime();
+    /** Records a finished zone for the calling thread, the name has to outlive the trace (string literal). */
+    void RecordTraceZone(const char* name, std::int64_t begin, std::int64_t end);
+    /** Id of this process, used for the trace file names and as process id in the trace. */
+    std::uint32_t GetTraceProcessId();
+    /** Names the calling thread in the trace. */
+    void SetTraceThreadName(const std::string& name);
+    /** Sets the offset of the trace clock of this node to the one of the master, it is added to all written zones. */
+    void SetTraceClockOffset(std::int64_t offset);
+    /**
+     *  Writes all recorded zones in the Chrome trace event format (chrome://tracing, Perfetto), one event per line.
+     *  The process id separates the nodes when traces are merged (see MergeChromeTraces).
+     */
+    bool WriteChromeTrace(const std::string& filename, const std::string& processName, std::uint32_t processId);
+    /** Merges the traces of several nodes into one file. */
+    bool MergeChromeTraces(const std::vector<std::string>& filenames, const std::string& filename);
+
+    /** Records the lifetime of the object as a zone (nothing but a flag check while tracing is disabled). */
+    class TraceZone
+    {
+    public:
+        explicit TraceZone(const char* name) : name_{ name }, begin_{ IsTracingEnabled() ? GetTraceTime() : -1 } {}
+        TraceZone(const TraceZone&) = delete;
+        TraceZone& operator=(const TraceZone&) = delete;
+        ~TraceZone() { if (begin_ >= 0) RecordTraceZone(name_, begin_, GetTraceTime()); }
+
+    private:
+        /** Holds the name of the zone. */
+        const char* name_;
+        /** Holds the start time (-1 if tracing is disabled). */
+        std::int64_t begin_;
+    };
+}
+
+#define VISCOM_TRACE_CONCAT_IMPL(a, b) a##b
+#define VISCOM_TRACE_CONCAT(a, b) VISCOM_TRACE_CONCAT_IMPL(a, b)
+/** Traces the rest of the enclosing scope. */
+#define VISCOM_TRACE_ZONE(name) ::viscom::util::TraceZone VISCOM_TRACE_CONCAT(traceZone, __LINE__){ name }
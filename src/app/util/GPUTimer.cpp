@@ -0,0 +1,65 @@
+/**
+ * @file   GPUTimer.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of asynchronous GPU time measurements.
+ */
+
+#include "GPUTimer.h"
+#include "core/open_gl.h"
+
+namespace viscom::util {
+
+    GPUTimer::GPUTimer()
+    {
+        for (auto& query : queries_) glGenQueries(1, &query.query_);
+    }
+
+    GPUTimer::~GPUTimer()
+    {
+        for (auto& query : queries_) glDeleteQueries(1, &query.query_);
+    }
+
+    void GPUTimer::Begin(int tag, std::uint64_t count)
+    {
+        if (running_ || numQueries_ == NUM_QUERIES) return;
+        auto& query = queries_[(oldestQuery_ + numQueries_) % NUM_QUERIES];
+        query.tag_ = tag;
+        query.count_ = count;
+        glBeginQuery(GL_TIME_ELAPSED, query.query_);
+        ++numQueries_;
+        running_ = true;
+    }
+
+    void GPUTimer::End()
+    {
+        if (!running_) return;
+        glEndQuery(GL_TIME_ELAPSED);
+        running_ = false;
+    }
+
+    bool GPUTimer::Collect(double& milliseconds, int& tag)
+    {
+        std::uint64_t count = 0;
+        return Collect(milliseconds, tag, count);
+    }
+
+    bool GPUTimer::Collect(double& milliseconds, int& tag, std::uint64_t& count)
+    {
+        if (numQueries_ == 0 || (running_ && numQueries_ == 1)) return false;
+        auto& query = queries_[oldestQuery_];
+        GLint available = GL_FALSE;
+        glGetQueryObjectiv(query.query_, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (available == GL_FALSE) return false;
+
+        GLuint64 nanoseconds = 0;
+        glGetQueryObjectui64v(query.query_, GL_QUERY_RESULT, &nanoseconds);
+        milliseconds = static_cast<double>(nanoseconds) / 1000000.0;
+        tag = query.tag_;
+        count = query.count_;
+        oldestQuery_ = (oldestQuery_ + 1) % NUM_QUERIES;
+        --numQueries_;
+        return true;
+    }
+}
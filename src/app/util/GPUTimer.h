@@ -0,0 +1,55 @@
+/**
+ * @file   GPUTimer.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of asynchronous GPU time measurements.
+ */
+
+#pragma once
+
+#include "core/main.h"
+#include <array>
+#include <cstdint>
+
+namespace viscom::util {
+
+    /**
+     *  Measures GPU time with GL_TIME_ELAPSED queries. Results are collected a few frames later so the GL thread does
+     *  not wait. Measurements must not be nested and are skipped if all queries are in flight.
+     */
+    class GPUTimer
+    {
+    public:
+        GPUTimer();
+        GPUTimer(const GPUTimer&) = delete;
+        GPUTimer& operator=(const GPUTimer&) = delete;
+        ~GPUTimer();
+
+        /** Starts a measurement, the tag and the count of measured work (e.g. iterations) are returned with the result. */
+        void Begin(int tag = 0, std::uint64_t count = 0);
+        void End();
+        /** Returns the oldest finished measurement in milliseconds. */
+        bool Collect(double& milliseconds, int& tag);
+        bool Collect(double& milliseconds, int& tag, std::uint64_t& count);
+
+    private:
+        struct Query {
+            GLuint query_ = 0;
+            int tag_ = 0;
+            std::uint64_t count_ = 0;
+        };
+
+        /** Number of queries in flight. */
+        static constexpr std::size_t NUM_QUERIES = 16;
+
+        /** Holds the queries, used round robin. */
+        std::array<Query, NUM_QUERIES> queries_;
+        /** Index of the oldest query in flight. */
+        std::size_t oldestQuery_ = 0;
+        /** Number of queries in flight (including a running one). */
+        std::size_t numQueries_ = 0;
+        /** A measurement is running. */
+        bool running_ = false;
+    };
+}
@@ -0,0 +1,187 @@
+/**
+ * @file   GPUTiming.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the GPU time measurements of the simulation, the shared passes and the views of a node.
+ */
+
+#include "GPUTiming.h"
+#include "GPUTimer.h"
+#include "AllocationCheck.h"
+#include "app/ApplicationNodeImplementation.h"
+#include "app/idle/IdleStatistics.h"
+#include "app/metrics/NodeMetrics.h"
+#include "app/sync/SustainableRate.h"
+#include "core/gfx/FrameBuffer.h"
+#include "core/open_gl.h"
+#include <string>
+
+namespace viscom::util {
+
+    GPUTiming::GPUTiming(ApplicationNodeImplementation* appNode) : NodeComponent{ appNode } {}
+
+    GPUTiming::~GPUTiming() = default;
+
+    void GPUTiming::Init()
+    {
+        simulationTimer_ = std::make_unique<GPUTimer>();
+        sharedPassTimer_ = std::make_unique<GPUTimer>();
+    }
+
+    void GPUTiming::UpdateFrame()
+    {
+        Collect();
+        Report();
+    }
+
+    void GPUTiming::CleanUp()
+    {
+        activeView_ = nullptr;
+        viewTimings_.clear();
+        sharedPassTimer_ = nullptr;
+        simulationTimer_ = nullptr;
+    }
+
+    int GPUTiming::GetFrameTag() const
+    {
+        return GetAppNode()->GetSimulationData().simulationIdle_ ? 1 : 0;
+    }
+
+    void GPUTiming::BeginSimulation(bool gpuSimulation, std::uint64_t iterations)
+    {
+        // the GPU time of the simulation also measures the rate this node can sustain (not for the CPU backend).
+        simulationTimer_->Begin(GetFrameTag(), gpuSimulation ? iterations : 0);
+    }
+
+    void GPUTiming::EndSimulation()
+    {
+        simulationTimer_->End();
+    }
+
+    void GPUTiming::BeginSharedPasses()
+    {
+        sharedPassTimer_->Begin(GetFrameTag());
+    }
+
+    void GPUTiming::EndSharedPasses()
+    {
+        sharedPassTimer_->End();
+        ++reportedSharedPasses_;
+    }
+
+    void GPUTiming::BeginView(FrameBuffer& fbo)
+    {
+        activeView_ = nullptr;
+        for (auto& view : viewTimings_) {
+            if (view.fbo_ == &fbo) activeView_ = &view;
+        }
+
+        if (!activeView_) {
+            GetAppNode()->GetAllocationCheck().AllowFrameAllocations();
+            activeView_ = &viewTimings_.emplace_back();
+            activeView_->fbo_ = &fbo;
+            activeView_->timer_ = std::make_unique<GPUTimer>();
+
+            // the frame buffers of the windows are created by the framework, they are tracked when first drawn to.
+            std::size_t textureBytes = 0, renderbufferBytes = 0;
+            fbo.DrawToFBO([&textureBytes, &renderbufferBytes]() {
+                GLint framebuffer = 0;
+                glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &framebuffer);
+                QueryFramebufferSize(static_cast<GLuint>(framebuffer), textureBytes, renderbufferBytes);
+            });
+            const auto viewName = "view " + std::to_string(viewTimings_.size() - 1);
+            if (textureBytes > 0) activeView_->memory_[0] = TrackedResource(ResourceType::Texture, "Window", viewName, textureBytes);
+            if (renderbufferBytes > 0) activeView_->memory_[1] = TrackedResource(ResourceType::Renderbuffer, "Window", viewName, renderbufferBytes);
+        }
+        activeView_->timer_->Begin(GetFrameTag());
+    }
+
+    void GPUTiming::EndView()
+    {
+        if (activeView_) activeView_->timer_->End();
+        activeView_ = nullptr;
+    }
+
+    void GPUTiming::AddSubmissionTime(std::uint64_t iterations, double microseconds)
+    {
+        reportedSubmissionTime_ += microseconds;
+        reportedSubmittedIterations_ += iterations;
+    }
+
+    void GPUTiming::ResetSubmissionTime()
+    {
+        reportedSubmissionTime_ = 0.0;
+        reportedSubmittedIterations_ = 0;
+    }
+
+    void GPUTiming::AddCPUSimulationTime(std::uint64_t iterations, double milliseconds)
+    {
+        reportedCPUIterations_ += iterations;
+        reportedCPUSimulationTime_ += milliseconds;
+    }
+
+    void GPUTiming::Collect()
+    {
+        auto appNode = GetAppNode();
+        auto& idleStatistics = appNode->GetIdleStatistics();
+        auto& nodeMetrics = appNode->GetNodeMetrics();
+        double milliseconds = 0.0;
+        int tag = 0;
+        std::uint64_t iterations = 0;
+        while (simulationTimer_->Collect(milliseconds, tag, iterations)) {
+            if (tag == 0 && iterations > 0) appNode->GetSustainableRate().AddSimulationTime(iterations, milliseconds);
+            idleStatistics.AddGPUTime(tag, milliseconds);
+            reportedSimulationTime_ += milliseconds;
+            nodeMetrics.ObserveGPUTime(metrics::GPUPass::Simulation, milliseconds);
+        }
+        while (sharedPassTimer_->Collect(milliseconds, tag)) {
+            idleStatistics.AddGPUTime(tag, milliseconds);
+            reportedSharedPassTime_ += milliseconds;
+            nodeMetrics.ObserveGPUTime(metrics::GPUPass::Shared, milliseconds);
+        }
+        for (auto& view : viewTimings_) {
+            while (view.timer_->Collect(milliseconds, tag)) {
+                idleStatistics.AddGPUTime(tag, milliseconds);
+                view.gpuTime_ += milliseconds;
+                ++view.draws_;
+                nodeMetrics.ObserveGPUTime(metrics::GPUPass::View, milliseconds);
+            }
+        }
+    }
+
+    void GPUTiming::Report()
+    {
+        const auto& settings = GetAppNode()->GetAppSettings();
+        if (settings.gpuTimingReport_ == 0 || ++timingFrames_ < settings.gpuTimingReport_) return;
+
+        const auto frames = static_cast<double>(timingFrames_);
+        LOG(INFO) << "GPU time per frame: simulation " << reportedSimulationTime_ / frames << "ms, shared passes " << reportedSharedPassTime_ / frames
+            << "ms (run in " << reportedSharedPasses_ << " of " << timingFrames_ << " frames).";
+        // the throughput of the fixed point and in-place simulations is compared to the float one with two runs of the same session.
+        const auto precision = settings.fixedPointSimulation_ ? "fixed point" : settings.inPlaceSimulation_ ? "float, in-place" : "float";
+        if (reportedSubmittedIterations_ > 0) {
+            const auto submission = settings.fixedPointSimulation_ ? "compute" : settings.inPlaceSimulation_ ? "compute, 4 dispatches"
+                : settings.batchedSimulationSubmission_ ? "batched" : "per iteration setup";
+            LOG(INFO) << "  simulation: " << 1000.0 * reportedSimulationTime_ / static_cast<double>(reportedSubmittedIterations_) << "us GPU time per iteration ("
+                << precision << "), submission " << reportedSubmissionTime_ / static_cast<double>(reportedSubmittedIterations_) << "us CPU time per iteration (" << submission << ").";
+        }
+        if (reportedCPUIterations_ > 0) {
+            LOG(INFO) << "  CPU simulation: " << 1000.0 * reportedCPUSimulationTime_ / static_cast<double>(reportedCPUIterations_) << "us per iteration (" << precision << ").";
+        }
+        for (std::size_t i = 0; i < viewTimings_.size(); ++i) {
+            auto& view = viewTimings_[i];
+            LOG(INFO) << "  window/eye " << i << ": " << view.gpuTime_ / frames << "ms per frame (" << view.draws_ << " draws).";
+            view.gpuTime_ = 0.0;
+            view.draws_ = 0;
+        }
+        GetAppNode()->ReportRenderGraphMemory();
+        reportedSimulationTime_ = 0.0;
+        reportedSharedPassTime_ = 0.0;
+        reportedSharedPasses_ = 0;
+        ResetSubmissionTime();
+        reportedCPUIterations_ = 0;
+        reportedCPUSimulationTime_ = 0.0;
+        timingFrames_ = 0;
+    }
+}
@@ -0,0 +1,97 @@
+/**
+ * @file   GPUTiming.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the GPU time measurements of the simulation, the shared passes and the views of a node.
+ */
+
+#pragma once
+
+#include "app/NodeComponent.h"
+#include "app/util/ResourceRegistry.h"
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace viscom {
+    class FrameBuffer;
+}
+
+namespace viscom::util {
+
+    class GPUTimer;
+
+    /**
+     *  Measures the GPU time of the simulation, of the view independent passes shared by all windows and eyes and of
+     *  each window and eye (tag 1 while the simulation is idle). The results feed the idle statistics, the sustainable
+     *  rate and the metrics and are reported every AppSettings::gpuTimingReport_ frames together with the submission
+     *  time and the time of the CPU backend.
+     */
+    class GPUTiming final : public NodeComponent
+    {
+    public:
+        explicit GPUTiming(ApplicationNodeImplementation* appNode);
+        ~GPUTiming() override;
+
+        void Init() override;
+        void UpdateFrame() override;
+        void CleanUp() override;
+
+        /** Measures the simulation of a frame, the GPU simulation also measures the sustainable rate with its iterations. */
+        void BeginSimulation(bool gpuSimulation, std::uint64_t iterations);
+        void EndSimulation();
+        /** Measures the passes shared by all windows and eyes. */
+        void BeginSharedPasses();
+        void EndSharedPasses();
+        /** Measures drawing the window and eye of this frame buffer (tracked when first drawn to). */
+        void BeginView(FrameBuffer& fbo);
+        void EndView();
+        /** Adds the CPU time in microseconds spent submitting GPU simulation iterations. */
+        void AddSubmissionTime(std::uint64_t iterations, double microseconds);
+        /** Drops the submission time measured so far (benchmark iterations of the autotuner). */
+        void ResetSubmissionTime();
+        /** Adds iterations and time in milliseconds of the CPU backend. */
+        void AddCPUSimulationTime(std::uint64_t iterations, double milliseconds);
+
+    private:
+        struct ViewTiming {
+            /** The frame buffer of the window and eye. */
+            const FrameBuffer* fbo_ = nullptr;
+            /** Measures drawing this view. */
+            std::unique_ptr<GPUTimer> timer_;
+            /** GPU time in milliseconds and number of draws since the last report. */
+            double gpuTime_ = 0.0;
+            std::uint64_t draws_ = 0;
+            /** Registers the textures and renderbuffers attached to the frame buffer. */
+            std::array<TrackedResource, 2> memory_;
+        };
+
+        /** Returns the tag of measurements of this frame (1 while the simulation is idle). */
+        int GetFrameTag() const;
+        void Collect();
+        void Report();
+
+        /** Measures the GPU time of the simulation. */
+        std::unique_ptr<GPUTimer> simulationTimer_;
+        /** Measures the GPU time of the view independent passes shared by all windows and eyes. */
+        std::unique_ptr<GPUTimer> sharedPassTimer_;
+        /** Holds the timing of each window and eye of this node. */
+        std::vector<ViewTiming> viewTimings_;
+        /** The view currently measured. */
+        ViewTiming* activeView_ = nullptr;
+        /** GPU time in milliseconds and number of runs of the simulation and the shared passes since the last report. */
+        double reportedSimulationTime_ = 0.0;
+        double reportedSharedPassTime_ = 0.0;
+        std::uint64_t reportedSharedPasses_ = 0;
+        /** CPU time in microseconds spent submitting GPU simulation iterations and their number since the last report. */
+        double reportedSubmissionTime_ = 0.0;
+        std::uint64_t reportedSubmittedIterations_ = 0;
+        /** Iterations and time in milliseconds of the CPU backend since the last report. */
+        std::uint64_t reportedCPUIterations_ = 0;
+        double reportedCPUSimulationTime_ = 0.0;
+        /** Number of frames since the last report. */
+        std::uint64_t timingFrames_ = 0;
+    };
+}
@@ -0,0 +1,66 @@
+/**
+ * @file   InputLatencyTracker.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the input to photon latency measurement.
+ */
+
+#include "InputLatencyTracker.h"
+#include "FrameTrace.h"
+#include "core/open_gl.h"
+#include <algorithm>
+
+namespace viscom::util {
+
+    InputLatencyTracker::~InputLatencyTracker()
+    {
+        for (auto& frame : framesInFlight_) glDeleteSync(frame.second);
+    }
+
+    void InputLatencyTracker::InputReceived(std::uint64_t iteration, std::int64_t inputTime)
+    {
+        if (iteration <= lastInputIteration_) return;
+        lastInputIteration_ = iteration;
+        pendingInputs_.emplace_back(iteration, inputTime);
+    }
+
+    void InputLatencyTracker::FrameDrawn(std::uint64_t iterationCount)
+    {
+        // only frames that show a pending input for the first time need a fence.
+        if (iterationCount <= lastDrawnIterationCount_) return;
+        lastDrawnIterationCount_ = iterationCount;
+        if (pendingInputs_.empty() || pendingInputs_.front().first >= iterationCount) return;
+        framesInFlight_.emplace_back(iterationCount, glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+    }
+
+    void InputLatencyTracker::Update()
+    {
+        while (!framesInFlight_.empty()) {
+            auto status = glClientWaitSync(framesInFlight_.front().second, 0, 0);
+            if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) break;
+
+            const auto now = GetTraceTime();
+            const auto iterationCount = framesInFlight_.front().first;
+            glDeleteSync(framesInFlight_.front().second);
+            framesInFlight_.pop_front();
+
+            // an input applied in iteration i is visible once i + 1 iterations are done.
+            while (!pendingInputs_.empty() && pendingInputs_.front().first < iterationCount) {
+                const auto latency = 1e-6 * static_cast<double>(now - pendingInputs_.front().second);
+                pendingInputs_.pop_front();
+                latencySum_ += latency;
+                latencyMax_ = std::max(latencyMax_, latency);
+                ++numSamples_;
+            }
+        }
+
+        if (numSamples_ >= LOG_INTERVAL) {
+            LOG(INFO) << "Input to photon latency (" << mode_ << "): " << latencySum_ / static_cast<double>(numSamples_) << "ms average, "
+                << latencyMax_ << "ms maximum over " << numSamples_ << " inputs.";
+            latencySum_ = 0.0;
+            latencyMax_ = 0.0;
+            numSamples_ = 0;
+        }
+    }
+}
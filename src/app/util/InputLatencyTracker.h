@@ -0,0 +1,59 @@
+/**
+ * @file   InputLatencyTracker.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the input to photon latency measurement.
+ */
+
+#pragma once
+
+#include "core/main.h"
+#include "RingBuffer.h"
+
+namespace viscom::util {
+
+    /**
+     *  Measures the time from the input on the master until the GPU of this node finished drawing the first frame that
+     *  shows the seed point placed by it. The input time is carried from the master with the seed, slaves convert it
+     *  with the trace clock offset, so the sync and the frames waited for the seed are part of the latency. Display
+     *  scan out is not included, so the latency on screen is higher by up to one refresh interval.
+     */
+    class InputLatencyTracker
+    {
+    public:
+        explicit InputLatencyTracker(const std::string& mode) : mode_{ mode } {}
+        InputLatencyTracker(const InputLatencyTracker&) = delete;
+        InputLatencyTracker& operator=(const InputLatencyTracker&) = delete;
+        ~InputLatencyTracker();
+
+        /** A seed applied in the given iteration was received, inputTime is the time of its input on the trace clock of this node. */
+        void InputReceived(std::uint64_t iteration, std::int64_t inputTime);
+        /** A frame showing the given number of iterations was drawn (call after drawing). */
+        void FrameDrawn(std::uint64_t iterationCount);
+        /** Checks for finished frames and logs the statistics from time to time (call once per frame). */
+        void Update();
+
+    private:
+        /** Number of samples between two log messages. */
+        static constexpr std::size_t LOG_INTERVAL = 20;
+
+        /** Holds the mode name used in the log. */
+        std::string mode_;
+        /** Inputs not displayed yet (iteration, input time on the trace clock). */
+        RingBuffer<std::pair<std::uint64_t, std::int64_t>> pendingInputs_;
+        /** Frames drawn but not finished on the GPU (iteration count, fence). */
+        RingBuffer<std::pair<std::uint64_t, GLsync>> framesInFlight_;
+        /** Iteration of the newest input received. */
+        std::uint64_t lastInputIteration_ = 0;
+        /** Iteration count of the newest frame drawn. */
+        std::uint64_t lastDrawnIterationCount_ = 0;
+
+        /** Sum of all latencies since the last log message in milliseconds. */
+        double latencySum_ = 0.0;
+        /** Maximum latency since the last log message in milliseconds. */
+        double latencyMax_ = 0.0;
+        /** Number of samples since the last log message. */
+        std::size_t numSamples_ = 0;
+    };
+}
@@ -0,0 +1,102 @@
+/**
+ * @file   MappedFile.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of a read only memory mapped file.
+ */
+
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace viscom::util {
+
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+#ifdef _WIN32
+    bool MappedFile::Open(const std::string& filename)
+    {
+        Close();
+        auto file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return false;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+            CloseHandle(file);
+            return false;
+        }
+
+        auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr) {
+            CloseHandle(file);
+            return false;
+        }
+
+        auto data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (data == nullptr) {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+
+        fileHandle_ = file;
+        mappingHandle_ = mapping;
+        data_ = data;
+        size_ = static_cast<std::size_t>(fileSize.QuadPart);
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (data_ != nullptr) UnmapViewOfFile(data_);
+        if (mappingHandle_ != nullptr) CloseHandle(mappingHandle_);
+        if (fileHandle_ != nullptr) CloseHandle(fileHandle_);
+        data_ = nullptr;
+        mappingHandle_ = nullptr;
+        fileHandle_ = nullptr;
+        size_ = 0;
+    }
+#else
+    bool MappedFile::Open(const std::string& filename)
+    {
+        Close();
+        auto fd = open(filename.c_str(), O_RDONLY);
+        if (fd == -1) return false;
+
+        struct stat fileStat;
+        if (fstat(fd, &fileStat) == -1 || fileStat.st_size == 0) {
+            close(fd);
+            return false;
+        }
+
+        const auto size = static_cast<std::size_t>(fileStat.st_size);
+        auto data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (data == MAP_FAILED) return false;
+
+        data_ = data;
+        size_ = size;
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (data_ != nullptr) munmap(const_cast<void*>(data_), size_);
+        data_ = nullptr;
+        size_ = 0;
+    }
+#endif
+}
@@ -0,0 +1,45 @@
+/**
+ * @file   MappedFile.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of a read only memory mapped file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace viscom::util {
+
+    /** A file mapped read only into memory. */
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        explicit MappedFile(const std::string& filename) { Open(filename); }
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        ~MappedFile();
+
+        bool Open(const std::string& filename);
+        void Close();
+
+        bool IsValid() const { return data_ != nullptr; }
+        const void* GetData() const { return data_; }
+        std::size_t GetSize() const { return size_; }
+
+    private:
+        /** Holds the mapped memory. */
+        const void* data_ = nullptr;
+        /** Holds the size of the file. */
+        std::size_t size_ = 0;
+#ifdef _WIN32
+        /** Holds the file handle. */
+        void* fileHandle_ = nullptr;
+        /** Holds the file mapping handle. */
+        void* mappingHandle_ = nullptr;
+#endif
+    };
+}
@@ -0,0 +1,89 @@
+/**
+ * @file   MemoryMonitor.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the monitoring of the tracked GPU and host memory against its budgets.
+ */
+
+#include "MemoryMonitor.h"
+#include "AllocationCheck.h"
+#include "app/ApplicationNodeImplementation.h"
+#include <imgui.h>
+#include <algorithm>
+
+namespace viscom::util {
+
+    namespace {
+        double ToMB(std::size_t bytes) { return static_cast<double>(bytes) / (1024.0 * 1024.0); }
+    }
+
+    void MemoryMonitor::UpdateFrame()
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (now - checkIntervalStart_ < CHECK_INTERVAL) return;
+        checkIntervalStart_ = now;
+        CheckBudgets(GetResourceTotals());
+    }
+
+    void MemoryMonitor::CleanUp()
+    {
+        Report();
+    }
+
+    void MemoryMonitor::CheckBudgets(const ResourceTotals& totals)
+    {
+        static const std::array<const char*, 2> MEMORY_NAMES = { { "GPU", "Host" } };
+        const auto& settings = GetAppNode()->GetAppSettings();
+        const std::array<std::size_t, 2> used = { { totals.GetGPUBytes(), totals.GetHostBytes() } };
+        const std::array<unsigned int, 2> budgets = { { settings.gpuMemoryBudget_, settings.hostMemoryBudget_ } };
+        for (std::size_t i = 0; i < used.size(); ++i) {
+            peakMemory_[i] = std::max(peakMemory_[i], used[i]);
+            const auto exceeded = budgets[i] > 0 && used[i] > static_cast<std::size_t>(budgets[i]) * 1024 * 1024;
+            if (exceeded && !budgetExceeded_[i]) {
+                GetAppNode()->GetAllocationCheck().AllowFrameAllocations();
+                LOG(WARNING) << MEMORY_NAMES[i] << " memory of " << ToMB(used[i]) << "MB exceeds the budget of " << budgets[i] << "MB.";
+                Report();
+            }
+            budgetExceeded_[i] = exceeded;
+        }
+    }
+
+    void MemoryMonitor::Report() const
+    {
+        const auto totals = GetResourceTotals();
+        std::vector<ResourceEntry> resources;
+        GetTrackedResources(resources);
+
+        // only the resources the app creates are tracked, the driver and the framework (fonts, meshes) need more.
+        LOG(INFO) << "Memory: GPU " << ToMB(totals.GetGPUBytes()) << "MB (peak " << ToMB(peakMemory_[0]) << "MB), host " << ToMB(totals.GetHostBytes())
+            << "MB (peak " << ToMB(peakMemory_[1]) << "MB) in " << resources.size() << " resources.";
+        for (std::size_t i = 0; i < NUM_RESOURCE_TYPES; ++i) {
+            if (totals.count_[i] == 0) continue;
+            LOG(INFO) << "  " << GetResourceTypeName(static_cast<ResourceType>(i)) << ": " << ToMB(totals.bytes_[i]) << "MB in " << totals.count_[i] << " resources.";
+        }
+        for (std::size_t i = 0; i < std::min(resources.size(), REPORT_RESOURCES); ++i) {
+            LOG(INFO) << "  " << resources[i].owner_ << " '" << resources[i].name_ << "' (" << GetResourceTypeName(resources[i].type_) << "): "
+                << ToMB(resources[i].bytes_) << "MB.";
+        }
+    }
+
+    void MemoryMonitor::DrawGUI()
+    {
+        const auto& settings = GetAppNode()->GetAppSettings();
+        const auto totals = GetResourceTotals();
+        if (settings.gpuMemoryBudget_ > 0) ImGui::Text("GPU: %.1f of %u MB", ToMB(totals.GetGPUBytes()), settings.gpuMemoryBudget_);
+        else ImGui::Text("GPU: %.1f MB", ToMB(totals.GetGPUBytes()));
+        if (settings.hostMemoryBudget_ > 0) ImGui::Text("Host: %.1f of %u MB", ToMB(totals.GetHostBytes()), settings.hostMemoryBudget_);
+        else ImGui::Text("Host: %.1f MB", ToMB(totals.GetHostBytes()));
+        if (ImGui::TreeNode("Resources")) {
+            // the entries copy the names, they are only gathered while the list is open.
+            GetAppNode()->GetAllocationCheck().AllowFrameAllocations();
+            GetTrackedResources(guiResources_);
+            for (const auto& resource : guiResources_) {
+                ImGui::Text("%8.2f MB  %s %s (%s)", ToMB(resource.bytes_), resource.owner_.c_str(), resource.name_.c_str(), GetResourceTypeName(resource.type_));
+            }
+            ImGui::TreePop();
+        }
+    }
+}
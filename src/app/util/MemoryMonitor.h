@@ -0,0 +1,52 @@
+/**
+ * @file   MemoryMonitor.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the monitoring of the tracked GPU and host memory against its budgets.
+ */
+
+#pragma once
+
+#include "app/NodeComponent.h"
+#include "ResourceRegistry.h"
+#include <array>
+#include <chrono>
+
+namespace viscom::util {
+
+    /**
+     *  Watches the memory of the resource registry: warns once when the GPU or host memory exceeds its budget
+     *  (AppSettings::gpuMemoryBudget_, hostMemoryBudget_), logs the largest resources and lists them in the GUI.
+     */
+    class MemoryMonitor final : public NodeComponent
+    {
+    public:
+        explicit MemoryMonitor(ApplicationNodeImplementation* appNode) : NodeComponent{ appNode } {}
+
+        void UpdateFrame() override;
+        void CleanUp() override;
+
+        /** Logs the memory per resource type and the largest resources. */
+        void Report() const;
+        /** Shows the GPU and host memory and the largest resources (inside an ImGui window). */
+        void DrawGUI();
+
+    private:
+        /** Warns once when the GPU or host memory exceeds its budget (until it is met again). */
+        void CheckBudgets(const ResourceTotals& totals);
+
+        /** Holds the resources listed in the GUI (gathered while the list is open). */
+        std::vector<ResourceEntry> guiResources_;
+        /** Highest GPU and host memory in bytes (checked once per interval). */
+        std::array<std::size_t, 2> peakMemory_ = { { 0, 0 } };
+        /** The GPU and host memory budget is exceeded. */
+        std::array<bool, 2> budgetExceeded_ = { { false, false } };
+        /** Start of the current check interval. */
+        std::chrono::steady_clock::time_point checkIntervalStart_ = std::chrono::steady_clock::now();
+        /** Interval of the budget checks. */
+        static constexpr std::chrono::seconds CHECK_INTERVAL{ 1 };
+        /** Number of resources listed in the memory report. */
+        static constexpr std::size_t REPORT_RESOURCES = 10;
+    };
+}
@@ -0,0 +1,193 @@
+/**
+ * @file   ResourceRegistry.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the accounting of GPU and host memory per resource.
+ */
+
+#include "ResourceRegistry.h"
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+namespace viscom::util {
+
+    namespace {
+        /** Protects the registry, resources are created on the GL thread and on workers. */
+        std::mutex registryMutex;
+        std::unordered_map<std::uint64_t, ResourceEntry> registry;
+        ResourceTotals registryTotals;
+        std::uint64_t nextResourceId = 1;
+
+        std::size_t TypeIndex(ResourceType type) { return static_cast<std::size_t>(type); }
+    }
+
+    std::size_t ResourceTotals::GetGPUBytes() const
+    {
+        return bytes_[TypeIndex(ResourceType::Texture)] + bytes_[TypeIndex(ResourceType::Renderbuffer)] + bytes_[TypeIndex(ResourceType::Buffer)];
+    }
+
+    TrackedResource::TrackedResource(ResourceType type, std::string owner, std::string name, std::size_t bytes)
+    {
+        std::lock_guard<std::mutex> lock{ registryMutex };
+        id_ = nextResourceId++;
+        registry.emplace(id_, ResourceEntry{ type, std::move(owner), std::move(name), bytes });
+        registryTotals.bytes_[TypeIndex(type)] += bytes;
+        ++registryTotals.count_[TypeIndex(type)];
+    }
+
+    TrackedResource::TrackedResource(TrackedResource&& rhs) noexcept :
+        id_{ rhs.id_ }
+    {
+        rhs.id_ = 0;
+    }
+
+    TrackedResource& TrackedResource::operator=(TrackedResource&& rhs) noexcept
+    {
+        if (this != &rhs) {
+            Unregister();
+            id_ = rhs.id_;
+            rhs.id_ = 0;
+        }
+        return *this;
+    }
+
+    TrackedResource::~TrackedResource()
+    {
+        Unregister();
+    }
+
+    void TrackedResource::SetSize(std::size_t bytes)
+    {
+        if (id_ == 0) return;
+        std::lock_guard<std::mutex> lock{ registryMutex };
+        auto& entry = registry.at(id_);
+        auto& total = registryTotals.bytes_[TypeIndex(entry.type_)];
+        total = total - entry.bytes_ + bytes;
+        entry.bytes_ = bytes;
+    }
+
+    void TrackedResource::Unregister()
+    {
+        if (id_ == 0) return;
+        std::lock_guard<std::mutex> lock{ registryMutex };
+        auto entry = registry.find(id_);
+        registryTotals.bytes_[TypeIndex(entry->second.type_)] -= entry->second.bytes_;
+        --registryTotals.count_[TypeIndex(entry->second.type_)];
+        registry.erase(entry);
+        id_ = 0;
+    }
+
+    ResourceTotals GetResourceTotals()
+    {
+        std::lock_guard<std::mutex> lock{ registryMutex };
+        return registryTotals;
+    }
+
+    void GetTrackedResources(std::vector<ResourceEntry>& resources)
+    {
+        {
+            std::lock_guard<std::mutex> lock{ registryMutex };
+            resources.clear();
+            for (const auto& entry : registry) resources.push_back(entry.second);
+        }
+        std::sort(resources.begin(), resources.end(), [](const ResourceEntry& a, const ResourceEntry& b) { return a.bytes_ > b.bytes_; });
+    }
+
+    const char* GetResourceTypeName(ResourceType type)
+    {
+        switch (type) {
+        case ResourceType::Texture: return "texture";
+        case ResourceType::Renderbuffer: return "renderbuffer";
+        case ResourceType::Buffer: return "buffer";
+        case ResourceType::Host: return "host";
+        }
+        return "unknown";
+    }
+
+    std::size_t QueryTextureSize(GLuint texture)
+    {
+        if (texture == 0) return 0;
+        GLint target = GL_TEXTURE_2D;
+        glGetTextureParameteriv(texture, GL_TEXTURE_TARGET, &target);
+        const std::size_t faces = target == GL_TEXTURE_CUBE_MAP ? 6 : 1;
+
+        // the component sizes include the shared exponent of RGB9_E5, compressed levels report their size directly.
+        static const GLenum COMPONENT_SIZES[] = { GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE,
+            GL_TEXTURE_DEPTH_SIZE, GL_TEXTURE_STENCIL_SIZE, GL_TEXTURE_SHARED_SIZE };
+        std::size_t bytes = 0;
+        for (GLint level = 0; level < 32; ++level) {
+            GLint width = 0, height = 0, depth = 0, compressed = GL_FALSE;
+            glGetTextureLevelParameteriv(texture, level, GL_TEXTURE_WIDTH, &width);
+            if (width == 0) break;
+            glGetTextureLevelParameteriv(texture, level, GL_TEXTURE_HEIGHT, &height);
+            glGetTextureLevelParameteriv(texture, level, GL_TEXTURE_DEPTH, &depth);
+            glGetTextureLevelParameteriv(texture, level, GL_TEXTURE_COMPRESSED, &compressed);
+            if (compressed == GL_TRUE) {
+                GLint levelSize = 0;
+                glGetTextureLevelParameteriv(texture, level, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &levelSize);
+                bytes += faces * static_cast<std::size_t>(levelSize);
+                continue;
+            }
+            std::size_t bits = 0;
+            for (auto component : COMPONENT_SIZES) {
+                GLint componentBits = 0;
+                glGetTextureLevelParameteriv(texture, level, component, &componentBits);
+                bits += static_cast<std::size_t>(componentBits);
+            }
+            bytes += faces * static_cast<std::size_t>(width) * static_cast<std::size_t>(std::max(height, 1)) * static_cast<std::size_t>(std::max(depth, 1)) * bits / 8;
+        }
+        return bytes;
+    }
+
+    std::size_t QueryRenderbufferSize(GLuint renderbuffer)
+    {
+        if (renderbuffer == 0) return 0;
+        static const GLenum COMPONENT_SIZES[] = { GL_RENDERBUFFER_RED_SIZE, GL_RENDERBUFFER_GREEN_SIZE, GL_RENDERBUFFER_BLUE_SIZE,
+            GL_RENDERBUFFER_ALPHA_SIZE, GL_RENDERBUFFER_DEPTH_SIZE, GL_RENDERBUFFER_STENCIL_SIZE };
+        GLint width = 0, height = 0, samples = 0;
+        glGetNamedRenderbufferParameteriv(renderbuffer, GL_RENDERBUFFER_WIDTH, &width);
+        glGetNamedRenderbufferParameteriv(renderbuffer, GL_RENDERBUFFER_HEIGHT, &height);
+        glGetNamedRenderbufferParameteriv(renderbuffer, GL_RENDERBUFFER_SAMPLES, &samples);
+        std::size_t bits = 0;
+        for (auto component : COMPONENT_SIZES) {
+            GLint componentBits = 0;
+            glGetNamedRenderbufferParameteriv(renderbuffer, component, &componentBits);
+            bits += static_cast<std::size_t>(componentBits);
+        }
+        return static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * static_cast<std::size_t>(std::max(samples, 1)) * bits / 8;
+    }
+
+    std::size_t QueryBufferSize(GLuint buffer)
+    {
+        if (buffer == 0) return 0;
+        GLint64 size = 0;
+        glGetNamedBufferParameteri64v(buffer, GL_BUFFER_SIZE, &size);
+        return static_cast<std::size_t>(size);
+    }
+
+    void QueryFramebufferSize(GLuint framebuffer, std::size_t& textureBytes, std::size_t& renderbufferBytes)
+    {
+        textureBytes = renderbufferBytes = 0;
+        if (framebuffer == 0) return;
+        GLint maxColorAttachments = 8;
+        glGetIntegerv(GL_MAX_COLOR_ATTACHMENTS, &maxColorAttachments);
+        std::vector<GLenum> attachments{ GL_DEPTH_ATTACHMENT, GL_STENCIL_ATTACHMENT };
+        for (GLint i = 0; i < maxColorAttachments; ++i) attachments.push_back(GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(i));
+
+        // a depth stencil attachment is reported for both, it is counted once.
+        std::vector<GLuint> countedTextures, countedRenderbuffers;
+        for (auto attachment : attachments) {
+            GLint type = GL_NONE, name = 0;
+            glGetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &type);
+            if (type == GL_NONE) continue;
+            glGetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME, &name);
+            auto& counted = type == GL_TEXTURE ? countedTextures : countedRenderbuffers;
+            if (std::find(counted.begin(), counted.end(), static_cast<GLuint>(name)) != counted.end()) continue;
+            counted.push_back(static_cast<GLuint>(name));
+            if (type == GL_TEXTURE) textureBytes += QueryTextureSize(static_cast<GLuint>(name));
+            else renderbufferBytes += QueryRenderbufferSize(static_cast<GLuint>(name));
+        }
+    }
+}
@@ -0,0 +1,85 @@
+/**
+ * @file   ResourceRegistry.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the accounting of GPU and host memory per resource.
+ */
+
+#pragma once
+
+#include "core/open_gl.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace viscom::util {
+
+    /** Kind of memory a tracked resource occupies. */
+    enum class ResourceType { Texture, Renderbuffer, Buffer, Host };
+    /** Number of resource types. */
+    constexpr std::size_t NUM_RESOURCE_TYPES = 4;
+
+    /** A resource in the registry. */
+    struct ResourceEntry {
+        ResourceType type_ = ResourceType::Host;
+        /** The class owning the resource. */
+        std::string owner_;
+        std::string name_;
+        std::size_t bytes_ = 0;
+    };
+
+    /** Bytes and number of the tracked resources per type. */
+    struct ResourceTotals {
+        std::array<std::size_t, NUM_RESOURCE_TYPES> bytes_ = { {} };
+        std::array<std::size_t, NUM_RESOURCE_TYPES> count_ = { {} };
+
+        /** Bytes of textures, renderbuffers and buffers. */
+        std::size_t GetGPUBytes() const;
+        std::size_t GetHostBytes() const { return bytes_[static_cast<std::size_t>(ResourceType::Host)]; }
+    };
+
+    /**
+     *  Keeps a resource in the process wide registry while it exists. Owners hold one next to each GL object or large
+     *  host buffer and update the size when it changes, the registry sums them up for the GUI, the log and the memory
+     *  budgets (see AppSettings::gpuMemoryBudget_). Only registering allocates, so it is done where the resource is
+     *  created and never in the frame loop.
+     */
+    class TrackedResource
+    {
+    public:
+        TrackedResource() = default;
+        TrackedResource(ResourceType type, std::string owner, std::string name, std::size_t bytes = 0);
+        TrackedResource(const TrackedResource&) = delete;
+        TrackedResource& operator=(const TrackedResource&) = delete;
+        TrackedResource(TrackedResource&& rhs) noexcept;
+        TrackedResource& operator=(TrackedResource&& rhs) noexcept;
+        ~TrackedResource();
+
+        /** Sets the size in bytes (does not allocate). */
+        void SetSize(std::size_t bytes);
+        bool IsRegistered() const { return id_ != 0; }
+
+    private:
+        void Unregister();
+
+        /** Key of the resource in the registry (0 if not registered). */
+        std::uint64_t id_ = 0;
+    };
+
+    /** Returns the totals of all tracked resources. */
+    ResourceTotals GetResourceTotals();
+    /** Copies all tracked resources, largest first. */
+    void GetTrackedResources(std::vector<ResourceEntry>& resources);
+    const char* GetResourceTypeName(ResourceType type);
+
+    /** Size of all levels and layers of a texture as reported by the driver. */
+    std::size_t QueryTextureSize(GLuint texture);
+    /** Size of a renderbuffer including its samples as reported by the driver. */
+    std::size_t QueryRenderbufferSize(GLuint renderbuffer);
+    std::size_t QueryBufferSize(GLuint buffer);
+    /** Sizes of the textures and renderbuffers attached to a frame buffer object (nothing for the default frame buffer). */
+    void QueryFramebufferSize(GLuint framebuffer, std::size_t& textureBytes, std::size_t& renderbufferBytes);
+}
@@ -0,0 +1,125 @@
+/**
+ * @file   RingBuffer.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration and implementation of a growable ring buffer.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace viscom::util {
+
+    /**
+     *  FIFO with contiguous storage. Elements are appended at the back and dropped at the front without moving the
+     *  others, the storage only grows (doubling) when it is full, so a queue of bounded size does not allocate.
+     */
+    template<typename T>
+    class RingBuffer
+    {
+    public:
+        template<typename Buffer, typename Value>
+        class Iterator
+        {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Value*;
+            using reference = Value&;
+
+            Iterator(Buffer* buffer, std::size_t index) : buffer_{ buffer }, index_{ index } {}
+
+            reference operator*() const { return (*buffer_)[index_]; }
+            pointer operator->() const { return &(*buffer_)[index_]; }
+            Iterator& operator++() { ++index_; return *this; }
+            Iterator operator++(int) { auto result = *this; ++index_; return result; }
+            Iterator& operator--() { --index_; return *this; }
+            Iterator& operator+=(difference_type n) { index_ = static_cast<std::size_t>(static_cast<difference_type>(index_) + n); return *this; }
+            Iterator operator+(difference_type n) const { auto result = *this; return result += n; }
+            difference_type operator-(const Iterator& rhs) const { return static_cast<difference_type>(index_) - static_cast<difference_type>(rhs.index_); }
+            bool operator==(const Iterator& rhs) const { return index_ == rhs.index_; }
+            bool operator!=(const Iterator& rhs) const { return index_ != rhs.index_; }
+            bool operator<(const Iterator& rhs) const { return index_ < rhs.index_; }
+
+        private:
+            Buffer* buffer_;
+            std::size_t index_;
+        };
+
+        using iterator = Iterator<RingBuffer, T>;
+        using const_iterator = Iterator<const RingBuffer, const T>;
+
+        explicit RingBuffer(std::size_t capacity = 64) : storage_(RoundUpCapacity(capacity)) {}
+
+        std::size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+        std::size_t capacity() const { return storage_.size(); }
+
+        T& operator[](std::size_t index) { return storage_[(head_ + index) & (storage_.size() - 1)]; }
+        const T& operator[](std::size_t index) const { return storage_[(head_ + index) & (storage_.size() - 1)]; }
+        T& front() { return (*this)[0]; }
+        const T& front() const { return (*this)[0]; }
+        T& back() { return (*this)[size_ - 1]; }
+        const T& back() const { return (*this)[size_ - 1]; }
+
+        iterator begin() { return iterator{ this, 0 }; }
+        iterator end() { return iterator{ this, size_ }; }
+        const_iterator begin() const { return const_iterator{ this, 0 }; }
+        const_iterator end() const { return const_iterator{ this, size_ }; }
+
+        void push_back(const T& value)
+        {
+            if (size_ == storage_.size()) Grow();
+            storage_[(head_ + size_++) & (storage_.size() - 1)] = value;
+        }
+
+        template<typename... Args> T& emplace_back(Args&&... args)
+        {
+            if (size_ == storage_.size()) Grow();
+            auto& element = storage_[(head_ + size_++) & (storage_.size() - 1)];
+            element = T(std::forward<Args>(args)...);
+            return element;
+        }
+
+        void pop_front()
+        {
+            head_ = (head_ + 1) & (storage_.size() - 1);
+            --size_;
+        }
+
+        void clear()
+        {
+            head_ = 0;
+            size_ = 0;
+        }
+
+    private:
+        static std::size_t RoundUpCapacity(std::size_t capacity)
+        {
+            std::size_t result = 1;
+            while (result < capacity) result <<= 1;
+            return result;
+        }
+
+        void Grow()
+        {
+            std::vector<T> storage(2 * storage_.size());
+            for (std::size_t i = 0; i < size_; ++i) storage[i] = std::move((*this)[i]);
+            storage_ = std::move(storage);
+            head_ = 0;
+        }
+
+        /** Holds the elements, the size is a power of two. */
+        std::vector<T> storage_;
+        /** Index of the first element in the storage. */
+        std::size_t head_ = 0;
+        /** Number of elements. */
+        std::size_t size_ = 0;
+    };
+}
@@ -0,0 +1,179 @@
+/**
+ * @file   Socket.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the helpers shared by the socket based transports.
+ */
+
+#include "Socket.h"
+#include <cerrno>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/time.h>
+#endif
+
+namespace viscom::util {
+
+    void StartSockets()
+    {
+#ifdef _WIN32
+        WSADATA wsaData;
+        WSAStartup(MAKEWORD(2, 2), &wsaData);
+#endif
+    }
+
+    void StopSockets()
+    {
+#ifdef _WIN32
+        WSACleanup();
+#endif
+    }
+
+    namespace {
+        void SetNoSigPipe(socket_t s)
+        {
+#ifdef SO_NOSIGPIPE
+            int noSigPipe = 1;
+            setsockopt(s, SOL_SOCKET, SO_NOSIGPIPE, reinterpret_cast<const char*>(&noSigPipe), sizeof(noSigPipe));
+#else
+            static_cast<void>(s);
+#endif
+        }
+    }
+
+    socket_t CreateSocket(int type, int protocol)
+    {
+        auto s = socket(AF_INET, type, protocol);
+        if (s != VISCOM_INVALID_SOCKET) SetNoSigPipe(s);
+        return s;
+    }
+
+    socket_t AcceptSocket(socket_t listenSocket)
+    {
+        auto s = accept(listenSocket, nullptr, nullptr);
+        if (s != VISCOM_INVALID_SOCKET) SetNoSigPipe(s);
+        return s;
+    }
+
+    void CloseSocket(std::intptr_t& s)
+    {
+        if (s != -1) VISCOM_CLOSE_SOCKET(ToSocket(s));
+        s = -1;
+    }
+
+    socket_t ListenTCP(const std::string& address, unsigned short port)
+    {
+        sockaddr_in bindAddress{};
+        bindAddress.sin_family = AF_INET;
+        bindAddress.sin_port = htons(port);
+        if (address.empty()) bindAddress.sin_addr.s_addr = htonl(INADDR_ANY);
+        else if (inet_pton(AF_INET, address.c_str(), &bindAddress.sin_addr) != 1) return VISCOM_INVALID_SOCKET;
+
+        auto s = CreateSocket(SOCK_STREAM, IPPROTO_TCP);
+        if (s == VISCOM_INVALID_SOCKET) return s;
+        int reuse = 1;
+        setsockopt(s, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&reuse), sizeof(reuse));
+        if (bind(s, reinterpret_cast<sockaddr*>(&bindAddress), sizeof(bindAddress)) != 0 || listen(s, 4) != 0) {
+            VISCOM_CLOSE_SOCKET(s);
+            return VISCOM_INVALID_SOCKET;
+        }
+        return s;
+    }
+
+    socket_t ConnectTCP(const std::string& address, unsigned short port, std::chrono::steady_clock::time_point deadline)
+    {
+        addrinfo hints{};
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+        addrinfo* result = nullptr;
+        if (getaddrinfo(address.c_str(), std::to_string(port).c_str(), &hints, &result) != 0 || result == nullptr) return VISCOM_INVALID_SOCKET;
+
+        socket_t s = VISCOM_INVALID_SOCKET;
+        do {
+            s = CreateSocket(SOCK_STREAM, IPPROTO_TCP);
+            if (s != VISCOM_INVALID_SOCKET && connect(s, result->ai_addr, static_cast<socklen_t>(result->ai_addrlen)) == 0) break;
+            if (s != VISCOM_INVALID_SOCKET) VISCOM_CLOSE_SOCKET(s);
+            s = VISCOM_INVALID_SOCKET;
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        } while (std::chrono::steady_clock::now() < deadline);
+        freeaddrinfo(result);
+        return s;
+    }
+
+    void SetNonBlocking(socket_t s)
+    {
+#ifdef _WIN32
+        u_long mode = 1;
+        ioctlsocket(s, FIONBIO, &mode);
+#else
+        fcntl(s, F_SETFL, fcntl(s, F_GETFL, 0) | O_NONBLOCK);
+#endif
+    }
+
+    void SetNoDelay(socket_t s)
+    {
+        int noDelay = 1;
+        setsockopt(s, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&noDelay), sizeof(noDelay));
+    }
+
+    void SetTimeouts(socket_t s, int receiveMilliseconds, int sendMilliseconds)
+    {
+        auto setTimeout = [s](int option, int milliseconds) {
+            if (milliseconds <= 0) return;
+#ifdef _WIN32
+            DWORD timeout = static_cast<DWORD>(milliseconds);
+#else
+            timeval timeout{ milliseconds / 1000, (milliseconds % 1000) * 1000 };
+#endif
+            setsockopt(s, SOL_SOCKET, option, reinterpret_cast<const char*>(&timeout), sizeof(timeout));
+        };
+        setTimeout(SO_RCVTIMEO, receiveMilliseconds);
+        setTimeout(SO_SNDTIMEO, sendMilliseconds);
+    }
+
+    bool WouldBlock()
+    {
+#ifdef _WIN32
+        return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+        return errno == EAGAIN || errno == EWOULDBLOCK;
+#endif
+    }
+
+    long long SendSome(socket_t s, const void* data, std::size_t size)
+    {
+        return static_cast<long long>(send(s, static_cast<const char*>(data), static_cast<int>(size), VISCOM_SEND_FLAGS));
+    }
+
+    long long ReceiveSome(socket_t s, void* data, std::size_t size)
+    {
+        return static_cast<long long>(recv(s, static_cast<char*>(data), static_cast<int>(size), 0));
+    }
+
+    bool SendAll(socket_t s, const void* data, std::size_t size)
+    {
+        auto bytes = static_cast<const char*>(data);
+        while (size > 0) {
+            auto sent = SendSome(s, bytes, size);
+            if (sent <= 0) return false;
+            bytes += sent;
+            size -= static_cast<std::size_t>(sent);
+        }
+        return true;
+    }
+
+    bool ReceiveAll(socket_t s, void* data, std::size_t size)
+    {
+        auto bytes = static_cast<char*>(data);
+        while (size > 0) {
+            auto received = ReceiveSome(s, bytes, size);
+            if (received <= 0) return false;
+            bytes += received;
+            size -= static_cast<std::size_t>(received);
+        }
+        return true;
+    }
+}
@@ -0,0 +1,86 @@
+/**
+ * @file   Socket.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Platform layer and helpers shared by the socket based transports.
+ *
+ *  Include this from translation units only, the headers of the transports keep their sockets as std::intptr_t (-1 if
+ *  not open) so the platform headers do not spread.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <WinSock2.h>
+#include <WS2tcpip.h>
+using socket_t = SOCKET;
+using socklen_t = int;
+#define VISCOM_INVALID_SOCKET INVALID_SOCKET
+#define VISCOM_CLOSE_SOCKET closesocket
+#define VISCOM_POLL WSAPoll
+#define VISCOM_SEND_FLAGS 0
+#else
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+using socket_t = int;
+#define VISCOM_INVALID_SOCKET (-1)
+#define VISCOM_CLOSE_SOCKET close
+#define VISCOM_POLL poll
+#ifdef MSG_NOSIGNAL
+#define VISCOM_SEND_FLAGS MSG_NOSIGNAL
+#else
+// no MSG_NOSIGNAL (macOS), the sockets are created with SO_NOSIGPIPE instead.
+#define VISCOM_SEND_FLAGS 0
+#endif
+#endif
+
+namespace viscom::util {
+
+    inline socket_t ToSocket(std::intptr_t s) { return static_cast<socket_t>(s); }
+
+    /** Initializes the socket library (Winsock), every call needs a matching StopSockets. */
+    void StartSockets();
+    /** Releases the socket library. */
+    void StopSockets();
+
+    /** Creates a socket that does not raise SIGPIPE when the peer is gone. */
+    socket_t CreateSocket(int type, int protocol);
+    /** Accepts a client of a listening socket (see CreateSocket), returns VISCOM_INVALID_SOCKET on failure. */
+    socket_t AcceptSocket(socket_t listenSocket);
+    /** Closes the socket if it is open and sets it to -1. */
+    void CloseSocket(std::intptr_t& s);
+
+    /** Opens a TCP socket listening on port, address is an IPv4 address or empty for all interfaces. */
+    socket_t ListenTCP(const std::string& address, unsigned short port);
+    /** Connects to a TCP server and retries until the deadline as the server may not listen yet. */
+    socket_t ConnectTCP(const std::string& address, unsigned short port, std::chrono::steady_clock::time_point deadline);
+
+    void SetNonBlocking(socket_t s);
+    void SetNoDelay(socket_t s);
+    /** Sets the receive and send timeouts of a blocking socket, 0 keeps a timeout unchanged. */
+    void SetTimeouts(socket_t s, int receiveMilliseconds, int sendMilliseconds);
+    /** Returns if the last call failed on a non-blocking socket because it would have blocked. */
+    bool WouldBlock();
+
+    /** Sends a part of data without raising SIGPIPE, returns the result of send. */
+    long long SendSome(socket_t s, const void* data, std::size_t size);
+    /** Receives a part of data, returns the result of recv. */
+    long long ReceiveSome(socket_t s, void* data, std::size_t size);
+    /** Sends all of data on a blocking socket. */
+    bool SendAll(socket_t s, const void* data, std::size_t size);
+    /** Receives exactly size bytes on a blocking socket. */
+    bool ReceiveAll(socket_t s, void* data, std::size_t size);
+}
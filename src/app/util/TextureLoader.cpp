@@ -0,0 +1,203 @@
+/**
+ * @file   TextureLoader.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the texture loader decoding images on worker threads.
+ */
+
+#include "TextureLoader.h"
+#include "core/open_gl.h"
+#include "FrameTrace.h"
+#include <algorithm>
+#include <fstream>
+
+namespace viscom::util {
+
+    namespace {
+        /** GL internal format, format and type of the baked formats. */
+        struct GLFormat {
+            GLenum internalFormat_;
+            GLenum format_;
+            GLenum type_;
+        };
+
+        GLFormat GetGLFormat(BakedFormat format)
+        {
+            if (format == BakedFormat::RGB9E5) return GLFormat{ GL_RGB9_E5, GL_RGB, GL_UNSIGNED_INT_5_9_9_9_REV };
+            return GLFormat{ GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE };
+        }
+    }
+
+    AsyncTexture::AsyncTexture(const std::string& name, GLuint placeholderId) :
+        name_{ name },
+        placeholderId_{ placeholderId }
+    {
+    }
+
+    AsyncTexture::~AsyncTexture()
+    {
+        if (textureId_ != 0) glDeleteTextures(1, &textureId_);
+        textureId_ = 0;
+    }
+
+    TextureLoader::TextureLoader(const std::vector<std::string>& searchPaths, const std::string& cacheDirectory, unsigned int numThreads) :
+        searchPaths_{ searchPaths },
+        cacheDirectory_{ cacheDirectory }
+    {
+        const std::uint8_t grey[4] = { 128, 128, 128, 255 };
+        glGenTextures(1, &placeholderId_);
+        glBindTexture(GL_TEXTURE_2D, placeholderId_);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, grey);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        for (unsigned int i = 0; i < std::max(1u, numThreads); ++i) workers_.emplace_back([this]() { WorkerLoop(); });
+    }
+
+    TextureLoader::~TextureLoader()
+    {
+        {
+            std::lock_guard<std::mutex> lock{ mutex_ };
+            stopWorkers_ = true;
+        }
+        condition_.notify_all();
+        for (auto& worker : workers_) worker.join();
+        glDeleteTextures(1, &placeholderId_);
+    }
+
+    std::shared_ptr<AsyncTexture> TextureLoader::Request(const std::string& name)
+    {
+        if (auto texture = textures_[name].lock()) return texture;
+
+        auto texture = std::make_shared<AsyncTexture>(name, placeholderId_);
+        textures_[name] = texture;
+        ++numPending_;
+
+        LoadRequest request;
+        request.texture_ = texture;
+        request.requestTime_ = std::chrono::steady_clock::now();
+        {
+            std::lock_guard<std::mutex> lock{ mutex_ };
+            requests_.push_back(std::move(request));
+        }
+        condition_.notify_one();
+        return texture;
+    }
+
+    std::size_t TextureLoader::Upload()
+    {
+        {
+            std::lock_guard<std::mutex> lock{ mutex_ };
+            if (loaded_.empty()) return 0;
+            std::swap(loaded_, uploading_);
+        }
+        VISCOM_TRACE_ZONE("UploadTextures");
+
+        for (auto& request : uploading_) {
+            --numPending_;
+            if (request.baked_.levels_.empty()) continue;
+
+            const auto uploadStart = std::chrono::steady_clock::now();
+            const auto data = static_cast<const std::uint8_t*>(request.cacheFile_ ? request.cacheFile_->GetData() : request.bakedData_.data());
+            const auto glFormat = GetGLFormat(request.baked_.format_);
+            const auto& levels = request.baked_.levels_;
+
+            GLuint textureId = 0;
+            glGenTextures(1, &textureId);
+            glBindTexture(GL_TEXTURE_2D, textureId);
+            glTexStorage2D(GL_TEXTURE_2D, static_cast<GLsizei>(levels.size()), glFormat.internalFormat_, levels[0].width_, levels[0].height_);
+            for (std::size_t i = 0; i < levels.size(); ++i) {
+                glTexSubImage2D(GL_TEXTURE_2D, static_cast<GLint>(i), 0, 0, levels[i].width_, levels[i].height_, glFormat.format_, glFormat.type_, data + levels[i].offset_);
+            }
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+            glBindTexture(GL_TEXTURE_2D, 0);
+            request.texture_->textureId_ = textureId;
+
+            std::uint64_t textureSize = 0;
+            for (const auto& level : levels) textureSize += level.size_;
+            request.texture_->memory_ = TrackedResource(ResourceType::Texture, "TextureLoader", request.texture_->GetName(), static_cast<std::size_t>(textureSize));
+            const auto uploadEnd = std::chrono::steady_clock::now();
+            LOG(INFO) << "Loaded texture '" << request.texture_->GetName() << "' (" << levels[0].width_ << "x" << levels[0].height_ << ", "
+                << levels.size() << " levels, " << textureSize / 1024 << "KB) " << (request.fromCache_ ? "from the cache" : "and baked it") << " in "
+                << request.loadTime_ << "ms, uploaded in " << std::chrono::duration<double, std::milli>(uploadEnd - uploadStart).count()
+                << "ms, available " << std::chrono::duration<double, std::milli>(uploadEnd - request.requestTime_).count() << "ms after the request.";
+        }
+
+        const auto numUploaded = uploading_.size();
+        // releases the mapped cache files and baked texels.
+        uploading_.clear();
+        return numUploaded;
+    }
+
+    void TextureLoader::WorkerLoop()
+    {
+        SetTraceThreadName("texture loader");
+        while (true) {
+            LoadRequest request;
+            {
+                std::unique_lock<std::mutex> lock{ mutex_ };
+                condition_.wait(lock, [this]() { return stopWorkers_ || !requests_.empty(); });
+                if (stopWorkers_) return;
+                request = std::move(requests_.front());
+                requests_.erase(requests_.begin());
+            }
+
+            Load(request);
+
+            std::lock_guard<std::mutex> lock{ mutex_ };
+            loaded_.push_back(std::move(request));
+        }
+    }
+
+    void TextureLoader::Load(LoadRequest& request) const
+    {
+        VISCOM_TRACE_ZONE("LoadTexture");
+        const auto loadStart = std::chrono::steady_clock::now();
+        const auto& name = request.texture_->GetName();
+        const auto filename = FindResource(name);
+        MappedFile sourceFile;
+        if (filename.empty() || !sourceFile.Open(filename)) {
+            LOG(WARNING) << "Could not find texture '" << name << "'.";
+            return;
+        }
+        const auto sourceHash = HashContent(sourceFile.GetData(), sourceFile.GetSize());
+
+        const auto useCache = cacheDirectory_ != "none";
+        const auto cacheFilename = GetBakedTextureFilename(cacheDirectory_, name);
+        if (useCache) {
+            auto cacheFile = std::make_unique<MappedFile>();
+            if (cacheFile->Open(cacheFilename) && ParseBakedTexture(cacheFile->GetData(), cacheFile->GetSize(), request.baked_)
+                && request.baked_.sourceHash_ == sourceHash) {
+                request.cacheFile_ = std::move(cacheFile);
+                request.fromCache_ = true;
+                request.loadTime_ = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - loadStart).count();
+                return;
+            }
+            request.baked_.levels_.clear();
+        }
+
+        DecodedImage image;
+        if (!DecodeImage(filename, sourceFile.GetData(), sourceFile.GetSize(), image)) {
+            LOG(WARNING) << "Could not decode texture '" << filename << "'.";
+            return;
+        }
+        BakeTexture(image, sourceHash, request.bakedData_);
+        ParseBakedTexture(request.bakedData_.data(), request.bakedData_.size(), request.baked_);
+        if (useCache && !SaveBakedTexture(cacheFilename, request.bakedData_)) LOG(WARNING) << "Could not write the texture cache file '" << cacheFilename << "'.";
+        request.loadTime_ = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - loadStart).count();
+    }
+
+    std::string TextureLoader::FindResource(const std::string& name) const
+    {
+        for (const auto& searchPath : searchPaths_) {
+            auto filename = searchPath + "/" + name;
+            if (std::ifstream(filename).good()) return filename;
+        }
+        return std::string();
+    }
+}
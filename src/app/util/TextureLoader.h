@@ -0,0 +1,125 @@
+/**
+ * @file   TextureLoader.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the texture loader decoding images on worker threads.
+ */
+
+#pragma once
+
+#include "core/main.h"
+#include "BakedTexture.h"
+#include "MappedFile.h"
+#include "ResourceRegistry.h"
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace viscom::util {
+
+    /** A texture that is loaded in the background, a placeholder is returned until it is uploaded. */
+    class AsyncTexture
+    {
+    public:
+        AsyncTexture(const std::string& name, GLuint placeholderId);
+        AsyncTexture(const AsyncTexture&) = delete;
+        AsyncTexture& operator=(const AsyncTexture&) = delete;
+        ~AsyncTexture();
+
+        /** Returns the texture or the placeholder while it is not uploaded yet. */
+        GLuint GetTextureId() const { return textureId_ != 0 ? textureId_ : placeholderId_; }
+        bool IsLoaded() const { return textureId_ != 0; }
+        const std::string& GetName() const { return name_; }
+
+    private:
+        friend class TextureLoader;
+
+        /** Holds the resource name. */
+        std::string name_;
+        /** Holds the uploaded texture (0 while loading or if loading failed). */
+        GLuint textureId_ = 0;
+        /** Holds the placeholder texture (owned by the loader). */
+        GLuint placeholderId_;
+        /** Registers the uploaded texture. */
+        TrackedResource memory_;
+    };
+
+    /**
+     *  Loads textures without blocking the GL thread. Files are found in the resource search paths and loaded on a
+     *  pool of worker threads, the GL thread uploads finished images in Upload() (once per frame). Requests for the
+     *  same resource share one texture.
+     *  Images are baked to RGB9E5 (HDR) or RGBA8 with a full mip chain. The baked textures are kept in a cache
+     *  directory keyed by the hash of the source file, later loads map the cache file and upload it directly.
+     */
+    class TextureLoader
+    {
+    public:
+        /** A cache directory of "none" bakes the textures in memory only. */
+        TextureLoader(const std::vector<std::string>& searchPaths, const std::string& cacheDirectory, unsigned int numThreads);
+        TextureLoader(const TextureLoader&) = delete;
+        TextureLoader& operator=(const TextureLoader&) = delete;
+        ~TextureLoader();
+
+        /** Returns the texture for a resource, loading starts with the first request. */
+        std::shared_ptr<AsyncTexture> Request(const std::string& name);
+        /**
+         *  Uploads the decoded images (GL thread only).
+         *  @return the number of textures that changed.
+         */
+        std::size_t Upload();
+        /** Number of textures not uploaded yet. */
+        std::size_t GetNumPending() const { return numPending_; }
+
+    private:
+        struct LoadRequest {
+            std::shared_ptr<AsyncTexture> texture_;
+            std::chrono::steady_clock::time_point requestTime_;
+            /** Time loading took on the worker in milliseconds. */
+            double loadTime_ = 0.0;
+            /** The texture was loaded from the cache. */
+            bool fromCache_ = false;
+            /** Holds the header of the baked texture (no levels if loading failed). */
+            BakedTexture baked_;
+            /** Holds the mapped cache file the texels are uploaded from. */
+            std::unique_ptr<MappedFile> cacheFile_;
+            /** Holds the texels baked in memory (if there is no cache file). */
+            std::vector<std::uint8_t> bakedData_;
+        };
+
+        void WorkerLoop();
+        void Load(LoadRequest& request) const;
+        std::string FindResource(const std::string& name) const;
+
+        /** Holds the resource search paths (searched in order). */
+        std::vector<std::string> searchPaths_;
+        /** Holds the directory of the baked textures ("none" disables the cache). */
+        std::string cacheDirectory_;
+        /** Holds the mid grey placeholder texture. */
+        GLuint placeholderId_ = 0;
+        /** Holds all requested textures by name (GL thread only). */
+        std::unordered_map<std::string, std::weak_ptr<AsyncTexture>> textures_;
+        /** Number of textures not uploaded yet (GL thread only). */
+        std::size_t numPending_ = 0;
+
+        /** Protects the queues. */
+        std::mutex mutex_;
+        /** Signals new requests. */
+        std::condition_variable condition_;
+        /** Holds the images not yet decoded. */
+        std::vector<LoadRequest> requests_;
+        /** Holds the loaded textures not yet uploaded. */
+        std::vector<LoadRequest> loaded_;
+        /** Holds the loaded textures while they are uploaded (GL thread only). */
+        std::vector<LoadRequest> uploading_;
+        /** Tells the workers to stop. */
+        bool stopWorkers_ = false;
+        /** Holds the worker threads. */
+        std::vector<std::thread> workers_;
+    };
+}
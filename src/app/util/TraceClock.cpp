@@ -0,0 +1,45 @@
+/**
+ * @file   TraceClock.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Implementation of the alignment of the trace clock of a node to the one of the master.
+ */
+
+#include "TraceClock.h"
+#include "FrameTrace.h"
+#include "app/ApplicationNodeImplementation.h"
+#include <algorithm>
+
+namespace viscom::util {
+
+    void TraceClock::UpdateFrame()
+    {
+        // the master syncs its own PreSync time, so its offset stays 0.
+        const auto syncTime = GetAppNode()->GetSimulationData().traceSyncTime_;
+        if (syncTime == 0) return;
+
+        // the barrier releases the nodes with network jitter, smoothing averages it out.
+        const auto offset = syncTime - preSyncTime_;
+        ++clockSamples_;
+        clockOffset_ += (offset - clockOffset_) / static_cast<std::int64_t>(std::min(clockSamples_, CLOCK_SMOOTHING));
+        if (IsTracingEnabled()) SetTraceClockOffset(clockOffset_);
+    }
+
+    std::int64_t TraceClock::PreSync()
+    {
+        // all nodes run PreSync right after the swap barrier, which makes it the common point in time of the trace clocks.
+        preSyncTime_ = GetTraceTime();
+        return preSyncTime_;
+    }
+
+    void TraceClock::WriteTrace(const std::string& role) const
+    {
+        if (!IsTracingEnabled()) return;
+
+        const auto processId = GetTraceProcessId();
+        const auto filename = GetAppNode()->GetAppSettings().traceFile_ + "_" + role + "_" + std::to_string(processId) + ".json";
+        if (WriteChromeTrace(filename, role + " " + std::to_string(processId), processId)) LOG(INFO) << "Trace written to '" << filename << "'.";
+        else LOG(WARNING) << "Could not write the trace to '" << filename << "'.";
+    }
+}
@@ -0,0 +1,46 @@
+/**
+ * @file   TraceClock.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Declaration of the alignment of the trace clock of a node to the one of the master.
+ */
+
+#pragma once
+
+#include "app/NodeComponent.h"
+#include <cstdint>
+#include <string>
+
+namespace viscom::util {
+
+    /**
+     *  Measures the offset of the trace clock of this node to the one of the master with the PreSync time the master
+     *  syncs (SimulationData::traceSyncTime_) and writes the trace of the node. The offset is also used for the input
+     *  latency, so it is measured without tracing as well.
+     */
+    class TraceClock final : public NodeComponent
+    {
+    public:
+        explicit TraceClock(ApplicationNodeImplementation* appNode) : NodeComponent{ appNode } {}
+
+        void UpdateFrame() override;
+
+        /** Stores the trace clock in PreSync and returns it (synced by the master). */
+        std::int64_t PreSync();
+        /** Moves a time on the trace clock of the master onto the clock of this node. */
+        std::int64_t ToLocalTime(std::int64_t masterTime) const { return masterTime - clockOffset_; }
+        /** Writes the trace of this node if tracing is enabled (role is part of the file and process name). */
+        void WriteTrace(const std::string& role) const;
+
+    private:
+        /** Trace clock of this node in the last PreSync. */
+        std::int64_t preSyncTime_ = 0;
+        /** Smoothed offset of the trace clock to the one of the master. */
+        std::int64_t clockOffset_ = 0;
+        /** Number of clock offsets measured. */
+        std::uint64_t clockSamples_ = 0;
+        /** Weight of a new offset in the smoothed offset (the first ones are weighted higher to converge quickly). */
+        static constexpr std::uint64_t CLOCK_SMOOTHING = 16;
+    };
+}
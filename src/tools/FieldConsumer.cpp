@@ -0,0 +1,184 @@
+/**
+ * @file   FieldConsumer.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Sample consumer of the shared memory simulation field export.
+ *
+ *  Usage:
+ *    RDFieldConsumer [name] [--timeout s]   prints statistics of the frames exported by a running node, gives up if
+ *                                           the ring does not appear within the timeout (default 30s, 0 waits forever).
+ *    RDFieldConsumer --bench [frames] [w h] measures ring buffer throughput with an in-process producer.
+ */
+
+#include "app/export/SharedFieldRing.h"
+#include "tools/ToolArguments.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace viscom::exporter;
+using namespace viscom::tools;
+
+namespace {
+
+    struct FieldStatistics {
+        float minB = 1.0f;
+        float maxB = 0.0f;
+        double meanB = 0.0;
+    };
+
+    FieldStatistics ComputeStatistics(const float* data, std::size_t cells)
+    {
+        FieldStatistics stats;
+        double sumB = 0.0;
+        for (std::size_t i = 0; i < cells; ++i) {
+            const auto b = data[2 * i + 1];
+            stats.minB = std::min(stats.minB, b);
+            stats.maxB = std::max(stats.maxB, b);
+            sumB += b;
+        }
+        stats.meanB = cells > 0 ? sumB / static_cast<double>(cells) : 0.0;
+        return stats;
+    }
+
+    /** Default time to wait for the ring buffer to appear in seconds. */
+    constexpr unsigned int DEFAULT_TIMEOUT = 30;
+    /** Largest width or height of the benchmark frames. */
+    constexpr unsigned int MAX_BENCHMARK_SIZE = 16384;
+
+    int Consume(const std::string& name, unsigned int timeout)
+    {
+        SharedFieldRingReader reader;
+        const auto waitStart = std::chrono::steady_clock::now();
+        while (!reader.Open(name)) {
+            if (timeout > 0 && std::chrono::steady_clock::now() - waitStart >= std::chrono::seconds(timeout)) {
+                std::cerr << "Shared memory '" << name << "' did not appear within " << timeout << "s, is a node exporting with exportSharedMemory= 1?" << std::endl;
+                return 1;
+            }
+            std::cout << "Waiting for '" << name << "'..." << std::endl;
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+        }
+
+        const auto header = reader.GetHeader();
+        const auto cells = static_cast<std::size_t>(header->width_) * header->height_;
+        std::cout << "Connected: " << header->width_ << "x" << header->height_ << ", " << header->slotCount_ << " slots." << std::endl;
+
+        std::uint64_t lastSequence = reader.GetLatestSequence();
+        std::uint64_t lostFrames = 0;
+        for (;;) {
+            const auto latest = reader.GetLatestSequence();
+            if (latest == lastSequence) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                continue;
+            }
+
+            // always process the newest frame, count the ones we could not keep up with.
+            lostFrames += latest - lastSequence - 1;
+            lastSequence = latest;
+
+            const float* data = nullptr;
+            std::uint64_t lock = 0;
+            auto slot = reader.AcquireFrame(latest, &data, lock);
+            if (slot == nullptr) {
+                ++lostFrames;
+                continue;
+            }
+
+            const auto iteration = slot->iteration_;
+            const auto stats = ComputeStatistics(data, cells);
+            if (!reader.ValidateFrame(slot, lock)) {
+                ++lostFrames;
+                continue;
+            }
+
+            std::cout << "frame " << latest << " (iteration " << iteration << "): B min " << stats.minB << " max " << stats.maxB
+                << " mean " << stats.meanB << ", lost " << lostFrames << std::endl;
+        }
+    }
+
+    int Benchmark(std::uint64_t frames, unsigned int width, unsigned int height)
+    {
+        const std::string name = "/viscom_rd_field_bench";
+        SharedFieldRingWriter writer;
+        if (!writer.Create(name, width, height, 2, 4)) {
+            std::cerr << "Could not create shared memory '" << name << "'." << std::endl;
+            return 1;
+        }
+        SharedFieldRingReader reader;
+        if (!reader.Open(name)) {
+            std::cerr << "Could not open shared memory '" << name << "'." << std::endl;
+            return 1;
+        }
+
+        const auto cells = static_cast<std::size_t>(width) * height;
+        std::vector<float> source(2 * cells, 0.5f);
+
+        std::uint64_t consumedFrames = 0;
+        std::uint64_t tornFrames = 0;
+        std::thread consumer([&]() {
+            std::uint64_t lastSequence = 0;
+            std::vector<float> copy(2 * cells);
+            while (lastSequence < frames) {
+                const auto latest = reader.GetLatestSequence();
+                if (latest == lastSequence) continue;
+                lastSequence = latest;
+
+                const float* data = nullptr;
+                std::uint64_t lock = 0;
+                auto slot = reader.AcquireFrame(latest, &data, lock);
+                if (slot == nullptr) continue;
+                std::memcpy(copy.data(), data, copy.size() * sizeof(float));
+                if (reader.ValidateFrame(slot, lock)) ++consumedFrames;
+                else ++tornFrames;
+            }
+        });
+
+        const auto start = std::chrono::high_resolution_clock::now();
+        for (std::uint64_t i = 0; i < frames; ++i) {
+            source[0] = static_cast<float>(i);
+            std::memcpy(writer.BeginFrame(), source.data(), source.size() * sizeof(float));
+            writer.EndFrame(i);
+        }
+        const auto producerEnd = std::chrono::high_resolution_clock::now();
+        consumer.join();
+
+        const auto seconds = std::chrono::duration<double>(producerEnd - start).count();
+        const auto bytes = static_cast<double>(frames) * writer.GetFrameSize();
+        std::cout << "Produced " << frames << " frames of " << width << "x" << height << " in " << seconds << "s: "
+            << frames / seconds << " frames/s, " << bytes / seconds / (1024.0 * 1024.0 * 1024.0) << " GiB/s." << std::endl;
+        std::cout << "Consumed " << consumedFrames << " frames in place, " << tornFrames << " detected as overwritten." << std::endl;
+        return 0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    return RunTool(argv[0], { "[name] [--timeout seconds]", "--bench [frames] [width height]" }, [argc, argv]() {
+        if (argc > 1 && std::string(argv[1]) == "--bench") {
+            if (argc > 5 || argc == 4) throw UsageError("");
+            const auto frames = argc > 2 ? ParseArgument<std::uint64_t>(argv[2], "frames", 1) : 10000;
+            const auto width = argc > 4 ? ParseArgument(argv[3], "width", 1u, MAX_BENCHMARK_SIZE) : 480u;
+            const auto height = argc > 4 ? ParseArgument(argv[4], "height", 1u, MAX_BENCHMARK_SIZE) : 270u;
+            return Benchmark(frames, width, height);
+        }
+
+        std::string name = "/viscom_rd_field";
+        auto timeout = DEFAULT_TIMEOUT;
+        auto nameGiven = false;
+        for (int i = 1; i < argc; ++i) {
+            const std::string argument = argv[i];
+            if (argument == "--timeout" && i + 1 < argc) timeout = ParseArgument<unsigned int>(argv[++i], "timeout");
+            else if (!argument.empty() && argument[0] == '-') throw UsageError("Unknown option '" + argument + "'.");
+            else if (!nameGiven) {
+                name = argument;
+                nameGiven = true;
+            } else throw UsageError("");
+        }
+        return Consume(name, timeout);
+    });
+}
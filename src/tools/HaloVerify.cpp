@@ -0,0 +1,176 @@
+/**
+ * @file   HaloVerify.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Verifies the distributed simulation against the single node solver over loopback.
+ *
+ *  Usage:
+ *    RDHaloVerify [tilesX] [tilesY] [iterations] [exchange interval]
+ *
+ *  Starts one process per node (the tool itself with --node), every process simulates its sub-domain on the CPU and
+ *  exchanges halos over TCP. The assembled result has to be bit identical to the single node simulation.
+ *
+ *  This checks the decomposition, the exchange and the transport with the CPU solver (HostHaloField). The GPU path of
+ *  the nodes (reactionDiffusionSimulation.frag, TextureHaloField) needs a GL context and is not covered.
+ */
+
+#include "app/distributed/DomainDecomposition.h"
+#include "app/distributed/HaloExchange.h"
+#include "app/distributed/HaloTransport.h"
+#include "app/simulation/GrayScottCPU.h"
+#include "tools/ToolArguments.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace viscom;
+using namespace viscom::tools;
+
+namespace {
+
+    constexpr unsigned int GLOBAL_WIDTH = 1920 / 4;
+    constexpr unsigned int GLOBAL_HEIGHT = 1080 / 4;
+    constexpr unsigned short BASE_PORT = 27300;
+    /** Every tile is a process with its own port, more than this per axis only slows the machine down. */
+    constexpr unsigned int MAX_TILES = 16;
+
+    struct VerifySetup {
+        unsigned int tilesX_ = 2;
+        unsigned int tilesY_ = 2;
+        std::uint64_t iterations_ = 500;
+        unsigned int exchangeInterval_ = 4;
+    };
+
+    /** Deterministic seed points, one every 8 iterations during the first half. */
+    std::vector<float> GetSeedPoints(std::uint64_t iteration, std::uint64_t totalIterations)
+    {
+        if (iteration % 8 != 0 || iteration > totalIterations / 2) return {};
+        std::mt19937 rng(static_cast<unsigned int>(iteration) + 7);
+        std::uniform_real_distribution<float> dist(0.05f, 0.95f);
+        auto x = dist(rng);
+        auto y = dist(rng);
+        return { x, y };
+    }
+
+    std::string GetNodeResultFile(unsigned int nodeIndex)
+    {
+        return "rd_halo_verify_node" + std::to_string(nodeIndex) + ".bin";
+    }
+
+    int RunNode(const VerifySetup& setup, unsigned int nodeIndex)
+    {
+        distributed::DomainDecomposition decomposition(GLOBAL_WIDTH, GLOBAL_HEIGHT, setup.tilesX_, setup.tilesY_, nodeIndex, setup.exchangeInterval_);
+        const auto& extended = decomposition.GetExtended();
+
+        simulation::GrayScottGrid grid(extended.width_, extended.height_);
+        grid.SetGlobalDomain(extended.x_, extended.y_, GLOBAL_WIDTH, GLOBAL_HEIGHT);
+        simulation::GrayScottParameters params;
+
+        distributed::HaloTransport transport(nodeIndex, std::vector<std::string>(decomposition.GetNumNodes(), "127.0.0.1"), BASE_PORT);
+        if (!transport.Connect(decomposition, 10000)) {
+            std::cerr << "Node " << nodeIndex << ": could not connect to neighbours." << std::endl;
+            return 1;
+        }
+        distributed::HaloExchange exchange(decomposition, transport);
+
+        for (std::uint64_t i = 0; i < setup.iterations_; ++i) {
+            auto seedPoints = GetSeedPoints(i, setup.iterations_);
+            grid.Step(params, seedPoints.data(), seedPoints.size() / 2);
+            if ((i + 1) % setup.exchangeInterval_ == 0 && !exchange.Exchange(i, grid.GetField().data(), 10000)) {
+                std::cerr << "Node " << nodeIndex << ": halo exchange failed in iteration " << i << "." << std::endl;
+                return 1;
+            }
+        }
+
+        const auto interior = decomposition.GetInterior();
+        std::vector<float> interiorData;
+        distributed::HaloExchange::ExtractRect(grid.GetField().data(), extended.width_, decomposition.GetLocalInterior(), interiorData);
+        std::ofstream ofs(GetNodeResultFile(nodeIndex), std::ofstream::binary | std::ofstream::trunc);
+        ofs.write(reinterpret_cast<const char*>(&interior), sizeof(interior));
+        ofs.write(reinterpret_cast<const char*>(interiorData.data()), static_cast<std::streamsize>(interiorData.size() * sizeof(float)));
+        std::cout << "Node " << nodeIndex << ": sent " << transport.GetBytesSent() << " bytes." << std::endl;
+        return ofs.good() ? 0 : 1;
+    }
+
+    int RunVerification(const std::string& executable, const VerifySetup& setup)
+    {
+        const auto numNodes = setup.tilesX_ * setup.tilesY_;
+        std::vector<int> results(numNodes, -1);
+        std::vector<std::thread> nodes;
+        for (unsigned int i = 0; i < numNodes; ++i) {
+            auto command = "\"" + executable + "\" --node " + std::to_string(i) + " " + std::to_string(setup.tilesX_) + " " + std::to_string(setup.tilesY_)
+                + " " + std::to_string(setup.iterations_) + " " + std::to_string(setup.exchangeInterval_);
+            nodes.emplace_back([command, &results, i]() { results[i] = std::system(command.c_str()); });
+        }
+
+        simulation::GrayScottGrid reference(GLOBAL_WIDTH, GLOBAL_HEIGHT);
+        simulation::GrayScottParameters params;
+        for (std::uint64_t i = 0; i < setup.iterations_; ++i) {
+            auto seedPoints = GetSeedPoints(i, setup.iterations_);
+            reference.Step(params, seedPoints.data(), seedPoints.size() / 2);
+        }
+
+        for (auto& node : nodes) node.join();
+        for (unsigned int i = 0; i < numNodes; ++i) {
+            if (results[i] != 0) {
+                std::cerr << "Node " << i << " failed." << std::endl;
+                return 1;
+            }
+        }
+
+        std::vector<float> assembled(reference.GetField().size(), -1.0f);
+        for (unsigned int i = 0; i < numNodes; ++i) {
+            std::ifstream ifs(GetNodeResultFile(i), std::ifstream::binary);
+            distributed::DomainRect interior;
+            ifs.read(reinterpret_cast<char*>(&interior), sizeof(interior));
+            std::vector<float> interiorData(2 * static_cast<std::size_t>(interior.width_) * interior.height_);
+            ifs.read(reinterpret_cast<char*>(interiorData.data()), static_cast<std::streamsize>(interiorData.size() * sizeof(float)));
+            distributed::HaloExchange::InsertRect(assembled.data(), GLOBAL_WIDTH, interior, interiorData);
+            ifs.close();
+            std::remove(GetNodeResultFile(i).c_str());
+        }
+
+        std::size_t mismatches = 0;
+        for (std::size_t i = 0; i < assembled.size(); ++i) {
+            if (std::memcmp(&assembled[i], &reference.GetField()[i], sizeof(float)) != 0) ++mismatches;
+        }
+
+        std::cout << numNodes << " nodes (" << setup.tilesX_ << "x" << setup.tilesY_ << "), " << setup.iterations_ << " iterations, exchange every "
+            << setup.exchangeInterval_ << ": " << mismatches << " of " << assembled.size() << " values differ from the single node solver." << std::endl;
+        return mismatches == 0 ? 0 : 1;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    return RunTool(argv[0], { "[tilesX] [tilesY] [iterations] [exchange interval]" }, [argc, argv]() {
+        VerifySetup setup;
+        auto argOffset = 1;
+        auto nodeIndex = -1;
+        if (argc > 1 && std::string(argv[1]) == "--node") {
+            if (argc < 3) throw UsageError("--node needs the index of the node.");
+            nodeIndex = ParseArgument(argv[2], "node index", 0, std::numeric_limits<int>::max());
+            argOffset = 3;
+        }
+        if (argc > argOffset + 4) throw UsageError("");
+        if (argc > argOffset + 0) setup.tilesX_ = ParseArgument(argv[argOffset + 0], "tilesX", 1u, MAX_TILES);
+        if (argc > argOffset + 1) setup.tilesY_ = ParseArgument(argv[argOffset + 1], "tilesY", 1u, MAX_TILES);
+        if (argc > argOffset + 2) setup.iterations_ = ParseArgument<std::uint64_t>(argv[argOffset + 2], "iterations", 1);
+        // the halo is as wide as the exchange interval and has to come from the direct neighbours.
+        const auto maxInterval = std::min(GLOBAL_WIDTH / setup.tilesX_, GLOBAL_HEIGHT / setup.tilesY_);
+        if (argc > argOffset + 3) setup.exchangeInterval_ = ParseArgument(argv[argOffset + 3], "exchange interval", 1u, maxInterval);
+        if (nodeIndex >= static_cast<int>(setup.tilesX_ * setup.tilesY_)) throw UsageError("The node index is outside of the tiles.");
+
+        if (nodeIndex >= 0) return RunNode(setup, static_cast<unsigned int>(nodeIndex));
+        return RunVerification(argv[0], setup);
+    });
+}
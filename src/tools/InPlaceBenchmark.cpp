@@ -0,0 +1,110 @@
+/**
+ * @file   InPlaceBenchmark.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Compares the ping-pong and the in-place CPU simulation in throughput, memory and result.
+ *
+ *  Usage:
+ *    RDInPlaceBenchmark [width height [iterations]]
+ *
+ *  Develops a pattern, then simulates the same number of iterations from it with two fields (ping-pong, like the two
+ *  RG32F textures) and with one field updated in four colour order (inPlaceSimulation). Prints the iterations per
+ *  second, the state memory, the memory traffic per iteration and the difference of the two results. Without a size
+ *  the node size, a 4x larger and a 16x larger domain are measured.
+ */
+
+#include "app/simulation/GrayScottCPU.h"
+#include "tools/ToolArguments.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace viscom::simulation;
+using namespace viscom::tools;
+
+namespace {
+
+    /** Iterations simulated before the measurement so the field holds a pattern instead of the resting state. */
+    constexpr unsigned int PATTERN_ITERATIONS = 500;
+    /** Largest width or height, the two fields of 16384x16384 cells already take 4 GiB. */
+    constexpr unsigned int MAX_SIZE = 16384;
+
+    struct SchemeResult {
+        double iterationsPerSecond_ = 0.0;
+        std::vector<float> field_;
+    };
+
+    SchemeResult Measure(const std::vector<float>& start, unsigned int width, unsigned int height, unsigned int iterations, bool inPlace)
+    {
+        GrayScottGrid grid{ width, height, inPlace };
+        grid.GetField() = start;
+        const GrayScottParameters params;
+        // one step warms up the caches.
+        grid.Step(params, nullptr, 0);
+        grid.GetField() = start;
+
+        const auto begin = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < iterations; ++i) grid.Step(params, nullptr, 0);
+        const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        return { static_cast<double>(iterations) / seconds, grid.GetField() };
+    }
+
+    void Benchmark(unsigned int width, unsigned int height, unsigned int iterations)
+    {
+        GrayScottGrid pattern{ width, height };
+        GrayScottParameters params;
+        params.seedPointRadius_ = 0.05f;
+        const float seedPoints[] = { 0.3f, 0.4f, 0.7f, 0.6f, 0.5f, 0.2f };
+        for (unsigned int i = 0; i < PATTERN_ITERATIONS; ++i) pattern.Step(params, i == 0 ? seedPoints : nullptr, i == 0 ? 3 : 0);
+
+        const auto pingPong = Measure(pattern.GetField(), width, height, iterations, false);
+        const auto inPlace = Measure(pattern.GetField(), width, height, iterations, true);
+
+        // ping-pong streams the state in and the next state out (plus the read for ownership of the written lines),
+        // in place each line is read and written back once. The neighbours hit the cache in both schemes.
+        const auto cells = static_cast<double>(width) * height;
+        const auto cellBytes = 2.0 * sizeof(float);
+        const auto pingPongTraffic = 3.0 * cellBytes * cells;
+        const auto inPlaceTraffic = 2.0 * cellBytes * cells;
+        const auto toMB = 1.0 / (1024.0 * 1024.0);
+
+        std::cout << width << "x" << height << ", " << iterations << " iterations:" << std::endl;
+        std::cout << "  ping-pong: " << pingPong.iterationsPerSecond_ << " iterations/s, " << 1e-6 * cells * pingPong.iterationsPerSecond_ << " Mcells/s, state "
+            << 2.0 * cellBytes * cells * toMB << "MB, " << pingPongTraffic * toMB << "MB traffic per iteration (" << 1e-9 * pingPongTraffic * pingPong.iterationsPerSecond_
+            << "GB/s)." << std::endl;
+        std::cout << "  in-place:  " << inPlace.iterationsPerSecond_ << " iterations/s, " << 1e-6 * cells * inPlace.iterationsPerSecond_ << " Mcells/s, state "
+            << cellBytes * cells * toMB << "MB, " << inPlaceTraffic * toMB << "MB traffic per iteration (" << 1e-9 * inPlaceTraffic * inPlace.iterationsPerSecond_
+            << "GB/s), speed up " << inPlace.iterationsPerSecond_ / pingPong.iterationsPerSecond_ << "." << std::endl;
+
+        double maxDifference[2] = { 0.0, 0.0 };
+        double squaredDifference[2] = { 0.0, 0.0 };
+        for (std::size_t i = 0; i < pingPong.field_.size(); ++i) {
+            const auto difference = std::abs(static_cast<double>(pingPong.field_[i]) - inPlace.field_[i]);
+            maxDifference[i % 2] = std::max(maxDifference[i % 2], difference);
+            squaredDifference[i % 2] += difference * difference;
+        }
+        std::cout << "  difference: A max " << maxDifference[0] << ", rms " << std::sqrt(squaredDifference[0] / cells) << "; B max " << maxDifference[1]
+            << ", rms " << std::sqrt(squaredDifference[1] / cells) << "." << std::endl;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    return RunTool(argv[0], { "[width height [iterations]]" }, [argc, argv]() {
+        if (argc == 2 || argc > 4) throw UsageError("");
+        const auto iterations = argc == 4 ? ParseArgument(argv[3], "iterations", 1u, std::numeric_limits<unsigned int>::max()) : 100u;
+        if (argc >= 3) {
+            Benchmark(ParseArgument(argv[1], "width", 1u, MAX_SIZE), ParseArgument(argv[2], "height", 1u, MAX_SIZE), iterations);
+            return 0;
+        }
+
+        // the simulation size of a node (SIMULATION_SIZE_X/Y) and larger domains that no longer fit into the caches.
+        for (unsigned int scale : { 1u, 2u, 4u }) Benchmark(scale * 1920 / 4, scale * 1080 / 4, iterations);
+        return 0;
+    });
+}
@@ -0,0 +1,139 @@
+/**
+ * @file   MonitorViewer.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Viewer of the remote monitoring stream of the master.
+ *
+ *  Usage:
+ *    RDMonitorViewer <address> <port> [image.pgm]   reconstructs the stream, prints bandwidth statistics and keeps the
+ *                                                   newest frame in a PGM image.
+ *    RDMonitorViewer --loopback [frames] [port]     streams a CPU simulation over loopback and checks every frame.
+ */
+
+#include "app/export/MonitorStream.h"
+#include "app/simulation/GrayScottCPU.h"
+#include "tools/ToolArguments.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace viscom::exporter;
+using namespace viscom::tools;
+
+namespace {
+
+    bool WritePGM(const std::string& filename, const std::vector<std::uint8_t>& frame, unsigned int width, unsigned int height)
+    {
+        // write to a temporary file first, so image viewers never see a partial frame.
+        const auto tempFilename = filename + ".tmp";
+        {
+            std::ofstream ofs(tempFilename, std::ofstream::binary | std::ofstream::trunc);
+            ofs << "P5\n" << width << " " << height << "\n255\n";
+            // rows are stored bottom to top.
+            for (unsigned int y = height; y > 0; --y) ofs.write(reinterpret_cast<const char*>(&frame[static_cast<std::size_t>(y - 1) * width]), width);
+            if (!ofs.good()) return false;
+        }
+        std::remove(filename.c_str());
+        return std::rename(tempFilename.c_str(), filename.c_str()) == 0;
+    }
+
+    int View(const std::string& address, unsigned short port, const std::string& imageFilename)
+    {
+        MonitorClient client;
+        while (!client.Connect(address, port, 5000)) std::cout << "Waiting for " << address << ":" << port << "..." << std::endl;
+        std::cout << "Connected: " << client.GetWidth() << "x" << client.GetHeight() << "." << std::endl;
+
+        const auto rawFrameSize = static_cast<double>(client.GetWidth()) * client.GetHeight();
+        auto reportStart = std::chrono::steady_clock::now();
+        std::uint64_t reportBytes = client.GetBytesReceived();
+        std::uint64_t frames = 0;
+        while (client.Receive()) {
+            ++frames;
+            if (!imageFilename.empty()) WritePGM(imageFilename, client.GetFrame(), client.GetWidth(), client.GetHeight());
+
+            const auto now = std::chrono::steady_clock::now();
+            const auto seconds = std::chrono::duration<double>(now - reportStart).count();
+            if (seconds < 1.0) continue;
+            const auto bytes = static_cast<double>(client.GetBytesReceived() - reportBytes);
+            std::cout << "Iteration " << client.GetIteration() << ": " << static_cast<double>(frames) / seconds << " frames/s, "
+                << 8.0 * bytes / seconds / 1000.0 << " kbit/s, " << bytes / static_cast<double>(frames) / 1024.0 << "KB per frame ("
+                << 100.0 * bytes / (static_cast<double>(frames) * rawFrameSize) << "% of 8 bit raw)." << std::endl;
+            reportStart = now;
+            reportBytes = client.GetBytesReceived();
+            frames = 0;
+        }
+        std::cout << "Stream closed." << std::endl;
+        return 0;
+    }
+
+    int Loopback(std::uint64_t numFrames, unsigned short port)
+    {
+        using namespace viscom::simulation;
+        constexpr unsigned int WIDTH = 480;
+        constexpr unsigned int HEIGHT = 270;
+        constexpr unsigned int ITERATIONS_PER_FRAME = 5;
+
+        MonitorServer server{ WIDTH, HEIGHT };
+        if (!server.Start(port)) {
+            std::cerr << "Could not listen on port " << port << "." << std::endl;
+            return 1;
+        }
+        MonitorClient client;
+        if (!client.Connect("127.0.0.1", port, 5000)) {
+            std::cerr << "Could not connect over loopback." << std::endl;
+            return 1;
+        }
+        // the server accepts clients on its worker, frames are only sent once the client is known.
+        while (server.GetNumClients() == 0) std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        GrayScottGrid grid{ WIDTH, HEIGHT };
+        GrayScottParameters params;
+        params.seedPointRadius_ = 0.02f;
+        const float seedPoints[] = { 0.3f, 0.4f, 0.7f, 0.6f };
+        std::vector<std::uint8_t> frame(static_cast<std::size_t>(WIDTH) * HEIGHT);
+
+        std::uint64_t mismatches = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (std::uint64_t i = 0; i < numFrames; ++i) {
+            for (unsigned int s = 0; s < ITERATIONS_PER_FRAME; ++s) grid.Step(params, i == 0 && s == 0 ? seedPoints : nullptr, i == 0 && s == 0 ? 2 : 0);
+            // quantized like the read back of the GPU (B, clamped to [0, 1]).
+            const auto& field = grid.GetField();
+            for (std::size_t c = 0; c < frame.size(); ++c) frame[c] = static_cast<std::uint8_t>(std::clamp(field[2 * c + 1], 0.0f, 1.0f) * 255.0f + 0.5f);
+
+            server.Submit(i + 1, frame.data());
+            if (!client.Receive()) {
+                std::cerr << "Stream closed after " << i << " frames." << std::endl;
+                return 1;
+            }
+            if (client.GetIteration() != i + 1 || client.GetFrame() != frame) ++mismatches;
+        }
+        const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        const auto rawBytes = static_cast<double>(numFrames) * frame.size();
+        std::cout << "Streamed " << numFrames << " frames (" << WIDTH << "x" << HEIGHT << ") in " << seconds << "s: " << client.GetBytesReceived() / 1024
+            << "KB received, " << 100.0 * static_cast<double>(client.GetBytesReceived()) / rawBytes << "% of 8 bit raw, "
+            << 100.0 * static_cast<double>(client.GetBytesReceived()) / (8.0 * rawBytes) << "% of the float A/B field, " << mismatches << " mismatched frames."
+            << std::endl;
+        return mismatches == 0 ? 0 : 1;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    return RunTool(argv[0], { "<address> <port> [image.pgm]", "--loopback [frames] [port]" }, [argc, argv]() {
+        if (argc >= 2 && std::string(argv[1]) == "--loopback") {
+            if (argc > 4) throw UsageError("");
+            const auto frames = argc >= 3 ? ParseArgument<std::uint64_t>(argv[2], "frames", 1) : 100ull;
+            const auto port = argc >= 4 ? ParseArgument<unsigned short>(argv[3], "port", 1) : static_cast<unsigned short>(27500);
+            return Loopback(frames, port);
+        }
+        if (argc < 3 || argc > 4) throw UsageError("");
+        return View(argv[1], ParseArgument<unsigned short>(argv[2], "port", 1), argc >= 4 ? argv[3] : std::string());
+    });
+}
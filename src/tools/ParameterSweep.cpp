@@ -0,0 +1,211 @@
+/**
+ * @file   ParameterSweep.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Headless tool that simulates a grid of feed/kill rates at once to find parameters for new presets.
+ *
+ *  Usage:
+ *    RDParameterSweep <output prefix> [feed min] [feed max] [kill min] [kill max] [steps] [iterations] [instance size] [threads]
+ *
+ *  Runs steps x steps independent instances on a shared pool of worker threads. Writes <output prefix>.ppm, a contact
+ *  sheet with the feed rate growing to the right and the kill rate growing upwards, and <output prefix>.csv with the
+ *  statistics of every instance.
+ */
+
+#include "app/simulation/GrayScottCPU.h"
+#include "tools/ToolArguments.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace viscom::simulation;
+using namespace viscom::tools;
+
+namespace {
+
+    /** Seed points placed at the beginning of every instance (one per iteration). */
+    constexpr std::size_t NUM_SEED_POINTS = 8;
+    /** Border between two instances in the contact sheet in pixels. */
+    constexpr unsigned int SHEET_BORDER = 2;
+    /** B values above this count as covered by the pattern. */
+    constexpr float COVERAGE_THRESHOLD = 0.25f;
+
+    struct SweepSetup {
+        float feedMin_ = 0.01f;
+        float feedMax_ = 0.09f;
+        float killMin_ = 0.045f;
+        float killMax_ = 0.07f;
+        unsigned int steps_ = 8;
+        std::uint64_t iterations_ = 5000;
+        unsigned int instanceSize_ = 128;
+        unsigned int threads_ = std::max(1u, std::thread::hardware_concurrency());
+    };
+
+    /** One simulation of the sweep and its statistics. */
+    struct SweepInstance {
+        GrayScottParameters params_;
+        float meanA_ = 0.0f;
+        float meanB_ = 0.0f;
+        /** Fraction of cells covered by the pattern. */
+        float coverage_ = 0.0f;
+        /** Largest change of B in the last iteration (0 means the pattern is steady). */
+        float lastChange_ = 0.0f;
+        /** Time the instance was simulated. */
+        double seconds_ = 0.0;
+        std::vector<float> field_;
+    };
+
+    float Interpolate(float minValue, float maxValue, unsigned int step, unsigned int steps)
+    {
+        return steps > 1 ? minValue + (maxValue - minValue) * static_cast<float>(step) / static_cast<float>(steps - 1) : minValue;
+    }
+
+    void SimulateInstance(SweepInstance& instance, const SweepSetup& setup, const std::vector<float>& seedPoints)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        GrayScottGrid grid(setup.instanceSize_, setup.instanceSize_);
+        std::vector<float> previousB;
+        for (std::uint64_t i = 0; i < setup.iterations_; ++i) {
+            const auto numSeedPoints = i < NUM_SEED_POINTS ? std::size_t{ 1 } : std::size_t{ 0 };
+            if (i + 1 == setup.iterations_) {
+                previousB.resize(grid.GetField().size() / 2);
+                for (std::size_t c = 0; c < previousB.size(); ++c) previousB[c] = grid.GetField()[2 * c + 1];
+            }
+            grid.Step(instance.params_, numSeedPoints > 0 ? &seedPoints[2 * i] : nullptr, numSeedPoints);
+        }
+        instance.seconds_ = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+        const auto& field = grid.GetField();
+        const auto numCells = field.size() / 2;
+        double sumA = 0.0, sumB = 0.0;
+        std::size_t covered = 0;
+        for (std::size_t c = 0; c < numCells; ++c) {
+            sumA += field[2 * c];
+            sumB += field[2 * c + 1];
+            if (field[2 * c + 1] > COVERAGE_THRESHOLD) ++covered;
+            if (!previousB.empty()) instance.lastChange_ = std::max(instance.lastChange_, std::abs(field[2 * c + 1] - previousB[c]));
+        }
+        instance.meanA_ = static_cast<float>(sumA / numCells);
+        instance.meanB_ = static_cast<float>(sumB / numCells);
+        instance.coverage_ = static_cast<float>(covered) / static_cast<float>(numCells);
+        instance.field_ = field;
+    }
+
+    bool WriteContactSheet(const std::string& filename, const std::vector<SweepInstance>& instances, const SweepSetup& setup)
+    {
+        const auto tile = setup.instanceSize_ + SHEET_BORDER;
+        const auto sheetSize = setup.steps_ * tile + SHEET_BORDER;
+        std::vector<unsigned char> image(3 * static_cast<std::size_t>(sheetSize) * sheetSize, 64);
+
+        for (unsigned int k = 0; k < setup.steps_; ++k) {
+            for (unsigned int f = 0; f < setup.steps_; ++f) {
+                const auto& field = instances[k * setup.steps_ + f].field_;
+                for (unsigned int y = 0; y < setup.instanceSize_; ++y) {
+                    // image rows go top down, simulation rows bottom up and the kill rate grows upwards.
+                    const auto imageY = sheetSize - 1 - (SHEET_BORDER + k * tile + y);
+                    for (unsigned int x = 0; x < setup.instanceSize_; ++x) {
+                        const auto cell = 2 * (static_cast<std::size_t>(y) * setup.instanceSize_ + x);
+                        const auto value = std::clamp(field[cell] - field[cell + 1], 0.0f, 1.0f);
+                        auto pixel = &image[3 * (static_cast<std::size_t>(imageY) * sheetSize + SHEET_BORDER + f * tile + x)];
+                        pixel[0] = pixel[1] = pixel[2] = static_cast<unsigned char>(value * 255.0f + 0.5f);
+                    }
+                }
+            }
+        }
+
+        std::ofstream ofs(filename, std::ofstream::binary | std::ofstream::trunc);
+        ofs << "P6\n" << sheetSize << " " << sheetSize << "\n255\n";
+        ofs.write(reinterpret_cast<const char*>(image.data()), static_cast<std::streamsize>(image.size()));
+        return ofs.good();
+    }
+
+    bool WriteStatistics(const std::string& filename, const std::vector<SweepInstance>& instances, const SweepSetup& setup)
+    {
+        std::ofstream ofs(filename, std::ofstream::trunc);
+        ofs << "instance,column,row,feed_rate,kill_rate,mean_a,mean_b,coverage,last_change,seconds\n";
+        for (std::size_t i = 0; i < instances.size(); ++i) {
+            const auto& instance = instances[i];
+            ofs << i << "," << i % setup.steps_ << "," << i / setup.steps_ << "," << instance.params_.feedRate_ << "," << instance.params_.killRate_ << ","
+                << instance.meanA_ << "," << instance.meanB_ << "," << instance.coverage_ << "," << instance.lastChange_ << "," << instance.seconds_ << "\n";
+        }
+        return ofs.good();
+    }
+
+    int Sweep(const std::string& outputPrefix, const SweepSetup& setup)
+    {
+        // all instances get the same seed points, so they only differ in their parameters.
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> seedDist(0.2f, 0.8f);
+        std::vector<float> seedPoints(2 * NUM_SEED_POINTS);
+        for (auto& coordinate : seedPoints) coordinate = seedDist(rng);
+
+        std::vector<SweepInstance> instances(static_cast<std::size_t>(setup.steps_) * setup.steps_);
+        for (unsigned int k = 0; k < setup.steps_; ++k) {
+            for (unsigned int f = 0; f < setup.steps_; ++f) {
+                auto& params = instances[k * setup.steps_ + f].params_;
+                params.feedRate_ = Interpolate(setup.feedMin_, setup.feedMax_, f, setup.steps_);
+                params.killRate_ = Interpolate(setup.killMin_, setup.killMax_, k, setup.steps_);
+            }
+        }
+
+        // the instances are independent, every worker takes the next one until all are done.
+        const auto numThreads = std::min<std::size_t>(setup.threads_, instances.size());
+        std::atomic<std::size_t> nextInstance{ 0 };
+        std::atomic<std::size_t> finishedInstances{ 0 };
+        const auto start = std::chrono::high_resolution_clock::now();
+        std::vector<std::thread> workers;
+        for (std::size_t t = 0; t < numThreads; ++t) {
+            workers.emplace_back([&]() {
+                for (auto i = nextInstance++; i < instances.size(); i = nextInstance++) {
+                    SimulateInstance(instances[i], setup, seedPoints);
+                    ++finishedInstances;
+                }
+            });
+        }
+        while (finishedInstances < instances.size()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            std::cout << "\r" << finishedInstances << "/" << instances.size() << " instances" << std::flush;
+        }
+        for (auto& worker : workers) worker.join();
+        const auto seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+        const auto cellUpdates = static_cast<double>(instances.size()) * setup.instanceSize_ * setup.instanceSize_ * static_cast<double>(setup.iterations_);
+        std::cout << std::endl << "Simulated " << instances.size() << " instances of " << setup.instanceSize_ << "x" << setup.instanceSize_ << " cells for "
+            << setup.iterations_ << " iterations on " << numThreads << " threads in " << seconds << "s (" << cellUpdates / seconds * 1e-6
+            << " M cell updates/s)." << std::endl;
+
+        if (!WriteContactSheet(outputPrefix + ".ppm", instances, setup) || !WriteStatistics(outputPrefix + ".csv", instances, setup)) {
+            std::cerr << "Could not write the results to '" << outputPrefix << "'." << std::endl;
+            return 1;
+        }
+        std::cout << "Wrote '" << outputPrefix << ".ppm' and '" << outputPrefix << ".csv'." << std::endl;
+        return 0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    return RunTool(argv[0], { "<output prefix> [feed min] [feed max] [kill min] [kill max] [steps] [iterations] [instance size] [threads]" }, [argc, argv]() {
+        if (argc < 2 || argc > 10) throw UsageError("");
+
+        SweepSetup setup;
+        const std::string outputPrefix = argv[1];
+        if (argc > 2) setup.feedMin_ = ParseArgument(argv[2], "feed min", 0.0f, 1.0f);
+        if (argc > 3) setup.feedMax_ = ParseArgument(argv[3], "feed max", 0.0f, 1.0f);
+        if (argc > 4) setup.killMin_ = ParseArgument(argv[4], "kill min", 0.0f, 1.0f);
+        if (argc > 5) setup.killMax_ = ParseArgument(argv[5], "kill max", 0.0f, 1.0f);
+        if (argc > 6) setup.steps_ = ParseArgument(argv[6], "steps", 1u, 1024u);
+        if (argc > 7) setup.iterations_ = ParseArgument<std::uint64_t>(argv[7], "iterations", 1);
+        if (argc > 8) setup.instanceSize_ = ParseArgument(argv[8], "instance size", 8u, 4096u);
+        if (argc > 9) setup.threads_ = ParseArgument(argv[9], "threads", 1u, 1024u);
+        return Sweep(outputPrefix, setup);
+    });
+}
@@ -0,0 +1,178 @@
+/**
+ * @file   RaycastBenchmark.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Measures the CPU height field raycaster against the number of threads without a GPU.
+ *
+ *  Usage:
+ *    RDRaycastBenchmark [width] [height] [frames] [image.ppm]
+ *
+ *  Simulates a pattern on the CPU and raycasts it like the HeightfieldRaycasterCPU renderer (procedural environment
+ *  and background) with 1, 2, 4, ... threads up to the number of hardware threads, printing the frames per second.
+ *  The image of the last run is written as reference if a file is given.
+ */
+
+#include "app/renderers/CPURaycaster.h"
+#include "app/simulation/GrayScottCPU.h"
+#include "tools/ToolArguments.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace viscom::renderers;
+using namespace viscom::tools;
+
+namespace {
+
+    /** Size of the simulated height field (same as the simulation of a node). */
+    constexpr unsigned int FIELD_WIDTH = 1920 / 4;
+    constexpr unsigned int FIELD_HEIGHT = 1080 / 4;
+    constexpr unsigned int FIELD_ITERATIONS = 1000;
+    /** Largest width or height of the raycast image. */
+    constexpr unsigned int MAX_IMAGE_SIZE = 16384;
+    /** Vertical field of view of the benchmark camera in radians. */
+    constexpr float FIELD_OF_VIEW = 1.0f;
+
+    std::vector<float> SimulateHeightField()
+    {
+        using namespace viscom::simulation;
+        GrayScottGrid grid{ FIELD_WIDTH, FIELD_HEIGHT };
+        GrayScottParameters params;
+        params.seedPointRadius_ = 0.05f;
+        const float seedPoints[] = { 0.3f, 0.4f, 0.7f, 0.6f, 0.5f, 0.2f };
+        for (unsigned int i = 0; i < FIELD_ITERATIONS; ++i) grid.Step(params, i == 0 ? seedPoints : nullptr, i == 0 ? 3 : 0);
+
+        // the result texture of reactionDiffusionSimulation.frag.
+        std::vector<float> heights(static_cast<std::size_t>(FIELD_WIDTH) * FIELD_HEIGHT);
+        const auto& field = grid.GetField();
+        for (std::size_t i = 0; i < heights.size(); ++i) heights[i] = 1.0f - std::clamp(field[2 * i] - field[2 * i + 1], 0.0f, 1.0f);
+        return heights;
+    }
+
+    CPURaycastImage CreateCheckerboard(unsigned int size, unsigned int checks)
+    {
+        CPURaycastImage image;
+        image.width_ = image.height_ = size;
+        image.rgb_.resize(3 * static_cast<std::size_t>(size) * size);
+        for (unsigned int y = 0; y < size; ++y) {
+            for (unsigned int x = 0; x < size; ++x) {
+                const auto odd = ((x * checks / size) + (y * checks / size)) % 2 == 1;
+                const auto texel = &image.rgb_[3 * (static_cast<std::size_t>(y) * size + x)];
+                texel[0] = odd ? 0.9f : 0.2f;
+                texel[1] = odd ? 0.8f : 0.3f;
+                texel[2] = odd ? 0.6f : 0.5f;
+            }
+        }
+        return image;
+    }
+
+    CPURaycastImage CreateSky(unsigned int size)
+    {
+        CPURaycastImage image;
+        image.width_ = image.height_ = size;
+        image.rgb_.resize(3 * static_cast<std::size_t>(size) * size);
+        for (unsigned int y = 0; y < size; ++y) {
+            for (unsigned int x = 0; x < size; ++x) {
+                const auto dx = static_cast<float>(x) / static_cast<float>(size) - 0.5f;
+                const auto dy = static_cast<float>(y) / static_cast<float>(size) - 0.5f;
+                const auto sun = std::exp(-60.0f * ((dx - 0.1f) * (dx - 0.1f) + (dy - 0.15f) * (dy - 0.15f)));
+                const auto texel = &image.rgb_[3 * (static_cast<std::size_t>(y) * size + x)];
+                texel[0] = 0.3f + 4.0f * sun;
+                texel[1] = 0.5f + 3.5f * sun;
+                texel[2] = 0.9f + 2.0f * sun;
+            }
+        }
+        return image;
+    }
+
+    /** Camera at the origin looking down -z, the simulation quad fills most of the view. */
+    void SetupView(unsigned int width, unsigned int height, CPURaycastView& view, CPURaycastParameters& params)
+    {
+        const auto aspect = static_cast<float>(width) / static_cast<float>(height);
+        const auto f = 1.0f / std::tan(0.5f * FIELD_OF_VIEW);
+        const auto zNear = 0.1f;
+        const auto zFar = 100.0f;
+
+        // inverse of the symmetric perspective projection (column major).
+        view.inverseViewProjection_.fill(0.0f);
+        view.inverseViewProjection_[0] = aspect / f;
+        view.inverseViewProjection_[5] = 1.0f / f;
+        view.inverseViewProjection_[11] = (zNear - zFar) / (2.0f * zNear * zFar);
+        view.inverseViewProjection_[14] = -1.0f;
+        view.inverseViewProjection_[15] = (zNear + zFar) / (2.0f * zNear * zFar);
+        view.cameraPosition_ = { { 0.0f, 0.0f, 0.0f } };
+        view.width_ = width;
+        view.height_ = height;
+
+        params.quadSize_ = { { 0.95f * params.drawDistance_ * aspect / f, 0.95f * params.drawDistance_ / f } };
+    }
+
+    bool WritePPM(const std::string& filename, const std::vector<std::uint8_t>& rgba, unsigned int width, unsigned int height)
+    {
+        std::ofstream ofs(filename, std::ofstream::binary | std::ofstream::trunc);
+        ofs << "P6\n" << width << " " << height << "\n255\n";
+        // rows are stored bottom to top.
+        for (unsigned int y = height; y > 0; --y) {
+            for (unsigned int x = 0; x < width; ++x) ofs.write(reinterpret_cast<const char*>(&rgba[4 * (static_cast<std::size_t>(y - 1) * width + x)]), 3);
+        }
+        return ofs.good();
+    }
+
+    int Benchmark(unsigned int width, unsigned int height, unsigned int frames, const std::string& imageFilename)
+    {
+        const auto heights = SimulateHeightField();
+        CPURaycastView view;
+        CPURaycastParameters params;
+        SetupView(width, height, view, params);
+        std::vector<std::uint8_t> image(4 * static_cast<std::size_t>(width) * height);
+
+        const auto maxThreads = std::max(1u, std::thread::hardware_concurrency());
+        std::vector<unsigned int> threadCounts;
+        for (auto threads = 1u; threads < maxThreads; threads *= 2) threadCounts.push_back(threads);
+        threadCounts.push_back(maxThreads);
+
+        std::cout << "Raycasting " << width << "x" << height << " (" << FIELD_WIDTH << "x" << FIELD_HEIGHT << " height field), " << frames << " frames per run." << std::endl;
+        double singleThreadFps = 0.0;
+        for (auto threads : threadCounts) {
+            CPURaycaster raycaster{ threads };
+            raycaster.SetHeightField(heights.data(), FIELD_WIDTH, FIELD_HEIGHT, { { 0.0f, 0.0f, 1.0f, 1.0f } });
+            raycaster.SetEnvironment(CreateSky(256));
+            raycaster.SetBackground(CreateCheckerboard(512, 16));
+            // the first frame warms up the caches and the worker threads.
+            raycaster.Render(view, params, image.data());
+
+            const auto start = std::chrono::steady_clock::now();
+            for (unsigned int i = 0; i < frames; ++i) raycaster.Render(view, params, image.data());
+            const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            const auto fps = static_cast<double>(frames) / seconds;
+            if (threads == 1) singleThreadFps = fps;
+            std::cout << "  " << threads << " threads: " << fps << " frames/s, " << 1000.0 / fps << "ms per frame, speed up " << fps / singleThreadFps << "."
+                << std::endl;
+        }
+
+        if (!imageFilename.empty() && !WritePPM(imageFilename, image, width, height)) {
+            std::cerr << "Could not write '" << imageFilename << "'." << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    return RunTool(argv[0], { "[width] [height] [frames] [image.ppm]" }, [argc, argv]() {
+        if (argc > 5) throw UsageError("");
+        const auto width = argc >= 2 ? ParseArgument(argv[1], "width", 1u, MAX_IMAGE_SIZE) : 1920u;
+        const auto height = argc >= 3 ? ParseArgument(argv[2], "height", 1u, MAX_IMAGE_SIZE) : 1080u;
+        const auto frames = argc >= 4 ? ParseArgument(argv[3], "frames", 1u, std::numeric_limits<unsigned int>::max()) : 10u;
+        const auto imageFilename = argc >= 5 ? std::string(argv[4]) : std::string();
+        return Benchmark(width, height, frames, imageFilename);
+    });
+}
@@ -0,0 +1,100 @@
+/**
+ * @file   SnapshotBaker.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Headless tool that simulates a preset on the CPU and writes a warm start state snapshot.
+ *
+ *  Usage:
+ *    RDSnapshotBaker <preset file> <snapshot file> [iterations] [seed points] [random seed]
+ *
+ *  The snapshot is referenced as optional third column in presetList.txt.
+ */
+
+#include "app/simulation/GrayScottCPU.h"
+#include "app/simulation/StateSnapshot.h"
+#include "tools/ToolArguments.h"
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+
+using namespace viscom::simulation;
+using namespace viscom::tools;
+
+namespace {
+
+    /** The simulation size of the application (ApplicationNodeImplementation::SIMULATION_SIZE_X/Y). */
+    constexpr unsigned int SIMULATION_SIZE_X = 1920 / 4;
+    constexpr unsigned int SIMULATION_SIZE_Y = 1080 / 4;
+
+    bool LoadParameters(const std::string& presetFile, GrayScottParameters& params)
+    {
+        std::ifstream ifs(presetFile);
+        if (!ifs.is_open()) return false;
+
+        std::string str;
+        while (ifs >> str && ifs.good()) {
+            if (str == "diffusion_rate_a=") ifs >> params.diffusionRateA_;
+            else if (str == "diffusion_rate_b=") ifs >> params.diffusionRateB_;
+            else if (str == "feed_rate=") ifs >> params.feedRate_;
+            else if (str == "kill_rate=") ifs >> params.killRate_;
+            else if (str == "dt=") ifs >> params.dt_;
+            else if (str == "seed_point_radius=") ifs >> params.seedPointRadius_;
+            else if (str == "use_manhattan_distance=") ifs >> params.useManhattanDistance_;
+        }
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    return RunTool(argv[0], { "<preset file> <snapshot file> [iterations] [seed points] [random seed]" }, [argc, argv]() {
+        if (argc < 3 || argc > 6) throw UsageError("");
+        const std::uint64_t iterations = argc > 3 ? ParseArgument<std::uint64_t>(argv[3], "iterations", 1) : 20000;
+        const std::uint64_t numSeeds = argc > 4 ? ParseArgument<std::uint64_t>(argv[4], "seed points") : 16;
+        const unsigned int randomSeed = argc > 5 ? ParseArgument<unsigned int>(argv[5], "random seed") : 42;
+
+        GrayScottParameters params;
+        if (!LoadParameters(argv[1], params)) {
+            std::cerr << "Could not read preset '" << argv[1] << "'." << std::endl;
+            return 1;
+        }
+
+        GrayScottGrid grid(SIMULATION_SIZE_X, SIMULATION_SIZE_Y);
+        std::mt19937 rng(randomSeed);
+        std::uniform_real_distribution<float> seedDist(0.1f, 0.9f);
+
+        const auto start = std::chrono::high_resolution_clock::now();
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            // one seed point per iteration at the beginning, like a visitor touching the wall.
+            float seedPoint[2] = { 0.0f, 0.0f };
+            std::size_t numSeedPoints = 0;
+            if (i < numSeeds) {
+                seedPoint[0] = seedDist(rng);
+                seedPoint[1] = seedDist(rng);
+                numSeedPoints = 1;
+            }
+            grid.Step(params, seedPoint, numSeedPoints);
+
+            if ((i + 1) % 1000 == 0) std::cout << "\r" << (i + 1) << "/" << iterations << " iterations" << std::flush;
+        }
+        const auto seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+        std::cout << std::endl << "Simulated " << iterations << " iterations in " << seconds << "s." << std::endl;
+
+        StateSnapshot snapshot;
+        snapshot.width_ = grid.GetWidth();
+        snapshot.height_ = grid.GetHeight();
+        snapshot.iteration_ = iterations;
+        snapshot.field_ = grid.GetField();
+        if (!SaveStateSnapshot(argv[2], snapshot)) {
+            std::cerr << "Could not write snapshot '" << argv[2] << "'." << std::endl;
+            return 1;
+        }
+
+        std::ifstream written(argv[2], std::ifstream::binary | std::ifstream::ate);
+        std::cout << "Wrote '" << argv[2] << "' (" << written.tellg() << " bytes, uncompressed " << snapshot.field_.size() * sizeof(float) << " bytes)." << std::endl;
+        return 0;
+    });
+}
@@ -0,0 +1,63 @@
+/**
+ * @file   TextureBaker.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Headless tool that bakes textures into the cache of the texture loader.
+ *
+ *  Usage:
+ *    RDTextureBaker <cache directory> <resource directory> <texture>...
+ *
+ *  Textures are named relative to the resource directory like in the application (e.g. textures/grace_probe.hdr).
+ *  Baking them once (e.g. into a cache directory shared by all nodes) means no node has to decode them at start up.
+ */
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+#include "app/util/BakedTexture.h"
+#include "app/util/MappedFile.h"
+#include <chrono>
+#include <iostream>
+#include <string>
+
+using namespace viscom::util;
+
+int main(int argc, char** argv)
+{
+    if (argc < 4) {
+        std::cerr << "Usage: " << argv[0] << " <cache directory> <resource directory> <texture>..." << std::endl;
+        return 1;
+    }
+
+    const std::string cacheDirectory = argv[1];
+    const std::string resourceDirectory = argv[2];
+    auto result = 0;
+    for (int i = 3; i < argc; ++i) {
+        const std::string name = argv[i];
+        const auto filename = resourceDirectory + "/" + name;
+        const auto start = std::chrono::high_resolution_clock::now();
+
+        MappedFile sourceFile;
+        DecodedImage image;
+        if (!sourceFile.Open(filename) || !DecodeImage(filename, sourceFile.GetData(), sourceFile.GetSize(), image)) {
+            std::cerr << "Could not decode '" << filename << "'." << std::endl;
+            result = 1;
+            continue;
+        }
+
+        std::vector<std::uint8_t> data;
+        BakeTexture(image, HashContent(sourceFile.GetData(), sourceFile.GetSize()), data);
+        const auto cacheFilename = GetBakedTextureFilename(cacheDirectory, name);
+        if (!SaveBakedTexture(cacheFilename, data)) {
+            std::cerr << "Could not write '" << cacheFilename << "'." << std::endl;
+            result = 1;
+            continue;
+        }
+
+        const auto sourceSize = image.pixels_.size();
+        std::cout << "Baked '" << name << "' (" << image.width_ << "x" << image.height_ << (image.hdr_ ? ", HDR" : "") << ") to '" << cacheFilename << "': "
+            << data.size() / 1024 << "KB with mip chain instead of " << sourceSize / 1024 << "KB decoded in "
+            << std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count() << "ms." << std::endl;
+    }
+    return result;
+}
@@ -0,0 +1,95 @@
+/**
+ * @file   ToolArguments.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Command line parsing shared by the headless tools.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace viscom::tools {
+
+    /** Thrown for arguments a tool cannot use, RunTool prints the usage for it. */
+    class UsageError : public std::runtime_error
+    {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+
+    /**
+     *  Parses a number argument, the whole argument has to be a number in [minimum, maximum].
+     *  @param argument the command line argument.
+     *  @param name the name of the argument used in the error message.
+     *  @param minimum the smallest accepted value.
+     *  @param maximum the largest accepted value.
+     */
+    template<typename T>
+    T ParseArgument(const std::string& argument, const char* name, T minimum = std::numeric_limits<T>::lowest(),
+        T maximum = std::numeric_limits<T>::max())
+    {
+        static_assert(std::is_arithmetic_v<T>, "Only number arguments can be parsed.");
+        const auto invalid = [&argument, name, minimum, maximum]() {
+            std::ostringstream message;
+            message << name << " has to be a number in [" << +minimum << ", " << +maximum << "], got '" << argument << "'.";
+            return UsageError(message.str());
+        };
+
+        std::size_t end = 0;
+        T value{};
+        try {
+            if constexpr (std::is_floating_point_v<T>) {
+                const auto parsed = std::stold(argument, &end);
+                if (!(parsed >= minimum && parsed <= maximum)) throw invalid();
+                value = static_cast<T>(parsed);
+            } else if constexpr (std::is_unsigned_v<T>) {
+                // std::stoull accepts "-1" and wraps it around.
+                if (argument.find('-') != std::string::npos) throw invalid();
+                const auto parsed = std::stoull(argument, &end);
+                if (parsed < minimum || parsed > maximum) throw invalid();
+                value = static_cast<T>(parsed);
+            } else {
+                const auto parsed = std::stoll(argument, &end);
+                if (parsed < minimum || parsed > maximum) throw invalid();
+                value = static_cast<T>(parsed);
+            }
+        } catch (const std::logic_error&) {
+            // std::invalid_argument and std::out_of_range of the std::sto* functions.
+            throw invalid();
+        }
+        if (end != argument.size()) throw invalid();
+        return value;
+    }
+
+    /**
+     *  Runs the main function of a tool and prints its usage if it throws a UsageError.
+     *  @param program the program name (argv[0]).
+     *  @param usages one line per way to call the tool, without the program name.
+     *  @param toolMain the main function of the tool, returns the exit code.
+     *  @return the exit code of toolMain or 1 for unusable arguments.
+     */
+    template<typename Main>
+    int RunTool(const char* program, std::initializer_list<const char*> usages, Main&& toolMain)
+    {
+        try {
+            return toolMain();
+        } catch (const UsageError& error) {
+            if (error.what()[0] != '\0') std::cerr << error.what() << std::endl;
+            auto prefix = "Usage: ";
+            for (const auto usage : usages) {
+                std::cerr << prefix << program << " " << usage << std::endl;
+                prefix = "       ";
+            }
+            return 1;
+        }
+    }
+}
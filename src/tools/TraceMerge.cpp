@@ -0,0 +1,64 @@
+/**
+ * @file   TraceMerge.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Merges the CPU traces of all nodes onto one timeline.
+ *
+ *  Usage:
+ *    RDTraceMerge <merged.json> <node trace.json>...   merges the traces written by the nodes (see traceFile).
+ *    RDTraceMerge --overhead [zones]                   measures the cost of a trace zone.
+ *
+ *  The nodes align their trace clocks to the master, the merged file can be opened in chrome://tracing or Perfetto.
+ */
+
+#include "app/util/FrameTrace.h"
+#include "tools/ToolArguments.h"
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace viscom::tools;
+
+namespace {
+
+    int MeasureOverhead(std::uint64_t numZones)
+    {
+        using namespace viscom::util;
+        volatile std::uint64_t sink = 0;
+        const auto measure = [numZones, &sink]() {
+            const auto start = std::chrono::steady_clock::now();
+            for (std::uint64_t i = 0; i < numZones; ++i) {
+                VISCOM_TRACE_ZONE("zone");
+                sink = sink + i;
+            }
+            return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / static_cast<double>(numZones);
+        };
+
+        const auto disabled = measure();
+        EnableTracing(65536);
+        const auto enabled = measure();
+        std::cout << "Trace zone: " << disabled << "ns disabled, " << enabled << "ns enabled (" << enabled - disabled << "ns per zone)." << std::endl;
+        return 0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    return RunTool(argv[0], { "<merged.json> <node trace.json>...", "--overhead [zones]" }, [argc, argv]() {
+        if (argc >= 2 && std::string(argv[1]) == "--overhead") {
+            if (argc > 3) throw UsageError("");
+            return MeasureOverhead(argc >= 3 ? ParseArgument<std::uint64_t>(argv[2], "zones", 1) : 10000000ull);
+        }
+        if (argc < 3) throw UsageError("");
+
+        const std::vector<std::string> traces(argv + 2, argv + argc);
+        if (!viscom::util::MergeChromeTraces(traces, argv[1])) {
+            std::cerr << "Could not merge the traces (missing file or not written by a node)." << std::endl;
+            return 1;
+        }
+        std::cout << "Merged " << traces.size() << " traces into '" << argv[1] << "'." << std::endl;
+        return 0;
+    });
+}
@@ -0,0 +1,94 @@
+/**
+ * @file   ByteCodecTest.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Tests the byte shuffle and run length coding of util/ByteCodec.
+ */
+
+#include "TestCheck.h"
+#include "app/util/ByteCodec.h"
+#include <random>
+
+using namespace viscom::util;
+
+namespace {
+
+    bool RoundTrip(const std::vector<std::uint8_t>& data)
+    {
+        std::vector<std::uint8_t> encoded;
+        EncodeRLE(data.data(), data.size(), encoded);
+        if (data.size() > MaxDecodedRLESize(encoded.size()) && !data.empty()) return false;
+        std::vector<std::uint8_t> decoded(data.size());
+        return DecodeRLE(encoded.data(), encoded.size(), decoded.data(), decoded.size()) && decoded == data;
+    }
+
+    void TestRoundTrip()
+    {
+        std::mt19937 random{ 42 };
+        std::vector<std::uint8_t> noise(1000);
+        for (auto& value : noise) value = static_cast<std::uint8_t>(random());
+        VISCOM_CHECK(RoundTrip(noise));
+
+        // runs around the limits of a repeat run (3 to 130) and of a literal run (128).
+        for (std::size_t length : { 1, 2, 3, 4, 127, 128, 129, 130, 131, 260, 1000 }) {
+            VISCOM_CHECK(RoundTrip(std::vector<std::uint8_t>(length, 7)));
+            std::vector<std::uint8_t> literals(length);
+            for (std::size_t i = 0; i < length; ++i) literals[i] = static_cast<std::uint8_t>(i);
+            VISCOM_CHECK(RoundTrip(literals));
+        }
+
+        std::vector<std::uint8_t> mixed;
+        for (int i = 0; i < 50; ++i) {
+            mixed.insert(mixed.end(), static_cast<std::size_t>(random() % 200), static_cast<std::uint8_t>(i));
+            for (int j = 0; j < static_cast<int>(random() % 5); ++j) mixed.push_back(static_cast<std::uint8_t>(random()));
+        }
+        VISCOM_CHECK(RoundTrip(mixed));
+        VISCOM_CHECK(RoundTrip({}));
+    }
+
+    void TestShuffle()
+    {
+        const float values[] = { 0.0f, 1.0f, -2.5f, 1e-7f, 3.0e8f };
+        std::vector<std::uint8_t> shuffled(sizeof(values));
+        ShuffleBytes(values, 5, sizeof(float), shuffled.data());
+        // the first plane holds the first byte of every element.
+        VISCOM_CHECK(shuffled[1] == reinterpret_cast<const std::uint8_t*>(values)[sizeof(float)]);
+
+        float restored[5] = {};
+        UnshuffleBytes(shuffled.data(), 5, sizeof(float), restored);
+        for (int i = 0; i < 5; ++i) VISCOM_CHECK(restored[i] == values[i]);
+    }
+
+    void TestBounds()
+    {
+        std::vector<std::uint8_t> data(300, 1);
+        std::vector<std::uint8_t> encoded;
+        EncodeRLE(data.data(), data.size(), encoded);
+
+        // a destination that is too small or too large is an error, not a partial decode.
+        std::vector<std::uint8_t> decoded(data.size() + 1);
+        VISCOM_CHECK(!DecodeRLE(encoded.data(), encoded.size(), decoded.data(), data.size() - 1));
+        VISCOM_CHECK(!DecodeRLE(encoded.data(), encoded.size(), decoded.data(), data.size() + 1));
+
+        // truncated input: a literal run missing its bytes and a repeat run missing its value.
+        const std::uint8_t literal[] = { 5, 1, 2 };
+        VISCOM_CHECK(!DecodeRLE(literal, sizeof(literal), decoded.data(), 6));
+        const std::uint8_t repeat[] = { 200 };
+        VISCOM_CHECK(!DecodeRLE(repeat, sizeof(repeat), decoded.data(), 75));
+
+        // the bound is reached by repeat runs of maximal length and never exceeded.
+        const std::uint8_t maxRuns[] = { 255, 9, 255, 9 };
+        VISCOM_CHECK(MaxDecodedRLESize(sizeof(maxRuns)) == 260);
+        VISCOM_CHECK(DecodeRLE(maxRuns, sizeof(maxRuns), decoded.data(), 260));
+        VISCOM_CHECK(MaxDecodedRLESize(1) == 0);
+    }
+}
+
+int main()
+{
+    TestRoundTrip();
+    TestShuffle();
+    TestBounds();
+    return VISCOM_TEST_RESULT();
+}
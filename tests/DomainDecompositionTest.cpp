@@ -0,0 +1,88 @@
+/**
+ * @file   DomainDecompositionTest.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Tests the neighbours, halos and strips of distributed/DomainDecomposition.
+ */
+
+#include "TestCheck.h"
+#include "app/distributed/DomainDecomposition.h"
+
+using namespace viscom::distributed;
+
+namespace {
+
+    bool Equals(const DomainRect& rect, unsigned int x, unsigned int y, unsigned int width, unsigned int height)
+    {
+        return rect.x_ == x && rect.y_ == y && rect.width_ == width && rect.height_ == height;
+    }
+
+    void TestNeighbours()
+    {
+        // 3x2 nodes, node 4 is the middle one of the upper row.
+        const DomainDecomposition middle{ 300, 200, 3, 2, 4, 2 };
+        VISCOM_CHECK(middle.GetNeighbourIndex(Neighbour::LEFT) == 3);
+        VISCOM_CHECK(middle.GetNeighbourIndex(Neighbour::RIGHT) == 5);
+        VISCOM_CHECK(middle.GetNeighbourIndex(Neighbour::DOWN) == 1);
+        VISCOM_CHECK(middle.GetNeighbourIndex(Neighbour::UP) == -1);
+
+        const DomainDecomposition corner{ 300, 200, 3, 2, 0, 2 };
+        VISCOM_CHECK(corner.GetNeighbourIndex(Neighbour::LEFT) == -1);
+        VISCOM_CHECK(corner.GetNeighbourIndex(Neighbour::RIGHT) == 1);
+        VISCOM_CHECK(corner.GetNeighbourIndex(Neighbour::DOWN) == -1);
+        VISCOM_CHECK(corner.GetNeighbourIndex(Neighbour::UP) == 3);
+
+        const DomainDecomposition single{ 300, 200, 1, 1, 0, 2 };
+        for (auto neighbour : { Neighbour::LEFT, Neighbour::RIGHT, Neighbour::DOWN, Neighbour::UP }) VISCOM_CHECK(single.GetNeighbourIndex(neighbour) == -1);
+        VISCOM_CHECK(Equals(single.GetExtended(), 0, 0, 300, 200));
+    }
+
+    void TestInteriors()
+    {
+        // uneven sizes are split without gaps or overlaps.
+        unsigned int covered = 0;
+        unsigned int nextX = 0;
+        for (unsigned int node = 0; node < 3; ++node) {
+            const auto interior = DomainDecomposition::ComputeInterior(100, 10, 3, 1, node);
+            VISCOM_CHECK(interior.x_ == nextX);
+            VISCOM_CHECK(interior.width_ == 33 || interior.width_ == 34);
+            nextX = interior.x_ + interior.width_;
+            covered += interior.width_;
+        }
+        VISCOM_CHECK(covered == 100);
+    }
+
+    void TestHalos()
+    {
+        const DomainDecomposition middle{ 300, 200, 3, 2, 4, 2 };
+        VISCOM_CHECK(Equals(middle.GetInterior(), 100, 100, 100, 100));
+        // halos on the left, right and bottom side only.
+        VISCOM_CHECK(Equals(middle.GetExtended(), 98, 98, 104, 102));
+        VISCOM_CHECK(Equals(middle.GetLocalInterior(), 2, 2, 100, 100));
+
+        VISCOM_CHECK(Equals(middle.GetSendRect(Neighbour::LEFT), 2, 2, 2, 100));
+        VISCOM_CHECK(Equals(middle.GetSendRect(Neighbour::RIGHT), 100, 2, 2, 100));
+        VISCOM_CHECK(Equals(middle.GetReceiveRect(Neighbour::LEFT), 0, 2, 2, 100));
+        VISCOM_CHECK(Equals(middle.GetReceiveRect(Neighbour::RIGHT), 102, 2, 2, 100));
+        // the second phase sends and receives whole rows including the corners.
+        VISCOM_CHECK(Equals(middle.GetSendRect(Neighbour::DOWN), 0, 2, 104, 2));
+        VISCOM_CHECK(Equals(middle.GetReceiveRect(Neighbour::DOWN), 0, 0, 104, 2));
+
+        // what a node sends is what its neighbour receives, in global coordinates.
+        const DomainDecomposition left{ 300, 200, 3, 2, 3, 2 };
+        const auto send = left.GetSendRect(Neighbour::RIGHT);
+        const auto receive = middle.GetReceiveRect(Neighbour::LEFT);
+        VISCOM_CHECK(left.GetExtended().x_ + send.x_ == middle.GetExtended().x_ + receive.x_);
+        VISCOM_CHECK(left.GetExtended().y_ + send.y_ == middle.GetExtended().y_ + receive.y_);
+        VISCOM_CHECK(send.width_ == receive.width_ && send.height_ == receive.height_);
+    }
+}
+
+int main()
+{
+    TestNeighbours();
+    TestInteriors();
+    TestHalos();
+    return VISCOM_TEST_RESULT();
+}
@@ -0,0 +1,78 @@
+/**
+ * @file   FixedPointSimulationTest.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Tests the fixed point arithmetic and simulation of simulation/GrayScottCPU.
+ */
+
+#include "TestCheck.h"
+#include "app/simulation/GrayScottCPU.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace viscom::simulation;
+
+namespace {
+
+    constexpr unsigned int WIDTH = 48;
+    constexpr unsigned int HEIGHT = 32;
+    constexpr unsigned int ITERATIONS = 200;
+
+    void TestMultiply()
+    {
+        VISCOM_CHECK(MultiplyFixedPoint(FIXED_POINT_ONE, FIXED_POINT_ONE) == FIXED_POINT_ONE);
+        VISCOM_CHECK(MultiplyFixedPoint(3, FIXED_POINT_ONE / 2) == 1);
+        // negative products are rounded towards negative infinity like the arithmetic shift in the shader.
+        VISCOM_CHECK(MultiplyFixedPoint(-3, FIXED_POINT_ONE / 2) == -2);
+        VISCOM_CHECK(MultiplyFixedPoint(-1, 1) == -1);
+        VISCOM_CHECK(MultiplyFixedPoint(1, -1) == -1);
+        VISCOM_CHECK(MultiplyFixedPoint(-FIXED_POINT_ONE, FIXED_POINT_ONE / 2) == -FIXED_POINT_ONE / 2);
+        VISCOM_CHECK(MultiplyFixedPoint(-FIXED_POINT_ONE, -FIXED_POINT_ONE) == FIXED_POINT_ONE);
+
+        VISCOM_CHECK(ToFixedPoint(0.5) == FIXED_POINT_ONE / 2);
+        // saturating, also for values whose fixed point value does not fit into 64 bits.
+        VISCOM_CHECK(ToFixedPoint(1e12) == INT32_MAX);
+        VISCOM_CHECK(ToFixedPoint(-1e12) == INT32_MIN);
+        VISCOM_CHECK(FromFixedPoint(FIXED_POINT_ONE / 4) == 0.25f);
+    }
+
+    void Simulate(GrayScottFixedGrid& grid, const GrayScottFixedParameters& params)
+    {
+        std::int32_t seedPoints[4];
+        QuantizeSeedPoint(0.3f, 0.4f, WIDTH, HEIGHT, seedPoints);
+        QuantizeSeedPoint(0.7f, 0.6f, WIDTH, HEIGHT, seedPoints + 2);
+        for (unsigned int i = 0; i < ITERATIONS; ++i) grid.Step(params, i == 0 ? seedPoints : nullptr, i == 0 ? 2 : 0);
+    }
+
+    void TestDeterminism()
+    {
+        GrayScottParameters params;
+        params.seedPointRadius_ = 0.15f;
+        const auto fixedParams = ToFixedParameters(params, HEIGHT);
+
+        GrayScottFixedGrid first{ WIDTH, HEIGHT };
+        GrayScottFixedGrid second{ WIDTH, HEIGHT };
+        Simulate(first, fixedParams);
+        Simulate(second, fixedParams);
+        VISCOM_CHECK(first.GetField() == second.GetField());
+        VISCOM_CHECK(std::any_of(first.GetField().begin(), first.GetField().end(), [](std::int32_t value) { return value != 0 && value != FIXED_POINT_ONE; }));
+
+        // the float state of a fixed point grid is exact, a warm start from it continues bit identically.
+        std::vector<float> state(first.GetField().size());
+        first.GetState(state.data());
+        GrayScottFixedGrid restored{ WIDTH, HEIGHT };
+        restored.SetState(state.data());
+        VISCOM_CHECK(restored.GetField() == first.GetField());
+        Simulate(first, fixedParams);
+        Simulate(restored, fixedParams);
+        VISCOM_CHECK(restored.GetField() == first.GetField());
+    }
+}
+
+int main()
+{
+    TestMultiply();
+    TestDeterminism();
+    return VISCOM_TEST_RESULT();
+}
@@ -0,0 +1,64 @@
+/**
+ * @file   InPlaceSimulationTest.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Tests the in-place four colour update of simulation/GrayScottCPU.
+ */
+
+#include "TestCheck.h"
+#include "app/simulation/GrayScottCPU.h"
+
+using namespace viscom::simulation;
+
+namespace {
+
+    /**
+     *  The reference of one in-place step: four separate sweeps, one per colour in the order (0, 0), (1, 0), (0, 1),
+     *  (1, 1). Each sweep computes a regular step from the field updated by the earlier colours and keeps the cells of
+     *  its colour only (the cells of one colour do not read each other).
+     */
+    void StepColourSweeps(std::vector<float>& field, unsigned int width, unsigned int height, const GrayScottParameters& params, const float* seedPoints,
+        std::size_t numSeedPoints)
+    {
+        for (unsigned int colour = 0; colour < 4; ++colour) {
+            GrayScottGrid sweep{ width, height };
+            sweep.GetField() = field;
+            sweep.Step(params, seedPoints, numSeedPoints);
+            for (unsigned int y = colour / 2; y < height; y += 2) {
+                for (unsigned int x = colour % 2; x < width; x += 2) {
+                    const auto cell = 2 * (static_cast<std::size_t>(y) * width + x);
+                    field[cell] = sweep.GetField()[cell];
+                    field[cell + 1] = sweep.GetField()[cell + 1];
+                }
+            }
+        }
+    }
+
+    void TestColourSweeps(unsigned int width, unsigned int height)
+    {
+        GrayScottParameters params;
+        params.seedPointRadius_ = 0.2f;
+        const float seedPoints[] = { 0.3f, 0.4f, 0.7f, 0.6f };
+
+        GrayScottGrid grid{ width, height, true };
+        VISCOM_CHECK(grid.IsInPlace());
+        auto reference = grid.GetField();
+        for (unsigned int i = 0; i < 50; ++i) {
+            const auto numSeedPoints = i % 10 == 0 ? std::size_t{ 2 } : std::size_t{ 0 };
+            grid.Step(params, seedPoints, numSeedPoints);
+            StepColourSweeps(reference, width, height, params, seedPoints, numSeedPoints);
+        }
+        // the fused row pair order of the grid has to compute exactly the same values.
+        VISCOM_CHECK(grid.GetField() == reference);
+    }
+}
+
+int main()
+{
+    // even and odd sizes, the last row or column of an odd size has cells of two colours only.
+    TestColourSweeps(32, 24);
+    TestColourSweeps(17, 13);
+    TestColourSweeps(1, 5);
+    return VISCOM_TEST_RESULT();
+}
@@ -0,0 +1,84 @@
+/**
+ * @file   MetricsTest.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Tests the metric types and the Prometheus text format of metrics/Metrics.
+ */
+
+#include "TestCheck.h"
+#include "app/metrics/Metrics.h"
+
+using namespace viscom::metrics;
+
+namespace {
+
+    bool Contains(const std::string& text, const std::string& line) { return text.find(line + "\n") != std::string::npos; }
+
+    void TestRegistry()
+    {
+        MetricsRegistry registry;
+        auto& counter = registry.AddCounter("rd_iterations_total", "Iterations.");
+        counter.Increment(5.0);
+        // adding the same name and labels again returns the existing metric.
+        registry.AddCounter("rd_iterations_total", "Iterations.").Increment();
+        VISCOM_CHECK(counter.GetValue() == 6.0);
+
+        registry.AddGauge("rd_lag", "Lag.", MetricLabel("node", "a\"b")).Set(2.5);
+        registry.AddHistogram("rd_other", "Other.", { 1.0 });
+        registry.AddGauge("rd_lag", "Lag.", MetricLabel("node", "c")).Set(1.0);
+
+        std::string text;
+        registry.WriteText(text);
+        VISCOM_CHECK(Contains(text, "# TYPE rd_iterations_total counter"));
+        VISCOM_CHECK(Contains(text, "rd_iterations_total 6"));
+        // label values are escaped and the samples of a family are written together.
+        VISCOM_CHECK(Contains(text, "rd_lag{node=\"a\\\"b\"} 2.5\nrd_lag{node=\"c\"} 1"));
+        VISCOM_CHECK(text.find("# HELP rd_lag") == text.rfind("# HELP rd_lag"));
+    }
+
+    void TestHistogram()
+    {
+        MetricsRegistry registry;
+        auto& histogram = registry.AddHistogram("rd_frame", "Frame.", { 1.0, 10.0 });
+        histogram.Observe(0.5);
+        histogram.Observe(5.0);
+        histogram.Observe(50.0);
+
+        // the buckets are cumulative.
+        std::string text;
+        registry.WriteText(text);
+        VISCOM_CHECK(Contains(text, "rd_frame_bucket{le=\"1\"} 1"));
+        VISCOM_CHECK(Contains(text, "rd_frame_bucket{le=\"10\"} 2"));
+        VISCOM_CHECK(Contains(text, "rd_frame_bucket{le=\"+Inf\"} 3"));
+        VISCOM_CHECK(Contains(text, "rd_frame_sum 55.5"));
+        VISCOM_CHECK(Contains(text, "rd_frame_count 3"));
+    }
+
+    void TestSummary()
+    {
+        MetricsRegistry registry;
+        auto& summary = registry.AddSummary("rd_time", "Time.", 4, { 0.5, 0.99 });
+        for (int i = 1; i <= 6; ++i) summary.Observe(static_cast<double>(i));
+
+        // the quantiles cover the newest four observations, sum and count all of them.
+        double quantiles[2] = { 0.0, 0.0 };
+        summary.GetQuantiles(quantiles);
+        VISCOM_CHECK(quantiles[0] == 4.0);
+        VISCOM_CHECK(quantiles[1] == 6.0);
+
+        std::string text;
+        registry.WriteText(text);
+        VISCOM_CHECK(Contains(text, "rd_time{quantile=\"0.5\"} 4"));
+        VISCOM_CHECK(Contains(text, "rd_time_sum 21"));
+        VISCOM_CHECK(Contains(text, "rd_time_count 6"));
+    }
+}
+
+int main()
+{
+    TestRegistry();
+    TestHistogram();
+    TestSummary();
+    return VISCOM_TEST_RESULT();
+}
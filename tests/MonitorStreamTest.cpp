@@ -0,0 +1,68 @@
+/**
+ * @file   MonitorStreamTest.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Tests the delta and run length coding of the frames of export/MonitorStream.
+ */
+
+#include "TestCheck.h"
+#include "app/export/MonitorStream.h"
+#include <random>
+
+using namespace viscom::exporter;
+
+namespace {
+
+    constexpr std::size_t FRAME_SIZE = 64 * 48;
+
+    void TestRoundTrip()
+    {
+        std::mt19937 random{ 7 };
+        std::vector<std::uint8_t> frame(FRAME_SIZE);
+        for (auto& value : frame) value = static_cast<std::uint8_t>(random() % 4 == 0 ? random() : 0);
+
+        std::vector<std::uint8_t> delta, payload, decodeDelta;
+        std::vector<std::uint8_t> received(FRAME_SIZE, 0xAA);
+        EncodeMonitorFrame(frame.data(), nullptr, FRAME_SIZE, delta, payload);
+        // a key frame replaces whatever the client held.
+        VISCOM_CHECK(DecodeMonitorFrame(payload.data(), payload.size(), true, decodeDelta, received.data(), FRAME_SIZE));
+        VISCOM_CHECK(received == frame);
+
+        for (int i = 0; i < 20; ++i) {
+            auto next = frame;
+            // a few changed cells, including changes that wrap around (mod 256).
+            for (int j = 0; j < 30; ++j) next[random() % FRAME_SIZE] = static_cast<std::uint8_t>(random());
+            EncodeMonitorFrame(next.data(), frame.data(), FRAME_SIZE, delta, payload);
+            VISCOM_CHECK(DecodeMonitorFrame(payload.data(), payload.size(), false, decodeDelta, received.data(), FRAME_SIZE));
+            VISCOM_CHECK(received == next);
+            frame = next;
+        }
+
+        // an unchanged frame is a few runs of zeros.
+        EncodeMonitorFrame(frame.data(), frame.data(), FRAME_SIZE, delta, payload);
+        VISCOM_CHECK(payload.size() < FRAME_SIZE / 50);
+        VISCOM_CHECK(DecodeMonitorFrame(payload.data(), payload.size(), false, decodeDelta, received.data(), FRAME_SIZE));
+        VISCOM_CHECK(received == frame);
+    }
+
+    void TestMalformed()
+    {
+        std::vector<std::uint8_t> frame(FRAME_SIZE, 3);
+        std::vector<std::uint8_t> delta, payload, decodeDelta;
+        EncodeMonitorFrame(frame.data(), nullptr, FRAME_SIZE, delta, payload);
+
+        // payloads of another frame size or cut off are rejected.
+        std::vector<std::uint8_t> received(2 * FRAME_SIZE);
+        VISCOM_CHECK(!DecodeMonitorFrame(payload.data(), payload.size(), true, decodeDelta, received.data(), FRAME_SIZE + 1));
+        VISCOM_CHECK(!DecodeMonitorFrame(payload.data(), payload.size() - 1, true, decodeDelta, received.data(), FRAME_SIZE));
+        VISCOM_CHECK(!DecodeMonitorFrame(payload.data(), payload.size(), false, decodeDelta, received.data(), FRAME_SIZE - 1));
+    }
+}
+
+int main()
+{
+    TestRoundTrip();
+    TestMalformed();
+    return VISCOM_TEST_RESULT();
+}
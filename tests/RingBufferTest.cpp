@@ -0,0 +1,91 @@
+/**
+ * @file   RingBufferTest.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Tests the wraparound and growth of util/RingBuffer.
+ */
+
+#include "TestCheck.h"
+#include "app/util/RingBuffer.h"
+#include <algorithm>
+#include <memory>
+
+using namespace viscom::util;
+
+namespace {
+
+    void TestWraparound()
+    {
+        RingBuffer<int> buffer{ 4 };
+        VISCOM_CHECK(buffer.capacity() == 4);
+        VISCOM_CHECK(buffer.empty());
+
+        // the head moves around the storage many times without growing it.
+        int next = 0;
+        int expected = 0;
+        for (int round = 0; round < 100; ++round) {
+            while (buffer.size() < 3) buffer.push_back(next++);
+            VISCOM_CHECK(buffer.front() == expected);
+            VISCOM_CHECK(buffer.back() == next - 1);
+            buffer.pop_front();
+            ++expected;
+        }
+        VISCOM_CHECK(buffer.capacity() == 4);
+
+        // indexing and iteration start at the front, wherever it is in the storage.
+        for (std::size_t i = 0; i < buffer.size(); ++i) VISCOM_CHECK(buffer[i] == expected + static_cast<int>(i));
+        int value = expected;
+        for (auto element : buffer) VISCOM_CHECK(element == value++);
+        VISCOM_CHECK(value == next);
+    }
+
+    void TestGrowth()
+    {
+        RingBuffer<int> buffer{ 3 };
+        VISCOM_CHECK(buffer.capacity() == 4);
+
+        // grow while wrapped around: the elements keep their order.
+        for (int i = 0; i < 3; ++i) buffer.push_back(i);
+        buffer.pop_front();
+        buffer.pop_front();
+        for (int i = 3; i < 10; ++i) buffer.emplace_back(i);
+        VISCOM_CHECK(buffer.capacity() == 8);
+        VISCOM_CHECK(buffer.size() == 8);
+        for (std::size_t i = 0; i < buffer.size(); ++i) VISCOM_CHECK(buffer[i] == static_cast<int>(i) + 2);
+
+        buffer.clear();
+        VISCOM_CHECK(buffer.empty());
+        VISCOM_CHECK(buffer.capacity() == 8);
+    }
+
+    void TestAlgorithms()
+    {
+        // the iterators are random access and work with the standard algorithms.
+        RingBuffer<int> buffer{ 8 };
+        for (int i = 0; i < 6; ++i) buffer.push_back(i);
+        for (int i = 0; i < 4; ++i) buffer.pop_front();
+        for (int i = 6; i < 12; ++i) buffer.push_back(i);
+        VISCOM_CHECK(std::lower_bound(buffer.begin(), buffer.end(), 7) - buffer.begin() == 3);
+        VISCOM_CHECK(std::count_if(buffer.begin(), buffer.end(), [](int value) { return value % 2 == 0; }) == 4);
+    }
+
+    void TestMoveOnly()
+    {
+        RingBuffer<std::unique_ptr<int>> buffer{ 2 };
+        for (int i = 0; i < 5; ++i) buffer.emplace_back(std::make_unique<int>(i));
+        VISCOM_CHECK(*buffer.front() == 0 && *buffer.back() == 4);
+        auto front = std::move(buffer.front());
+        buffer.pop_front();
+        VISCOM_CHECK(*front == 0 && *buffer.front() == 1);
+    }
+}
+
+int main()
+{
+    TestWraparound();
+    TestGrowth();
+    TestAlgorithms();
+    TestMoveOnly();
+    return VISCOM_TEST_RESULT();
+}
@@ -0,0 +1,90 @@
+/**
+ * @file   SessionLogTest.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Tests that recording/SessionLog plays back what was recorded.
+ */
+
+#include "TestCheck.h"
+#include "app/recording/SessionLog.h"
+#include <cstdio>
+#include <fstream>
+
+using namespace viscom::recording;
+
+namespace {
+
+    /** The log is written to the working directory of the test. */
+    const std::string LOG_FILE = "SessionLogTest.rdsession";
+
+    SessionParameters CreateParameters(float feedRate)
+    {
+        SessionParameters parameters;
+        parameters.drawDistance_ = 2.0f;
+        parameters.sigmaA_[1] = 0.5f;
+        parameters.resetIteration_ = 77;
+        parameters.warmStartPreset_ = -1;
+        parameters.feedRate_ = feedRate;
+        parameters.killRate_ = 0.062f;
+        parameters.useManhattanDistance_ = true;
+        parameters.simulationScale_ = 2;
+        parameters.renderer_ = 2;
+        return parameters;
+    }
+
+    void TestRoundTrip()
+    {
+        const auto initialParameters = CreateParameters(0.055f);
+        const auto changedParameters = CreateParameters(0.03f);
+        {
+            SessionRecorder recorder;
+            VISCOM_CHECK(recorder.Open(LOG_FILE, initialParameters));
+            recorder.RecordMouseButton(10, 0, 1);
+            recorder.RecordMousePosition(10, 0.25f, -0.75f);
+            recorder.RecordTuio(RecordType::TUIO_ADD, 12, 3, 0.5f, 0.125f);
+            recorder.RecordSeed(15, 45, 0.3f, 0.7f);
+            // iterations never decrease in a recording, a smaller one is stored as the last one.
+            recorder.RecordParameters(14, changedParameters);
+            recorder.RecordTuio(RecordType::TUIO_REMOVE, 1000000, 3, 0.5f, 0.125f);
+            recorder.Close(1000005);
+            VISCOM_CHECK(recorder.GetNumRecords() == 7);
+        }
+
+        SessionPlayer player;
+        VISCOM_CHECK(player.Open(LOG_FILE));
+        VISCOM_CHECK(player.GetInitialParameters() == initialParameters);
+
+        SessionRecord record;
+        VISCOM_CHECK(player.Next(record) && record.type_ == RecordType::MOUSE_BUTTON && record.iteration_ == 10 && record.id_ == 0 && record.action_ == 1);
+        VISCOM_CHECK(player.Next(record) && record.type_ == RecordType::MOUSE_POSITION && record.x_ == 0.25f && record.y_ == -0.75f);
+        VISCOM_CHECK(player.Next(record) && record.type_ == RecordType::TUIO_ADD && record.iteration_ == 12 && record.id_ == 3 && record.y_ == 0.125f);
+        VISCOM_CHECK(player.Peek() != nullptr && player.Peek()->type_ == RecordType::SEED);
+        VISCOM_CHECK(player.Next(record) && record.type_ == RecordType::SEED && record.iteration_ == 15 && record.seedIteration_ == 45 && record.x_ == 0.3f);
+        VISCOM_CHECK(player.Next(record) && record.type_ == RecordType::PARAMETERS && record.iteration_ == 15 && record.parameters_ == changedParameters);
+        VISCOM_CHECK(player.Next(record) && record.type_ == RecordType::TUIO_REMOVE && record.iteration_ == 1000000);
+        VISCOM_CHECK(player.Next(record) && record.type_ == RecordType::END && record.iteration_ == 1000005);
+        VISCOM_CHECK(record.time_ >= 0.0);
+        VISCOM_CHECK(!player.Next(record));
+        VISCOM_CHECK(player.Peek() == nullptr);
+    }
+
+    void TestMalformed()
+    {
+        {
+            std::ofstream ofs(LOG_FILE, std::ofstream::binary | std::ofstream::trunc);
+            ofs << "not a session log";
+        }
+        SessionPlayer player;
+        VISCOM_CHECK(!player.Open(LOG_FILE));
+        VISCOM_CHECK(!player.Open(LOG_FILE + ".missing"));
+    }
+}
+
+int main()
+{
+    TestRoundTrip();
+    TestMalformed();
+    std::remove(LOG_FILE.c_str());
+    return VISCOM_TEST_RESULT();
+}
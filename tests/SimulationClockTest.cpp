@@ -0,0 +1,95 @@
+/**
+ * @file   SimulationClockTest.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Tests the accumulation and clamping of sync/SimulationClock.
+ */
+
+#include "TestCheck.h"
+#include "app/sync/SimulationClock.h"
+
+using namespace viscom::sync;
+using namespace std::chrono_literals;
+
+namespace {
+
+    void TestAccumulation()
+    {
+        SimulationClock clock{ 300.0, 15, 30 };
+        auto now = SimulationClock::Clock::time_point{} + 1s;
+        // the first advance only starts the clock.
+        VISCOM_CHECK(clock.Advance(now, 0) == 0);
+
+        // 300 iterations/s at 60Hz are exactly 5 iterations per frame, fractions carry over.
+        std::uint64_t iteration = 0;
+        for (int frame = 0; frame < 60; ++frame) {
+            now += 16666667ns;
+            iteration += clock.Advance(now, iteration);
+        }
+        VISCOM_CHECK(iteration >= 299 && iteration <= 300);
+
+        // at 144Hz the frames alternate between 2 and 3 iterations, nothing is lost.
+        for (int frame = 0; frame < 144; ++frame) {
+            now += 6944444ns;
+            iteration += clock.Advance(now, iteration);
+        }
+        VISCOM_CHECK(iteration >= 598 && iteration <= 600);
+    }
+
+    void TestClamping()
+    {
+        SimulationClock clock{ 300.0, 15, 30 };
+        auto now = SimulationClock::Clock::time_point{} + 1s;
+        clock.Advance(now, 0);
+
+        // a hiccup of one second hands out at most 15 iterations per frame and keeps at most 30 in the backlog.
+        now += 1s;
+        VISCOM_CHECK(clock.Advance(now, 0) == 15);
+        VISCOM_CHECK(clock.Advance(now, 15) == 15);
+        VISCOM_CHECK(clock.Advance(now, 30) == 0);
+    }
+
+    void TestPause()
+    {
+        SimulationClock clock{ 100.0, 15, 30 };
+        auto now = SimulationClock::Clock::time_point{} + 1s;
+        clock.Advance(now, 0);
+        now += 100ms;
+        VISCOM_CHECK(clock.Advance(now, 0) == 10);
+
+        // the paused time is not simulated, the first advance after the pause restarts the clock.
+        clock.Pause();
+        now += 10s;
+        VISCOM_CHECK(clock.Advance(now, 10) == 0);
+        now += 50ms;
+        VISCOM_CHECK(clock.Advance(now, 10) == 5);
+
+        // the rate can change at any time (clamped to the slowest node).
+        clock.SetRate(20.0);
+        now += 100ms;
+        VISCOM_CHECK(clock.Advance(now, 15) == 2);
+    }
+
+    void TestIterationAt()
+    {
+        SimulationClock clock{ 100.0, 15, 30 };
+        const auto start = SimulationClock::Clock::time_point{} + 1s;
+        clock.Advance(start, 0);
+        VISCOM_CHECK(clock.Advance(start + 100ms, 40) == 10);
+
+        // input is placed at the iteration of its time within the last frame, earlier input at the first one.
+        VISCOM_CHECK(clock.GetIterationAt(start - 1s) == 41);
+        VISCOM_CHECK(clock.GetIterationAt(start + 55ms) == 46);
+        VISCOM_CHECK(clock.GetIterationAt(start + 1s) == 50);
+    }
+}
+
+int main()
+{
+    TestAccumulation();
+    TestClamping();
+    TestPause();
+    TestIterationAt();
+    return VISCOM_TEST_RESULT();
+}
@@ -0,0 +1,133 @@
+/**
+ * @file   StateSnapshotTest.cpp
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Tests encoding and decoding of simulation/StateSnapshot, in particular that malformed snapshots are rejected.
+ */
+
+#include "TestCheck.h"
+#include "app/simulation/StateSnapshot.h"
+#include <cstring>
+
+using namespace viscom::simulation;
+
+namespace {
+
+    /** Offsets of the header fields in an encoded snapshot (magic, version, width, height, iteration, payload size). */
+    constexpr std::size_t MAGIC_OFFSET = 0;
+    constexpr std::size_t WIDTH_OFFSET = 8;
+    constexpr std::size_t HEIGHT_OFFSET = 12;
+    constexpr std::size_t PAYLOAD_SIZE_OFFSET = 24;
+    constexpr std::size_t HEADER_SIZE = 32;
+
+    StateSnapshot CreateSnapshot(unsigned int width, unsigned int height)
+    {
+        StateSnapshot snapshot;
+        snapshot.width_ = width;
+        snapshot.height_ = height;
+        snapshot.iteration_ = 1234;
+        snapshot.field_.resize(2 * static_cast<std::size_t>(width) * height);
+        for (std::size_t i = 0; i < snapshot.field_.size(); i += 2) {
+            snapshot.field_[i] = 1.0f;
+            snapshot.field_[i + 1] = i % 7 == 0 ? 0.25f * static_cast<float>(i % 4) : 0.0f;
+        }
+        return snapshot;
+    }
+
+    template<typename T> void Patch(std::vector<std::uint8_t>& data, std::size_t offset, T value)
+    {
+        std::memcpy(data.data() + offset, &value, sizeof(value));
+    }
+
+    void TestRoundTrip()
+    {
+        const auto snapshot = CreateSnapshot(33, 17);
+        std::vector<std::uint8_t> data;
+        VISCOM_CHECK(EncodeStateSnapshot(snapshot, data));
+
+        StateSnapshot decoded;
+        VISCOM_CHECK(DecodeStateSnapshot(data.data(), data.size(), decoded, 33, 17));
+        StateDifference difference;
+        VISCOM_CHECK(CompareStateSnapshots(snapshot, decoded, difference));
+        VISCOM_CHECK(difference.differingCells_ == 0);
+        VISCOM_CHECK(decoded.iteration_ == snapshot.iteration_);
+
+        // a field that does not match the size is not encoded.
+        auto broken = snapshot;
+        broken.field_.pop_back();
+        VISCOM_CHECK(!EncodeStateSnapshot(broken, data));
+    }
+
+    void TestMalformed()
+    {
+        std::vector<std::uint8_t> data;
+        VISCOM_CHECK(EncodeStateSnapshot(CreateSnapshot(16, 8), data));
+        StateSnapshot decoded;
+
+        // truncated in the header and in the payload.
+        VISCOM_CHECK(!DecodeStateSnapshot(data.data(), HEADER_SIZE - 1, decoded));
+        VISCOM_CHECK(!DecodeStateSnapshot(data.data(), data.size() - 1, decoded));
+
+        auto badMagic = data;
+        badMagic[MAGIC_OFFSET] ^= 0xFF;
+        VISCOM_CHECK(!DecodeStateSnapshot(badMagic.data(), badMagic.size(), decoded));
+
+        // a snapshot of another size than the domain is rejected, any size is accepted without expectation.
+        VISCOM_CHECK(!DecodeStateSnapshot(data.data(), data.size(), decoded, 16, 9));
+        VISCOM_CHECK(!DecodeStateSnapshot(data.data(), data.size(), decoded, 15, 8));
+        VISCOM_CHECK(DecodeStateSnapshot(data.data(), data.size(), decoded));
+
+        // a header size the payload cannot hold is rejected before the field is allocated.
+        auto huge = data;
+        Patch<std::uint32_t>(huge, WIDTH_OFFSET, 65536);
+        Patch<std::uint32_t>(huge, HEIGHT_OFFSET, 65536);
+        VISCOM_CHECK(!DecodeStateSnapshot(huge.data(), huge.size(), decoded));
+
+        // a repeat run of 130 bytes is longer than the field of a 1x1 snapshot (8 bytes).
+        std::vector<std::uint8_t> longRun(data.begin(), data.begin() + HEADER_SIZE);
+        Patch<std::uint32_t>(longRun, WIDTH_OFFSET, 1);
+        Patch<std::uint32_t>(longRun, HEIGHT_OFFSET, 1);
+        Patch<std::uint64_t>(longRun, PAYLOAD_SIZE_OFFSET, 2);
+        longRun.push_back(255);
+        longRun.push_back(0);
+        VISCOM_CHECK(!DecodeStateSnapshot(longRun.data(), longRun.size(), decoded));
+        // the same run with the right length (control 133 repeats 8 times) decodes.
+        longRun[HEADER_SIZE] = 133;
+        VISCOM_CHECK(DecodeStateSnapshot(longRun.data(), longRun.size(), decoded, 1, 1));
+    }
+
+    void TestDownsample()
+    {
+        // cell (x, y) holds A = x and B = y, the 2x2 averages are the centres of the blocks.
+        StateSnapshot snapshot;
+        snapshot.width_ = 6;
+        snapshot.height_ = 4;
+        for (unsigned int y = 0; y < snapshot.height_; ++y) {
+            for (unsigned int x = 0; x < snapshot.width_; ++x) {
+                snapshot.field_.push_back(static_cast<float>(x));
+                snapshot.field_.push_back(static_cast<float>(y));
+            }
+        }
+        auto odd = CreateSnapshot(5, 4);
+        VISCOM_CHECK(!DownsampleStateSnapshot(odd, 2));
+
+        VISCOM_CHECK(DownsampleStateSnapshot(snapshot, 2));
+        VISCOM_CHECK(snapshot.width_ == 3 && snapshot.height_ == 2 && snapshot.field_.size() == 12);
+        for (unsigned int y = 0; y < snapshot.height_; ++y) {
+            for (unsigned int x = 0; x < snapshot.width_; ++x) {
+                const auto cell = 2 * (y * snapshot.width_ + x);
+                VISCOM_CHECK(snapshot.field_[cell] == 2.0f * x + 0.5f);
+                VISCOM_CHECK(snapshot.field_[cell + 1] == 2.0f * y + 0.5f);
+            }
+        }
+    }
+}
+
+int main()
+{
+    TestRoundTrip();
+    TestMalformed();
+    TestDownsample();
+    return VISCOM_TEST_RESULT();
+}
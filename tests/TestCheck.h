@@ -0,0 +1,34 @@
+/**
+ * @file   TestCheck.h
+ * @author Sebastian Maisch <sebastian.maisch@uni-ulm.de>
+ * @date   2026.10.18
+ *
+ * @brief  Minimal check macros of the unit tests.
+ *
+ *  Every test is an executable run by CTest, a failed check prints the expression and its location and the test
+ *  returns a non zero exit code from VISCOM_TEST_RESULT.
+ */
+
+#pragma once
+
+#include <iostream>
+
+namespace viscom::test {
+
+    inline int& GetFailureCount()
+    {
+        static int failures = 0;
+        return failures;
+    }
+
+    inline void ReportFailure(const char* expression, const char* file, int line)
+    {
+        std::cerr << file << ":" << line << ": check failed: " << expression << std::endl;
+        ++GetFailureCount();
+    }
+}
+
+#define VISCOM_CHECK(expression) \
+    do { if (!(expression)) viscom::test::ReportFailure(#expression, __FILE__, __LINE__); } while (false)
+
+#define VISCOM_TEST_RESULT() (viscom::test::GetFailureCount() == 0 ? 0 : 1)